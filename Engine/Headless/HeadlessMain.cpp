@@ -0,0 +1,21 @@
+#include "pch.h"
+#include "Core/Public/HeadlessApp.h"
+
+/**
+ * @brief FutureEngineHeadless 진입점
+ * 윈도우/렌더러 없이 Headless 경로만 실행하므로 인자 앞에 -headless를 붙여 FHeadlessApp에 전달
+ * 사용법: FutureEngineHeadless -scene=<Scene Path> [-frames=N] [-dt=Seconds] [-bench=<Name|all>] [-alloccsv=<CSV Path>]
+ */
+int main(int argc, char** argv)
+{
+    FString CommandLine = "-headless";
+    for (int Index = 1; Index < argc; ++Index)
+    {
+        CommandLine += " \"";
+        CommandLine += argv[Index];
+        CommandLine += "\"";
+    }
+
+    FHeadlessApp HeadlessApp;
+    return HeadlessApp.Run(CommandLine);
+}
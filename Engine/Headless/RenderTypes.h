@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @brief Headless 빌드용 렌더 핸들 타입 선언
+ * CPU 측 컴포넌트/에셋 헤더가 GPU 리소스를 포인터로만 보관하므로
+ * D3D11 헤더 없이 불완전 타입과 값 타입 몇 개만 선언합니다.
+ * Headless 실행에서는 URenderer가 없으므로 이 핸들들은 항상 nullptr입니다.
+ */
+#include <cstddef>
+
+struct ID3D11Device;
+struct ID3D11DeviceContext;
+struct ID3D11Buffer;
+struct ID3D11VertexShader;
+struct ID3D11PixelShader;
+struct ID3D11InputLayout;
+struct ID3D11ShaderResourceView;
+struct ID3D11SamplerState;
+struct ID3D11UnorderedAccessView;
+struct ID3D11ComputeShader;
+struct ID3D11Texture2D;
+
+enum D3D11_PRIMITIVE_TOPOLOGY
+{
+	D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_POINTLIST = 1,
+	D3D11_PRIMITIVE_TOPOLOGY_LINELIST = 2,
+	D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP = 3,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5,
+};
+
+struct D3D11_VIEWPORT
+{
+	float TopLeftX;
+	float TopLeftY;
+	float Width;
+	float Height;
+	float MinDepth;
+	float MaxDepth;
+};
+
+/**
+ * @brief Microsoft::WRL::ComPtr 대체
+ * Headless 빌드는 COM 객체를 생성하지 않으므로 참조 카운트 없이 포인터만 보관합니다.
+ */
+template <typename T>
+class ComPtr
+{
+public:
+	ComPtr() = default;
+	ComPtr(std::nullptr_t) {}
+	ComPtr(T* InPointer) : Pointer(InPointer) {}
+
+	T* Get() const { return Pointer; }
+	T* operator->() const { return Pointer; }
+	T** GetAddressOf() { return &Pointer; }
+	T** ReleaseAndGetAddressOf() { Pointer = nullptr; return &Pointer; }
+	void Reset() { Pointer = nullptr; }
+	explicit operator bool() const { return Pointer != nullptr; }
+
+	ComPtr& operator=(std::nullptr_t) { Pointer = nullptr; return *this; }
+
+private:
+	T* Pointer = nullptr;
+};
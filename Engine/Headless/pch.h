@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @brief Headless 빌드 전용 Precompiled Header
+ * Engine/pch.h에서 Win32, D3D11, D2D, ImGui 의존성을 제외한 버전입니다.
+ * FutureEngineHeadless 타겟은 이 디렉토리를 Include 경로 맨 앞에 두므로
+ * Source/ 아래 파일의 #include "pch.h"가 이 파일로 연결됩니다.
+ * Editor/Public/EditorEngine.h 대신 GWorld를 선언하는 World.h를 포함합니다.
+ */
+#ifndef IS_HEADLESS
+#error "Headless/pch.h는 IS_HEADLESS 빌드에서만 사용합니다"
+#endif
+
+// Standard Library
+#include <cmath>
+#include <cassert>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+#include <iterator>
+#include <sstream>
+#include <xmmintrin.h>
+
+// Render Handle Types
+#include "RenderTypes.h"
+
+// Global Included
+#include "Global/Types.h"
+#include "Global/Platform.h"
+#include "Global/Memory.h"
+#include "Global/Constant.h"
+#include "Global/Enum.h"
+#include "Global/Matrix.h"
+#include "Global/Vector.h"
+#include "Global/Quaternion.h"
+#include "Global/Transform.h"
+#include "Global/CoreTypes.h"
+#include "Global/Macro.h"
+#include "Global/Function.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+#include "Level/Public/World.h"
+
+using std::clamp;
+using std::unordered_map;
+using std::to_string;
+using std::function;
+using std::wstring;
+using std::cout;
+using std::cerr;
+using std::min;
+using std::max;
+using std::exception;
+using std::stoul;
+using std::ofstream;
+using std::ifstream;
+using std::setw;
+using std::sort;
+using std::shared_ptr;
+using std::unique_ptr;
+using std::streamsize;
+
+// File System
+namespace filesystem = std::filesystem;
+using filesystem::path;
+using filesystem::exists;
+using filesystem::create_directories;
+
+// DT Include
+#include "Manager/Time/Public/TimeManager.h"
@@ -7,11 +7,15 @@
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Public/SceneComponent.h"
 #include "Component/Public/UUIDTextComponent.h"
-#include "Editor/Public/Editor.h"
 #include "Level/Public/Level.h"
+#include "Level/Public/TickTaskManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Utility/Public/JsonSerializer.h"
 
+#ifndef IS_HEADLESS
+#include "Editor/Public/Editor.h"
+#endif
+
 IMPLEMENT_CLASS(AActor, UObject)
 
 AActor::AActor()
@@ -310,6 +314,7 @@ void AActor::RegisterComponent(UActorComponent* InNewComponent)
 	}
 
 	GWorld->GetLevel()->RegisterComponent(InNewComponent);
+	FTickTaskManager::MarkRegistrationDirty();
 }
 
 bool AActor::RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldDetachChildren)
@@ -349,7 +354,7 @@ bool AActor::RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldD
     	USceneComponent* Parent = SceneComponent->GetAttachParent();
         SceneComponent->DetachFromComponent();
 
-        TArray<USceneComponent*> ChildrenToProcess = SceneComponent->GetChildren();
+        const TArray<USceneComponent*> ChildrenToProcess(SceneComponent->GetChildren().begin(), SceneComponent->GetChildren().end());
         if (bShouldDetachChildren)
         {
             for (USceneComponent* Child : ChildrenToProcess)
@@ -368,12 +373,15 @@ bool AActor::RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldD
         }
     }
 
-	if (GEditor->GetEditorModule()->GetSelectedComponent() == InComponentToDelete)
+#ifndef IS_HEADLESS
+	if (GEditor && GEditor->GetEditorModule()->GetSelectedComponent() == InComponentToDelete)
 	{
 		GEditor->GetEditorModule()->SelectComponent(nullptr);
 	}
+#endif
 	OwnedComponents.erase(It); 
     SafeDelete(InComponentToDelete); 
+	FTickTaskManager::MarkRegistrationDirty();
     return true;
 }
 
@@ -392,6 +400,8 @@ UObject* AActor::Duplicate()
 {
 	AActor* Actor = Cast<AActor>(Super::Duplicate());
 	Actor->bCanEverTick = bCanEverTick;
+	Actor->TickGroup = TickGroup;
+	Actor->bRunOnAnyThread = bRunOnAnyThread;
 	return Actor;
 }
 
@@ -453,6 +463,8 @@ UObject* AActor::DuplicateForEditor()
 {
 	AActor* Actor = Cast<AActor>(NewObject(GetClass()));
 	Actor->bCanEverTick = bCanEverTick;
+	Actor->TickGroup = TickGroup;
+	Actor->bRunOnAnyThread = bRunOnAnyThread;
 	DuplicateSubObjectsForEditor(Actor);
 	return Actor;
 }
@@ -506,14 +518,84 @@ void AActor::DuplicateSubObjectsForEditor(UObject* DuplicatedObject)
 	}
 }
 
+/**
+ * @brief Actor 자체의 Tick
+ * 컴포넌트 Tick은 FTickTaskManager가 이 Tick 이후에 별도로 실행한다
+ */
 void AActor::Tick(float DeltaTimes)
 {
-	for (auto& Component : OwnedComponents)
+}
+
+void AActor::SetCanTick(bool InbCanEverTick)
+{
+	if (bCanEverTick != InbCanEverTick)
 	{
-		if (Component && Component->CanEverTick())
-		{
-			Component->TickComponent(DeltaTimes);
-		}
+		bCanEverTick = InbCanEverTick;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void AActor::SetTickInEditor(bool InbTickInEditor)
+{
+	if (bTickInEditor != InbTickInEditor)
+	{
+		bTickInEditor = InbTickInEditor;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void AActor::SetTickGroup(ETickingGroup InTickGroup)
+{
+	if (TickGroup != InTickGroup)
+	{
+		TickGroup = InTickGroup;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void AActor::SetRunOnAnyThread(bool bInRunOnAnyThread)
+{
+	if (bRunOnAnyThread != bInRunOnAnyThread)
+	{
+		bRunOnAnyThread = bInRunOnAnyThread;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void AActor::AddTickPrerequisiteActor(AActor* InPrerequisiteActor)
+{
+	if (!InPrerequisiteActor || InPrerequisiteActor == this)
+	{
+		return;
+	}
+
+	if (std::find(TickPrerequisites.begin(), TickPrerequisites.end(), InPrerequisiteActor) == TickPrerequisites.end())
+	{
+		TickPrerequisites.push_back(InPrerequisiteActor);
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void AActor::AddTickPrerequisiteComponent(UActorComponent* InPrerequisiteComponent)
+{
+	if (!InPrerequisiteComponent)
+	{
+		return;
+	}
+
+	if (std::find(TickPrerequisites.begin(), TickPrerequisites.end(), InPrerequisiteComponent) == TickPrerequisites.end())
+	{
+		TickPrerequisites.push_back(InPrerequisiteComponent);
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void AActor::RemoveTickPrerequisite(UObject* InPrerequisite)
+{
+	if (auto It = std::find(TickPrerequisites.begin(), TickPrerequisites.end(), InPrerequisite); It != TickPrerequisites.end())
+	{
+		TickPrerequisites.erase(It);
+		FTickTaskManager::MarkRegistrationDirty();
 	}
 }
 
@@ -5,6 +5,7 @@ IMPLEMENT_CLASS(AMovingCubeActor, ACubeActor)
 AMovingCubeActor::AMovingCubeActor()
 {
     bCanEverTick = true;
+    bRunOnAnyThread = true;
 }
 
 void AMovingCubeActor::Tick(float DeltaTime)
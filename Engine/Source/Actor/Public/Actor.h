@@ -38,7 +38,7 @@ public:
 
 	// Getter & Setter
 	USceneComponent* GetRootComponent() const { return RootComponent; }
-	TArray<UActorComponent*>& GetOwnedComponents()  { return OwnedComponents; }
+	TInlineArray<UActorComponent*, 4>& GetOwnedComponents()  { return OwnedComponents; }
 
 	void SetRootComponent(USceneComponent* InOwnedComponents) { RootComponent = InOwnedComponents; }
 
@@ -105,10 +105,25 @@ public:
 	bool RemoveComponent(UActorComponent* InComponentToDelete, bool bShouldDetachChildren = false);
 
 	bool CanTick() const { return bCanEverTick; }
-	void SetCanTick(bool InbCanEverTick) { bCanEverTick = InbCanEverTick; }
+	void SetCanTick(bool InbCanEverTick);
 
 	bool CanTickInEditor() const { return bTickInEditor; }
-	void SetTickInEditor(bool InbTickInEditor) { bTickInEditor = InbTickInEditor; }
+	void SetTickInEditor(bool InbTickInEditor);
+
+	ETickingGroup GetTickGroup() const { return TickGroup; }
+	void SetTickGroup(ETickingGroup InTickGroup);
+
+	bool CanTickOnAnyThread() const { return bRunOnAnyThread; }
+	void SetRunOnAnyThread(bool bInRunOnAnyThread);
+
+	/**
+	 * @brief 이 Actor의 Tick보다 먼저 끝나야 하는 Actor/Component 지정
+	 * 대상이 더 늦은 Tick 그룹에 있으면 이 Actor의 Tick도 그 그룹으로 미뤄진다
+	 */
+	void AddTickPrerequisiteActor(AActor* InPrerequisiteActor);
+	void AddTickPrerequisiteComponent(UActorComponent* InPrerequisiteComponent);
+	void RemoveTickPrerequisite(UObject* InPrerequisite);
+	const TArray<UObject*>& GetTickPrerequisites() const { return TickPrerequisites; }
 
 	bool IsPendingDestroy() const { return bIsPendingDestroy; }
 	void SetIsPendingDestroy(bool bInIsPendingDestroy) { bIsPendingDestroy = bInIsPendingDestroy; }
@@ -131,11 +146,20 @@ protected:
 	bool bHidden = false;
 	bool bActorEnableCollision = false;
 
+	ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+	/**
+	 * @brief 워커 스레드에서 Tick해도 되는지 여부
+	 * 자신과 자신의 컴포넌트 상태만 변경하는 Tick에서만 켠다 (Spawn/Destroy, 다른 Actor 접근, 로그 출력 금지)
+	 */
+	bool bRunOnAnyThread = false;
+
 private:
 	void UpdateComponentVisibility(bool bInHidden);
 	
 	USceneComponent* RootComponent = nullptr;
-	TArray<UActorComponent*> OwnedComponents;
+	// 대부분의 액터는 컴포넌트가 4개 이하이므로 별도 힙 블록 없이 액터 안에 저장
+	TInlineArray<UActorComponent*, 4> OwnedComponents;
+	TArray<UObject*> TickPrerequisites;
 	
 public:
 	virtual UObject* Duplicate() override;
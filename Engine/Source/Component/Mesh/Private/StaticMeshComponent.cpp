@@ -5,12 +5,15 @@
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
-#include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 #include "Texture/Public/Texture.h"
 
 #include <json.hpp>
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/StaticMeshComponentWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UStaticMeshComponent, UMeshComponent)
 
 UStaticMeshComponent::UStaticMeshComponent()
@@ -91,7 +94,11 @@ void UStaticMeshComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 UClass* UStaticMeshComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+	return nullptr;
+#else
 	return UStaticMeshComponentWidget::StaticClass();
+#endif
 }
 
 void UStaticMeshComponent::SetStaticMesh(const FName& InObjPath)
@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "Component/Public/ActorComponent.h"
+#include "Actor/Public/Actor.h"
 
+#include "Level/Public/TickTaskManager.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UActorComponent, UObject)
@@ -50,6 +52,70 @@ void UActorComponent::EndPlay()
 
 }
 
+void UActorComponent::SetCanEverTick(bool InbCanEverTick)
+{
+	if (bCanEverTick != InbCanEverTick)
+	{
+		bCanEverTick = InbCanEverTick;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void UActorComponent::SetTickGroup(ETickingGroup InTickGroup)
+{
+	if (TickGroup != InTickGroup)
+	{
+		TickGroup = InTickGroup;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void UActorComponent::SetRunOnAnyThread(bool bInRunOnAnyThread)
+{
+	if (bRunOnAnyThread != bInRunOnAnyThread)
+	{
+		bRunOnAnyThread = bInRunOnAnyThread;
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void UActorComponent::AddTickPrerequisiteActor(AActor* InPrerequisiteActor)
+{
+	if (!InPrerequisiteActor)
+	{
+		return;
+	}
+
+	if (std::find(TickPrerequisites.begin(), TickPrerequisites.end(), InPrerequisiteActor) == TickPrerequisites.end())
+	{
+		TickPrerequisites.push_back(InPrerequisiteActor);
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void UActorComponent::AddTickPrerequisiteComponent(UActorComponent* InPrerequisiteComponent)
+{
+	if (!InPrerequisiteComponent || InPrerequisiteComponent == this)
+	{
+		return;
+	}
+
+	if (std::find(TickPrerequisites.begin(), TickPrerequisites.end(), InPrerequisiteComponent) == TickPrerequisites.end())
+	{
+		TickPrerequisites.push_back(InPrerequisiteComponent);
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
+void UActorComponent::RemoveTickPrerequisite(UObject* InPrerequisite)
+{
+	if (auto It = std::find(TickPrerequisites.begin(), TickPrerequisites.end(), InPrerequisite); It != TickPrerequisites.end())
+	{
+		TickPrerequisites.erase(It);
+		FTickTaskManager::MarkRegistrationDirty();
+	}
+}
+
 
 void UActorComponent::OnSelected()
 {
@@ -66,6 +132,8 @@ UObject* UActorComponent::Duplicate()
 {
 	UActorComponent* ActorComponent = Cast<UActorComponent>(Super::Duplicate());
 	ActorComponent->bCanEverTick = bCanEverTick;
+	ActorComponent->TickGroup = TickGroup;
+	ActorComponent->bRunOnAnyThread = bRunOnAnyThread;
 	ActorComponent->bIsEditorOnly = bIsEditorOnly;
 	ActorComponent->bIsVisualizationComponent = bIsVisualizationComponent;
 
@@ -1,7 +1,12 @@
 #include "pch.h"
 #include "Component/Public/AmbientLightComponent.h"
+#include "Component/Public/EditorIconComponent.h"
+#include "Actor/Public/Actor.h"
 
+#ifndef IS_HEADLESS
 #include "Render/UI/Widget/Public/AmbientLightComponentWidget.h"
+#endif
+
 
 IMPLEMENT_CLASS(UAmbientLightComponent, ULightComponent)
 
@@ -19,7 +24,11 @@ UObject* UAmbientLightComponent::Duplicate()
 
 UClass* UAmbientLightComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+	return nullptr;
+#else
 	return UAmbientLightComponentWidget::StaticClass();
+#endif
 }
 
 void UAmbientLightComponent::EnsureVisualizationIcon()
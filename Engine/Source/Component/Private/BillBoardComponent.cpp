@@ -1,15 +1,16 @@
 #include "pch.h"
 #include "Component/Public/BillBoardComponent.h"
 #include "Manager/Asset/Public/AssetManager.h"
-#include "Render/Renderer/Public/Renderer.h"
 #include "Physics/Public/AABB.h"
-#include "Render/Renderer/Public/RenderResourceFactory.h"
-#include "Render/UI/Widget/Public/SpriteSelectionWidget.h"
 #include "Texture/Public/Texture.h"
 #include "Utility/Public/JsonSerializer.h"
 
 #include <algorithm>
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/SpriteSelectionWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UBillBoardComponent, UPrimitiveComponent)
 
 UBillBoardComponent::UBillBoardComponent()
@@ -111,7 +112,11 @@ void UBillBoardComponent::SetSpriteTint(const FVector& InTint, float Alpha)
 
 UClass* UBillBoardComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return USpriteSelectionWidget::StaticClass();
+#endif
 }
 
 const FRenderState& UBillBoardComponent::GetClassDefaultRenderState()
@@ -3,13 +3,17 @@
 #include <algorithm>
 
 #include "Component/Public/DecalComponent.h"
+#include "Actor/Public/Actor.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
-#include "Render/UI/Widget/Public/DecalTextureSelectionWidget.h"
 #include "Texture/Public/Texture.h"
 #include "Utility/Public/JsonSerializer.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/DecalTextureSelectionWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UDecalComponent, UPrimitiveComponent)
 
 UDecalComponent::UDecalComponent()
@@ -23,6 +27,9 @@ UDecalComponent::UDecalComponent()
 	
     SetPerspective(false);
 	bReceivesDecals = false;
+
+	// 페이드 처리에서 로그 출력 및 Owner 삭제 요청을 하므로 Game Thread에서 Tick
+	bRunOnAnyThread = false;
 }
 
 UDecalComponent::~UDecalComponent()
@@ -124,7 +131,11 @@ void UDecalComponent::SetFadeTexture(UTexture* InFadeTexture)
 
 UClass* UDecalComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return UDecalTextureSelectionWidget::StaticClass();
+#endif
 }
 
 UObject* UDecalComponent::Duplicate()
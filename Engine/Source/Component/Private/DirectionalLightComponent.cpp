@@ -1,16 +1,18 @@
 #include "pch.h"
 #include "Component/Public/DirectionalLightComponent.h"
 
-#include "Render/UI/Widget/Public/DirectionalLightComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
-#include "Render/Renderer/Public/Renderer.h"
-#include "Editor/Public/Camera.h"
 #include "Editor/Public/EditorPrimitive.h"
 #include "Component/Public/ActorComponent.h"
-#include "Editor/Public/EditorEngine.h"
 #include "Actor/Public/Actor.h"
 #include "Level/Public/World.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/DirectionalLightComponentWidget.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Editor/Public/Camera.h"
+#endif
+
 IMPLEMENT_CLASS(UDirectionalLightComponent, ULightComponent)
 
 UDirectionalLightComponent::UDirectionalLightComponent()
@@ -115,7 +117,11 @@ UObject* UDirectionalLightComponent::Duplicate()
 
 UClass* UDirectionalLightComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return UDirectionalLightComponentWidget::StaticClass();
+#endif
 }
 
 FVector UDirectionalLightComponent::GetForwardVector() const
@@ -124,6 +130,7 @@ FVector UDirectionalLightComponent::GetForwardVector() const
     return LightRotation.RotateVector(FVector::ForwardVector());
 }
 
+#ifndef IS_HEADLESS
 void UDirectionalLightComponent::RenderLightDirectionGizmo(UCamera* InCamera, const D3D11_VIEWPORT& InViewport)
 {
     if (!InCamera)
@@ -175,6 +182,7 @@ void UDirectionalLightComponent::RenderLightDirectionGizmo(UCamera* InCamera, co
 
     URenderer::GetInstance().RenderEditorPrimitive(LightDirectionArrow, RenderState);
 }
+#endif
 
 FDirectionalLightInfo UDirectionalLightComponent::GetDirectionalLightInfo() const
 {
@@ -1,8 +1,11 @@
 #include "pch.h"
 #include "Component/Public/HeightFogComponent.h"
-#include "Render/UI/Widget/Public/HeightFogComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/HeightFogComponentWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UHeightFogComponent, USceneComponent)
 
 UHeightFogComponent::UHeightFogComponent()
@@ -47,7 +50,11 @@ void UHeightFogComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 
 UClass* UHeightFogComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+	return nullptr;
+#else
 	return UHeightFogComponentWidget::StaticClass();
+#endif
 }
 
 UObject* UHeightFogComponent::Duplicate()
@@ -1,13 +1,15 @@
 ﻿#include "pch.h"
 #include "Component/Public/MovementComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
+#include "Actor/Public/Actor.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UMovementComponent, UActorComponent)
 
 UMovementComponent::UMovementComponent()
 {
-    
+    // UpdatedComponent(Owner의 컴포넌트)만 움직이므로 워커 스레드에서 Tick 가능
+    bRunOnAnyThread = true;
 }
 
 UMovementComponent::~UMovementComponent()
@@ -31,13 +33,13 @@ void UMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponen
     {
         UpdatedComponent = NewUpdatedComponent;
         UpdatedPrimitive = Cast<UPrimitiveComponent>(UpdatedComponent);
-        bCanEverTick = true;
+        SetCanEverTick(true);
     }
     else
     {
         UpdatedComponent = nullptr;
         UpdatedPrimitive = nullptr;
-        bCanEverTick = false;
+        SetCanEverTick(false);
     }
 }
 
@@ -1,9 +1,14 @@
 ﻿#include "pch.h"
 #include "Component/Public/PointLightComponent.h"
+#include "Component/Public/EditorIconComponent.h"
+#include "Actor/Public/Actor.h"
 
-#include "Render/UI/Widget/Public/PointLightComponentWidget.h"
 #include "Utility/Public/JsonSerializer.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/PointLightComponentWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UPointLightComponent, ULightComponent)
 
 void UPointLightComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -33,7 +38,11 @@ UObject* UPointLightComponent::Duplicate()
 
 UClass* UPointLightComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return UPointLightComponentWidget::StaticClass();
+#endif
 }
 
 void UPointLightComponent::EnsureVisualizationIcon()
@@ -4,6 +4,7 @@
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/AABB.h"
 #include "Physics/Public/OBB.h"
+#include "Level/Public/WorldAABBCache.h"
 #include "Utility/Public/JsonSerializer.h"
 
 IMPLEMENT_ABSTRACT_CLASS(UPrimitiveComponent, USceneComponent)
@@ -11,6 +12,16 @@ IMPLEMENT_ABSTRACT_CLASS(UPrimitiveComponent, USceneComponent)
 UPrimitiveComponent::UPrimitiveComponent()
 {
 	bCanEverTick = true;
+	// 기본 TickComponent는 아무것도 하지 않으므로 워커 스레드에서 실행 가능
+	bRunOnAnyThread = true;
+}
+
+UPrimitiveComponent::~UPrimitiveComponent()
+{
+	if (WorldAABBCache)
+	{
+		WorldAABBCache->Remove(this);
+	}
 }
 
 void UPrimitiveComponent::BeginPlay()
@@ -87,66 +98,80 @@ const IBoundingVolume* UPrimitiveComponent::GetBoundingVolume()
 	return BoundingVolume;
 }
 
-void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
+EBoundingVolumeType UPrimitiveComponent::GetLocalBounds(FVector& OutCenter, FVector& OutExtent) const
 {
 	if (!BoundingVolume)
 	{
-		OutMin = FVector(); OutMax = FVector();
-		return;
+		OutCenter = FVector(); OutExtent = FVector();
+		return EBoundingVolumeType::None;
 	}
 
-	if (bIsAABBCacheDirty)
+	const EBoundingVolumeType Type = BoundingVolume->GetType();
+	if (Type == EBoundingVolumeType::AABB)
 	{
-		if (BoundingVolume->GetType() == EBoundingVolumeType::AABB)
-		{
-			const FAABB* LocalAABB = static_cast<const FAABB*>(BoundingVolume);
-			FVector LocalCorners[8] =
-			{
-				FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Min.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Min.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Min.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Min.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Min.Y, LocalAABB->Max.Z),
-				FVector(LocalAABB->Min.X, LocalAABB->Max.Y, LocalAABB->Max.Z), FVector(LocalAABB->Max.X, LocalAABB->Max.Y, LocalAABB->Max.Z)
-			};
-
-			const FMatrix& WorldTransform = GetWorldTransformMatrix();
-			FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-			FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-			for (int32 Idx = 0; Idx < 8; Idx++)
-			{
-				FVector4 WorldCorner = FVector4(LocalCorners[Idx].X, LocalCorners[Idx].Y, LocalCorners[Idx].Z, 1.0f) * WorldTransform;
-				WorldMin.X = min(WorldMin.X, WorldCorner.X);
-				WorldMin.Y = min(WorldMin.Y, WorldCorner.Y);
-				WorldMin.Z = min(WorldMin.Z, WorldCorner.Z);
-				WorldMax.X = max(WorldMax.X, WorldCorner.X);
-				WorldMax.Y = max(WorldMax.Y, WorldCorner.Y);
-				WorldMax.Z = max(WorldMax.Z, WorldCorner.Z);
-			}
-
-			CachedWorldMin = WorldMin;
-			CachedWorldMax = WorldMax;
-		}
-		else if (BoundingVolume->GetType() == EBoundingVolumeType::OBB ||
-			BoundingVolume->GetType() == EBoundingVolumeType::SpotLight)
-		{
-			const FOBB* OBB = static_cast<const FOBB*>(GetBoundingVolume());
-			FAABB AABB = OBB->ToWorldAABB();
+		const FAABB* LocalAABB = static_cast<const FAABB*>(BoundingVolume);
+		OutCenter = (LocalAABB->Min + LocalAABB->Max) * 0.5f;
+		OutExtent = (LocalAABB->Max - LocalAABB->Min) * 0.5f;
+		return Type;
+	}
+
+	if (Type == EBoundingVolumeType::OBB || Type == EBoundingVolumeType::SpotLight)
+	{
+		// FOBB::Update는 월드 행렬을 그대로 담으므로 로컬 박스는 원점 중심의 Extents
+		const FOBB* OBB = static_cast<const FOBB*>(BoundingVolume);
+		OutCenter = FVector();
+		OutExtent = OBB->Extents;
+		return Type;
+	}
+
+	OutCenter = FVector(); OutExtent = FVector();
+	return EBoundingVolumeType::None;
+}
+
+EBoundingVolumeType UPrimitiveComponent::GetBoundingVolumeType() const
+{
+	if (WorldAABBCache)
+	{
+		return WorldAABBCache->GetVolumeType(WorldAABBHandle);
+	}
+
+	FVector LocalCenter, LocalExtent;
+	return GetLocalBounds(LocalCenter, LocalExtent);
+}
 
-			CachedWorldMin = AABB.Min;
-			CachedWorldMax = AABB.Max;
-       }
+void UPrimitiveComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax) const
+{
+	if (WorldAABBCache)
+	{
+		WorldAABBCache->GetBounds(WorldAABBHandle, OutMin, OutMax);
+		return;
+	}
 
-		bIsAABBCacheDirty = false;
+	FVector LocalCenter, LocalExtent;
+	if (GetLocalBounds(LocalCenter, LocalExtent) == EBoundingVolumeType::None)
+	{
+		OutMin = FVector(); OutMax = FVector();
+		return;
 	}
 
-	// 캐시된 값 반환
-	OutMin = CachedWorldMin;
-	OutMax = CachedWorldMax;
+	FWorldAABBCache::TransformBounds(LocalCenter, LocalExtent, GetWorldTransformMatrix(), OutMin, OutMax);
+}
+
+void UPrimitiveComponent::OnWorldTransformUpdated()
+{
+	// 부모가 움직여 World 행렬만 바뀐 자손도 다음 UpdateDirtyBounds에서 함께 갱신
+	if (WorldAABBCache)
+	{
+		WorldAABBCache->MarkDirty(WorldAABBHandle);
+	}
 }
 
 void UPrimitiveComponent::MarkAsDirty()
 {
-	bIsAABBCacheDirty = true;
+	if (WorldAABBCache)
+	{
+		WorldAABBCache->MarkDirty(WorldAABBHandle);
+	}
 	Super::MarkAsDirty();
 }
 
@@ -264,7 +289,7 @@ void UPrimitiveComponent::UpdateOverlaps(const TArray<UPrimitiveComponent*>& All
 	if (!bGenerateOverlapEvents)
 		return;
 
-	TArray<FOverlapInfo> NewOverlapInfos;
+	TFrameArray<FOverlapInfo> NewOverlapInfos;
 
 	// 모든 컴포넌트와 충돌 체크
 	for (UPrimitiveComponent* Other : AllComponents)
@@ -278,8 +303,18 @@ void UPrimitiveComponent::UpdateOverlaps(const TArray<UPrimitiveComponent*>& All
 		}
 	}
 
+	ApplyOverlapInfos(NewOverlapInfos);
+}
+
+void UPrimitiveComponent::GetOverlapBounds(FVector& OutMin, FVector& OutMax)
+{
+	GetWorldAABB(OutMin, OutMax);
+}
+
+void UPrimitiveComponent::ApplyOverlapInfos(const TFrameArray<FOverlapInfo>& InNewOverlapInfos)
+{
 	// 새로 겹친 것 확인 (BeginOverlap)
-	for (const FOverlapInfo& NewInfo : NewOverlapInfos)
+	for (const FOverlapInfo& NewInfo : InNewOverlapInfos)
 	{
 		auto It = std::find(OverlapInfos.begin(), OverlapInfos.end(), NewInfo);
 		if (It == OverlapInfos.end())
@@ -299,8 +334,8 @@ void UPrimitiveComponent::UpdateOverlaps(const TArray<UPrimitiveComponent*>& All
 	// 분리된 것 확인 (EndOverlap)
 	for (const FOverlapInfo& OldInfo : OverlapInfos)
 	{
-		auto It = std::find(NewOverlapInfos.begin(), NewOverlapInfos.end(), OldInfo);
-		if (It == NewOverlapInfos.end())
+		auto It = std::find(InNewOverlapInfos.begin(), InNewOverlapInfos.end(), OldInfo);
+		if (It == InNewOverlapInfos.end())
 		{
 			OnComponentEndOverlap.Broadcast(OldInfo);
 			// 분리됨 - 로그 출력
@@ -315,5 +350,5 @@ void UPrimitiveComponent::UpdateOverlaps(const TArray<UPrimitiveComponent*>& All
 	}
 
 	// 새로운 Overlap 정보로 업데이트
-	OverlapInfos = NewOverlapInfos;
+	OverlapInfos.assign(InNewOverlapInfos.begin(), InNewOverlapInfos.end());
 }
\ No newline at end of file
@@ -1,8 +1,12 @@
 ﻿#include "pch.h"
 #include "Component/Public/ProjectileMovementComponent.h"
-#include "Render/UI/Widget/Public/ProjectileMovementComponentWidget.h"
+#include "Component/Public/SceneComponent.h"
 #include "Utility/Public/JsonSerializer.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/ProjectileMovementComponentWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UProjectileMovementComponent, UMovementComponent)
 
 UProjectileMovementComponent::UProjectileMovementComponent()
@@ -79,5 +83,9 @@ UObject* UProjectileMovementComponent::Duplicate()
 
 UClass* UProjectileMovementComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return UProjectileMovementComponentWidget::StaticClass();
+#endif
 }
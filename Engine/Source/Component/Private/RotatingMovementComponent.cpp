@@ -1,8 +1,12 @@
 ﻿#include "pch.h"
 #include "Component/Public/RotatingMovementComponent.h"
-#include "Render/UI/Widget/Public/RotatingMovementComponentWidget.h"
+#include "Component/Public/SceneComponent.h"
 #include "Utility/Public/JsonSerializer.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/RotatingMovementComponentWidget.h"
+#endif
+
 IMPLEMENT_CLASS(URotatingMovementComponent, UMovementComponent)
 
 void URotatingMovementComponent::TickComponent(float DeltaTime)
@@ -60,5 +64,9 @@ UObject* URotatingMovementComponent::Duplicate()
 
 UClass* URotatingMovementComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return URotatingMovementComponentWidget::StaticClass();
+#endif
 }
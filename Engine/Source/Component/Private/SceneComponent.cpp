@@ -5,6 +5,7 @@
 
 #include "Component/Public/PrimitiveComponent.h"
 #include "Level/Public/Level.h"
+#include "Level/Public/SceneTransformSystem.h"
 
 #include <json.hpp>
 
@@ -14,6 +15,14 @@ USceneComponent::USceneComponent()
 {
 }
 
+USceneComponent::~USceneComponent()
+{
+	if (TransformSystem)
+	{
+		TransformSystem->Remove(this);
+	}
+}
+
 void USceneComponent::BeginPlay()
 {
 
@@ -92,8 +101,14 @@ void USceneComponent::DuplicateSubObjects(UObject* DuplicatedObject)
 void USceneComponent::MarkAsDirty()
 {
 	bIsTransformDirty = true;
-	bIsTransformDirtyInverse = true;
 
+	if (TransformSystem)
+	{
+		TransformSystem->MarkDirty(this);
+		return;
+	}
+
+	// 레벨에 등록되지 않은 컴포넌트는 등록된 자손이 대기 목록에 오르도록 재귀로 전파
 	for (USceneComponent* Child : AttachChildren)
 	{
 		Child->MarkAsDirty();
@@ -133,37 +148,55 @@ void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 	}
 }
 
-const FMatrix& USceneComponent::GetWorldTransformMatrix() const
+const FTransform& USceneComponent::GetWorldTransform() const
 {
+	// 갱신이 끝난 시스템의 컴포넌트는 UpdateTransforms가 부모 -> 자식 순서로 맞춰 두었으므로 부모를 확인하지 않음
+	if (AttachParent && (!TransformSystem || TransformSystem->HasPendingUpdates()))
+	{
+		AttachParent->GetWorldTransform();
+		if (ParentTransformVersion != AttachParent->TransformVersion)
+		{
+			bIsTransformDirty = true;
+		}
+	}
+
 	if (bIsTransformDirty)
 	{
-		WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, RelativeRotation, RelativeScale3D);
+		WorldTransform = GetRelativeTransform();
 
 		if (AttachParent)
 		{
-			WorldTransformMatrix *= AttachParent->GetWorldTransformMatrix();
+			WorldTransform *= AttachParent->GetWorldTransform();
+			ParentTransformVersion = AttachParent->TransformVersion;
 		}
 
+		++TransformVersion;
 		bIsTransformDirty = false;
 	}
 
-	return WorldTransformMatrix;
+	return WorldTransform;
 }
 
-const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
+const FMatrix& USceneComponent::GetWorldTransformMatrix() const
 {
-	if (bIsTransformDirtyInverse)
+	const FTransform& World = GetWorldTransform();
+	if (MatrixTransformVersion != TransformVersion)
 	{
-		WorldTransformMatrixInverse = FMatrix::Identity();
-
-		if (AttachParent)
-		{
-			WorldTransformMatrixInverse *= AttachParent->GetWorldTransformMatrixInverse();
-		}
+		WorldTransformMatrix = World.ToMatrix();
+		MatrixTransformVersion = TransformVersion;
+	}
 
-		WorldTransformMatrixInverse *= FMatrix::GetModelMatrixInverse(RelativeLocation, RelativeRotation, RelativeScale3D);
+	return WorldTransformMatrix;
+}
 
-		bIsTransformDirtyInverse = false;
+const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
+{
+	// World 트랜스폼을 먼저 최신으로 맞춘 뒤, 그 뒤로 다시 계산된 적이 있으면 역행렬도 다시 계산
+	const FTransform& World = GetWorldTransform();
+	if (InverseTransformVersion != TransformVersion)
+	{
+		WorldTransformMatrixInverse = World.ToInverseMatrix();
+		InverseTransformVersion = TransformVersion;
 	}
 
 	return WorldTransformMatrixInverse;
@@ -171,16 +204,12 @@ const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 
 FVector USceneComponent::GetWorldLocation() const
 {
-    return GetWorldTransformMatrix().GetLocation();
+    return GetWorldTransform().GetLocation();
 }
 
 FQuaternion USceneComponent::GetWorldRotationAsQuaternion() const
 {
-    if (AttachParent)
-    {
-        return RelativeRotation * AttachParent->GetWorldRotationAsQuaternion();
-    }
-    return RelativeRotation;
+    return GetWorldTransform().GetRotation();
 }
 
 FVector USceneComponent::GetWorldRotation() const
@@ -190,15 +219,16 @@ FVector USceneComponent::GetWorldRotation() const
 
 FVector USceneComponent::GetWorldScale3D() const
 {
-    return GetWorldTransformMatrix().GetScale();
+    // 행렬의 행 길이로 구하던 이전 결과와 같도록 크기만 반환
+    const FVector Scale = GetWorldTransform().GetScale3D();
+    return FVector(std::abs(Scale.X), std::abs(Scale.Y), std::abs(Scale.Z));
 }
 
 void USceneComponent::SetWorldLocation(const FVector& NewLocation)
 {
     if (AttachParent)
     {
-        const FMatrix ParentWorldMatrixInverse = AttachParent->GetWorldTransformMatrixInverse();
-        SetRelativeLocation(ParentWorldMatrixInverse.TransformPosition(NewLocation));
+        SetRelativeLocation(AttachParent->GetWorldTransform().InverseTransformPosition(NewLocation));
     }
     else
     {
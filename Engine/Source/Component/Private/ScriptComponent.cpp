@@ -270,7 +270,7 @@ void UScriptComponent::BindOverlapDelegates()
 		return;
 
 	// Owner Actor의 모든 Component 순회
-	const TArray<UActorComponent*>& Components = Owner->GetOwnedComponents();
+	const auto& Components = Owner->GetOwnedComponents();
 
 	for (UActorComponent* Component : Components)
 	{
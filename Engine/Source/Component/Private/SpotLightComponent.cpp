@@ -1,10 +1,15 @@
 #include "pch.h"
 #include "Component/Public/SpotLightComponent.h"
-#include "Render/UI/Widget/Public/SpotLightComponentWidget.h"
+#include "Component/Public/EditorIconComponent.h"
+#include "Actor/Public/Actor.h"
 #include "Utility/Public/JsonSerializer.h"
+#include "Editor/Public/EditorPrimitive.h"
+
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/SpotLightComponentWidget.h"
 #include "Render/Renderer/Public/Renderer.h"
 #include "Editor/Public/Camera.h"
-#include "Editor/Public/EditorPrimitive.h"
+#endif
 
 IMPLEMENT_CLASS(USpotLightComponent, UPointLightComponent)
 
@@ -47,7 +52,11 @@ UObject* USpotLightComponent::Duplicate()
 
 UClass* USpotLightComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     return USpotLightComponentWidget::StaticClass();
+#endif
 }
 
 FVector USpotLightComponent::GetForwardVector() const
@@ -67,6 +76,7 @@ void USpotLightComponent::SetInnerAngle(float const InAttenuationAngleRad)
     InnerConeAngleRad = std::clamp(InAttenuationAngleRad, 0.0f, OuterConeAngleRad);
 }
 
+#ifndef IS_HEADLESS
 void USpotLightComponent::RenderLightDirectionGizmo(UCamera* InCamera, const D3D11_VIEWPORT& InViewport)
 {
 	if (!InCamera)
@@ -118,6 +128,7 @@ void USpotLightComponent::RenderLightDirectionGizmo(UCamera* InCamera, const D3D
 
 	URenderer::GetInstance().RenderEditorPrimitive(LightDirectionArrow, RenderState);
 }
+#endif
 
 FSpotLightInfo USpotLightComponent::GetSpotLightInfo() const
 {
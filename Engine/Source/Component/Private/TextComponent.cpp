@@ -1,10 +1,12 @@
 #include "pch.h"
 #include "Component/Public/TextComponent.h"
-#include "Editor/Public/Editor.h"
 #include "Manager/Asset/Public/AssetManager.h"
-#include "Render/UI/Widget/Public/SetTextComponentWidget.h"
 #include "Level/Public/Level.h"
 
+#ifndef IS_HEADLESS
+#include "Render/UI/Widget/Public/SetTextComponentWidget.h"
+#endif
+
 IMPLEMENT_CLASS(UTextComponent, UPrimitiveComponent)
 
 UTextComponent::UTextComponent()
@@ -42,7 +44,11 @@ void UTextComponent::SetText(const FString& InText)
 
 UClass* UTextComponent::GetSpecificWidgetClass() const
 {
+#ifdef IS_HEADLESS
+	return nullptr;
+#else
 	return USetTextComponentWidget::StaticClass();
+#endif
 }
 
 UObject* UTextComponent::Duplicate()
@@ -85,4 +91,5 @@ void UTextComponent::RegulatePickingAreaByTextLength()
 			FVector(0.0f, 0.5f * NewStrLen, 0.5f)
 		);
 	BoundingVolume = &PickingAreaBoundingBox;
+	MarkAsDirty();
 }
@@ -1,7 +1,6 @@
 #include "pch.h"
 #include "Component/Public/UUIDTextComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
-#include "Editor/Public/Editor.h"
 #include "Actor/Public/Actor.h"
 
 IMPLEMENT_CLASS(UUUIDTextComponent, UTextComponent)
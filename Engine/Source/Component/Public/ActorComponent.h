@@ -35,13 +35,33 @@ public:
 	AActor* GetOwner() const { return Owner; }
 
 	bool CanEverTick() const { return bCanEverTick; }
-	void SetCanEverTick(bool InbCanEverTick) { bCanEverTick = InbCanEverTick; }
+	void SetCanEverTick(bool InbCanEverTick);
+
+	/** @brief Owner Actor보다 앞선 그룹을 지정해도 Owner Actor의 Tick 그룹에서 실행된다 */
+	ETickingGroup GetTickGroup() const { return TickGroup; }
+	void SetTickGroup(ETickingGroup InTickGroup);
+
+	bool CanTickOnAnyThread() const { return bRunOnAnyThread; }
+	void SetRunOnAnyThread(bool bInRunOnAnyThread);
+
+	/** @brief 이 컴포넌트의 Tick보다 먼저 끝나야 하는 Actor/Component 지정 (Owner Actor의 Tick은 항상 먼저 실행) */
+	void AddTickPrerequisiteActor(AActor* InPrerequisiteActor);
+	void AddTickPrerequisiteComponent(UActorComponent* InPrerequisiteComponent);
+	void RemoveTickPrerequisite(UObject* InPrerequisite);
+	const TArray<UObject*>& GetTickPrerequisites() const { return TickPrerequisites; }
 
 protected:
 	bool bCanEverTick = false;
+	ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+	/**
+	 * @brief 워커 스레드에서 Tick해도 되는지 여부
+	 * Owner Actor 계층의 상태만 변경하는 Tick에서만 켠다 (Spawn/Destroy, 다른 Actor 접근, 로그 출력 금지)
+	 */
+	bool bRunOnAnyThread = false;
 
 private:
 	AActor* Owner;
+	TArray<UObject*> TickPrerequisites;
 	
 public:
 	virtual UObject* Duplicate() override;
@@ -47,7 +47,9 @@ public:
      -----------------------------------------------------------------------------*/
 public:
     FVector GetForwardVector() const;
+#ifndef IS_HEADLESS
     void RenderLightDirectionGizmo(UCamera* InCamera, const D3D11_VIEWPORT& InViewport);
+#endif
     FDirectionalLightInfo GetDirectionalLightInfo() const;
 
     // Shadow mapping
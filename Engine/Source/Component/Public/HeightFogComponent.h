@@ -1,4 +1,5 @@
 #pragma once
+#include "Component/Public/SceneComponent.h"
 
 UCLASS()
 class UHeightFogComponent : public USceneComponent
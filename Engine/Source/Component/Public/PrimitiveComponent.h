@@ -3,6 +3,9 @@
 #include "Core/Delegates/Public/Delegate.h"
 #include "Physics/Public/BoundingVolume.h"
 #include "Physics/Public/CollisionTypes.h"
+#include "Global/FrameArena.h"
+
+class FWorldAABBCache;
 
 /*-----------------------------------------------------------------------------
 	델리게이트 선언
@@ -24,6 +27,7 @@ class UPrimitiveComponent : public USceneComponent
 
 public:
 	UPrimitiveComponent();
+	virtual ~UPrimitiveComponent() override;
 
 	void BeginPlay() override;
 	void TickComponent(float DeltaTime) override;
@@ -53,7 +57,17 @@ public:
 	void SetColor(const FVector4& InColor) { Color = InColor; }
 
 	virtual const IBoundingVolume* GetBoundingVolume();
-	void GetWorldAABB(FVector& OutMin, FVector& OutMax);
+
+	/**
+	 * @brief 로컬 공간 박스(중심, 반 크기)와 그 출처가 된 바운딩 볼륨 타입
+	 * World AABB는 이 박스를 월드 행렬로 변환해 얻으므로, 바운딩 볼륨을 직접 갖지 않는 프리미티브는 재정의해서 제공한다
+	 * @return 바운딩 볼륨이 없으면 None (이때 World AABB는 원점의 크기 0 박스)
+	 */
+	virtual EBoundingVolumeType GetLocalBounds(FVector& OutCenter, FVector& OutExtent) const;
+	EBoundingVolumeType GetBoundingVolumeType() const;
+
+	/** @brief 레벨에 등록되어 있으면 레벨의 FWorldAABBCache에서 읽고, 아니면 바로 계산 */
+	void GetWorldAABB(FVector& OutMin, FVector& OutMax) const;
 
 	virtual void MarkAsDirty() override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
@@ -68,7 +82,7 @@ public:
 	bool IsOverlappingComponent(const UPrimitiveComponent* Other) const;
 	bool IsOverlappingActor(const AActor* Other) const;
 
-	const TArray<FOverlapInfo>& GetOverlapInfos() const { return OverlapInfos; }
+	const TInlineArray<FOverlapInfo, 4>& GetOverlapInfos() const { return OverlapInfos; }
 	void ClearOverlapInfos() { OverlapInfos.clear(); }
 	void AddOverlapInfo(const FOverlapInfo& Info);
 	void RemoveOverlapInfo(const UPrimitiveComponent* Component);
@@ -76,11 +90,21 @@ public:
 	virtual bool CheckOverlapWith(const UPrimitiveComponent* Other) const;
 	void UpdateOverlaps(const TArray<UPrimitiveComponent*>& AllComponents);
 
+	/**
+	 * @brief Overlap Broadphase에 사용할 World AABB
+	 * CheckOverlapWith가 true를 반환할 수 있는 모든 영역을 포함해야 한다
+	 */
+	virtual void GetOverlapBounds(FVector& OutMin, FVector& OutMax);
+
+	/**
+	 * @brief 이번 프레임의 Overlap 목록과 기존 목록을 비교해 Begin/End Overlap을 발생시키고 교체
+	 */
+	void ApplyOverlapInfos(const TFrameArray<FOverlapInfo>& InNewOverlapInfos);
+
 	// 데칼에 덮일 수 있는가
 	bool bReceivesDecals = true;
 
-	// 다른 곳에서 사용할 인덱스
-	mutable int32 CachedAABBIndex = -1;
+	// 다른 곳에서 사용할 프레임 표시
 	mutable uint32 CachedFrame = 0;
 
 	// --- 델리게이트 ---
@@ -108,19 +132,32 @@ protected:
 
 	IBoundingVolume* BoundingVolume = nullptr;
 	bool bOwnsBoundingVolume = false;
-	
-	mutable FVector CachedWorldMin;
-	mutable FVector CachedWorldMax;
-	mutable bool bIsAABBCacheDirty = true;
 
 	// Collision
 	bool bGenerateOverlapEvents = false;
 	bool bBlockComponent = false;
-	TArray<FOverlapInfo> OverlapInfos;
+	TInlineArray<FOverlapInfo, 4> OverlapInfos;
 
 public:
 	virtual UObject* Duplicate() override;
 
 protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject) override;
+	virtual void OnWorldTransformUpdated() override;
+
+private:
+	friend class FOctree;
+	friend class FDynamicAABBTree;
+	friend class FWorldAABBCache;
+
+	// 이 프리미티브가 들어 있는 FOctree 노드와 노드 내 위치 (탐색 없이 O(1)로 재배치/제거하기 위한 Back-pointer)
+	int32 OctreeNodeIndex = -1;
+	int32 OctreeElementIndex = -1;
+
+	// 움직이는 프리미티브가 들어 있는 FDynamicAABBTree Leaf
+	int32 DynamicTreeLeafIndex = -1;
+
+	// 이 프리미티브의 World AABB가 들어 있는 레벨 캐시와 핸들
+	FWorldAABBCache* WorldAABBCache = nullptr;
+	int32 WorldAABBHandle = -1;
 };
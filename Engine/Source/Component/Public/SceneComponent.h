@@ -1,9 +1,12 @@
 #pragma once
 #include "Component/Public/ActorComponent.h"
+#include <atomic>
 
 namespace json { class JSON; }
 using JSON = json::JSON;
 
+class FSceneTransformSystem;
+
 UCLASS()
 class USceneComponent : public UActorComponent
 {
@@ -12,11 +15,16 @@ class USceneComponent : public UActorComponent
 
 public:
 	USceneComponent();
+	virtual ~USceneComponent() override;
 
 	void BeginPlay() override;
 	void TickComponent(float DeltaTime) override;
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 	
+	/**
+	 * @brief 상대 트랜스폼이 바뀌었음을 표시
+	 * 레벨에 등록된 컴포넌트는 FSceneTransformSystem 대기 목록에만 올리고, 자손은 UpdateTransforms에서 한 번에 갱신한다
+	 */
 	virtual void MarkAsDirty();
 
 	void SetRelativeLocation(const FVector& Location);
@@ -29,7 +37,15 @@ public:
 	const FVector& GetRelativeLocation() const { return RelativeLocation; }
 	const FQuaternion& GetRelativeRotation() const { return RelativeRotation; }
 	const FVector& GetRelativeScale3D() const { return RelativeScale3D; }
+	FTransform GetRelativeTransform() const { return FTransform(RelativeLocation, RelativeRotation, RelativeScale3D); }
+
+	/**
+	 * @brief 계층 갱신이 대기 중이면 부모가 먼저 바뀌었는지 확인한 뒤 반환
+	 * 계층 합성은 행렬 곱 대신 FTransform(쿼터니언 + 이동 + 스케일)으로 처리한다
+	 */
+	const FTransform& GetWorldTransform() const;
 
+	/** @brief World 트랜스폼이 바뀐 뒤 처음 조회할 때 한 번만 행렬로 변환 */
 	const FMatrix& GetWorldTransformMatrix() const;
 	const FMatrix& GetWorldTransformMatrixInverse() const;
 
@@ -46,12 +62,31 @@ public:
     void SetRelativeRotationPreservingChildren(const FQuaternion& NewRotation);
     void SetWorldScale3D(const FVector& NewScale);
 
+protected:
+	/** @brief FSceneTransformSystem이 World 트랜스폼을 다시 계산한 직후 호출 (워커 스레드에서 호출될 수 있음) */
+	virtual void OnWorldTransformUpdated() {}
+
 private:
+	friend class FSceneTransformSystem;
+
 	mutable bool bIsTransformDirty = true;
-	mutable bool bIsTransformDirtyInverse = true;
+	mutable FTransform WorldTransform;
 	mutable FMatrix WorldTransformMatrix;
 	mutable FMatrix WorldTransformMatrixInverse;
 
+	// World 트랜스폼을 다시 계산할 때마다 증가 (자식은 계산 당시의 부모 버전과 비교해 부모가 바뀌었는지 판단)
+	mutable uint32 TransformVersion = 0;
+	mutable uint32 ParentTransformVersion = 0;
+	// 각 행렬을 만들 때의 TransformVersion
+	mutable uint32 MatrixTransformVersion = 0;
+	mutable uint32 InverseTransformVersion = 0;
+
+	// 이 컴포넌트가 등록된 레벨의 트랜스폼 시스템과 핸들
+	FSceneTransformSystem* TransformSystem = nullptr;
+	int32 TransformSystemHandle = -1;
+	// 병렬 Tick 중 여러 워커가 MarkDirty를 호출하므로 처음 대기열에 올린 스레드만 true로 바꾼다
+	std::atomic<bool> bIsTransformQueued{ false };
+
 	FVector RelativeLocation = FVector{ 0,0,0.f };
 	FQuaternion RelativeRotation = FQuaternion::Identity();
 	FVector RelativeScale3D = FVector{ 1.f,1.f,1.f };
@@ -63,14 +98,14 @@ public:
 	void AttachToComponent(USceneComponent* Parent, bool bRemainTransform = false);
 	void DetachFromComponent();
 	bool IsAttachedTo(const USceneComponent* Parent) const { return AttachParent == Parent; }
-	const TArray<USceneComponent*>& GetChildren() const { return AttachChildren; }
+	const TInlineArray<USceneComponent*, 4>& GetChildren() const { return AttachChildren; }
 	
 protected:
 	void DetachChild(USceneComponent* ChildToDetach);
 
 private:
 	USceneComponent* AttachParent = nullptr;
-	TArray<USceneComponent*> AttachChildren;
+	TInlineArray<USceneComponent*, 4> AttachChildren;
 	
 public:
 	virtual UObject* Duplicate() override;
@@ -142,6 +142,8 @@ void UScriptComponent::CallLuaFunction(const char* FunctionName, Args&&... args)
 	if (!InstanceEnv.valid())
 		return;
 
+	ALLOC_SCOPE(Lua)
+
 	try
 	{
 		// 캐싱된 함수에서 찾기 (이미 environment가 설정됨)
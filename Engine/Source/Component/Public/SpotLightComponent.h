@@ -61,7 +61,9 @@ public:
     void SetOuterAngle(float const InAttenuationAngleRad);
     void SetInnerAngle(float const InAttenuationAngleRad);
 
+#ifndef IS_HEADLESS
     void RenderLightDirectionGizmo(UCamera* InCamera, const D3D11_VIEWPORT& InViewport);
+#endif
 
     FSpotLightInfo GetSpotLightInfo() const;
 
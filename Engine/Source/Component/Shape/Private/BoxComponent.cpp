@@ -26,50 +26,21 @@ void UBoxComponent::SetBoxExtent(const FVector& InExtent)
 
 FAABB UBoxComponent::GetWorldAABB() const
 {
-	// Local AABB 생성
-	FAABB LocalAABB(-BoxExtent, BoxExtent);
-
-	// World Transform 적용
-	const FMatrix& WorldTransform = GetWorldTransformMatrix();
-	FVector WorldCenter;
-	WorldCenter = FVector4(0.f, 0.f, 0.f, 1.f) * WorldTransform;
-
-	// World space의 8개 코너 계산
-	FVector LocalCorners[8] =
-	{
-		FVector(-BoxExtent.X, -BoxExtent.Y, -BoxExtent.Z),
-		FVector(+BoxExtent.X, -BoxExtent.Y, -BoxExtent.Z),
-		FVector(-BoxExtent.X, +BoxExtent.Y, -BoxExtent.Z),
-		FVector(+BoxExtent.X, +BoxExtent.Y, -BoxExtent.Z),
-		FVector(-BoxExtent.X, -BoxExtent.Y, +BoxExtent.Z),
-		FVector(+BoxExtent.X, -BoxExtent.Y, +BoxExtent.Z),
-		FVector(-BoxExtent.X, +BoxExtent.Y, +BoxExtent.Z),
-		FVector(+BoxExtent.X, +BoxExtent.Y, +BoxExtent.Z)
-	};
-
-	FVector WorldMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
-	FVector WorldMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-	for (int32 i = 0; i < 8; i++)
-	{
-		FVector4 WorldCorner = FVector4(LocalCorners[i].X, LocalCorners[i].Y, LocalCorners[i].Z, 1.0f) * WorldTransform;
-		WorldMin.X = min(WorldMin.X, WorldCorner.X);
-		WorldMin.Y = min(WorldMin.Y, WorldCorner.Y);
-		WorldMin.Z = min(WorldMin.Z, WorldCorner.Z);
-		WorldMax.X = max(WorldMax.X, WorldCorner.X);
-		WorldMax.Y = max(WorldMax.Y, WorldCorner.Y);
-		WorldMax.Z = max(WorldMax.Z, WorldCorner.Z);
-	}
+	FAABB WorldAABB;
+	GetWorldAABB(WorldAABB.Min, WorldAABB.Max);
+	return WorldAABB;
+}
 
-	return FAABB(WorldMin, WorldMax);
+EBoundingVolumeType UBoxComponent::GetLocalBounds(FVector& OutCenter, FVector& OutExtent) const
+{
+	OutCenter = FVector();
+	OutExtent = BoxExtent;
+	return EBoundingVolumeType::AABB;
 }
 
-void UBoxComponent::GetWorldAABB(FVector& OutMin, FVector& OutMax)
+void UBoxComponent::GetOverlapBounds(FVector& OutMin, FVector& OutMax)
 {
-	// 이미 World Space AABB를 계산하므로 직접 반환
-	FAABB WorldAABB = GetWorldAABB();
-	OutMin = WorldAABB.Min;
-	OutMax = WorldAABB.Max;
+	GetWorldAABB(OutMin, OutMax);
 }
 
 const IBoundingVolume* UBoxComponent::GetBoundingVolume()
@@ -48,6 +48,18 @@ FBoundingCapsule UCapsuleComponent::GetWorldCapsule() const
 	return FBoundingCapsule(WorldCenter, WorldHalfHeight, WorldRadius, WorldOrientation);
 }
 
+void UCapsuleComponent::GetOverlapBounds(FVector& OutMin, FVector& OutMax)
+{
+	// 양 끝 반구 중심을 잇는 선분을 반지름만큼 확장
+	const FBoundingCapsule WorldCapsule = GetWorldCapsule();
+	const FVector Top = WorldCapsule.GetTopSphereCenter();
+	const FVector Bottom = WorldCapsule.GetBottomSphereCenter();
+	const FVector Extent(WorldCapsule.Radius, WorldCapsule.Radius, WorldCapsule.Radius);
+
+	OutMin = FVector(min(Top.X, Bottom.X), min(Top.Y, Bottom.Y), min(Top.Z, Bottom.Z)) - Extent;
+	OutMax = FVector(max(Top.X, Bottom.X), max(Top.Y, Bottom.Y), max(Top.Z, Bottom.Z)) + Extent;
+}
+
 const IBoundingVolume* UCapsuleComponent::GetBoundingVolume()
 {
 	CachedWorldCapsule = GetWorldCapsule();
@@ -39,6 +39,14 @@ FBoundingSphere USphereComponent::GetWorldSphere() const
 	return FBoundingSphere(WorldCenter, WorldRadius);
 }
 
+void USphereComponent::GetOverlapBounds(FVector& OutMin, FVector& OutMax)
+{
+	const FBoundingSphere WorldSphere = GetWorldSphere();
+	const FVector Extent(WorldSphere.Radius, WorldSphere.Radius, WorldSphere.Radius);
+	OutMin = WorldSphere.Center - Extent;
+	OutMax = WorldSphere.Center + Extent;
+}
+
 const IBoundingVolume* USphereComponent::GetBoundingVolume()
 {
 	CachedWorldSphere = GetWorldSphere();
@@ -25,15 +25,17 @@ public:
 
 	// World space AABB 얻기
 	FAABB GetWorldAABB() const;
+	using UPrimitiveComponent::GetWorldAABB;
 
-	// UPrimitiveComponent 오버라이드 - World AABB 얻기 (out 파라미터 버전)
-	void GetWorldAABB(FVector& OutMin, FVector& OutMax);
+	// 로컬 박스는 원점 중심의 BoxExtent
+	virtual EBoundingVolumeType GetLocalBounds(FVector& OutCenter, FVector& OutExtent) const override;
 
 	// IBoundingVolume 인터페이스
 	virtual const IBoundingVolume* GetBoundingVolume() override;
 
 	// 충돌 체크 오버라이드
 	virtual bool CheckOverlapWith(const UPrimitiveComponent* Other) const override;
+	virtual void GetOverlapBounds(FVector& OutMin, FVector& OutMax) override;
 
 	void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
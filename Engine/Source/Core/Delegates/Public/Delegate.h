@@ -318,11 +318,14 @@ public:
     TMulticastDelegateRegistration
  -----------------------------------------------------------------------------*/
 
+template <typename FuncType>
+class TMulticastDelegateRegistration;
+
 template <typename... ParamTypes>
 class TMulticastDelegateRegistration<void(ParamTypes...)> : public TMulticastDelegateBase
 {
 protected:
-    using Super                         = typename TMulticastDelegateBase;
+    using Super                         = TMulticastDelegateBase;
     using DelegateInstanceInterfaceType = IBaseDelegateInstance<void (ParamTypes...)>;
 
 private:
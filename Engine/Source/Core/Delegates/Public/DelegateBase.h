@@ -100,7 +100,8 @@ class TMulticastDelegateBase
 protected:
     using UnicastDelegateType = TDelegateBase;
     
-    using InvocationListType = TArray<UnicastDelegateType>;
+    /** 대부분의 multi-cast 델리게이트는 바인딩이 한두 개이므로 힙 할당 없이 델리게이트 안에 저장한다. */
+    using InvocationListType = TInlineArray<UnicastDelegateType, 2>;
 
 public:
     /**
@@ -229,7 +230,7 @@ private:
 
         if (ValidInvocationListIndex < OldNumItems)
         {
-            InvocationList.erase(InvocationList.begin() + ValidInvocationListIndex);
+            InvocationList.erase(InvocationList.begin() + ValidInvocationListIndex, InvocationList.end());
         }
     }
 
@@ -4,45 +4,51 @@
 
 using std::stringstream;
 
+// 캐시는 0으로 시작하므로 첫 FindClasses에서 항상 만들어지도록 1부터 센다
+uint32 UClass::RegistryVersion = 1;
+
 void UClass::SignUpClass(UClass* InClass)
 {
 	if (InClass)
 	{
-		for (UClass* Class : GetAllClasses())
-		{
-			if (Class == InClass) return;
-		}
+		// 생성자에서만 호출되므로 중복 검사 없이 추가
 		GetAllClasses().emplace_back(InClass);
+		// 같은 이름이 다시 등록되면 먼저 등록된 클래스를 유지 (이전 선형 검색과 동일)
+		GetClassMap().emplace(InClass->GetName(), InClass);
+		++RegistryVersion;
 		UE_LOG("UClass: Class registered: %s (Total: %llu)", InClass->GetName().ToString().data(), GetAllClasses().size());
 	}
 }
 
 UClass* UClass::FindClass(const FName& InClassName)
 {
-	for (UClass* Class : GetAllClasses())
-	{
-		if (Class && Class->GetName() == InClassName)
-		{
-			return Class;
-		}
-	}
-
-	return nullptr;
+	const TMap<FName, UClass*>& ClassMap = GetClassMap();
+	auto Iter = ClassMap.find(InClassName);
+	return Iter != ClassMap.end() ? Iter->second : nullptr;
 }
 
-TArray<UClass*> UClass::FindClasses(UClass* SuperClass)
+const TArray<UClass*>& UClass::FindClasses(UClass* SuperClass)
 {
-	TArray<UClass*> Classes;
+	static const TArray<UClass*> EmptyClasses;
+	if (!SuperClass)
+	{
+		return EmptyClasses;
+	}
 
-	for (UClass* Class: GetAllClasses())
+	if (SuperClass->SubClassCacheVersion != RegistryVersion)
 	{
-		if (Class->IsChildOf(SuperClass))
+		SuperClass->SubClassCache.clear();
+		for (UClass* Class : GetAllClasses())
 		{
-			Classes.push_back(Class);
+			if (Class->IsChildOf(SuperClass))
+			{
+				SuperClass->SubClassCache.push_back(Class);
+			}
 		}
+		SuperClass->SubClassCacheVersion = RegistryVersion;
 	}
 
-	return Classes;
+	return SuperClass->SubClassCache;
 }
 
 TArray<UClass*>& UClass::GetAllClasses()
@@ -51,6 +57,12 @@ TArray<UClass*>& UClass::GetAllClasses()
 	return AllClasses;
 }
 
+TMap<FName, UClass*>& UClass::GetClassMap()
+{
+	static TMap<FName, UClass*> ClassMap;
+	return ClassMap;
+}
+
 /**
  * @brief UClass Constructor
  * @param InName Class 이름
@@ -61,40 +73,15 @@ TArray<UClass*>& UClass::GetAllClasses()
 UClass::UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract)
 	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor), bIsAbstract(InIsAbstract)
 {
-	UE_LOG("UClass: 클래스 등록: %s", ClassName.ToString().data());
-}
-
-/**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
- * @param InClass 확인할 클래스
- * @return 하위 클래스이거나 같은 클래스면 true
- */
-bool UClass::IsChildOf(UClass* InClass) const
-{
-	if (!InClass)
+	// 부모 UClass는 StaticClass()의 정적 지역 변수라 항상 먼저 생성되어 있다
+	if (SuperClass)
 	{
-		return false;
-	}
-
-	// 자기 자신과 같은 클래스인 경우
-	if (this == InClass)
-	{
-		return true;
-	}
-
-	// 부모 클래스들을 거슬러 올라가면서 확인
-	const UClass* CurrentClass = this;
-	while (CurrentClass)
-	{
-		if (CurrentClass->ClassName == InClass->ClassName)
-		{
-			return true;
-		}
-
-		CurrentClass = CurrentClass->SuperClass;
+		ClassDepth = SuperClass->ClassDepth + 1;
+		ClassBaseChain = SuperClass->ClassBaseChain;
 	}
+	ClassBaseChain.push_back(this);
 
-	return false;
+	SignUpClass(this);
 }
 
 /**
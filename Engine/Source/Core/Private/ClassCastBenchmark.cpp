@@ -0,0 +1,116 @@
+#include "pch.h"
+#include "Level/Public/World.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Public/SceneComponent.h"
+#include "Component/Mesh/Public/StaticMeshComponent.h"
+#include "Component/Shape/Public/BoxComponent.h"
+#include "Component/Shape/Public/SphereComponent.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	constexpr int32 NumCasts = 10000000;
+
+	/**
+	 * @brief 이전 StaticClass()의 등록 비용 재현
+	 * 호출할 때마다 SignUpClass가 전체 클래스 목록에서 중복을 찾았다
+	 */
+	UClass* LegacyStaticClass(UClass* InClass, const TArray<UClass*>& InAllClasses)
+	{
+		for (UClass* Class : InAllClasses)
+		{
+			if (Class == InClass)
+			{
+				return InClass;
+			}
+		}
+		return InClass;
+	}
+
+	/**
+	 * @brief 이전 IsChildOf 재현 (부모 체인을 따라 올라가며 이름 비교)
+	 */
+	bool LegacyIsChildOf(const UClass* InClass, const UClass* InSuperClass)
+	{
+		for (const UClass* Current = InClass; Current; Current = Current->GetSuperClass())
+		{
+			if (Current->GetName() == InSuperClass->GetName())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template <typename T>
+	T* LegacyCast(UObject* InObject, const TArray<UClass*>& InAllClasses)
+	{
+		if (!InObject)
+		{
+			return nullptr;
+		}
+
+		UClass* TargetClass = LegacyStaticClass(T::StaticClass(), InAllClasses);
+		return LegacyIsChildOf(InObject->GetClass(), TargetClass) ? static_cast<T*>(InObject) : nullptr;
+	}
+}
+
+/**
+ * @brief Renderer의 프리미티브 분류와 같은 형태로 섞인 오브젝트에 Cast<UStaticMeshComponent>를 반복
+ * 이전 구현(StaticClass마다 등록 목록 선형 탐색 + 부모 체인 이름 비교)과 현재 구현(조상 배열 O(1))을 비교한다
+ */
+IMPLEMENT_BENCHMARK(ClassCast, "Cast<UStaticMeshComponent> 1천만 회: 등록 목록 탐색 + 부모 체인 vs 조상 배열")
+{
+	UWorld* PreviousWorld = GWorld;
+
+	UWorld* World = NewObject<UWorld>();
+	World->SetWorldType(EWorldType::Game);
+	GWorld = World;
+	World->CreateNewLevel();
+
+	// 메시/셰이프/씬 컴포넌트와 컴포넌트가 아닌 오브젝트를 섞어 분기 예측이 한쪽으로 치우치지 않게 한다
+	AActor* Owner = World->SpawnActor(AActor::StaticClass());
+	TArray<UObject*> Objects;
+	Objects.push_back(Owner->CreateDefaultSubobject<UStaticMeshComponent>());
+	Objects.push_back(Owner->CreateDefaultSubobject<UBoxComponent>());
+	Objects.push_back(Owner);
+	Objects.push_back(Owner->CreateDefaultSubobject<USphereComponent>());
+	Objects.push_back(Owner->CreateDefaultSubobject<UStaticMeshComponent>());
+	Objects.push_back(Owner->CreateDefaultSubobject<USceneComponent>());
+	Objects.push_back(World);
+	Objects.push_back(Owner->CreateDefaultSubobject<UStaticMeshComponent>());
+	const size_t NumObjects = Objects.size();
+
+	const TArray<UClass*>& AllClasses = UClass::FindClasses(UObject::StaticClass());
+
+	uint64 LegacyHits = 0;
+	FScopeCycleCounter LegacyCounter;
+	for (int32 Index = 0; Index < NumCasts; ++Index)
+	{
+		LegacyHits += LegacyCast<UStaticMeshComponent>(Objects[Index % NumObjects], AllClasses) != nullptr;
+	}
+	const double LegacyMilliseconds = LegacyCounter.Finish();
+
+	uint64 Hits = 0;
+	FScopeCycleCounter Counter;
+	for (int32 Index = 0; Index < NumCasts; ++Index)
+	{
+		Hits += Cast<UStaticMeshComponent>(Objects[Index % NumObjects]) != nullptr;
+	}
+	const double Milliseconds = Counter.Finish();
+
+	FBenchmarkRegistry::Consume(LegacyHits + Hits);
+	if (LegacyHits != Hits)
+	{
+		UE_LOG_ERROR("  Cast 결과 불일치: 이전 %llu, 현재 %llu",
+			static_cast<unsigned long long>(LegacyHits), static_cast<unsigned long long>(Hits));
+	}
+
+	UE_LOG("  등록된 클래스 %zu개, UStaticMeshComponent 상속 깊이 %d", AllClasses.size(), UStaticMeshComponent::StaticClass()->GetClassDepth());
+	UE_LOG("  Legacy (scan + walk) | %10.3f ms | %6.2f ns/cast", LegacyMilliseconds, LegacyMilliseconds * 1.0e6 / NumCasts);
+	UE_LOG("  Ancestor array       | %10.3f ms | %6.2f ns/cast", Milliseconds, Milliseconds * 1.0e6 / NumCasts);
+	UE_LOG("  Speedup              | %10.2fx", Milliseconds > 0.0 ? LegacyMilliseconds / Milliseconds : 0.0);
+
+	SafeDelete(World);
+	GWorld = PreviousWorld;
+}
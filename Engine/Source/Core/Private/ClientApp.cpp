@@ -18,7 +18,10 @@
 #include "Render/UI/Overlay/Public/StatOverlay.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Manager/UI/Public/ViewportManager.h"
+#include "Global/FrameArena.h"
+#include "Utility/Public/AllocationProfiler.h"
 #include "Manager/Script/Public/CoroutineManager.h"
+#include "Core/Public/TaskGraph.h"
 
 #ifdef IS_OBJ_VIEWER
 #include "Utility/Public/FileDialog.h"
@@ -89,6 +92,9 @@ int FClientApp::InitializeSystem() const
 	// Initialize By Get Instance
 	UTimeManager::GetInstance();
 	UInputManager::GetInstance();
+
+	// Job System (논리 코어 수 - 1 개의 워커)
+	FTaskGraph::GetInstance().Initialize();
 	
 	auto& Renderer = URenderer::GetInstance();
 	Renderer.Init(Window->GetWindowHandle());
@@ -154,6 +160,11 @@ void FClientApp::UpdateSystem() const
 		Renderer.Update();
 	}
 	UInputManager::GetInstance().ClearMouseWheelDelta();
+
+	FAllocationProfiler::GetInstance().EndFrame();
+
+	// 이번 프레임의 임시 배열은 모두 소멸했으므로 Frame Arena를 되돌린다
+	FFrameArena::GetInstance().Reset();
 }
 
 /**
@@ -218,4 +229,5 @@ void FClientApp::ShutdownSystem() const
 	UAssetManager::GetInstance().Release();
 	FObjManager::Release();
 	URenderer::GetInstance().Release();
+	FTaskGraph::GetInstance().Shutdown();
 }
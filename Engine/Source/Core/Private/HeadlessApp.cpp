@@ -0,0 +1,311 @@
+#include "pch.h"
+#include "Core/Public/HeadlessApp.h"
+
+#include "Level/Public/World.h"
+#include "Core/Public/NewObject.h"
+#include "Manager/Asset/Public/AssetManager.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Manager/Time/Public/TimeManager.h"
+#include "Manager/Script/Public/ScriptManager.h"
+#include "Manager/Script/Public/CoroutineManager.h"
+#include "Utility/Public/ScopeCycleCounter.h"
+#include "Utility/Public/Benchmark.h"
+#include "Core/Public/TaskGraph.h"
+#include "Global/FrameArena.h"
+#include "Utility/Public/AllocationProfiler.h"
+
+namespace
+{
+	/**
+	 * @brief 공백 기준으로 커맨드라인을 토큰화한다 (큰따옴표로 감싼 경로 지원)
+	 */
+	TArray<FString> TokenizeCommandLine(const FString& InCommandLine)
+	{
+		TArray<FString> Tokens;
+		FString Current;
+		bool bInQuote = false;
+
+		for (char Character : InCommandLine)
+		{
+			if (Character == '"')
+			{
+				bInQuote = !bInQuote;
+				continue;
+			}
+
+			if (!bInQuote && (Character == ' ' || Character == '\t'))
+			{
+				if (!Current.empty())
+				{
+					Tokens.push_back(Current);
+					Current.clear();
+				}
+				continue;
+			}
+
+			Current.push_back(Character);
+		}
+
+		if (!Current.empty())
+		{
+			Tokens.push_back(Current);
+		}
+		return Tokens;
+	}
+
+	bool ReadOption(const FString& InToken, const char* InPrefix, FString& OutValue)
+	{
+		const size_t PrefixLength = strlen(InPrefix);
+		if (InToken.compare(0, PrefixLength, InPrefix) != 0)
+		{
+			return false;
+		}
+		OutValue = InToken.substr(PrefixLength);
+		return true;
+	}
+
+	constexpr const char* FrameStatKey = "Frame";
+}
+
+FHeadlessApp::FHeadlessApp() = default;
+
+FHeadlessApp::~FHeadlessApp() = default;
+
+void FHeadlessApp::FSubsystemStat::AddSample(double InMilliseconds)
+{
+	if (SampleCount == 0)
+	{
+		MinMilliseconds = InMilliseconds;
+		MaxMilliseconds = InMilliseconds;
+	}
+	else
+	{
+		MinMilliseconds = std::min(MinMilliseconds, InMilliseconds);
+		MaxMilliseconds = std::max(MaxMilliseconds, InMilliseconds);
+	}
+
+	TotalMilliseconds += InMilliseconds;
+	++SampleCount;
+}
+
+bool FHeadlessApp::IsHeadlessCommandLine(const FString& InCommandLine)
+{
+	for (const FString& Token : TokenizeCommandLine(InCommandLine))
+	{
+		if (Token == "-headless")
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief 커맨드라인에서 Headless 설정을 읽는다
+ * @return -scene 또는 -bench 인자가 있고 모든 값이 유효하면 true
+ */
+bool FHeadlessApp::ParseCommandLine(const FString& InCommandLine, FHeadlessConfig& OutConfig)
+{
+	for (const FString& Token : TokenizeCommandLine(InCommandLine))
+	{
+		FString Value;
+		try
+		{
+			if (ReadOption(Token, "-scene=", Value))
+			{
+				OutConfig.ScenePath = Value;
+			}
+			else if (ReadOption(Token, "-frames=", Value))
+			{
+				OutConfig.FrameCount = std::stoi(Value);
+			}
+			else if (ReadOption(Token, "-dt=", Value))
+			{
+				OutConfig.FixedDeltaTime = std::stof(Value);
+			}
+			else if (ReadOption(Token, "-bench=", Value))
+			{
+				OutConfig.BenchmarkName = Value;
+			}
+			else if (ReadOption(Token, "-alloccsv=", Value))
+			{
+				OutConfig.AllocationCSVPath = Value;
+			}
+		}
+		catch (const exception&)
+		{
+			UE_LOG_ERROR("Headless: 잘못된 인자입니다: %s", Token.c_str());
+			return false;
+		}
+	}
+
+	const bool bHasWork = !OutConfig.ScenePath.empty() || !OutConfig.BenchmarkName.empty();
+	return bHasWork && OutConfig.FrameCount > 0 && OutConfig.FixedDeltaTime > 0.0f;
+}
+
+/**
+ * @brief Headless Main Runtime Function
+ * @return 0: 정상 종료, 1: 인자 오류 또는 Scene 로드 실패
+ */
+int FHeadlessApp::Run(const FString& InCommandLine)
+{
+#if PLATFORM_WINDOWS
+	// WinMain 프로세스는 콘솔이 없으므로 부모 콘솔에 붙거나 새로 생성
+	if (!AttachConsole(ATTACH_PARENT_PROCESS))
+	{
+		AllocConsole();
+	}
+	FILE* FilePtr;
+	(void)freopen_s(&FilePtr, "CONOUT$", "w", stdout);
+	(void)freopen_s(&FilePtr, "CONOUT$", "w", stderr);
+#endif
+
+	if (!ParseCommandLine(InCommandLine, Config))
+	{
+		printf("Usage: -headless -scene=<Scene Path> [-frames=N] [-dt=Seconds] [-bench=<Name|all>] [-alloccsv=<CSV Path>]\n");
+		return 1;
+	}
+
+	if (!InitializeSystem())
+	{
+		ShutdownSystem();
+		return 1;
+	}
+
+	bool bIsSucceeded = true;
+	if (!Config.BenchmarkName.empty())
+	{
+		bIsSucceeded = FBenchmarkRegistry::Run(Config.BenchmarkName);
+	}
+
+	if (World)
+	{
+		MainLoop();
+		PrintReport();
+
+		if (!Config.AllocationCSVPath.empty() && !FAllocationProfiler::GetInstance().ExportCSV(path(Config.AllocationCSVPath)))
+		{
+			bIsSucceeded = false;
+		}
+	}
+
+	ShutdownSystem();
+	return bIsSucceeded ? 0 : 1;
+}
+
+/**
+ * @brief 렌더러/윈도우/UI를 제외한 시스템만 초기화하고 Game World에 Scene을 로드
+ * URenderer::Init을 호출하지 않으므로 GPU 리소스 생성은 모두 nullptr로 생략된다
+ */
+bool FHeadlessApp::InitializeSystem()
+{
+	srand(static_cast<unsigned int>(time(NULL)));
+
+	UTimeManager::GetInstance();
+	// Frame Arena의 소유 스레드를 메인 스레드로 고정
+	FFrameArena::GetInstance();
+	UAssetManager::GetInstance().Initialize();
+	UScriptManager::GetInstance().Initialize();
+	UCoroutineManager::GetInstance().Init();
+	FTaskGraph::GetInstance().Initialize();
+
+	// 벤치마크만 실행하는 경우 Scene 없이 진행
+	if (Config.ScenePath.empty())
+	{
+		return true;
+	}
+
+	World = NewObject<UWorld>();
+	World->SetWorldType(EWorldType::Game);
+	GWorld = World;
+
+	if (!World->LoadLevel(path(Config.ScenePath)))
+	{
+		UE_LOG_ERROR("Headless: Scene 로드 실패: %s", Config.ScenePath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * @brief 고정 DeltaTime으로 World를 N 프레임 Tick하고 프레임별 프로파일을 누적
+ * @note 서브시스템 구간 측정은 TIME_PROFILE이 활성화된 _DEVELOP 빌드에서만 수집된다
+ */
+void FHeadlessApp::MainLoop()
+{
+	auto& TimeManager = UTimeManager::GetInstance();
+
+	for (int32 FrameIndex = 0; FrameIndex < Config.FrameCount; ++FrameIndex)
+	{
+		FScopeCycleCounter::TimeProfileInit();
+		TimeManager.SetDeltaTime(Config.FixedDeltaTime);
+
+		FScopeCycleCounter FrameCounter;
+		World->Tick(Config.FixedDeltaTime);
+		const double FrameMilliseconds = FrameCounter.Finish();
+
+		FFrameArena& FrameArena = FFrameArena::GetInstance();
+		FrameArena.Reset();
+		TotalFrameHeapAllocations += FrameArena.GetLastFrameHeapAllocations();
+		FAllocationProfiler::GetInstance().EndFrame();
+
+		auto AddStat = [this](const FString& InKey, double InMilliseconds)
+		{
+			auto It = SubsystemStats.find(InKey);
+			if (It == SubsystemStats.end())
+			{
+				It = SubsystemStats.emplace(InKey, FSubsystemStat()).first;
+				SubsystemOrder.push_back(InKey);
+			}
+			It->second.AddSample(InMilliseconds);
+		};
+
+		AddStat(FrameStatKey, FrameMilliseconds);
+
+		const TArray<FString> Keys = FScopeCycleCounter::GetTimeProfileKeys();
+		const TArray<FTimeProfile> Values = FScopeCycleCounter::GetTimeProfileValues();
+		for (size_t Index = 0; Index < Keys.size(); ++Index)
+		{
+			AddStat(Keys[Index], Values[Index].Milliseconds);
+		}
+	}
+}
+
+void FHeadlessApp::PrintReport() const
+{
+	printf("\n[Headless] Scene: %s\n", Config.ScenePath.c_str());
+	printf("[Headless] Frames: %d, Fixed DeltaTime: %.4fs\n", Config.FrameCount, Config.FixedDeltaTime);
+	printf("%-24s %10s %10s %10s %10s\n", "Subsystem", "Avg(ms)", "Min(ms)", "Max(ms)", "Total(ms)");
+
+	for (const FString& Key : SubsystemOrder)
+	{
+		const FSubsystemStat& Stat = SubsystemStats.at(Key);
+		const double Average = Stat.SampleCount > 0 ? Stat.TotalMilliseconds / Stat.SampleCount : 0.0;
+		printf("%-24s %10.4f %10.4f %10.4f %10.3f\n",
+			Key.c_str(), Average, Stat.MinMilliseconds, Stat.MaxMilliseconds, Stat.TotalMilliseconds);
+	}
+
+	const FFrameArena& FrameArena = FFrameArena::GetInstance();
+	printf("[Headless] Heap Allocations/Frame: %.1f, Frame Arena Peak: %.1f KB\n",
+		static_cast<double>(TotalFrameHeapAllocations) / Config.FrameCount,
+		static_cast<double>(FrameArena.GetPeakUsedBytes()) / 1024.0);
+
+#ifndef _DEVELOP
+	printf("[Headless] 서브시스템별 구간은 _DEVELOP 빌드(Develop 구성)에서만 측정됩니다.\n");
+#endif
+}
+
+void FHeadlessApp::ShutdownSystem()
+{
+	if (World)
+	{
+		SafeDelete(World);
+		GWorld = nullptr;
+	}
+
+	UScriptManager::GetInstance().Shutdown();
+	UAssetManager::GetInstance().Release();
+	FObjManager::Release();
+	FTaskGraph::GetInstance().Shutdown();
+}
@@ -1,7 +1,55 @@
 #include "pch.h"
 #include "Core/Public/Name.h"
-#include <algorithm> // for std::transform
-#include <cctype>    // for std::tolower
+
+#include <charconv>
+
+namespace
+{
+    constexpr uint32 FNVOffsetBasis = 2166136261u;
+    constexpr uint32 FNVPrime = 16777619u;
+
+    char ToLowerASCII(char InCharacter)
+    {
+        return (InCharacter >= 'A' && InCharacter <= 'Z') ? static_cast<char>(InCharacter + ('a' - 'A')) : InCharacter;
+    }
+
+    /**
+     * @brief 대소문자 구분 해시와 무시 해시를 문자열 한 번 순회로 계산 (FNV-1a)
+     * 소문자 복사본을 만들지 않는다
+     */
+    void ComputeNameHashes(const char* InString, int32 InLength, uint32& OutHash, uint32& OutInsensitiveHash)
+    {
+        uint32 Hash = FNVOffsetBasis;
+        uint32 InsensitiveHash = FNVOffsetBasis;
+        for (int32 Index = 0; Index < InLength; ++Index)
+        {
+            const char Character = InString[Index];
+            Hash = (Hash ^ static_cast<uint8>(Character)) * FNVPrime;
+            InsensitiveHash = (InsensitiveHash ^ static_cast<uint8>(ToLowerASCII(Character))) * FNVPrime;
+        }
+
+        // 하위 비트가 슬롯 위치, 상위 비트가 샤드 선택에 쓰이므로 한 번 더 섞는다
+        OutHash = Hash ^ (Hash >> 15);
+        OutInsensitiveHash = InsensitiveHash ^ (InsensitiveHash >> 15);
+    }
+
+    bool EqualsIgnoreCase(const char* InLeft, const char* InRight, int32 InLength)
+    {
+        for (int32 Index = 0; Index < InLength; ++Index)
+        {
+            if (ToLowerASCII(InLeft[Index]) != ToLowerASCII(InRight[Index]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint64 MakeSlot(uint32 InHash, int32 InEntryIndex)
+    {
+        return (static_cast<uint64>(InHash) << 32) | static_cast<uint32>(InEntryIndex + 1);
+    }
+}
 
 FName::FName() : DisplayIndex(0), ComparisonIndex(0), Number(-1)
 {
@@ -15,11 +63,17 @@ FName::FName(const FString& Str)
     Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str)) { }
+FName::FName(const char* Str)
+{
+    TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(Str, static_cast<int32>(strlen(Str)));
+    ComparisonIndex = Indices.first;
+    DisplayIndex = Indices.second;
+    Number = -1;
+}
 
 /**
 * @brief NameTable에서 UniqueName을 만들 때 사용하는 생성자
-* 
+*
 */
 FName::FName(int32 InDisplayIndex, int32 InComparisonIndex, int32 InNumber)
     : DisplayIndex(InDisplayIndex), ComparisonIndex(InComparisonIndex), Number(InNumber) {}
@@ -46,12 +100,14 @@ int32 FName::Compare(const FName& Other) const
 
 FString FName::ToString() const
 {
-    FString BaseName = FNameTable::GetInstance().GetDisplayString(DisplayIndex);
-    if (Number >= 0)
+    FString Result;
+    if (const FNameEntry* Entry = FNameTable::GetInstance().GetEntry(DisplayIndex))
     {
-        return BaseName + "_" + to_string(Number);
+        // "_" + 최대 10자리 번호
+        Result.reserve(Entry->GetLength() + (Number >= 0 ? 11 : 0));
     }
-    return BaseName;
+    AppendString(Result);
+    return Result;
 }
 
 FString FName::ToBaseNameString() const
@@ -59,25 +115,68 @@ FString FName::ToBaseNameString() const
     return FNameTable::GetInstance().GetDisplayString(DisplayIndex);
 }
 
+void FName::AppendString(FString& OutString) const
+{
+    if (const FNameEntry* Entry = FNameTable::GetInstance().GetEntry(DisplayIndex))
+    {
+        OutString.append(Entry->GetData(), Entry->GetLength());
+    }
+    else
+    {
+        OutString.append("None");
+    }
+
+    if (Number >= 0)
+    {
+        char Buffer[16];
+        const std::to_chars_result Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Number);
+        OutString.push_back('_');
+        OutString.append(Buffer, Result.ptr);
+    }
+}
+
 FName FName::GetNone()
 {
     return None;
 }
-const FName FName::None(0, 0, -1); 
+const FName FName::None(0, 0, -1);
 
 // FNameTable
-/**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
-* @return DisplayIndex, ComparisonIndex
-*/
 FNameTable::FNameTable()
 {
-    ComparisonMap["None"] = 0;
-    DisplayMap["None"] = 0;
+    for (FShard& Shard : Shards)
+    {
+        Shard.DisplayTable.store(new FSlotTable(InitialSlotCapacity), std::memory_order_relaxed);
+        Shard.ComparisonTable.store(new FSlotTable(InitialSlotCapacity), std::memory_order_relaxed);
+    }
+
+    // 0번은 항상 None
+    const TPair<int32, int32> NoneIndices = FindOrAddName("None", 4);
+    assert(NoneIndices.first == 0 && NoneIndices.second == 0);
+    (void)NoneIndices;
 }
 
-FNameTable::~FNameTable() = default;
+FNameTable::~FNameTable()
+{
+    for (FShard& Shard : Shards)
+    {
+        delete Shard.DisplayTable.load(std::memory_order_relaxed);
+        delete Shard.ComparisonTable.load(std::memory_order_relaxed);
+        for (FSlotTable* Table : Shard.RetiredTables)
+        {
+            delete Table;
+        }
+        for (uint8* Chunk : Shard.ArenaChunks)
+        {
+            ::operator delete(Chunk);
+        }
+    }
+
+    for (std::atomic<FNameEntry**>& Block : EntryBlocks)
+    {
+        delete[] Block.load(std::memory_order_relaxed);
+    }
+}
 
 FNameTable& FNameTable::GetInstance()
 {
@@ -85,35 +184,51 @@ FNameTable& FNameTable::GetInstance()
     return Instance;
 }
 
+/**
+* @brief 문자열을 찾고 없으면 등록
+* @param Str FName으로 등록되었는지 확인할 FString
+* @return ComparisonIndex, DisplayIndex
+*/
 TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
 {
-    FString LowerStr = ToLower(Str);
+    return FindOrAddName(Str.data(), static_cast<int32>(Str.size()));
+}
 
-    int32 ComparisonIndex;
-    auto ItComparison = ComparisonMap.find(LowerStr);
-    if (ItComparison != ComparisonMap.end())
-    {
-        ComparisonIndex = ItComparison->second;
-    }
-    else
+TPair<int32, int32> FNameTable::FindOrAddName(const char* InString, int32 InLength)
+{
+    uint32 Hash;
+    uint32 InsensitiveHash;
+    ComputeNameHashes(InString, InLength, Hash, InsensitiveHash);
+
+    // 대소문자만 다른 철자가 같은 샤드에 모이도록 무시 해시로 샤드를 고른다
+    FShard& Shard = Shards[InsensitiveHash >> (32 - NumShardBits)];
+
+    // 이미 있는 철자는 락 없이 찾는다
+    int32 DisplayIndex = FindInTable<true>(Shard.DisplayTable.load(std::memory_order_acquire), Hash, InString, InLength);
+    if (DisplayIndex >= 0)
     {
-        ComparisonIndex = static_cast<int32>(ComparisonStringPool.size());
-        ComparisonStringPool.push_back(LowerStr);
-        ComparisonMap[LowerStr] = ComparisonIndex;
+        return { GetEntry(DisplayIndex)->ComparisonIndex, DisplayIndex };
     }
 
-    int32 DisplayIndex;
-    auto ItDisplay = DisplayMap.find(Str);
-    if (ItDisplay != DisplayMap.end())
+    std::lock_guard<std::mutex> Lock(Shard.WriteMutex);
+
+    // 락을 기다리는 동안 다른 스레드가 추가했을 수 있음
+    DisplayIndex = FindInTable<true>(Shard.DisplayTable.load(std::memory_order_relaxed), Hash, InString, InLength);
+    if (DisplayIndex >= 0)
     {
-        DisplayIndex = ItDisplay->second;
+        return { GetEntry(DisplayIndex)->ComparisonIndex, DisplayIndex };
     }
-    else
+
+    int32 ComparisonIndex = FindInTable<false>(Shard.ComparisonTable.load(std::memory_order_relaxed), InsensitiveHash, InString, InLength);
+    const bool bIsNewComparison = ComparisonIndex < 0;
+
+    DisplayIndex = AllocateEntry(Shard, InString, InLength, ComparisonIndex);
+    if (bIsNewComparison)
     {
-        DisplayIndex = static_cast<int32>(DisplayStringPool.size());
-        DisplayStringPool.push_back(Str);
-        DisplayMap[Str] = DisplayIndex;
+        ComparisonIndex = DisplayIndex;
+        InsertIntoTable(Shard, Shard.ComparisonTable, Shard.NumComparisonSlotsUsed, InsensitiveHash, DisplayIndex);
     }
+    InsertIntoTable(Shard, Shard.DisplayTable, Shard.NumDisplaySlotsUsed, Hash, DisplayIndex);
 
     return { ComparisonIndex, DisplayIndex };
 }
@@ -124,26 +239,154 @@ FName FNameTable::GetUniqueName(const FString& BaseStr)
     int32 DisplayIndex = Indices.second;
     int32 ComparisonIndex = Indices.first;
 
-    int32 Number = NextNumberMap[BaseStr];
-    NextNumberMap[BaseStr]++;
+    // 번호는 철자별로 매기며 Entry에 원자적으로 보관
+    const FNameEntry* Entry = GetEntry(DisplayIndex);
+    int32 Number = Entry->NextUniqueNumber.fetch_add(1, std::memory_order_relaxed);
 
     return FName(DisplayIndex, ComparisonIndex, Number);
 }
 
 FString FNameTable::GetDisplayString(int32 Idx) const
 {
-    if (Idx >= 0 && Idx < DisplayStringPool.size())
+    if (const FNameEntry* Entry = GetEntry(Idx))
     {
-        return DisplayStringPool[Idx];
+        return FString(Entry->GetData(), Entry->GetLength());
     }
     static const FString EmptyString = "None";
     return EmptyString;
 }
 
-FString FNameTable::ToLower(const FString& Str) const
+const FNameEntry* FNameTable::GetEntry(int32 InIndex) const
 {
-    FString LowerStr = Str;
-    std::transform(LowerStr.begin(), LowerStr.end(), LowerStr.begin(),
-        [](unsigned char C) { return std::tolower(C); });
-    return LowerStr;
-}
\ No newline at end of file
+    if (InIndex < 0 || InIndex >= NumEntries.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    const FNameEntry* const* Block = EntryBlocks[InIndex >> EntryBlockBits].load(std::memory_order_acquire);
+    return Block ? Block[InIndex & (EntriesPerBlock - 1)] : nullptr;
+}
+
+template <bool bCaseSensitive>
+int32 FNameTable::FindInTable(const FSlotTable* InTable, uint32 InHash, const char* InString, int32 InLength) const
+{
+    const uint32 Mask = static_cast<uint32>(InTable->Slots.size()) - 1;
+    for (uint32 Position = InHash & Mask; ; Position = (Position + 1) & Mask)
+    {
+        const uint64 Slot = InTable->Slots[Position].load(std::memory_order_acquire);
+        if (Slot == 0)
+        {
+            return -1;
+        }
+        if (static_cast<uint32>(Slot >> 32) != InHash)
+        {
+            continue;
+        }
+
+        const int32 EntryIndex = static_cast<int32>(static_cast<uint32>(Slot)) - 1;
+        const FNameEntry* Entry = EntryBlocks[EntryIndex >> EntryBlockBits].load(std::memory_order_acquire)[EntryIndex & (EntriesPerBlock - 1)];
+        if (Entry->Length != InLength)
+        {
+            continue;
+        }
+
+        const bool bEquals = bCaseSensitive
+            ? memcmp(Entry->Data, InString, InLength) == 0
+            : EqualsIgnoreCase(Entry->Data, InString, InLength);
+        if (bEquals)
+        {
+            return EntryIndex;
+        }
+    }
+}
+
+/**
+ * @brief 샤드 락을 잡은 상태에서 슬롯을 추가하고, 절반을 넘으면 두 배 크기의 테이블로 옮겨 게시
+ */
+void FNameTable::InsertIntoTable(FShard& InShard, std::atomic<FSlotTable*>& InTable, uint32& InOutNumUsed, uint32 InHash, int32 InEntryIndex)
+{
+    FSlotTable* Table = InTable.load(std::memory_order_relaxed);
+    if ((InOutNumUsed + 1) * 2 > Table->Slots.size())
+    {
+        FSlotTable* NewTable = new FSlotTable(static_cast<uint32>(Table->Slots.size()) * 2);
+        const uint32 NewMask = static_cast<uint32>(NewTable->Slots.size()) - 1;
+        for (const std::atomic<uint64>& OldSlot : Table->Slots)
+        {
+            const uint64 Slot = OldSlot.load(std::memory_order_relaxed);
+            if (Slot == 0)
+            {
+                continue;
+            }
+
+            uint32 Position = static_cast<uint32>(Slot >> 32) & NewMask;
+            while (NewTable->Slots[Position].load(std::memory_order_relaxed) != 0)
+            {
+                Position = (Position + 1) & NewMask;
+            }
+            NewTable->Slots[Position].store(Slot, std::memory_order_relaxed);
+        }
+
+        // 이전 테이블을 읽고 있는 스레드가 있을 수 있으므로 바로 지우지 않는다
+        InTable.store(NewTable, std::memory_order_release);
+        InShard.RetiredTables.push_back(Table);
+        Table = NewTable;
+    }
+
+    const uint32 Mask = static_cast<uint32>(Table->Slots.size()) - 1;
+    uint32 Position = InHash & Mask;
+    while (Table->Slots[Position].load(std::memory_order_relaxed) != 0)
+    {
+        Position = (Position + 1) & Mask;
+    }
+    Table->Slots[Position].store(MakeSlot(InHash, InEntryIndex), std::memory_order_release);
+    ++InOutNumUsed;
+}
+
+/**
+ * @brief 샤드 Arena에 Entry를 기록하고 전역 번호를 발급
+ * @param InComparisonIndex 대소문자만 다른 기존 철자의 번호 (없으면 -1, 자기 자신을 가리키게 됨)
+ */
+int32 FNameTable::AllocateEntry(FShard& InShard, const char* InString, int32 InLength, int32 InComparisonIndex)
+{
+    const size_t EntrySize = (offsetof(FNameEntry, Data) + InLength + 1 + alignof(FNameEntry) - 1) & ~(alignof(FNameEntry) - 1);
+
+    if (InShard.ArenaCursor + EntrySize > InShard.ArenaEnd)
+    {
+        // 청크보다 긴 이름은 전용 청크에 담는다
+        const size_t ChunkSize = std::max(ArenaChunkSize, EntrySize);
+        uint8* Chunk = static_cast<uint8*>(::operator new(ChunkSize));
+        InShard.ArenaChunks.push_back(Chunk);
+        InShard.ArenaCursor = Chunk;
+        InShard.ArenaEnd = Chunk + ChunkSize;
+    }
+
+    FNameEntry* Entry = reinterpret_cast<FNameEntry*>(InShard.ArenaCursor);
+    InShard.ArenaCursor += EntrySize;
+
+    const int32 EntryIndex = NumEntries.fetch_add(1, std::memory_order_acq_rel);
+    const int32 BlockIndex = EntryIndex >> EntryBlockBits;
+    assert(BlockIndex < MaxEntryBlocks && "FNameTable: 이름 개수가 한도를 넘었습니다");
+
+    FNameEntry** Block = EntryBlocks[BlockIndex].load(std::memory_order_acquire);
+    if (!Block)
+    {
+        // 블록은 여러 샤드가 함께 쓰므로 별도 락으로 한 번만 만든다
+        std::lock_guard<std::mutex> BlockLock(EntryBlockMutex);
+        Block = EntryBlocks[BlockIndex].load(std::memory_order_relaxed);
+        if (!Block)
+        {
+            Block = new FNameEntry*[EntriesPerBlock]();
+            EntryBlocks[BlockIndex].store(Block, std::memory_order_release);
+        }
+    }
+
+    Entry->ComparisonIndex = InComparisonIndex >= 0 ? InComparisonIndex : EntryIndex;
+    Entry->Length = InLength;
+    new (&Entry->NextUniqueNumber) std::atomic<int32>(0);
+    memcpy(Entry->Data, InString, InLength);
+    Entry->Data[InLength] = '\0';
+
+    // 슬롯이 release로 게시되기 전에 기록되므로 슬롯을 읽은 스레드는 완성된 Entry를 본다
+    Block[EntryIndex & (EntriesPerBlock - 1)] = Entry;
+    return EntryIndex;
+}
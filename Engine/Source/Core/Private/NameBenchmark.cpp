@@ -0,0 +1,203 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <thread>
+
+namespace
+{
+	constexpr int32 NumUniqueNames = 4096;
+	constexpr int32 NumLookupRounds = 200;
+	constexpr int32 NumToStringCalls = 1000000;
+	constexpr int32 NumLookupThreads = 4;
+
+	/**
+	 * @brief 이전 FNameTable::FindOrAddName 재현
+	 * 매번 소문자 복사본을 만들고 비교용/표시용 unordered_map을 한 번씩 찾으며 동기화가 없다
+	 */
+	class FLegacyNameTable
+	{
+	public:
+		TPair<int32, int32> FindOrAddName(const FString& InString)
+		{
+			FString LowerString = InString;
+			std::transform(LowerString.begin(), LowerString.end(), LowerString.begin(),
+				[](unsigned char InCharacter) { return static_cast<char>(std::tolower(InCharacter)); });
+
+			int32 ComparisonIndex;
+			auto ComparisonIt = ComparisonMap.find(LowerString);
+			if (ComparisonIt != ComparisonMap.end())
+			{
+				ComparisonIndex = ComparisonIt->second;
+			}
+			else
+			{
+				ComparisonIndex = static_cast<int32>(ComparisonPool.size());
+				ComparisonPool.push_back(LowerString);
+				ComparisonMap[LowerString] = ComparisonIndex;
+			}
+
+			int32 DisplayIndex;
+			auto DisplayIt = DisplayMap.find(InString);
+			if (DisplayIt != DisplayMap.end())
+			{
+				DisplayIndex = DisplayIt->second;
+			}
+			else
+			{
+				DisplayIndex = static_cast<int32>(DisplayPool.size());
+				DisplayPool.push_back(InString);
+				DisplayMap[InString] = DisplayIndex;
+			}
+
+			return { ComparisonIndex, DisplayIndex };
+		}
+
+		/** @brief 이전 FName::ToString (표시 문자열 복사 + "_" + to_string 연결) */
+		FString ToString(int32 InDisplayIndex, int32 InNumber) const
+		{
+			FString BaseName = DisplayPool[InDisplayIndex];
+			if (InNumber >= 0)
+			{
+				return BaseName + "_" + std::to_string(InNumber);
+			}
+			return BaseName;
+		}
+
+	private:
+		TArray<FString> ComparisonPool;
+		TArray<FString> DisplayPool;
+		TMap<FString, int32> ComparisonMap;
+		TMap<FString, int32> DisplayMap;
+	};
+
+	/** @brief 오브젝트 이름과 비슷한 길이의 이름 (대소문자가 섞인 변형 포함) */
+	TArray<FString> MakeNames()
+	{
+		TArray<FString> Names;
+		Names.reserve(NumUniqueNames);
+		for (int32 Index = 0; Index < NumUniqueNames; ++Index)
+		{
+			FString Name = (Index % 2 == 0 ? "StaticMeshComponent" : "staticmeshcomponent");
+			Name += "Bench" + std::to_string(Index / 2);
+			Names.push_back(Name);
+		}
+		return Names;
+	}
+}
+
+/**
+ * @brief 이미 등록된 이름을 반복해서 찾는 비용과 ToString 비용을 이전 테이블과 비교
+ * 멀티스레드 조회는 이전 테이블이 동기화되지 않으므로 현재 테이블만 측정한다
+ */
+IMPLEMENT_BENCHMARK(NameTable, "FName 조회/ToString: 이전 unordered_map 테이블 vs 샤드 개방 주소 테이블")
+{
+	const TArray<FString> Names = MakeNames();
+
+	FLegacyNameTable LegacyTable;
+	FNameTable& NameTable = FNameTable::GetInstance();
+	for (const FString& Name : Names)
+	{
+		LegacyTable.FindOrAddName(Name);
+		NameTable.FindOrAddName(Name);
+	}
+
+	const int32 NumLookups = NumUniqueNames * NumLookupRounds;
+	uint64 LegacyChecksum = 0;
+	uint64 NewChecksum = 0;
+
+	FScopeCycleCounter LegacyLookupCounter;
+	for (int32 Round = 0; Round < NumLookupRounds; ++Round)
+	{
+		for (const FString& Name : Names)
+		{
+			LegacyChecksum += LegacyTable.FindOrAddName(Name).first;
+		}
+	}
+	const double LegacyLookupMilliseconds = LegacyLookupCounter.Finish();
+
+	FScopeCycleCounter NewLookupCounter;
+	for (int32 Round = 0; Round < NumLookupRounds; ++Round)
+	{
+		for (const FString& Name : Names)
+		{
+			NewChecksum += NameTable.FindOrAddName(Name).first;
+		}
+	}
+	const double NewLookupMilliseconds = NewLookupCounter.Finish();
+
+	// 여러 스레드가 동시에 같은 이름을 찾는 경우 (로더/워커 스레드)
+	std::atomic<uint64> ThreadedChecksum{ 0 };
+	FScopeCycleCounter ThreadedLookupCounter;
+	{
+		TArray<std::thread> Threads;
+		for (int32 ThreadIndex = 0; ThreadIndex < NumLookupThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back([&Names, &NameTable, &ThreadedChecksum]()
+			{
+				uint64 Checksum = 0;
+				for (int32 Round = 0; Round < NumLookupRounds; ++Round)
+				{
+					for (const FString& Name : Names)
+					{
+						Checksum += NameTable.FindOrAddName(Name).first;
+					}
+				}
+				ThreadedChecksum += Checksum;
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+	const double ThreadedLookupMilliseconds = ThreadedLookupCounter.Finish();
+
+	// ToString: 이전 구현 vs 새 ToString vs 호출자 버퍼에 AppendString
+	const FName SampleName = NameTable.GetUniqueName(Names[0]);
+	const TPair<int32, int32> LegacyIndices = LegacyTable.FindOrAddName(Names[0]);
+	uint64 LegacyLength = 0;
+	uint64 ToStringLength = 0;
+	uint64 AppendLength = 0;
+
+	FScopeCycleCounter LegacyToStringCounter;
+	for (int32 Index = 0; Index < NumToStringCalls; ++Index)
+	{
+		LegacyLength += LegacyTable.ToString(LegacyIndices.second, SampleName.GetUniqueNumber()).size();
+	}
+	const double LegacyToStringMilliseconds = LegacyToStringCounter.Finish();
+
+	FScopeCycleCounter ToStringCounter;
+	for (int32 Index = 0; Index < NumToStringCalls; ++Index)
+	{
+		ToStringLength += SampleName.ToString().size();
+	}
+	const double ToStringMilliseconds = ToStringCounter.Finish();
+
+	FString Buffer;
+	FScopeCycleCounter AppendCounter;
+	for (int32 Index = 0; Index < NumToStringCalls; ++Index)
+	{
+		Buffer.clear();
+		SampleName.AppendString(Buffer);
+		AppendLength += Buffer.size();
+	}
+	const double AppendMilliseconds = AppendCounter.Finish();
+
+	FBenchmarkRegistry::Consume(LegacyChecksum + NewChecksum + ThreadedChecksum.load() + LegacyLength + ToStringLength + AppendLength);
+	if (LegacyLength != ToStringLength || ToStringLength != AppendLength)
+	{
+		UE_LOG_ERROR("  ToString 결과 길이 불일치: Legacy %llu, ToString %llu, Append %llu",
+			static_cast<unsigned long long>(LegacyLength), static_cast<unsigned long long>(ToStringLength), static_cast<unsigned long long>(AppendLength));
+	}
+
+	UE_LOG("  %d names (half differ only by case), %d lookups per table", NumUniqueNames, NumLookups);
+	UE_LOG("  Lookup       | Total (ms) | ns/lookup");
+	UE_LOG("  Legacy       | %10.3f | %9.1f", LegacyLookupMilliseconds, LegacyLookupMilliseconds * 1.0e6 / NumLookups);
+	UE_LOG("  Sharded      | %10.3f | %9.1f", NewLookupMilliseconds, NewLookupMilliseconds * 1.0e6 / NumLookups);
+	UE_LOG("  Sharded x%d   | %10.3f | %9.1f (wall time per lookup)", NumLookupThreads, ThreadedLookupMilliseconds,
+		ThreadedLookupMilliseconds * 1.0e6 / (static_cast<double>(NumLookups) * NumLookupThreads));
+	UE_LOG("  ToString     | Total (ms) | ns/call");
+	UE_LOG("  Legacy       | %10.3f | %7.1f", LegacyToStringMilliseconds, LegacyToStringMilliseconds * 1.0e6 / NumToStringCalls);
+	UE_LOG("  ToString     | %10.3f | %7.1f", ToStringMilliseconds, ToStringMilliseconds * 1.0e6 / NumToStringCalls);
+	UE_LOG("  AppendString | %10.3f | %7.1f", AppendMilliseconds, AppendMilliseconds * 1.0e6 / NumToStringCalls);
+}
@@ -6,6 +6,8 @@
 #include "Core/Public/EngineStatics.h"
 #include "Core/Public/Name.h"
 #include "Core/Public/NewObject.h"
+#include "Core/Public/ObjectPool.h"
+#include "Core/Public/ObjectUUIDIndex.h"
 
 uint32 UEngineStatics::NextUUID = 0;
 
@@ -15,32 +17,211 @@ TArray<UObject*>& GetUObjectArray()
 	return GUObjectArray;
 }
 
+UObject* FindObjectByUUID(uint32 InUUID)
+{
+	return FObjectUUIDIndex::GetInstance().Find(InUUID);
+}
+
+namespace
+{
+	// 소멸한 객체가 비운 GUObjectArray 슬롯 (다음 생성 시 재사용)
+	TArray<uint32>& GetUObjectFreeSlots()
+	{
+		static TArray<uint32> FreeSlots;
+		return FreeSlots;
+	}
+
+	/**
+	 * @brief 모든 UObject 할당 앞에 붙는 헤더
+	 * 풀에서 온 메모리면 소속 풀, 힙에서 온 메모리면 nullptr (16바이트 정렬 유지)
+	 */
+	struct alignas(16) FObjectAllocHeader
+	{
+		FObjectPool* Pool;
+	};
+
+	// 0은 "객체 없음"을 뜻하도록 1부터 발급
+	uint32 NextSerialNumber = 1;
+
+	/**
+	 * @brief 생성되었지만 아직 클래스별 목록으로 분류되지 않은 객체
+	 * 슬롯이 재사용될 수 있으므로 인덱스와 함께 생성 당시의 일련번호로 같은 객체인지 확인한다
+	 */
+	struct FPendingClassRegistration
+	{
+		uint32 Index;
+		uint32 SerialNumber;
+	};
+
+	TArray<FPendingClassRegistration>& GetPendingClassRegistrations()
+	{
+		static TArray<FPendingClassRegistration> PendingObjects;
+		return PendingObjects;
+	}
+
+	UObject* ResolvePendingObject(const FPendingClassRegistration& InPending)
+	{
+		const TArray<UObject*>& ObjectArray = GetUObjectArray();
+		UObject* Object = InPending.Index < ObjectArray.size() ? ObjectArray[InPending.Index] : nullptr;
+		return Object && Object->GetSerialNumber() == InPending.SerialNumber ? Object : nullptr;
+	}
+
+	/**
+	 * @brief 순회 없이 생성/소멸만 반복될 때 대기 목록이 끝없이 커지지 않도록 이미 소멸한 객체를 제거
+	 * 대기 목록이 살아 있는 객체 수의 두 배를 넘을 때만 수행하므로 생성 비용은 분할 상환 O(1)이다
+	 */
+	void CompactPendingClassRegistrations()
+	{
+		TArray<FPendingClassRegistration>& PendingObjects = GetPendingClassRegistrations();
+		const size_t NumLiveObjects = GetUObjectArray().size() - GetUObjectFreeSlots().size();
+		if (PendingObjects.size() <= 64 || PendingObjects.size() <= NumLiveObjects * 2)
+		{
+			return;
+		}
+
+		PendingObjects.erase(
+			std::remove_if(PendingObjects.begin(), PendingObjects.end(),
+				[](const FPendingClassRegistration& InPending) { return ResolvePendingObject(InPending) == nullptr; }),
+			PendingObjects.end());
+	}
+}
+
 IMPLEMENT_CLASS_BASE(UObject)
 
 UObject::UObject()
 	: Name(FName::GetNone()), Outer(nullptr)
 {
 	UUID = UEngineStatics::GenUUID();
-	
-	GetUObjectArray().emplace_back(this);
-	InternalIndex = static_cast<uint32>(GetUObjectArray().size()) - 1;
+	SerialNumber = NextSerialNumber++;
+
+	// 빈 슬롯이 있으면 재사용하여 배열 크기가 동시에 살아 있는 최대 객체 수를 넘지 않게 한다
+	TArray<UObject*>& ObjectArray = GetUObjectArray();
+	TArray<uint32>& FreeSlots = GetUObjectFreeSlots();
+	if (!FreeSlots.empty())
+	{
+		InternalIndex = FreeSlots.back();
+		FreeSlots.pop_back();
+		ObjectArray[InternalIndex] = this;
+	}
+	else
+	{
+		InternalIndex = static_cast<uint32>(ObjectArray.size());
+		ObjectArray.emplace_back(this);
+	}
+
+	GetPendingClassRegistrations().push_back({ InternalIndex, SerialNumber });
+	CompactPendingClassRegistrations();
+
+	FObjectUUIDIndex::GetInstance().Add(this);
 }
 
 UObject::~UObject()
 {
-	/** @todo: 이후에 리뷰 필요 */
+	FObjectUUIDIndex::GetInstance().Remove(this);
+	UnregisterFromClassObjects();
+
+	TArray<UObject*>& ObjectArray = GetUObjectArray();
+	if (InternalIndex < ObjectArray.size() && ObjectArray[InternalIndex] == this)
+	{
+		ObjectArray[InternalIndex] = nullptr;
+		GetUObjectFreeSlots().push_back(InternalIndex);
+	}
+}
+
+void* UObject::operator new(size_t InSize, UClass* InClass)
+{
+	// StaticClass()가 부모 클래스를 가리키는 등 크기가 맞지 않으면 힙으로 대체
+	if (!InClass || InSize > InClass->GetClassSize())
+	{
+		return operator new(InSize);
+	}
+
+	if (!InClass->ObjectPool)
+	{
+		InClass->ObjectPool = new FObjectPool(InClass, sizeof(FObjectAllocHeader) + InClass->GetClassSize());
+	}
+
+	FObjectAllocHeader* Header = static_cast<FObjectAllocHeader*>(InClass->ObjectPool->Allocate());
+	Header->Pool = InClass->ObjectPool;
+	return Header + 1;
+}
+
+void* UObject::operator new(size_t InSize)
+{
+	FObjectAllocHeader* Header = static_cast<FObjectAllocHeader*>(::operator new(sizeof(FObjectAllocHeader) + InSize));
+	Header->Pool = nullptr;
+	return Header + 1;
+}
 
-	// std::vector에 맞는 올바른 인덱스 유효성 검사
-	if (InternalIndex < GetUObjectArray().size())
+void UObject::operator delete(void* InMemory) noexcept
+{
+	if (!InMemory)
 	{
-		GetUObjectArray()[InternalIndex] = nullptr;
+		return;
 	}
+
+	FObjectAllocHeader* Header = static_cast<FObjectAllocHeader*>(InMemory) - 1;
+	if (Header->Pool)
+	{
+		Header->Pool->Free(Header);
+	}
+	else
+	{
+		::operator delete(Header);
+	}
+}
+
+void UObject::operator delete(void* InMemory, UClass* InClass) noexcept
+{
+	// 생성자에서 예외가 발생했을 때만 호출되며, 헤더에 소속이 기록되어 있으므로 일반 해제와 같다
+	operator delete(InMemory);
 }
 
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 }
 
+void UObject::FlushPendingClassRegistrations()
+{
+	TArray<FPendingClassRegistration>& PendingObjects = GetPendingClassRegistrations();
+
+	for (const FPendingClassRegistration& Pending : PendingObjects)
+	{
+		// 그 사이 소멸한 객체는 건너뜀 (슬롯이 재사용되었으면 일련번호가 다르다)
+		UObject* Object = ResolvePendingObject(Pending);
+		if (Object && !Object->RegisteredClass)
+		{
+			Object->RegisterToClassObjects();
+		}
+	}
+
+	PendingObjects.clear();
+}
+
+void UObject::RegisterToClassObjects()
+{
+	RegisteredClass = GetClass();
+	ClassObjectIndex = static_cast<int32>(RegisteredClass->ClassObjects.size());
+	RegisteredClass->ClassObjects.push_back(this);
+}
+
+void UObject::UnregisterFromClassObjects()
+{
+	if (!RegisteredClass)
+	{
+		return;
+	}
+
+	TArray<UObject*>& ClassObjects = RegisteredClass->ClassObjects;
+	UObject* LastObject = ClassObjects.back();
+	ClassObjects[ClassObjectIndex] = LastObject;
+	LastObject->ClassObjectIndex = ClassObjectIndex;
+	ClassObjects.pop_back();
+
+	RegisteredClass = nullptr;
+	ClassObjectIndex = -1;
+}
+
 /**
  * @brief PIE 시스템에 사용되는 복제 함수입니다. 상속받은 클래스에서 재정의함으로써 조율해야 합니다.
  */
@@ -127,7 +308,7 @@ void UObject::PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta)
 
 /**
  * @brief 해당 클래스가 현재 내 클래스의 조상 클래스인지 판단하는 함수
- * 내부적으로 재귀를 활용해서 부모를 계속 탐색한 뒤 결과를 반환한다
+ * UClass의 조상 배열을 한 번 조회하므로 상속 깊이와 관계없이 상수 시간
  * @param InClass 판정할 Class
  * @return 판정 결과
  */
@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "Core/Public/ObjectPool.h"
+
+#include "Core/Public/Class.h"
+
+FObjectPool::FObjectPool(const UClass* InClass, size_t InSlotSize)
+	: OwnerClass(InClass)
+{
+	SlotSize = (std::max(InSlotSize, sizeof(FFreeSlot)) + SlotAlignment - 1) & ~(SlotAlignment - 1);
+	SlotsPerSlab = std::max(SlabSize / SlotSize, MinSlotsPerSlab);
+
+	GetMutablePools().push_back(this);
+}
+
+FObjectPool::~FObjectPool()
+{
+	if (NumLiveSlots > 0)
+	{
+		UE_LOG_ERROR("ObjectPool: %s 풀이 사용 중인 슬롯 %u개를 남긴 채 해제됩니다",
+			OwnerClass ? OwnerClass->GetName().ToString().data() : "Unknown", NumLiveSlots);
+	}
+
+	for (uint8* Slab : Slabs)
+	{
+		::operator delete(Slab);
+	}
+
+	TArray<FObjectPool*>& Pools = GetMutablePools();
+	Pools.erase(std::remove(Pools.begin(), Pools.end(), this), Pools.end());
+}
+
+void* FObjectPool::Allocate()
+{
+	void* Slot = nullptr;
+
+	// 최근에 해제된 슬롯부터 재사용 (캐시에 남아 있을 가능성이 높음)
+	if (FreeList)
+	{
+		Slot = FreeList;
+		FreeList = FreeList->Next;
+	}
+	else
+	{
+		if (BumpCursor == BumpEnd)
+		{
+			uint8* Slab = static_cast<uint8*>(::operator new(SlotsPerSlab * SlotSize));
+			Slabs.push_back(Slab);
+			BumpCursor = Slab;
+			BumpEnd = Slab + SlotsPerSlab * SlotSize;
+		}
+
+		Slot = BumpCursor;
+		BumpCursor += SlotSize;
+	}
+
+	++NumLiveSlots;
+	++TotalAllocations;
+	PeakLiveSlots = std::max(PeakLiveSlots, NumLiveSlots);
+	return Slot;
+}
+
+void FObjectPool::Free(void* InSlot)
+{
+	if (!InSlot)
+	{
+		return;
+	}
+
+	FFreeSlot* FreeSlot = static_cast<FFreeSlot*>(InSlot);
+	FreeSlot->Next = FreeList;
+	FreeList = FreeSlot;
+	--NumLiveSlots;
+}
+
+TArray<FObjectPool*>& FObjectPool::GetMutablePools()
+{
+	static TArray<FObjectPool*> Pools;
+	return Pools;
+}
+
+const TArray<FObjectPool*>& FObjectPool::GetAllPools()
+{
+	return GetMutablePools();
+}
+
+void FObjectPool::LogStats()
+{
+	size_t TotalReservedBytes = 0;
+	size_t TotalUsedBytes = 0;
+
+	UE_LOG("ObjectPool: %-32s | Slot(B) | Slabs |   Live |   Peak | Allocations", "Class");
+	for (const FObjectPool* Pool : GetAllPools())
+	{
+		UE_LOG("ObjectPool: %-32s | %7zu | %5zu | %6u | %6u | %11llu",
+			Pool->OwnerClass ? Pool->OwnerClass->GetName().ToString().data() : "Unknown",
+			Pool->SlotSize,
+			Pool->Slabs.size(),
+			Pool->NumLiveSlots,
+			Pool->PeakLiveSlots,
+			static_cast<unsigned long long>(Pool->TotalAllocations));
+
+		TotalReservedBytes += Pool->GetReservedBytes();
+		TotalUsedBytes += static_cast<size_t>(Pool->NumLiveSlots) * Pool->SlotSize;
+	}
+
+	UE_LOG("ObjectPool: %zu pools, %.2f / %.2f MB in use",
+		GetAllPools().size(),
+		static_cast<double>(TotalUsedBytes) / (1024.0 * 1024.0),
+		static_cast<double>(TotalReservedBytes) / (1024.0 * 1024.0));
+}
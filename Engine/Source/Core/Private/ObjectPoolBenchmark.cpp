@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "Core/Public/ObjectPool.h"
+#include "Component/Public/SceneComponent.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumLiveObjects = 20000;
+	constexpr int32 NumChurnRounds = 50;
+
+	struct FChurnResult
+	{
+		double ChurnMilliseconds = 0.0;
+		double TraverseMilliseconds = 0.0;
+		uint64 Checksum = 0;
+	};
+
+	/**
+	 * @brief 살아 있는 객체 N개를 유지하면서 매 라운드 무작위 절반을 소멸/재생성한 뒤, 남은 객체를 한 번 순회
+	 * 같은 시드를 사용하므로 두 할당 경로는 완전히 같은 생성/소멸 순서를 따른다
+	 */
+	template <typename AllocatorType>
+	FChurnResult RunChurn(AllocatorType InAllocate)
+	{
+		std::mt19937 Random(1234);
+		std::uniform_real_distribution<float> Position(-100.0f, 100.0f);
+
+		TArray<USceneComponent*> Objects(NumLiveObjects, nullptr);
+		TArray<int32> Order(NumLiveObjects);
+		for (int32 Index = 0; Index < NumLiveObjects; ++Index)
+		{
+			Order[Index] = Index;
+		}
+
+		FChurnResult Result;
+		FScopeCycleCounter ChurnCounter;
+		for (USceneComponent*& Object : Objects)
+		{
+			Object = InAllocate();
+			Object->SetRelativeLocation(FVector(Position(Random), Position(Random), Position(Random)));
+		}
+
+		for (int32 Round = 0; Round < NumChurnRounds; ++Round)
+		{
+			std::shuffle(Order.begin(), Order.end(), Random);
+			for (int32 Index = 0; Index < NumLiveObjects / 2; ++Index)
+			{
+				delete Objects[Order[Index]];
+			}
+			for (int32 Index = 0; Index < NumLiveObjects / 2; ++Index)
+			{
+				USceneComponent* Object = InAllocate();
+				Object->SetRelativeLocation(FVector(Position(Random), Position(Random), Position(Random)));
+				Objects[Order[Index]] = Object;
+			}
+		}
+		Result.ChurnMilliseconds = ChurnCounter.Finish();
+
+		// 컴포넌트 순회처럼 살아 있는 객체의 데이터를 한 번씩 읽는 비용 (메모리 흩어짐 정도)
+		FScopeCycleCounter TraverseCounter;
+		float Sum = 0.0f;
+		for (const USceneComponent* Object : Objects)
+		{
+			Sum += Object->GetRelativeLocation().X;
+		}
+		Result.TraverseMilliseconds = TraverseCounter.Finish();
+		Result.Checksum = static_cast<uint64>(static_cast<int64>(Sum));
+
+		for (USceneComponent* Object : Objects)
+		{
+			delete Object;
+		}
+
+		return Result;
+	}
+}
+
+/**
+ * @brief 같은 생성/소멸 순서로 힙 할당(new T)과 UClass 슬랩 풀 할당(new (T::StaticClass()) T)을 비교
+ */
+IMPLEMENT_BENCHMARK(ObjectPool, "UObject 생성/소멸 반복: 힙 할당 vs UClass별 슬랩 풀")
+{
+	const FChurnResult HeapResult = RunChurn([]() { return new USceneComponent(); });
+	const FChurnResult PoolResult = RunChurn([]() { return new (USceneComponent::StaticClass()) USceneComponent(); });
+
+	FBenchmarkRegistry::Consume(HeapResult.Checksum + PoolResult.Checksum);
+	if (HeapResult.Checksum != PoolResult.Checksum)
+	{
+		UE_LOG_ERROR("  결과 불일치: Heap %llu, Pool %llu",
+			static_cast<unsigned long long>(HeapResult.Checksum), static_cast<unsigned long long>(PoolResult.Checksum));
+	}
+
+	const int32 NumOperations = NumLiveObjects + NumChurnRounds * NumLiveObjects;
+	UE_LOG("  %d live objects, %d rounds (half replaced per round)", NumLiveObjects, NumChurnRounds);
+	UE_LOG("  Allocator | Churn (ms) |     ns/op | Traverse (us)");
+	UE_LOG("  Heap      | %10.3f | %9.1f | %13.1f",
+		HeapResult.ChurnMilliseconds, HeapResult.ChurnMilliseconds * 1.0e6 / NumOperations, HeapResult.TraverseMilliseconds * 1.0e3);
+	UE_LOG("  Pool      | %10.3f | %9.1f | %13.1f",
+		PoolResult.ChurnMilliseconds, PoolResult.ChurnMilliseconds * 1.0e6 / NumOperations, PoolResult.TraverseMilliseconds * 1.0e3);
+
+	FObjectPool::LogStats();
+}
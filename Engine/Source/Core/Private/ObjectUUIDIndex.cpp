@@ -0,0 +1,209 @@
+#include "pch.h"
+#include "Core/Public/ObjectUUIDIndex.h"
+
+#include "Core/Public/Object.h"
+
+FObjectUUIDIndex& FObjectUUIDIndex::GetInstance()
+{
+	static FObjectUUIDIndex Instance;
+	return Instance;
+}
+
+FObjectUUIDIndex::FObjectUUIDIndex()
+	: Table(new FSlotTable(InitialCapacity))
+{
+}
+
+FObjectUUIDIndex::~FObjectUUIDIndex()
+{
+	delete Table.load(std::memory_order_relaxed);
+	for (FSlotTable* RetiredTable : RetiredTables)
+	{
+		delete RetiredTable;
+	}
+}
+
+/**
+ * @brief 홀수 상수 곱의 하위 비트를 사용
+ * 2^k로 나눈 나머지에 대해 홀수 곱은 일대일 대응이므로 연속으로 발급된 UUID는 Capacity개 안에서 서로 충돌하지 않는다
+ */
+uint32 FObjectUUIDIndex::HashUUID(uint32 InUUID, uint32 InCapacity)
+{
+	return (InUUID * 0x9E3779B9u) & (InCapacity - 1);
+}
+
+void FObjectUUIDIndex::Add(UObject* InObject)
+{
+	const uint32 UUID = InObject->GetUUID();
+	if (UUID == EmptyKey)
+	{
+		UE_LOG_WARNING("ObjectUUIDIndex: UUID %u는 인덱싱할 수 없습니다", UUID);
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(WriteMutex);
+
+	// 묘비를 포함해 절반이 차면 재해시 (살아 있는 객체 기준으로 크기를 다시 정하므로 줄어들 수도 있다)
+	FSlotTable* CurrentTable = Table.load(std::memory_order_relaxed);
+	if ((NumUsedSlots + 1) * 2 > CurrentTable->Capacity)
+	{
+		const uint32 NumLive = NumLiveObjects.load(std::memory_order_relaxed) + 1;
+		uint32 NewCapacity = InitialCapacity;
+		while (NumLive * 4 > NewCapacity)
+		{
+			NewCapacity *= 2;
+		}
+		Rehash(NewCapacity);
+		CurrentTable = Table.load(std::memory_order_relaxed);
+	}
+
+	const uint32 Mask = CurrentTable->Capacity - 1;
+	uint32 SlotIndex = HashUUID(UUID, CurrentTable->Capacity);
+	while (CurrentTable->Slots[SlotIndex].Key.load(std::memory_order_relaxed) != EmptyKey)
+	{
+		SlotIndex = (SlotIndex + 1) & Mask;
+	}
+
+	// 조회 스레드가 키를 보면 객체도 보이도록 객체를 먼저 기록
+	FSlot& Slot = CurrentTable->Slots[SlotIndex];
+	Slot.Object.store(InObject, std::memory_order_relaxed);
+	Slot.Key.store(UUID, std::memory_order_release);
+
+	++NumUsedSlots;
+	NumLiveObjects.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FObjectUUIDIndex::Remove(const UObject* InObject)
+{
+	const uint32 UUID = InObject->GetUUID();
+	if (UUID == EmptyKey)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(WriteMutex);
+
+	// 아직 해제되지 않은 이전 테이블을 읽는 중인 스레드도 소멸한 객체를 받지 않도록 모든 테이블에서 비운다
+	auto ClearInTable = [UUID, InObject](FSlotTable* InTable) -> bool
+	{
+		const uint32 Mask = InTable->Capacity - 1;
+		uint32 SlotIndex = HashUUID(UUID, InTable->Capacity);
+		for (uint32 Probe = 0; Probe < InTable->Capacity; ++Probe)
+		{
+			FSlot& Slot = InTable->Slots[SlotIndex];
+			const uint32 Key = Slot.Key.load(std::memory_order_relaxed);
+			if (Key == EmptyKey)
+			{
+				return false;
+			}
+			if (Key == UUID)
+			{
+				if (Slot.Object.load(std::memory_order_relaxed) != InObject)
+				{
+					return false;
+				}
+				Slot.Object.store(nullptr, std::memory_order_release);
+				return true;
+			}
+			SlotIndex = (SlotIndex + 1) & Mask;
+		}
+		return false;
+	};
+
+	if (ClearInTable(Table.load(std::memory_order_relaxed)))
+	{
+		NumLiveObjects.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	for (FSlotTable* RetiredTable : RetiredTables)
+	{
+		ClearInTable(RetiredTable);
+	}
+	ReleaseRetiredTables();
+}
+
+UObject* FObjectUUIDIndex::Find(uint32 InUUID) const
+{
+	if (InUUID == EmptyKey)
+	{
+		return nullptr;
+	}
+
+	// 테이블 포인터를 읽기 전에 조회 중임을 알려 재해시된 이전 테이블이 해제되지 않게 한다
+	NumActiveReaders.fetch_add(1, std::memory_order_seq_cst);
+	const FSlotTable* CurrentTable = Table.load(std::memory_order_seq_cst);
+
+	UObject* Result = nullptr;
+	const uint32 Mask = CurrentTable->Capacity - 1;
+	uint32 SlotIndex = HashUUID(InUUID, CurrentTable->Capacity);
+	for (uint32 Probe = 0; Probe < CurrentTable->Capacity; ++Probe)
+	{
+		const FSlot& Slot = CurrentTable->Slots[SlotIndex];
+		const uint32 Key = Slot.Key.load(std::memory_order_acquire);
+		if (Key == EmptyKey)
+		{
+			break;
+		}
+		if (Key == InUUID)
+		{
+			Result = Slot.Object.load(std::memory_order_acquire);
+			break;
+		}
+		SlotIndex = (SlotIndex + 1) & Mask;
+	}
+
+	NumActiveReaders.fetch_sub(1, std::memory_order_release);
+	return Result;
+}
+
+void FObjectUUIDIndex::Rehash(uint32 InNewCapacity)
+{
+	FSlotTable* OldTable = Table.load(std::memory_order_relaxed);
+	FSlotTable* NewTable = new FSlotTable(InNewCapacity);
+
+	// 새 테이블은 공개 전이므로 순서 보장 없이 채운다 (묘비는 옮기지 않음)
+	const uint32 Mask = InNewCapacity - 1;
+	uint32 NumCopied = 0;
+	for (const FSlot& OldSlot : OldTable->Slots)
+	{
+		const uint32 Key = OldSlot.Key.load(std::memory_order_relaxed);
+		UObject* Object = OldSlot.Object.load(std::memory_order_relaxed);
+		if (Key == EmptyKey || !Object)
+		{
+			continue;
+		}
+
+		uint32 SlotIndex = HashUUID(Key, InNewCapacity);
+		while (NewTable->Slots[SlotIndex].Key.load(std::memory_order_relaxed) != EmptyKey)
+		{
+			SlotIndex = (SlotIndex + 1) & Mask;
+		}
+		NewTable->Slots[SlotIndex].Object.store(Object, std::memory_order_relaxed);
+		NewTable->Slots[SlotIndex].Key.store(Key, std::memory_order_relaxed);
+		++NumCopied;
+	}
+
+	Table.store(NewTable, std::memory_order_seq_cst);
+	NumUsedSlots = NumCopied;
+
+	RetiredTables.push_back(OldTable);
+	ReleaseRetiredTables();
+}
+
+/**
+ * @brief 진행 중인 조회가 없으면 이전 테이블을 모두 해제
+ * 조회는 카운터를 올린 뒤 테이블을 읽으므로, 여기서 0을 확인한 이후 시작한 조회는 반드시 현재 테이블을 본다
+ */
+void FObjectUUIDIndex::ReleaseRetiredTables()
+{
+	if (RetiredTables.empty() || NumActiveReaders.load(std::memory_order_seq_cst) != 0)
+	{
+		return;
+	}
+
+	for (FSlotTable* RetiredTable : RetiredTables)
+	{
+		delete RetiredTable;
+	}
+	RetiredTables.clear();
+}
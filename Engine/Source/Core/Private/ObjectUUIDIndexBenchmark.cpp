@@ -0,0 +1,101 @@
+#include "pch.h"
+#include "Core/Public/ObjectUUIDIndex.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumLiveObjects = 20000;
+	constexpr int32 NumLookups = 20000;
+
+	/** @brief 인덱스 도입 이전처럼 객체 배열을 앞에서부터 훑어 UUID가 같은 객체를 찾음 */
+	UObject* LegacyFindObjectByUUID(uint32 InUUID)
+	{
+		for (UObject* Object : GetUObjectArray())
+		{
+			if (Object && Object->GetUUID() == InUUID)
+			{
+				return Object;
+			}
+		}
+		return nullptr;
+	}
+}
+
+/**
+ * @brief 레벨 로드/PIE 복제 규모의 객체 수에서 UUID -> UObject* 조회를 배열 순회와 해시 인덱스로 비교
+ * 조회 대상의 절반은 이미 소멸한 UUID라 배열 순회는 끝까지 훑어야 한다
+ */
+IMPLEMENT_BENCHMARK(ObjectUUIDIndex, "UUID로 UObject 찾기: GUObjectArray 순회 vs 개방 주소 해시 인덱스")
+{
+	TArray<UObject*> Objects;
+	Objects.reserve(NumLiveObjects * 2);
+	for (int32 Index = 0; Index < NumLiveObjects * 2; ++Index)
+	{
+		Objects.push_back(new (UObject::StaticClass()) UObject());
+	}
+
+	TArray<uint32> UUIDs;
+	UUIDs.reserve(Objects.size());
+	for (UObject* Object : Objects)
+	{
+		UUIDs.push_back(Object->GetUUID());
+	}
+
+	// 홀수 번째 객체는 소멸시켜 묘비와 찾지 못하는 조회를 섞는다
+	for (size_t Index = 1; Index < Objects.size(); Index += 2)
+	{
+		delete Objects[Index];
+		Objects[Index] = nullptr;
+	}
+
+	std::mt19937 Random(1234);
+	std::uniform_int_distribution<size_t> Pick(0, UUIDs.size() - 1);
+	TArray<uint32> Queries(NumLookups);
+	for (uint32& Query : Queries)
+	{
+		Query = UUIDs[Pick(Random)];
+	}
+
+	uint64 LegacyChecksum = 0;
+	FScopeCycleCounter LegacyCounter;
+	for (uint32 Query : Queries)
+	{
+		if (UObject* Object = LegacyFindObjectByUUID(Query))
+		{
+			LegacyChecksum += Object->GetUUID();
+		}
+	}
+	const double LegacyMilliseconds = LegacyCounter.Finish();
+
+	uint64 IndexChecksum = 0;
+	FScopeCycleCounter IndexCounter;
+	for (uint32 Query : Queries)
+	{
+		if (UObject* Object = FindObjectByUUID(Query))
+		{
+			IndexChecksum += Object->GetUUID();
+		}
+	}
+	const double IndexMilliseconds = IndexCounter.Finish();
+
+	for (UObject* Object : Objects)
+	{
+		delete Object;
+	}
+
+	FBenchmarkRegistry::Consume(LegacyChecksum + IndexChecksum);
+	if (LegacyChecksum != IndexChecksum)
+	{
+		UE_LOG_ERROR("  결과 불일치: Scan %llu, Index %llu",
+			static_cast<unsigned long long>(LegacyChecksum), static_cast<unsigned long long>(IndexChecksum));
+	}
+
+	const FObjectUUIDIndex& UUIDIndex = FObjectUUIDIndex::GetInstance();
+	UE_LOG("  %d live objects (%d destroyed), %d lookups", NumLiveObjects, NumLiveObjects, NumLookups);
+	UE_LOG("  Method | Total (ms) | ns/lookup");
+	UE_LOG("  Scan   | %10.3f | %9.1f", LegacyMilliseconds, LegacyMilliseconds * 1.0e6 / NumLookups);
+	UE_LOG("  Index  | %10.3f | %9.1f", IndexMilliseconds, IndexMilliseconds * 1.0e6 / NumLookups);
+	UE_LOG("  Index: %u objects, %u slots", UUIDIndex.Num(), UUIDIndex.GetCapacity());
+}
@@ -0,0 +1,395 @@
+#include "pch.h"
+#include "Core/Public/TaskGraph.h"
+
+namespace
+{
+	// 워커 스레드가 자신의 Deque 인덱스를 알기 위한 스레드 로컬 정보
+	thread_local FTaskGraph* CurrentTaskGraph = nullptr;
+	thread_local int32 CurrentWorkerIndex = -1;
+
+	// 잠들기 전에 바쁜 대기로 작업을 다시 찾아보는 횟수
+	constexpr int32 SpinCountBeforeSleep = 64;
+}
+
+FTaskGraph& FTaskGraph::GetInstance()
+{
+	static FTaskGraph Instance;
+	return Instance;
+}
+
+FTaskGraph::~FTaskGraph()
+{
+	Shutdown();
+}
+
+void FTaskGraph::Initialize(int32 InNumWorkers)
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	NumWorkers = InNumWorkers >= 0 ? InNumWorkers : std::max(FPlatformMisc::NumberOfCores() - 1, 0);
+	bIsShuttingDown.store(false);
+
+	Queues.clear();
+	for (int32 Index = 0; Index <= NumWorkers; ++Index)
+	{
+		Queues.push_back(std::make_unique<FWorkerQueue>());
+	}
+
+	// 워커가 시작되기 전에 설정해야 워커가 일관된 상태를 본다
+	bIsInitialized = true;
+
+	Workers.reserve(NumWorkers);
+	for (int32 Index = 0; Index < NumWorkers; ++Index)
+	{
+		Workers.emplace_back(&FTaskGraph::WorkerMain, this, Index);
+	}
+
+	UE_LOG_SYSTEM("TaskGraph: %d개의 워커 스레드로 초기화되었습니다", NumWorkers);
+}
+
+/**
+ * @brief 남은 작업을 모두 처리한 뒤 워커 스레드 종료
+ */
+void FTaskGraph::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(WakeLock);
+		bIsShuttingDown.store(true);
+	}
+	WakeCondition.notify_all();
+
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.clear();
+
+	// 워커가 없던 경우(0개) Injection Queue에 남은 작업 처리
+	while (TryExecuteOne())
+	{
+	}
+
+	Queues.clear();
+	NumWorkers = 0;
+	bIsInitialized = false;
+}
+
+FGraphEventRef FTaskGraph::Dispatch(TFunction<void()> InWork, const FGraphEventArray& InPrerequisites)
+{
+	FGraphEventRef Task = std::make_shared<FGraphTask>();
+	Task->Work = std::move(InWork);
+
+	for (const FGraphEventRef& Prerequisite : InPrerequisites)
+	{
+		if (!Prerequisite)
+		{
+			continue;
+		}
+
+		std::lock_guard<std::mutex> Lock(Prerequisite->SubsequentsLock);
+		if (!Prerequisite->bIsCompleted.load(std::memory_order_acquire))
+		{
+			Task->NumPendingPrerequisites.fetch_add(1, std::memory_order_relaxed);
+			Prerequisite->Subsequents.push_back(Task);
+		}
+	}
+
+	// 초기값 1을 해제. 선행 작업이 모두 끝나 있었다면 바로 큐에 넣는다
+	if (Task->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		Enqueue(Task);
+	}
+
+	return Task;
+}
+
+void FTaskGraph::Wait(const FGraphEventRef& InEvent)
+{
+	if (!InEvent)
+	{
+		return;
+	}
+
+	while (!InEvent->IsCompleted())
+	{
+		if (!TryExecuteOne())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void FTaskGraph::WaitAll(const FGraphEventArray& InEvents)
+{
+	for (const FGraphEventRef& Event : InEvents)
+	{
+		Wait(Event);
+	}
+}
+
+void FTaskGraph::ParallelFor(int32 InCount, const TFunction<void(int32)>& InBody, int32 InMinBatchSize)
+{
+	ParallelForRange(InCount, [&InBody](int32 InBegin, int32 InEnd)
+	{
+		for (int32 Index = InBegin; Index < InEnd; ++Index)
+		{
+			InBody(Index);
+		}
+	}, InMinBatchSize);
+}
+
+/**
+ * @brief 구간을 Batch로 나누고 공유 카운터로 Batch를 동적으로 나눠 가진다
+ * 호출 스레드도 Batch를 처리하므로 워커 수만큼의 보조 작업만 Dispatch한다
+ */
+void FTaskGraph::ParallelForRange(int32 InCount, const TFunction<void(int32, int32)>& InBody, int32 InMinBatchSize)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	const int32 MinBatchSize = std::max(InMinBatchSize, 1);
+	const int32 MaxBatches = (InCount + MinBatchSize - 1) / MinBatchSize;
+
+	// 부하 불균형을 흡수하도록 스레드당 4개 정도의 Batch로 나눈다
+	const int32 NumBatches = std::min(MaxBatches, GetNumThreads() * 4);
+	if (!bIsInitialized || NumWorkers == 0 || NumBatches <= 1)
+	{
+		InBody(0, InCount);
+		return;
+	}
+
+	const int32 BatchSize = (InCount + NumBatches - 1) / NumBatches;
+	std::atomic<int32> NextBatch{ 0 };
+
+	auto ProcessBatches = [&]()
+	{
+		int32 Batch;
+		while ((Batch = NextBatch.fetch_add(1, std::memory_order_relaxed)) < NumBatches)
+		{
+			const int32 Begin = Batch * BatchSize;
+			const int32 End = std::min(Begin + BatchSize, InCount);
+			if (Begin < End)
+			{
+				InBody(Begin, End);
+			}
+		}
+	};
+
+	const int32 NumHelpers = std::min(NumWorkers, NumBatches - 1);
+	FGraphEventArray Helpers;
+	Helpers.reserve(NumHelpers);
+	for (int32 Index = 0; Index < NumHelpers; ++Index)
+	{
+		Helpers.push_back(Dispatch(ProcessBatches));
+	}
+
+	ProcessBatches();
+	WaitAll(Helpers);
+}
+
+bool FTaskGraph::IsWorkerThread() const
+{
+	return CurrentTaskGraph == this && CurrentWorkerIndex >= 0;
+}
+
+void FTaskGraph::WorkerMain(int32 InWorkerIndex)
+{
+	CurrentTaskGraph = this;
+	CurrentWorkerIndex = InWorkerIndex;
+
+	int32 SpinCount = 0;
+	while (true)
+	{
+		if (TryExecuteOne())
+		{
+			SpinCount = 0;
+			continue;
+		}
+
+		if (++SpinCount < SpinCountBeforeSleep)
+		{
+			FPlatformMisc::CpuPause();
+			continue;
+		}
+		SpinCount = 0;
+
+		// 작업이 없으면 새 작업이 들어오거나 종료될 때까지 잠든다
+		std::unique_lock<std::mutex> Lock(WakeLock);
+		NumSleepingWorkers.fetch_add(1);
+		WakeCondition.wait(Lock, [this]()
+		{
+			return bIsShuttingDown.load() || NumQueuedTasks.load() > 0;
+		});
+		NumSleepingWorkers.fetch_sub(1);
+
+		if (bIsShuttingDown.load() && NumQueuedTasks.load() == 0)
+		{
+			break;
+		}
+	}
+
+	CurrentTaskGraph = nullptr;
+	CurrentWorkerIndex = -1;
+}
+
+void FTaskGraph::Enqueue(FGraphEventRef InTask)
+{
+	// 워커가 없으면 호출 스레드에서 바로 실행
+	if (!bIsInitialized)
+	{
+		Execute(InTask);
+		return;
+	}
+
+	FWorkerQueue& Queue = *Queues[GetCurrentQueueIndex()];
+	{
+		std::lock_guard<std::mutex> Lock(Queue.Lock);
+		Queue.Tasks.push_back(std::move(InTask));
+	}
+
+	// 잠든 워커가 있을 때만 깨운다 (NumQueuedTasks 증가 후 확인해야 깨우기 누락이 없음)
+	NumQueuedTasks.fetch_add(1);
+	if (NumSleepingWorkers.load() > 0)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(WakeLock);
+		}
+		WakeCondition.notify_one();
+	}
+}
+
+bool FTaskGraph::TryExecuteOne()
+{
+	if (!bIsInitialized || NumQueuedTasks.load(std::memory_order_relaxed) <= 0)
+	{
+		return false;
+	}
+
+	const int32 QueueIndex = GetCurrentQueueIndex();
+
+	FGraphEventRef Task = PopLocal(QueueIndex);
+	if (!Task && QueueIndex != NumWorkers)
+	{
+		// 워커라면 Injection Queue를 먼저 확인
+		FWorkerQueue& Injection = *Queues[NumWorkers];
+		std::lock_guard<std::mutex> Lock(Injection.Lock);
+		if (!Injection.Tasks.empty())
+		{
+			Task = std::move(Injection.Tasks.front());
+			Injection.Tasks.pop_front();
+		}
+	}
+
+	if (!Task)
+	{
+		Task = Steal(QueueIndex);
+	}
+
+	if (!Task)
+	{
+		return false;
+	}
+
+	NumQueuedTasks.fetch_sub(1);
+	Execute(Task);
+	return true;
+}
+
+/**
+ * @brief 자기 Deque에서 꺼내기
+ * 워커는 최근에 넣은 작업(뒤)을, Injection Queue는 먼저 들어온 작업(앞)을 꺼낸다
+ */
+FGraphEventRef FTaskGraph::PopLocal(int32 InQueueIndex)
+{
+	FWorkerQueue& Queue = *Queues[InQueueIndex];
+	std::lock_guard<std::mutex> Lock(Queue.Lock);
+	if (Queue.Tasks.empty())
+	{
+		return nullptr;
+	}
+
+	FGraphEventRef Task;
+	if (InQueueIndex == NumWorkers)
+	{
+		Task = std::move(Queue.Tasks.front());
+		Queue.Tasks.pop_front();
+	}
+	else
+	{
+		Task = std::move(Queue.Tasks.back());
+		Queue.Tasks.pop_back();
+	}
+	return Task;
+}
+
+/**
+ * @brief 다른 워커 Deque의 앞쪽(가장 오래된 작업)을 훔쳐온다
+ * 모든 도둑이 같은 워커에 몰리지 않도록 자신의 다음 인덱스부터 순회
+ */
+FGraphEventRef FTaskGraph::Steal(int32 InThiefIndex)
+{
+	for (int32 Offset = 1; Offset <= NumWorkers; ++Offset)
+	{
+		const int32 VictimIndex = (InThiefIndex + Offset) % (NumWorkers + 1);
+		if (VictimIndex == NumWorkers || VictimIndex == InThiefIndex)
+		{
+			continue;
+		}
+
+		FWorkerQueue& Victim = *Queues[VictimIndex];
+		std::unique_lock<std::mutex> Lock(Victim.Lock, std::try_to_lock);
+		if (!Lock.owns_lock() || Victim.Tasks.empty())
+		{
+			continue;
+		}
+
+		FGraphEventRef Task = std::move(Victim.Tasks.front());
+		Victim.Tasks.pop_front();
+		NumStolenTasks.fetch_add(1, std::memory_order_relaxed);
+		return Task;
+	}
+	return nullptr;
+}
+
+void FTaskGraph::Execute(const FGraphEventRef& InTask)
+{
+	if (InTask->Work)
+	{
+		InTask->Work();
+		InTask->Work = nullptr; // 캡처한 리소스를 바로 해제
+	}
+	NumExecutedTasks.fetch_add(1, std::memory_order_relaxed);
+
+	TArray<FGraphEventRef> Subsequents;
+	{
+		std::lock_guard<std::mutex> Lock(InTask->SubsequentsLock);
+		InTask->bIsCompleted.store(true, std::memory_order_release);
+		Subsequents.swap(InTask->Subsequents);
+	}
+
+	for (FGraphEventRef& Subsequent : Subsequents)
+	{
+		if (Subsequent->NumPendingPrerequisites.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			Enqueue(std::move(Subsequent));
+		}
+	}
+}
+
+int32 FTaskGraph::GetCurrentQueueIndex() const
+{
+	return IsWorkerThread() ? CurrentWorkerIndex : NumWorkers;
+}
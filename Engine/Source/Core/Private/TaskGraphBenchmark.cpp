@@ -0,0 +1,109 @@
+#include "pch.h"
+#include "Core/Public/TaskGraph.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	constexpr int32 NumEmptyTasks = 100000;
+	constexpr int32 NumParallelItems = 1 << 16;
+	constexpr int32 WorkPerItem = 256;
+
+	uint64 SimulateWork(int32 InSeed)
+	{
+		// 캐시에 의존하지 않는 순수 연산 부하
+		uint64 Hash = static_cast<uint64>(InSeed) * 0x9E3779B97F4A7C15ull;
+		for (int32 Iteration = 0; Iteration < WorkPerItem; ++Iteration)
+		{
+			Hash ^= Hash >> 33;
+			Hash *= 0xFF51AFD7ED558CCDull;
+		}
+		return Hash;
+	}
+
+	/**
+	 * @brief 빈 작업 N개의 Dispatch + Wait 비용 (작업당 스케줄링 오버헤드)
+	 */
+	double MeasureDispatchOverhead(FTaskGraph& InTaskGraph)
+	{
+		FGraphEventArray Events;
+		Events.reserve(NumEmptyTasks);
+
+		FScopeCycleCounter Counter;
+		for (int32 Index = 0; Index < NumEmptyTasks; ++Index)
+		{
+			Events.push_back(InTaskGraph.Dispatch([]() {}));
+		}
+		InTaskGraph.WaitAll(Events);
+		return Counter.Finish();
+	}
+
+	double MeasureParallelFor(FTaskGraph& InTaskGraph)
+	{
+		std::atomic<uint64> Result{ 0 };
+
+		FScopeCycleCounter Counter;
+		InTaskGraph.ParallelForRange(NumParallelItems, [&Result](int32 InBegin, int32 InEnd)
+		{
+			uint64 LocalResult = 0;
+			for (int32 Index = InBegin; Index < InEnd; ++Index)
+			{
+				LocalResult += SimulateWork(Index);
+			}
+			Result.fetch_add(LocalResult, std::memory_order_relaxed);
+		}, 64);
+		const double Milliseconds = Counter.Finish();
+
+		FBenchmarkRegistry::Consume(Result.load());
+		return Milliseconds;
+	}
+}
+
+/**
+ * @brief 스레드 수를 1 → 논리 코어 수까지 늘려가며 작업당 오버헤드와 ParallelFor 확장성을 측정
+ * 측정 중에는 전역 Task Graph를 재초기화하므로 다른 작업이 없는 상태에서 실행해야 한다
+ */
+IMPLEMENT_BENCHMARK(TaskGraph, "Task Graph 작업당 스케줄링 오버헤드 및 1~N 스레드 확장성")
+{
+	FTaskGraph& TaskGraph = FTaskGraph::GetInstance();
+	const bool bWasInitialized = TaskGraph.IsInitialized();
+	const int32 PreviousNumWorkers = TaskGraph.GetNumWorkers();
+	TaskGraph.Shutdown();
+
+	const int32 MaxThreads = FPlatformMisc::NumberOfCores();
+	TArray<int32> ThreadCounts;
+	for (int32 NumThreads = 1; NumThreads < MaxThreads; NumThreads *= 2)
+	{
+		ThreadCounts.push_back(NumThreads);
+	}
+	ThreadCounts.push_back(MaxThreads);
+
+	double SerialMilliseconds = 0.0;
+	UE_LOG("  Threads | Dispatch+Wait (ns/task) | ParallelFor %d items (ms) | Speedup", NumParallelItems);
+	for (int32 NumThreads : ThreadCounts)
+	{
+		TaskGraph.Initialize(NumThreads - 1);
+
+		// 워커 기동 비용을 제외하기 위한 예열
+		MeasureParallelFor(TaskGraph);
+
+		const double DispatchMilliseconds = MeasureDispatchOverhead(TaskGraph);
+		const double ParallelMilliseconds = MeasureParallelFor(TaskGraph);
+		if (NumThreads == 1)
+		{
+			SerialMilliseconds = ParallelMilliseconds;
+		}
+
+		UE_LOG("  %7d | %23.1f | %25.3f | %6.2fx",
+			NumThreads,
+			DispatchMilliseconds * 1.0e6 / NumEmptyTasks,
+			ParallelMilliseconds,
+			ParallelMilliseconds > 0.0 ? SerialMilliseconds / ParallelMilliseconds : 0.0);
+
+		TaskGraph.Shutdown();
+	}
+
+	if (bWasInitialized)
+	{
+		TaskGraph.Initialize(PreviousNumWorkers);
+	}
+}
@@ -4,15 +4,18 @@
 
 FWeakObjectPtr::FWeakObjectPtr()
     : InternalIndex(INDEX_NONE)
+    , SerialNumber(0)
 {
 }
 
 FWeakObjectPtr::FWeakObjectPtr(UObject* InObject)
     : InternalIndex(INDEX_NONE)
+    , SerialNumber(0)
 {
     if (InObject)
     {
         InternalIndex = InObject->GetInternalIndex();
+        SerialNumber = InObject->GetSerialNumber();
     }
 }
 
@@ -28,7 +31,12 @@ UObject* FWeakObjectPtr::Get() const
 
     if (InternalIndex < GUObjectArray.size())
     {
-        return GUObjectArray[InternalIndex];
+        // 슬롯이 비었거나 다른 객체가 재사용 중이면 원래 객체는 소멸한 것이다
+        UObject* Object = GUObjectArray[InternalIndex];
+        if (Object && Object->GetSerialNumber() == SerialNumber)
+        {
+            return Object;
+        }
     }
 
     return nullptr;
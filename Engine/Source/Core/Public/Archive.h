@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <type_traits>
 
 #include "Global/CoreTypes.h"
@@ -13,6 +14,16 @@ struct FArchive
 	virtual bool IsLoading() const = 0;
 	virtual void Serialize(void* V, size_t Length) = 0;
 
+	/**
+	 * @brief 로드 중 아직 읽지 않은 바이트 수 (알 수 없으면 SIZE_MAX)
+	 * 배열 길이가 남은 데이터보다 크면 손상된 파일로 보고 할당 전에 거부하는 데 사용한다
+	 */
+	virtual size_t GetRemainingBytes() const { return SIZE_MAX; }
+
+	/** @brief 읽기 실패나 잘못된 길이를 만난 적이 있는지 여부 */
+	bool IsError() const { return bIsError; }
+	void SetError() { bIsError = true; }
+
 	template<typename T, typename = std::enable_if_t<std::is_trivially_copyable_v<T>>>
 	FArchive& operator<<(T& Value)
 	{
@@ -28,6 +39,13 @@ struct FArchive
 
 		if (IsLoading())
 		{
+			// 원소는 최소 1바이트를 차지하므로 남은 바이트보다 긴 배열은 손상된 길이
+			if (IsError() || Length > GetRemainingBytes())
+			{
+				SetError();
+				Value.clear();
+				return *this;
+			}
 			Value.resize(Length);
 		}
 
@@ -39,6 +57,39 @@ struct FArchive
 		return *this;
 	}
 
+	/**
+	 * @brief 원소를 메모리 배치 그대로 한 번에 읽고 쓰는 배열 직렬화
+	 * 원소마다 operator<<를 호출하지 않으므로 정점, BVH 노드처럼 큰 Cooked 데이터에 사용한다
+	 * @note 포인터나 힙 메모리를 소유한 타입에는 사용할 수 없으며, 결과 파일은 같은 빌드의 구조체 배치에 의존한다
+	 */
+	template<typename T>
+	FArchive& SerializeBulk(TArray<T>& Value)
+	{
+		static_assert(std::is_standard_layout_v<T> && std::is_trivially_destructible_v<T>,
+			"SerializeBulk requires a flat element type");
+
+		size_t Length = Value.size();
+		*this << Length;
+
+		if (IsLoading())
+		{
+			if (IsError() || Length > GetRemainingBytes() / sizeof(T))
+			{
+				SetError();
+				Value.clear();
+				return *this;
+			}
+			Value.resize(Length);
+		}
+
+		if (Length > 0)
+		{
+			Serialize(Value.data(), Length * sizeof(T));
+		}
+
+		return *this;
+	}
+
 	FArchive& operator<<(FString& Value)
 	{
 		size_t Length = Value.size();
@@ -50,10 +101,19 @@ struct FArchive
 		}
 		else
 		{
+			if (IsError() || Length > GetRemainingBytes() / sizeof(FString::value_type))
+			{
+				SetError();
+				Value.clear();
+				return *this;
+			}
 			Value.resize(Length);
 			Serialize(Value.data(), Length * sizeof(FString::value_type));
 		}
 
 		return *this;
 	}
+
+private:
+	bool bIsError = false;
 };
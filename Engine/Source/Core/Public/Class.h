@@ -2,6 +2,7 @@
 #include "Name.h"
 
 class UObject;
+class FObjectPool;
 /**
  * @brief UClass Metadata System
  * Runtime에 컴파일 시에 다양한 클래스 정보를 제공하기 위해 만들어진 클래스
@@ -16,11 +17,22 @@ public:
     // 생성자 함수 포인터 타입 정의
     typedef UObject* (*ClassConstructorType)();
 public:
-    static void SignUpClass(UClass* InClass);
+    /** @brief 이름으로 클래스 검색 (해시 조회) */
     static UClass* FindClass(const FName& InClassName);
-    static TArray<UClass*> FindClasses(UClass* SuperClass);
+
+    /**
+     * @brief SuperClass 자신과 모든 하위 클래스 목록
+     * SuperClass별로 캐시해 두고 새 클래스가 등록될 때만 다시 만든다 (메인 스레드 전용)
+     */
+    static const TArray<UClass*>& FindClasses(UClass* SuperClass);
 private:
+    /** @brief 생성자에서 한 번만 호출 (StaticClass의 정적 지역 변수가 생성될 때) */
+    static void SignUpClass(UClass* InClass);
     static TArray<UClass*>& GetAllClasses();
+    static TMap<FName, UClass*>& GetClassMap();
+
+    // 클래스가 등록될 때마다 증가하며, 하위 클래스 캐시의 유효성 판단에 사용
+    static uint32 RegistryVersion;
     
 public:
     UClass(const FName& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor, bool InIsAbstract = false);
@@ -29,18 +41,55 @@ public:
     const FName& GetName() const { return ClassName; }
     UClass* GetSuperClass() const { return SuperClass; }
     size_t GetClassSize() const { return ClassSize; }
+    int32 GetClassDepth() const { return ClassDepth; }
     
-    bool IsChildOf(UClass* InClass) const;
+    /**
+     * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인 (같은 클래스 포함)
+     * 조상 배열에서 InClass의 깊이 위치만 비교하므로 상속 깊이와 관계없이 O(1)
+     */
+    bool IsChildOf(const UClass* InClass) const
+    {
+        return InClass
+            && InClass->ClassDepth <= ClassDepth
+            && ClassBaseChain[InClass->ClassDepth] == InClass;
+    }
+
     UObject* CreateDefaultObject() const;
 
     bool IsAbstract() const { return bIsAbstract; }
 
+    /**
+     * @brief 정확히 이 클래스인 살아 있는 객체 목록 (하위 클래스 객체 제외)
+     * 순서는 보장되지 않으며, 생성 직후의 객체는 UObject::FlushPendingClassRegistrations 이후에 포함된다
+     */
+    const TArray<UObject*>& GetClassObjects() const { return ClassObjects; }
+
+    /** @brief 이 클래스 객체용 슬랩 풀 (아직 NewObject로 생성된 적이 없으면 nullptr) */
+    const FObjectPool* GetObjectPool() const { return ObjectPool; }
+
 private:
+    friend class UObject;
+
     FName ClassName;
     UClass* SuperClass;
     size_t ClassSize;
     ClassConstructorType Constructor;
     bool bIsAbstract;
+
+    // UObject를 0으로 센 상속 깊이
+    int32 ClassDepth = 0;
+    // UObject부터 자신까지의 조상 클래스 (ClassBaseChain[ClassDepth] == this)
+    TArray<const UClass*> ClassBaseChain;
+
+    // FindClasses(this) 결과 캐시
+    TArray<UClass*> SubClassCache;
+    uint32 SubClassCacheVersion = 0;
+
+    // UObject가 등록/해제하는 객체 목록 (제거 시 마지막 원소와 교체)
+    TArray<UObject*> ClassObjects;
+
+    // UObject::operator new가 처음 사용할 때 생성하며, 종료 시점까지 남은 객체가 있을 수 있어 해제하지 않는다
+    FObjectPool* ObjectPool = nullptr;
 };
 
 /**
@@ -77,7 +126,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -86,7 +134,7 @@ UClass* ClassName::GetClass() const \
     } \
 UObject* ClassName::CreateDefaultObject##ClassName() \
     { \
-        return new ClassName(); \
+        return new (ClassName::StaticClass()) ClassName(); \
     } \
 static bool bIsRegistered_##ClassName = [](){ ClassName::StaticClass(); return true; }();
 
@@ -101,7 +149,6 @@ UClass* ClassName::StaticClass() \
         nullptr, \
         true \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -142,7 +189,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         nullptr /* 싱글톤은 동적 생성을 지원하지 않으므로 생성자 포인터를 null로 전달 */ \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -172,7 +218,6 @@ UClass* ClassName::StaticClass() \
         sizeof(ClassName), \
         &ClassName::CreateDefaultObject##ClassName \
     ); \
-    UClass::SignUpClass(&Instance); \
     return &Instance; \
 } \
 UClass* ClassName::GetClass() const \
@@ -181,6 +226,6 @@ UClass* ClassName::GetClass() const \
 } \
 UObject* ClassName::CreateDefaultObject##ClassName() \
 { \
-    return new ClassName(); \
+    return new (ClassName::StaticClass()) ClassName(); \
 }\
 static bool bIsRegistered_##ClassName = [](){ ClassName::StaticClass(); return true; }();
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+class UWorld;
+
+/**
+ * @brief Headless 실행 설정
+ * @var ScenePath 로드할 .Scene 파일 경로
+ * @var FrameCount Tick할 프레임 수
+ * @var FixedDeltaTime 프레임마다 사용할 고정 DeltaTime (초)
+ * @var BenchmarkName 실행할 벤치마크 이름 ("all"이면 전체), 비어 있으면 실행하지 않음
+ */
+struct FHeadlessConfig
+{
+	FString ScenePath;
+	int32 FrameCount = 600;
+	float FixedDeltaTime = 1.0f / 60.0f;
+	FString BenchmarkName;
+	// 비어 있지 않으면 종료 시 태그별 프레임 할당 보고서를 CSV로 저장
+	FString AllocationCSVPath;
+};
+
+/**
+ * @brief Headless Runtime Class
+ * 윈도우, 렌더러, UI 없이 Game World만 구동하여 게임플레이/물리/스크립트 부하를 측정한다
+ * .Scene 파일을 로드한 뒤 고정 DeltaTime으로 N 프레임을 Tick하고 서브시스템별 시간을 출력한다
+ *
+ * 사용법: -headless -scene=<경로> [-frames=N] [-dt=초] [-bench=<이름|all>]
+ */
+class FHeadlessApp
+{
+public:
+	static bool IsHeadlessCommandLine(const FString& InCommandLine);
+	static bool ParseCommandLine(const FString& InCommandLine, FHeadlessConfig& OutConfig);
+
+	int Run(const FString& InCommandLine);
+
+	// Special Member Function
+	FHeadlessApp();
+	~FHeadlessApp();
+
+private:
+	/**
+	 * @brief 서브시스템별 프레임 시간 누적치
+	 */
+	struct FSubsystemStat
+	{
+		double TotalMilliseconds = 0.0;
+		double MinMilliseconds = 0.0;
+		double MaxMilliseconds = 0.0;
+		uint32 SampleCount = 0;
+
+		void AddSample(double InMilliseconds);
+	};
+
+	bool InitializeSystem();
+	void MainLoop();
+	void PrintReport() const;
+	void ShutdownSystem();
+
+	FHeadlessConfig Config;
+	UWorld* World = nullptr;
+	TMap<FString, FSubsystemStat> SubsystemStats;
+	TArray<FString> SubsystemOrder;
+	uint64 TotalFrameHeapAllocations = 0;
+};
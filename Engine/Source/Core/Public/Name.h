@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 /**
  * @brief 오브젝트의 이름을 담당하는 구조체
  * 대소문자 관계 없는 비교 처리와 사용자가 직접 작성한 Display Name을 동시에 사용할 수 있음
@@ -20,6 +23,12 @@ public:
 	FString ToString() const;
 	FString ToBaseNameString() const;
 
+	/**
+	 * @brief 이름("Base_Number")을 OutString 뒤에 덧붙인다
+	 * 호출자가 버퍼를 재사용하면 매 호출마다 FString을 새로 만들지 않는다
+	 */
+	void AppendString(FString& OutString) const;
+
 	int32 GetComparisonIndex() const { return ComparisonIndex; }
 	int32 GetDisplayIndex() const { return DisplayIndex; }
 	int32 GetUniqueNumber() const { return Number; }
@@ -46,15 +55,38 @@ namespace std {
 			// ComparisonIndex와 Number를 기반으로 해시 값을 계산
 			size_t HashValue = std::hash<int32>{}(Name.GetComparisonIndex());
 			size_t NumberHash = std::hash<int32>{}(Name.GetUniqueNumber());
-            
+
 			HashValue ^= (NumberHash + 0x9e3779b9 + (HashValue << 6) + (HashValue >> 2));
-            
+
 			return HashValue;
 		}
 	};
 }
 
+/**
+ * @brief 이름 테이블에 저장된 문자열 하나 (표시용 철자 하나당 하나)
+ * 청크 Arena에 한 번 기록되면 옮겨지거나 해제되지 않으므로 포인터를 계속 들고 있어도 된다
+ */
+struct FNameEntry
+{
+	// 대소문자만 다른 철자 중 처음 등록된 Entry의 번호
+	int32 ComparisonIndex;
+	int32 Length;
+	// GetUniqueName이 이 철자로 다음에 붙일 번호
+	mutable std::atomic<int32> NextUniqueNumber;
+	// 널 종료 문자열 (실제로는 Length + 1 바이트)
+	char Data[1];
+
+	const char* GetData() const { return Data; }
+	int32 GetLength() const { return Length; }
+};
 
+/**
+ * @brief 전역 FName 문자열 테이블
+ * 대소문자 구분/무시 해시를 문자열 복사 없이 한 번에 계산하고, 해시 상위 비트로 고른 샤드의 개방 주소 테이블에서 찾는다
+ * 조회는 락 없이 원자적 슬롯 읽기만 하며, 추가는 해당 샤드의 락만 잡으므로 로더/워커 스레드에서도 FName을 만들 수 있다
+ * 테이블이 커질 때 이전 슬롯 배열은 읽는 중인 스레드를 위해 테이블 소멸 시까지 남겨 둔다
+ */
 class FNameTable
 {
 public:
@@ -63,18 +95,64 @@ public:
 public:
 	FNameTable();
 	~FNameTable();
+
+	FNameTable(const FNameTable&) = delete;
+	FNameTable& operator=(const FNameTable&) = delete;
+
+	/** @return ComparisonIndex, DisplayIndex */
 	TPair<int32, int32> FindOrAddName(const FString& Str);
+	TPair<int32, int32> FindOrAddName(const char* InString, int32 InLength);
 	FName GetUniqueName(const FString& BaseStr);
 
 	FString GetDisplayString(int32 Idx) const;
 
+	/** @return 잘못된 번호면 nullptr */
+	const FNameEntry* GetEntry(int32 InIndex) const;
+	int32 GetNumEntries() const { return NumEntries.load(std::memory_order_acquire); }
+
 private:
-	FString ToLower(const FString& Str) const;
+	static constexpr int32 NumShardBits = 4;
+	static constexpr int32 NumShards = 1 << NumShardBits;
+	static constexpr uint32 InitialSlotCapacity = 256;
+
+	static constexpr int32 EntryBlockBits = 14;
+	static constexpr int32 EntriesPerBlock = 1 << EntryBlockBits;
+	static constexpr int32 MaxEntryBlocks = 1024;
+	static constexpr size_t ArenaChunkSize = 64 * 1024;
+
+	/**
+	 * @brief 개방 주소 슬롯 배열
+	 * 슬롯 하나는 (32비트 해시 << 32) | (Entry 번호 + 1)이며 0은 빈 슬롯
+	 */
+	struct FSlotTable
+	{
+		explicit FSlotTable(uint32 InCapacity) : Slots(InCapacity) {}
+		TArray<std::atomic<uint64>> Slots;
+	};
 
-	TArray<FString> ComparisonStringPool;
-	TArray<FString> DisplayStringPool;
+	struct alignas(64) FShard
+	{
+		std::mutex WriteMutex;
+		std::atomic<FSlotTable*> DisplayTable{ nullptr };
+		std::atomic<FSlotTable*> ComparisonTable{ nullptr };
+		uint32 NumDisplaySlotsUsed = 0;
+		uint32 NumComparisonSlotsUsed = 0;
+		TArray<FSlotTable*> RetiredTables;
 
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-	TMap<FString, int32> NextNumberMap;
-};
\ No newline at end of file
+		// 이 샤드의 Entry를 담는 청크 Arena
+		TArray<uint8*> ArenaChunks;
+		uint8* ArenaCursor = nullptr;
+		uint8* ArenaEnd = nullptr;
+	};
+
+	template <bool bCaseSensitive>
+	int32 FindInTable(const FSlotTable* InTable, uint32 InHash, const char* InString, int32 InLength) const;
+	void InsertIntoTable(FShard& InShard, std::atomic<FSlotTable*>& InTable, uint32& InOutNumUsed, uint32 InHash, int32 InEntryIndex);
+	int32 AllocateEntry(FShard& InShard, const char* InString, int32 InLength, int32 InComparisonIndex);
+
+	FShard Shards[NumShards];
+
+	std::atomic<FNameEntry**> EntryBlocks[MaxEntryBlocks] = {};
+	std::atomic<int32> NumEntries{ 0 };
+	std::mutex EntryBlockMutex;
+};
@@ -12,7 +12,7 @@ template <typename T>
 T* NewObject(UObject* InOuter = nullptr)
 {
 	static_assert(is_base_of_v<UObject, T>, "생성할 클래스는 UObject를 반드시 상속 받아야 합니다");
-	T* NewObject = new T();
+	T* NewObject = new (T::StaticClass()) T();
 	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName().ToString()));
 	NewObject->SetOuter(InOuter);
 	return NewObject;
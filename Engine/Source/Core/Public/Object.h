@@ -16,6 +16,16 @@ public:
 	UObject();
 	virtual ~UObject();
 
+	/**
+	 * @brief InClass의 슬랩 풀에서 할당 (NewObject / CreateDefaultObject 경로)
+	 * 풀 슬롯 앞에 소속 풀을 기록해 두므로 어느 경로로 할당했든 delete 한 번으로 올바른 곳에 반환된다
+	 */
+	static void* operator new(size_t InSize, UClass* InClass);
+	/** @brief 클래스를 지정하지 않은 new는 기존처럼 힙에서 할당 */
+	static void* operator new(size_t InSize);
+	static void operator delete(void* InMemory) noexcept;
+	static void operator delete(void* InMemory, UClass* InClass) noexcept;
+
 	// 가상 함수 (인터페이스)
 	virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
 
@@ -32,6 +42,7 @@ public:
 	uint32 GetAllocatedCount() const { return AllocatedCounts; }
 	uint32 GetUUID() const { return UUID; }
 	uint32 GetInternalIndex() const { return InternalIndex; }
+	uint32 GetSerialNumber() const { return SerialNumber; }
 
 	FName GetName() { return Name; }
 	void SetName(const FName& InName) { Name = InName; }
@@ -43,6 +54,13 @@ public:
 	virtual UObject* Duplicate();
 	virtual UObject* DuplicateForEditor();
 
+	/**
+	 * @brief 생성 이후 아직 클래스별 객체 목록에 들어가지 않은 객체를 등록
+	 * 생성자 안에서는 GetClass()가 최종 클래스를 반환하지 않으므로 생성 시에는 대기 목록에만 넣고,
+	 * TObjectIterator가 순회를 시작할 때 이 함수로 한 번에 분류한다
+	 */
+	static void FlushPendingClassRegistrations();
+
 protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject);
 
@@ -56,13 +74,21 @@ private:
 	// Private 멤버 변수
 	uint32 UUID;
 	uint32 InternalIndex;
+	// 생성될 때마다 증가하는 번호, 재사용된 슬롯의 이전 객체와 구분하는 데 사용
+	uint32 SerialNumber;
 	FName Name;
 	UObject* Outer;
 	uint64 AllocatedBytes = 0;
 	uint32 AllocatedCounts = 0;
 
+	// 이 객체가 들어 있는 클래스별 객체 목록과 그 안의 위치
+	UClass* RegisteredClass = nullptr;
+	int32 ClassObjectIndex = -1;
+
 	// Private 멤버 함수
 	void PropagateMemoryChange(uint64 InBytesDelta, uint32 InCountDelta);
+	void RegisterToClassObjects();
+	void UnregisterFromClassObjects();
 };
 
 /**
@@ -193,4 +219,20 @@ bool IsValid(const UObject* InObject)
 	return InObject && IsA<T>(InObject);
 }
 
+/**
+ * @brief 살아 있는 UObject 슬롯 배열 (소멸한 객체의 슬롯은 nullptr이며 다음 생성 시 재사용)
+ * 슬롯은 재사용되므로 인덱스만으로 객체를 식별하지 말고 GetSerialNumber()를 함께 비교해야 한다
+ */
 TArray<UObject*>& GetUObjectArray();
+
+/**
+ * @brief UUID로 살아 있는 객체를 찾음 (FObjectUUIDIndex 해시 조회, 어느 스레드에서나 호출 가능)
+ * @return 없거나 이미 소멸한 UUID면 nullptr
+ */
+UObject* FindObjectByUUID(uint32 InUUID);
+
+template <typename T>
+T* FindObjectByUUID(uint32 InUUID)
+{
+	return Cast<T>(FindObjectByUUID(InUUID));
+}
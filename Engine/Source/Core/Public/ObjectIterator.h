@@ -1,13 +1,19 @@
 #pragma once
 
 #include "Core/Public/Object.h"
+
+/**
+ * @brief TObject와 그 하위 클래스의 살아 있는 객체만 순회하는 반복자
+ * 전체 GUObjectArray 대신 TObject 하위 클래스들의 클래스별 객체 목록을 차례로 훑으므로 비용은 해당 객체 수에 비례한다
+ * 순회 중 TObject 계열 객체를 생성/소멸하면 일부 객체를 건너뛸 수 있다
+ */
 template<typename TObject>
 class TObjectIterator
 {
 public:
-	TObjectIterator() : UObjectArray(GetUObjectArray())
+	TObjectIterator() : Classes(&UClass::FindClasses(TObject::StaticClass()))
 	{
-		CurrentIndex = 0;
+		UObject::FlushPendingClassRegistrations();
 		AdvanceToNextValidObject();
 	}
 
@@ -28,7 +34,7 @@ public:
 
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		++CurrentObjectIndex;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -53,19 +59,23 @@ private:
 	void AdvanceToNextValidObject()
 	{
 		CurrentObject = nullptr;
-		while (CurrentIndex < UObjectArray.size())
+		while (CurrentClassIndex < Classes->size())
 		{
-			UObject* Obj = UObjectArray[CurrentIndex];
-			if (Obj && Obj->IsA(TObject::StaticClass()))
+			const TArray<UObject*>& ClassObjects = (*Classes)[CurrentClassIndex]->GetClassObjects();
+			if (CurrentObjectIndex < ClassObjects.size())
 			{
-				CurrentObject = Cast<TObject>(Obj);
+				// 클래스 목록이 TObject의 하위 클래스뿐이므로 IsA 검사 없이 변환
+				CurrentObject = static_cast<TObject*>(ClassObjects[CurrentObjectIndex]);
 				return;
 			}
-			++CurrentIndex;
+
+			++CurrentClassIndex;
+			CurrentObjectIndex = 0;
 		}
 	}
 
-	int32 CurrentIndex;
+	const TArray<UClass*>* Classes;
+	size_t CurrentClassIndex = 0;
+	size_t CurrentObjectIndex = 0;
 	TObject* CurrentObject = nullptr;
-	TArray<UObject*>& UObjectArray;
 };
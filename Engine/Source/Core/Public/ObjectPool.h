@@ -0,0 +1,64 @@
+#pragma once
+
+class UClass;
+
+/**
+ * @brief UClass 하나의 객체를 위한 고정 크기 슬랩 풀
+ * 슬롯 크기는 GetClassSize()에서 정해지며, 64KB 슬랩을 앞에서부터 잘라 쓰고 해제된 슬롯은 침투형 Free List로 재사용한다
+ * 같은 클래스의 객체가 같은 슬랩에 모이므로 컴포넌트를 순회할 때 캐시 적중률이 높고, 생성/소멸을 반복해도 힙이 조각나지 않는다
+ * 슬랩은 풀이 살아 있는 동안 OS에 반환하지 않는다 (다음 생성에 재사용)
+ */
+class FObjectPool
+{
+public:
+	static constexpr size_t SlabSize = 64 * 1024;
+	static constexpr size_t MinSlotsPerSlab = 8;
+	static constexpr size_t SlotAlignment = 16;
+
+	/** @param InSlotSize 객체 하나에 필요한 크기 (SlotAlignment 배수로 올림) */
+	FObjectPool(const UClass* InClass, size_t InSlotSize);
+	~FObjectPool();
+
+	FObjectPool(const FObjectPool&) = delete;
+	FObjectPool& operator=(const FObjectPool&) = delete;
+
+	void* Allocate();
+	void Free(void* InSlot);
+
+	const UClass* GetClass() const { return OwnerClass; }
+	size_t GetSlotSize() const { return SlotSize; }
+	size_t GetSlotsPerSlab() const { return SlotsPerSlab; }
+	size_t GetNumSlabs() const { return Slabs.size(); }
+	size_t GetReservedBytes() const { return Slabs.size() * SlotsPerSlab * SlotSize; }
+	uint32 GetNumLiveSlots() const { return NumLiveSlots; }
+	uint32 GetPeakLiveSlots() const { return PeakLiveSlots; }
+	uint64 GetTotalAllocations() const { return TotalAllocations; }
+
+	/** @brief 생성된 모든 풀 (UClass별 하나) */
+	static const TArray<FObjectPool*>& GetAllPools();
+
+	/** @brief 풀별 슬롯 크기, 슬랩 수, 사용 중/최대 슬롯 수를 로그로 출력 */
+	static void LogStats();
+
+private:
+	struct FFreeSlot
+	{
+		FFreeSlot* Next;
+	};
+
+	static TArray<FObjectPool*>& GetMutablePools();
+
+	const UClass* OwnerClass;
+	size_t SlotSize;
+	size_t SlotsPerSlab;
+
+	TArray<uint8*> Slabs;
+	FFreeSlot* FreeList = nullptr;
+	// 마지막 슬랩에서 아직 한 번도 쓰지 않은 구간
+	uint8* BumpCursor = nullptr;
+	uint8* BumpEnd = nullptr;
+
+	uint32 NumLiveSlots = 0;
+	uint32 PeakLiveSlots = 0;
+	uint64 TotalAllocations = 0;
+};
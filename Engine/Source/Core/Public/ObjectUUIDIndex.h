@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+class UObject;
+
+/**
+ * @brief UUID -> UObject* 개방 주소(선형 탐사) 해시 인덱스
+ * UObject 생성자/소멸자에서 유지되며, 스크립트/에디터 도구/레벨 로드가 UUID로 객체를 찾을 때 전체 객체 배열을 훑지 않게 한다
+ * 조회는 락 없이 원자적 슬롯 읽기만 하고, 추가/제거만 락을 잡는다
+ * UUID는 재사용되지 않으므로 제거는 값만 비운 묘비(Tombstone)로 남기고, 묘비가 쌓이면 재해시할 때 정리한다
+ * 재해시로 교체된 이전 테이블은 진행 중인 조회가 없을 때 해제한다
+ */
+class FObjectUUIDIndex
+{
+public:
+	static FObjectUUIDIndex& GetInstance();
+
+	FObjectUUIDIndex();
+	~FObjectUUIDIndex();
+
+	FObjectUUIDIndex(const FObjectUUIDIndex&) = delete;
+	FObjectUUIDIndex& operator=(const FObjectUUIDIndex&) = delete;
+
+	void Add(UObject* InObject);
+	void Remove(const UObject* InObject);
+
+	/** @return 없거나 이미 소멸한 UUID면 nullptr */
+	UObject* Find(uint32 InUUID) const;
+
+	uint32 Num() const { return NumLiveObjects.load(std::memory_order_relaxed); }
+	uint32 GetCapacity() const { return Table.load(std::memory_order_relaxed)->Capacity; }
+
+private:
+	static constexpr uint32 InitialCapacity = 1024;
+	// 빈 슬롯 표시 (이 값의 UUID는 발급되기 전에 경고 후 인덱싱하지 않음)
+	static constexpr uint32 EmptyKey = 0xFFFFFFFFu;
+
+	struct FSlot
+	{
+		std::atomic<uint32> Key{ EmptyKey };
+		// nullptr이면 묘비 (해당 UUID의 객체가 소멸함)
+		std::atomic<UObject*> Object{ nullptr };
+	};
+
+	struct FSlotTable
+	{
+		explicit FSlotTable(uint32 InCapacity) : Slots(InCapacity), Capacity(InCapacity) {}
+		TArray<FSlot> Slots;
+		uint32 Capacity;
+	};
+
+	static uint32 HashUUID(uint32 InUUID, uint32 InCapacity);
+
+	void Rehash(uint32 InNewCapacity);
+	void ReleaseRetiredTables();
+
+	std::atomic<FSlotTable*> Table;
+	// 키가 기록된 슬롯 수 (묘비 포함), 락 안에서만 변경
+	uint32 NumUsedSlots = 0;
+	std::atomic<uint32> NumLiveObjects{ 0 };
+
+	mutable std::atomic<int32> NumActiveReaders{ 0 };
+	TArray<FSlotTable*> RetiredTables;
+	std::mutex WriteMutex;
+};
@@ -0,0 +1,127 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <memory>
+
+class FTaskGraph;
+
+/**
+ * @brief Task Graph에서 실행되는 작업 단위
+ * 선행 작업(Prerequisite)이 모두 끝나야 큐에 들어가며, 완료되면 대기 중인 후속 작업을 큐에 넣는다
+ * Dispatch가 반환하는 FGraphEventRef로 완료 여부를 조회하거나 다른 작업의 선행 조건으로 넘긴다
+ */
+class FGraphTask
+{
+public:
+	bool IsCompleted() const { return bIsCompleted.load(std::memory_order_acquire); }
+
+private:
+	friend class FTaskGraph;
+
+	TFunction<void()> Work;
+
+	// Dispatch 도중 완료되는 것을 막기 위해 1에서 시작하고, 등록이 끝나면 1 감소
+	std::atomic<int32> NumPendingPrerequisites{ 1 };
+	std::atomic<bool> bIsCompleted{ false };
+
+	std::mutex SubsequentsLock;
+	TArray<std::shared_ptr<FGraphTask>> Subsequents;
+};
+
+using FGraphEventRef = std::shared_ptr<FGraphTask>;
+using FGraphEventArray = TArray<FGraphEventRef>;
+
+/**
+ * @brief Work-Stealing Job System
+ * 워커마다 Deque를 두고 자신의 작업은 LIFO로 꺼내며, 비면 다른 워커의 앞쪽(FIFO)에서 훔쳐온다
+ * 워커가 아닌 스레드(Main)가 넣은 작업은 공용 Injection Queue로 들어간다
+ * Wait 중인 스레드는 잠들지 않고 큐의 작업을 대신 실행하므로 작업 안에서 Wait/ParallelFor를 중첩해도 교착되지 않는다
+ *
+ * 기본 워커 수는 (논리 코어 수 - 1)이며, Wait하는 Main Thread까지 포함해 모든 코어를 사용한다
+ */
+class FTaskGraph
+{
+public:
+	static FTaskGraph& GetInstance();
+
+	/**
+	 * @brief 워커 스레드 생성
+	 * @param InNumWorkers 워커 수, 음수면 (논리 코어 수 - 1). 0이면 호출 스레드에서만 실행
+	 */
+	void Initialize(int32 InNumWorkers = -1);
+	void Shutdown();
+
+	bool IsInitialized() const { return bIsInitialized; }
+	int32 GetNumWorkers() const { return NumWorkers; }
+	/** @brief Wait하는 호출 스레드를 포함한 동시 실행 스레드 수 */
+	int32 GetNumThreads() const { return NumWorkers + 1; }
+
+	/**
+	 * @brief 작업 등록
+	 * @param InWork 실행할 함수
+	 * @param InPrerequisites 모두 완료된 뒤에 InWork가 실행될 선행 작업 목록
+	 * @return 완료 대기 및 선행 조건 지정에 쓰는 핸들
+	 */
+	FGraphEventRef Dispatch(TFunction<void()> InWork, const FGraphEventArray& InPrerequisites = {});
+
+	/** @brief 작업이 끝날 때까지 다른 작업을 실행하며 대기 */
+	void Wait(const FGraphEventRef& InEvent);
+	void WaitAll(const FGraphEventArray& InEvents);
+
+	/**
+	 * @brief [0, InCount) 구간을 병렬 실행하고 모두 끝날 때까지 대기
+	 * @param InBody 인덱스 단위 함수
+	 * @param InMinBatchSize 한 번에 가져갈 최소 인덱스 개수 (작업이 가벼울수록 크게)
+	 */
+	void ParallelFor(int32 InCount, const TFunction<void(int32)>& InBody, int32 InMinBatchSize = 1);
+
+	/** @brief ParallelFor의 구간 버전, InBody(Begin, End)는 [Begin, End)를 처리 */
+	void ParallelForRange(int32 InCount, const TFunction<void(int32, int32)>& InBody, int32 InMinBatchSize = 1);
+
+	/** @brief 현재 스레드가 이 Task Graph의 워커인지 여부 */
+	bool IsWorkerThread() const;
+
+	uint64 GetNumExecutedTasks() const { return NumExecutedTasks.load(std::memory_order_relaxed); }
+	uint64 GetNumStolenTasks() const { return NumStolenTasks.load(std::memory_order_relaxed); }
+
+	// Special Member Function
+	FTaskGraph() = default;
+	~FTaskGraph();
+	FTaskGraph(const FTaskGraph&) = delete;
+	FTaskGraph& operator=(const FTaskGraph&) = delete;
+
+private:
+	struct FWorkerQueue
+	{
+		std::mutex Lock;
+		TDeque<FGraphEventRef> Tasks;
+	};
+
+	void WorkerMain(int32 InWorkerIndex);
+
+	void Enqueue(FGraphEventRef InTask);
+	bool TryExecuteOne();
+	FGraphEventRef PopLocal(int32 InQueueIndex);
+	FGraphEventRef Steal(int32 InThiefIndex);
+	void Execute(const FGraphEventRef& InTask);
+
+	int32 GetCurrentQueueIndex() const;
+
+	bool bIsInitialized = false;
+	int32 NumWorkers = 0;
+
+	TArray<std::thread> Workers;
+	// [0, NumWorkers): 워커 전용 Deque, [NumWorkers]: 외부 스레드용 Injection Queue
+	TArray<std::unique_ptr<FWorkerQueue>> Queues;
+
+	std::atomic<int32> NumQueuedTasks{ 0 };
+	std::atomic<int32> NumSleepingWorkers{ 0 };
+	std::atomic<bool> bIsShuttingDown{ false };
+	std::mutex WakeLock;
+	std::condition_variable WakeCondition;
+
+	std::atomic<uint64> NumExecutedTasks{ 0 };
+	std::atomic<uint64> NumStolenTasks{ 0 };
+};
@@ -10,10 +10,9 @@ constexpr uint32 INDEX_NONE = static_cast<uint32>(-1);
  * @class FWeakObjectPtr
  * @brief UObject의 소멸을 안전하게 감지하는 약한 포인터이다.
  *
- * 이 클래스는 UObject의 InternalIndex를 저장하여, GObjectArray를 통해
+ * 이 클래스는 UObject의 InternalIndex와 SerialNumber를 저장하여, GObjectArray를 통해
  * 해당 UObject가 여전히 유효한지(소멸되지 않았는지) 안전하게 검사한다.
- * @note 현재 구현은 UObject의 InternalIndex가 고유하며, GObjectArray의
- * 슬롯이 재사용되지 않음을 전제로 한다. (Stale Index 문제에 취약할 수 있음)
+ * 슬롯이 다른 객체에 재사용되어도 SerialNumber가 달라지므로 새 객체를 가리키지 않는다.
  */
 class FWeakObjectPtr
 {
@@ -66,6 +65,9 @@ public:
     bool operator!=(const UObject* InObject) const;
 
 private:
-    /** @brief GObjectArray 내 UObject의 고유 인덱스이다. */
+    /** @brief GObjectArray 내 UObject의 슬롯 인덱스이다. */
     uint32 InternalIndex;
+
+    /** @brief 가리키던 UObject의 일련번호이다. 슬롯의 현재 객체와 다르면 이미 소멸된 것이다. */
+    uint32 SerialNumber;
 };
\ No newline at end of file
@@ -19,26 +19,52 @@ struct FWindowsBinReader : public FArchive
 	FWindowsBinReader(const std::filesystem::path& FilePath)
 		: Stream(FilePath, std::ios::binary | std::ios::in)
 	{
-		if (!Stream)
+		std::error_code ErrorCode;
+		FileSize = static_cast<size_t>(std::filesystem::file_size(FilePath, ErrorCode));
+		if (!Stream || ErrorCode)
 		{
 			UE_LOG_ERROR("읽기용 파일을 여는데 실패했습니다: %s", FilePath.string().c_str());
 			//assert("읽기용 파일을 여는데 실패했습니다" && false);
+			FileSize = 0;
+			SetError();
 		}
 	}
 
 	bool IsLoading() const override { return true; }
 
+	size_t GetRemainingBytes() const override { return FileSize - Offset; }
+
+	/** @brief 지금까지의 모든 읽기가 성공했는지 여부 (잘리거나 손상된 캐시 파일 검출용) */
+	bool IsValid() const { return !IsError(); }
+
+	/**
+	 * @brief Length 바이트를 읽음
+	 * 한 번 실패한 뒤에는 파일을 더 읽지 않고 0으로 채워, 손상된 값으로 이어지는 읽기를 막는다
+	 */
 	void Serialize(void* V, size_t Length) override
 	{
+		if (IsError() || Length > GetRemainingBytes())
+		{
+			memset(V, 0, Length);
+			SetError();
+			return;
+		}
+
 		Stream.read(reinterpret_cast<char*>(V), Length);
 		if (!Stream)
 		{
 			UE_LOG_ERROR("파일 읽기를 실패했습니다.");
 			//assert("파일 읽기를 실패했습니다." && false);
+			memset(V, 0, Length);
+			SetError();
+			return;
 		}
+		Offset += Length;
 	}
 
 private:
 	std::ifstream Stream;
+	size_t FileSize = 0;
+	size_t Offset = 0;
 };
 
@@ -79,7 +79,7 @@ void UBatchLines::UpdateOctreeVertices(const FOctree* InOctree)
 	OctreeLines.clear();
 	if (InOctree)
 	{
-		TraverseOctree(InOctree);
+		TraverseOctree(InOctree, FOctree::RootNodeIndex);
 	}
 	bChangedVertices = true;
 }
@@ -234,19 +234,23 @@ void UBatchLines::UpdateConeVertices(const FVector& InCenter, float InGenerating
 }
 
 
-void UBatchLines::TraverseOctree(const FOctree* InNode)
+void UBatchLines::TraverseOctree(const FOctree* InOctree, int32 InNodeIndex)
 {
-	if (!InNode) { return; }
+	if (!InOctree) { return; }
+
+	// Loose 영역은 서로 겹쳐 알아보기 어려우므로 분할 셀을 그림
+	const FOctreeNode& Node = InOctree->GetNode(InNodeIndex);
+	const FAABB CellBounds = Node.GetCellBounds();
 
 	UBoundingVolumeLines BoxLines;
-	BoxLines.UpdateVertices(&InNode->GetBoundingVolume());
+	BoxLines.UpdateVertices(&CellBounds);
 	OctreeLines.push_back(BoxLines);
 
-	if (!InNode->IsLeafNode())
+	if (!Node.IsLeafNode())
 	{
-		for (const auto& Child : InNode->GetChildren())
+		for (int32 Child = Node.GetFirstChild(); Child < Node.GetFirstChild() + FOctree::NumChildren; ++Child)
 		{
-			TraverseOctree(Child);
+			TraverseOctree(InOctree, Child);
 		}
 	}
 }
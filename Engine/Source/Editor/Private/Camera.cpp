@@ -136,7 +136,7 @@ void UCamera::Update(const D3D11_VIEWPORT& InViewport)
     {
         ViewVolumeCuller.Cull(
             CurrentLevel->GetStaticOctree(),
-            CurrentLevel->GetDynamicPrimitives(),
+            CurrentLevel->GetDynamicTree(),
             CameraConstants
         );
     }
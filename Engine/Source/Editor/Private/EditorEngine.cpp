@@ -9,7 +9,6 @@
 
 IMPLEMENT_CLASS(UEditorEngine, UObject)
 UEditorEngine* GEditor = nullptr;
-UWorld* GWorld = nullptr;
 UEditorEngine::UEditorEngine()
 {
     GEditor = this;
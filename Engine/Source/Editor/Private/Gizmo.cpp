@@ -227,17 +227,18 @@ void UGizmo::CollectRotationAngleOverlay(FD2DOverlayManager& OverlayManager, UCa
 	const FCameraConstants& CamConst = InCamera->GetFViewProjConstants();
 	const FMatrix ViewProj = CamConst.View * CamConst.Projection;
 
-	FVector4 GizmoScreenPos4 = FVector4(GizmoLocation, 1.0f) * ViewProj;
-	FVector4 PointScreenPos4 = FVector4(PointOnCircle, 1.0f) * ViewProj;
+	// 두 점을 한 번에 투영 (X/Y/Z는 W로 나눈 NDC)
+	const FVector WorldPoints[2] = { GizmoLocation, PointOnCircle };
+	FVector4 NDCPoints[2];
+	ViewProj.ProjectPoints(WorldPoints, NDCPoints, 2);
 
+	const FVector4& GizmoScreenPos4 = NDCPoints[0];
+	const FVector4& PointScreenPos4 = NDCPoints[1];
 	if (GizmoScreenPos4.W <= 0.0f || PointScreenPos4.W <= 0.0f)
 	{
 		return;
 	}
 
-	GizmoScreenPos4 *= 1.0f / GizmoScreenPos4.W;
-	PointScreenPos4 *= 1.0f / PointScreenPos4.W;
-
 	// NDC -> 스크린 좌표
 	const FVector2 GizmoScreenPos(
 		(GizmoScreenPos4.X * 0.5f + 0.5f) * InViewport.Width + InViewport.TopLeftX,
@@ -289,15 +289,42 @@ bool UObjectPicker::IsRayPrimitiveCollided(UCamera* InActiveCamera, const FRay&
 		return false; //AABB와 충돌하지 않으면 false반환
 	}
 
-	// 2. 삼각형 단위로 정밀 충돌 체크
+	FRay ModelRay = GetModelRay(WorldRay, Primitive);
+
+	// 2. BVH가 있는 StaticMesh는 가장 가까운 교차만 찾는 순회로 처리
+	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
+	{
+		UStaticMesh* StaticMeshAsset = StaticMeshComp->GetStaticMesh();
+		FStaticMesh* StaticMesh = StaticMeshAsset ? StaticMeshAsset->GetStaticMeshAsset() : nullptr;
+		if (StaticMesh && !StaticMesh->BVH.IsEmpty())
+		{
+			// 모델 공간 t와 카메라 전방 거리는 선형 관계이므로 Near/Far 검사를 t 범위로 바꿔 순회 중 가지치기에 사용
+			const FVector4 ModelDirection(ModelRay.Direction.X, ModelRay.Direction.Y, ModelRay.Direction.Z, 0.0f);
+			const FVector4 WorldDirection = ModelDirection * ModelMatrix;
+			const float ForwardScale = WorldDirection.Dot3(InActiveCamera->GetForward());
+			if (ForwardScale <= 0.0f)
+			{
+				return false; // 카메라 뒤쪽으로 향하는 Ray
+			}
+
+			FBVHRayHit Hit;
+			if (!StaticMesh->BVH.RaycastClosest(ModelRay, InActiveCamera->GetNearZ() / ForwardScale, InActiveCamera->GetFarZ() / ForwardScale, Hit))
+			{
+				return false;
+			}
+
+			*ShortestDistance = std::min(*ShortestDistance, Hit.Distance * WorldDirection.Length());
+			return true;
+		}
+	}
+
+	// 3. 삼각형 단위로 정밀 충돌 체크
 	float Distance = D3D11_FLOAT32_MAX; //Distance 초기화
 	bool bIsHit = false;
-	
+
 	const TArray<FNormalVertex>* Vertices = Primitive->GetVerticesData();
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
-	FRay ModelRay = GetModelRay(WorldRay, Primitive);
-	
 	// 충돌 가능성 있는 삼각형 인덱스 수집
 	// Triangle Ordinal(인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호)로 반환
 	TArray<int32> CandidateTriangleIndices;
@@ -418,47 +445,15 @@ bool UObjectPicker::IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoi
  * 레이와 충돌하는 후보 노드들을 찾아 그 안의 프리미티브들을 OutCandidate에 담습니다.
  * @return 후보를 찾았으면 true, 못 찾았으면 false를 반환합니다.
  */
-bool UObjectPicker::FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
+bool UObjectPicker::FindCandidateFromOctree(const FOctree* Octree, int32 NodeIndex, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate)
 {
-	// 0. nullptr인지 검사.
-	if (!Node) { return false; }
-
-	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
-	if (CheckIntersectionRayBox(WorldRay, Node->GetBoundingVolume()) == false) { return false; }
-
-	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
-	const auto& CurrentNodePrimitives = Node->GetPrimitives();
-	if (!CurrentNodePrimitives.empty())
-	{
-		OutCandidate.insert(OutCandidate.end(), CurrentNodePrimitives.begin(), CurrentNodePrimitives.end());
-	}
-
-	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
-	if (!Node->IsLeafNode())
-	{
-		for (FOctree* Child : Node->GetChildren())
-		{
-			FindCandidateFromOctree(Child, WorldRay, OutCandidate);
-		}
-	}
-
-	return true;
+	if (!Octree) { return false; }
+	return Octree->QueryRay(WorldRay, OutCandidate, NodeIndex);
 }
 
 void UObjectPicker::GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateIndices)
 {
-	if (UStaticMeshComponent* StaticMeshComp = Cast<UStaticMeshComponent>(Primitive))
-	{
-		if (FStaticMesh* StaticMesh = StaticMeshComp->GetStaticMesh()->GetStaticMeshAsset())
-		{
-			if (StaticMesh->BVH.TraverseRay(ModelRay, OutCandidateIndices))
-            {
-				return;
-            }
-		}
-	}
-
-	// fallback: 전체 삼각형 인덱스 채우기
+	// BVH가 없는 프리미티브(StaticMesh 외)는 전체 삼각형 인덱스 채우기
 	const TArray<FNormalVertex>* Vertices = Primitive->GetVerticesData();
 	const TArray<uint32>* Indices = Primitive->GetIndicesData();
 
@@ -69,7 +69,7 @@ public:
 private:
 	void SetIndices();
 
-	void TraverseOctree(const FOctree* InNode);
+	void TraverseOctree(const FOctree* InOctree, int32 InNodeIndex);
 
 	/*void AddWorldGridVerticesAndConstData();
 	void AddBoundingBoxVertices();*/
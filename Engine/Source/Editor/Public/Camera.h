@@ -72,7 +72,7 @@ public:
 	float GetOrthoWidth() const { return OrthoWidth; }
 	float GetOrthoZoom() const { return OrthoZoom; }
 	ECameraType GetCameraType() const { return CameraType; }
-	ViewVolumeCuller& GetViewVolumeCuller() { return ViewVolumeCuller; }
+	::ViewVolumeCuller& GetViewVolumeCuller() { return ViewVolumeCuller; }
 
 	// Input enable for main editor camera (disable when hovering other viewports)
 	void SetInputEnabled(bool b) { bInputEnabled = b; }
@@ -116,7 +116,7 @@ private:
 	ECameraType CameraType = {};
 
 	// 절두체 컬링을 이용한 최적화
-	ViewVolumeCuller ViewVolumeCuller;
+	::ViewVolumeCuller ViewVolumeCuller;
 
 	// Whether this camera consumes input (movement/rotation). Only used by editor main camera.
 	bool bInputEnabled = true;
@@ -75,5 +75,3 @@ private:
 
 // UEditorEngine의 전역 인스턴스 포인터
 extern UEditorEngine* GEditor;
-// 현재 활성화된 UWorld 포인터
-extern UWorld* GWorld;
@@ -1,5 +1,7 @@
 #pragma once
+#ifndef IS_HEADLESS
 #include <d3d11.h>
+#endif
 #include "Global/Vector.h"
 
 struct FEditorPrimitive
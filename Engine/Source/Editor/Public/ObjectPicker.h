@@ -21,7 +21,7 @@ public:
 	void PickGizmo(UCamera* InActiveCamera, const FRay& WorldRay, UGizmo& Gizmo, FVector& CollisionPoint);
 	bool IsRayCollideWithPlane(const FRay& WorldRay, FVector PlanePoint, FVector Normal, FVector& PointOnPlane);
 
-	bool FindCandidateFromOctree(FOctree* Node, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate);
+	bool FindCandidateFromOctree(const FOctree* Octree, int32 NodeIndex, const FRay& WorldRay, TArray<UPrimitiveComponent*>& OutCandidate);
 
 private:
 	void GatherCandidateTriangles(UPrimitiveComponent* Primitive, const FRay& ModelRay, TArray<int32>& OutCandidateTriangleIndices);
@@ -3,380 +3,536 @@
 #include "Global/BVH.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Mesh/Public/StaticMesh.h"
+#include "Core/Public/TaskGraph.h"
+#include "Core/Public/Archive.h"
 
-FBVH::FBVH(FStaticMesh* InMesh)
-{
-	Build(InMesh);
-}
-
-const FNode& FBVH::GetNode(uint32 Index) const
-{
-	assert(Index < Nodes.size());
-	return Nodes[Index];
-}
-
-FNode& FBVH::GetNode(uint32 Index)
+namespace
 {
-	assert(Index < Nodes.size());
-	return Nodes[Index];
-}
-
-void FBVH::Clear()
-{
-	Mesh = nullptr;
-	Nodes.clear();
-	RootIndex = -1;
-	Cost = 0.0f;
-}
+	// SAH 분할 후보를 찾을 때 축마다 나누는 구간 수
+	constexpr int32 NumSAHBins = 16;
+	// Leaf 하나가 가질 수 있는 최대 삼각형 수 (이하일 때만 SAH 비용에 따라 Leaf로 남김)
+	constexpr int32 MaxLeafTriangles = 4;
+	// 삼각형 교차 비용 대비 노드 순회 비용
+	constexpr float TraversalCost = 1.0f;
+	// 병렬 구축으로 넘길 서브트리의 최소 삼각형 수 (이보다 작으면 Task 오버헤드가 더 큼)
+	constexpr int32 MinParallelSubtreeTriangles = 2048;
+
+	float GetAxisValue(const FVector& InVector, int32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
 
-int32 FBVH::InsertLeaf(int32 InTriangleBaseIndex)
-{
-	if(!Mesh)
+	void ExpandAABB(FAABB& InOutBox, const FAABB& InOther)
 	{
-		std::cerr << "FBVH::InsertLeaf: Mesh is null. Cannot insert leaf node." << std::endl;
-		return -1;
+		InOutBox.Min.X = std::min(InOutBox.Min.X, InOther.Min.X);
+		InOutBox.Min.Y = std::min(InOutBox.Min.Y, InOther.Min.Y);
+		InOutBox.Min.Z = std::min(InOutBox.Min.Z, InOther.Min.Z);
+		InOutBox.Max.X = std::max(InOutBox.Max.X, InOther.Max.X);
+		InOutBox.Max.Y = std::max(InOutBox.Max.Y, InOther.Max.Y);
+		InOutBox.Max.Z = std::max(InOutBox.Max.Z, InOther.Max.Z);
 	}
 
-	if(InTriangleBaseIndex < 0 || InTriangleBaseIndex + 2 >= Mesh->Indices.size() || InTriangleBaseIndex % 3 != 0)
+	void ExpandAABB(FAABB& InOutBox, const FVector& InPoint)
 	{
-		std::cerr << "FBVH::InsertLeaf: Invalid triangle base index." << std::endl;
-		return -1;
+		InOutBox.Min.X = std::min(InOutBox.Min.X, InPoint.X);
+		InOutBox.Min.Y = std::min(InOutBox.Min.Y, InPoint.Y);
+		InOutBox.Min.Z = std::min(InOutBox.Min.Z, InPoint.Z);
+		InOutBox.Max.X = std::max(InOutBox.Max.X, InPoint.X);
+		InOutBox.Max.Y = std::max(InOutBox.Max.Y, InPoint.Y);
+		InOutBox.Max.Z = std::max(InOutBox.Max.Z, InPoint.Z);
 	}
 
-	// 1. 새 Leaf node의 AABB 계산
-	FNormalVertex V0 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex]];
-	FNormalVertex V1 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex + 1]];
-	FNormalVertex V2 = Mesh->Vertices[Mesh->Indices[InTriangleBaseIndex + 2]];
-	FAABB LeafAABB = GetTriangleAABB(V0, V1, V2);
-
-	// 2. 새 Leaf node 생성
-	FNode NewNode;
-	NewNode.ObjectIndex = static_cast<int32>(Nodes.size());
-	NewNode.ParentIndex = -1; // Parent는 InsertInternalNode에서 설정
-	NewNode.Child1 = -1;
-	NewNode.Child2 = -1;
-	NewNode.bIsLeaf = true;
-	NewNode.Box = LeafAABB;
-	NewNode.TriangleBaseIndex = InTriangleBaseIndex;
-	// 빈 트리인 경우 새 노드를 루트로 설정하고 종료
-	if (NewNode.ObjectIndex == 0)
+	FAABB MakeEmptyAABB()
 	{
-		Nodes.push_back(NewNode);
-		RootIndex = 0;
-		Cost = GetCost(RootIndex);
-		return 0;
+		return FAABB(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
 	}
 
-	// 3. 새 Leaf node를 삽입할 최적의 sibling node 찾기;
-	int32 SiblingIndex = FindBestSibling(NewNode.Box);
+	/**
+	 * @brief 구축 중에만 쓰는 이진 트리 노드
+	 * TriangleCount가 0이면 내부 노드, 양수면 TriangleIndices[FirstTriangle, FirstTriangle + TriangleCount)를 가진 Leaf
+	 */
+	struct FBuildNode
+	{
+		FAABB Box;
+		int32 Child1 = -1;
+		int32 Child2 = -1;
+		int32 FirstTriangle = -1;
+		int32 TriangleCount = 0;
+	};
 
-	// 4. 새 leaf node와 sibling의 새로운 부모 node 생성
-	Nodes.push_back(NewNode);
-	InsertInternalNode(NewNode.ObjectIndex, SiblingIndex);
+	/**
+	 * @brief Top-down Binned SAH 구축기
+	 * 삼각형 AABB와 중심을 미리 계산해 두고, TriangleIndices의 [Begin, End) 구간을 제자리에서 분할하며 이진 트리를 만든다
+	 * 서로 겹치지 않는 구간은 독립적으로 구축할 수 있어 서브트리 단위 병렬 구축이 가능하다
+	 */
+	struct FBVHBuilder
+	{
+		/**
+		 * @brief 병렬 구축으로 미룬 서브트리
+		 * @var NodeIndex 서브트리 루트 자리를 예약해 둔 노드 인덱스
+		 */
+		struct FPendingSubtree
+		{
+			int32 NodeIndex = -1;
+			int32 Begin = 0;
+			int32 End = 0;
+			TArray<FBuildNode> Nodes;
+		};
+
+		TArray<FAABB> TriangleBounds;
+		TArray<FVector> TriangleCentroids;
+		TArray<int32> TriangleIndices;
+
+		// 이 크기 이하의 서브트리는 직접 만들지 않고 PendingSubtrees로 넘긴다 (0이면 모두 순차 구축)
+		int32 DeferSubtreeThreshold = 0;
+		TArray<FPendingSubtree> PendingSubtrees;
+
+		/**
+		 * @brief [Begin, End) 구간의 서브트리를 OutNodes 뒤에 구축
+		 * @return 서브트리 루트 노드 인덱스
+		 */
+		int32 BuildSubtree(TArray<FBuildNode>& OutNodes, int32 Begin, int32 End, bool bInCanDefer)
+		{
+			const int32 NodeIndex = static_cast<int32>(OutNodes.size());
+			OutNodes.emplace_back();
 
-	// 5. 새 node가 추가되었으므로 부모 거슬러올라가며 AABB 리피팅
-	// NewNode의 부모가 InsertInternalNode에서 설정했고, 부모의 AABB도 끝내둠.
-	// 리핏은 ParentIndex부터 시작
-	RefitAncestors(Nodes[SiblingIndex].ParentIndex);
+			FAABB NodeBox = MakeEmptyAABB();
+			FAABB CentroidBox = MakeEmptyAABB();
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				const int32 Triangle = TriangleIndices[Index];
+				ExpandAABB(NodeBox, TriangleBounds[Triangle]);
+				ExpandAABB(CentroidBox, TriangleCentroids[Triangle]);
+			}
 
-	return NewNode.ObjectIndex;
-}
+			FBuildNode& Node = OutNodes[NodeIndex];
+			Node.Box = NodeBox;
+			Node.FirstTriangle = Begin;
+			Node.TriangleCount = End - Begin;
 
-float FBVH::GetCost(int32 SubTreeRootIndex, bool bInternalOnly) const
-{
-	// 인덱스 벗어난 경우 0 반환
-	if (SubTreeRootIndex >= Nodes.size() || SubTreeRootIndex < 0)
-	{
-		return 0.0f;
-	}
+			const int32 Count = End - Begin;
+			if (bInCanDefer && Count <= DeferSubtreeThreshold)
+			{
+				FPendingSubtree Pending;
+				Pending.NodeIndex = NodeIndex;
+				Pending.Begin = Begin;
+				Pending.End = End;
+				PendingSubtrees.push_back(std::move(Pending));
+				return NodeIndex;
+			}
 
-	const FNode& SubTreeRoot = Nodes[SubTreeRootIndex];
-	if (SubTreeRoot.bIsLeaf)
-	{
-		// InternalOnly면 leaf node의 cost는 0으로 계산
-		// 새 노드 삽입시 최적 위치 계산하는 경우는 leaf node의 cost가 상수이기 때문
-		if (bInternalOnly)
-		{
-			return 0.0f;
+			const int32 Middle = Partition(Begin, End, NodeBox, CentroidBox);
+			if (Middle == Begin)
+			{
+				return NodeIndex;
+			}
+
+			// 자식을 만드는 동안 OutNodes가 재할당될 수 있으므로 참조를 다시 얻는다
+			const int32 Child1 = BuildSubtree(OutNodes, Begin, Middle, bInCanDefer);
+			const int32 Child2 = BuildSubtree(OutNodes, Middle, End, bInCanDefer);
+
+			FBuildNode& Internal = OutNodes[NodeIndex];
+			Internal.Child1 = Child1;
+			Internal.Child2 = Child2;
+			Internal.FirstTriangle = -1;
+			Internal.TriangleCount = 0;
+			return NodeIndex;
 		}
 
-		return SubTreeRoot.Box.GetSurfaceArea();
-	}
+		/**
+		 * @brief SAH 비용이 가장 낮은 Bin 경계로 구간을 분할
+		 * @return 오른쪽 자식의 시작 위치, Leaf로 남기는 편이 나으면 Begin
+		 */
+		int32 Partition(int32 Begin, int32 End, const FAABB& InNodeBox, const FAABB& InCentroidBox)
+		{
+			const int32 Count = End - Begin;
+			if (Count <= 1)
+			{
+				return Begin;
+			}
 
-	return SubTreeRoot.Box.GetSurfaceArea() + GetCost(SubTreeRoot.Child1, bInternalOnly) + GetCost(SubTreeRoot.Child2, bInternalOnly);
-}
+			struct FBin
+			{
+				FAABB Box = MakeEmptyAABB();
+				int32 Count = 0;
+			};
 
-int32 FBVH::FindBestSibling(const FAABB& NewLeafAABB)
-{
-	int32 BestSiblingIndex = -1;
-	float MinCostIncrease = FLT_MAX;
+			float BestCost = FLT_MAX;
+			int32 BestAxis = -1;
+			int32 BestBin = -1;
 
-	// Branch and Bound 최적화를 위한 스택 기반 순회
-	// 루트부터 시작하여 더 나은 후보가 있을 수 있는 노드들만 방문
-	TArray<int32> CandidateStack;
-	CandidateStack.push_back(RootIndex);
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float CentroidMin = GetAxisValue(InCentroidBox.Min, Axis);
+				const float Extent = GetAxisValue(InCentroidBox.Max, Axis) - CentroidMin;
+				if (Extent <= 0.0f)
+				{
+					continue;
+				}
 
-	while (!CandidateStack.empty())
-	{
-		int32 CurrentIndex = CandidateStack.back();
-		CandidateStack.pop_back();
+				FBin Bins[NumSAHBins];
+				const float BinScale = NumSAHBins * (1.0f - 1e-4f) / Extent;
+				for (int32 Index = Begin; Index < End; ++Index)
+				{
+					const int32 Triangle = TriangleIndices[Index];
+					const int32 BinIndex = std::min(NumSAHBins - 1,
+						static_cast<int32>((GetAxisValue(TriangleCentroids[Triangle], Axis) - CentroidMin) * BinScale));
+					ExpandAABB(Bins[BinIndex].Box, TriangleBounds[Triangle]);
+					++Bins[BinIndex].Count;
+				}
 
-		if (CurrentIndex < 0 || CurrentIndex >= static_cast<int32>(Nodes.size()))
-		{
-			continue;
-		}
+				// 오른쪽에서 누적한 면적/개수를 먼저 구하고, 왼쪽에서 누적하며 경계마다 비용 계산
+				float RightArea[NumSAHBins - 1];
+				int32 RightCount[NumSAHBins - 1];
+				FAABB RightBox = MakeEmptyAABB();
+				int32 RightAccumulated = 0;
+				for (int32 BinIndex = NumSAHBins - 1; BinIndex > 0; --BinIndex)
+				{
+					RightAccumulated += Bins[BinIndex].Count;
+					if (Bins[BinIndex].Count > 0)
+					{
+						ExpandAABB(RightBox, Bins[BinIndex].Box);
+					}
+					RightCount[BinIndex - 1] = RightAccumulated;
+					RightArea[BinIndex - 1] = RightAccumulated > 0 ? RightBox.GetSurfaceArea() : 0.0f;
+				}
 
-		const FNode& CurrentNode = Nodes[CurrentIndex];
-		FAABB CombinedAABB = Union(NewLeafAABB, CurrentNode.Box);
+				FAABB LeftBox = MakeEmptyAABB();
+				int32 LeftAccumulated = 0;
+				for (int32 BinIndex = 0; BinIndex < NumSAHBins - 1; ++BinIndex)
+				{
+					LeftAccumulated += Bins[BinIndex].Count;
+					if (Bins[BinIndex].Count > 0)
+					{
+						ExpandAABB(LeftBox, Bins[BinIndex].Box);
+					}
+
+					if (LeftAccumulated == 0 || RightCount[BinIndex] == 0)
+					{
+						continue;
+					}
+
+					const float SplitCost = LeftBox.GetSurfaceArea() * LeftAccumulated + RightArea[BinIndex] * RightCount[BinIndex];
+					if (SplitCost < BestCost)
+					{
+						BestCost = SplitCost;
+						BestAxis = Axis;
+						BestBin = BinIndex;
+					}
+				}
+			}
 
-		// 하한 비용 계산: 이 서브트리의 어떤 리프를 선택하더라도 최소한 발생하는 '증가' 비용
-		float DirectIncrease = CombinedAABB.GetSurfaceArea() - CurrentNode.Box.GetSurfaceArea();
-		float InheritedIncrease = 0.0f;
-		int32 AncestorIndex = CurrentNode.ParentIndex;
-		int32 CurrentChildIndex = CurrentIndex;
-		FAABB CurrentAABB = CombinedAABB;
-		while(AncestorIndex != -1)
-		{
-			const FNode& AncestorNode = Nodes[AncestorIndex];
-			int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
-				? AncestorNode.Child2
-				: AncestorNode.Child1;
-			const FNode& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex];
-
-			FAABB AncestorNewAABB = Union(SiblingOfCurrentChild.Box, CurrentAABB);
-			InheritedIncrease += AncestorNewAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
-			AncestorIndex = AncestorNode.ParentIndex;
-			CurrentChildIndex = AncestorNode.ObjectIndex;
-			CurrentAABB = AncestorNewAABB;
-		}
-		float LowerBoundIncrease = DirectIncrease + InheritedIncrease;
+			// 모든 중심이 한 점에 모인 경우: 작으면 Leaf, 크면 절반으로 나눈다
+			if (BestAxis < 0)
+			{
+				return Count <= MaxLeafTriangles ? Begin : Begin + Count / 2;
+			}
 
-		// 하한 비용이 현재 최적 증가 비용 이상이면 이 서브트리에서는 더 나은 해를 찾을 수 없으므로 탐색 중단
-		if (LowerBoundIncrease >= MinCostIncrease)
-		{
-			continue; // 조기 포기
-		}
+			const float NodeArea = InNodeBox.GetSurfaceArea();
+			const float NormalizedSplitCost = NodeArea > 0.0f
+				? TraversalCost + BestCost / NodeArea
+				: TraversalCost + static_cast<float>(Count);
+			if (Count <= MaxLeafTriangles && NormalizedSplitCost >= static_cast<float>(Count))
+			{
+				return Begin;
+			}
 
-		if (CurrentNode.bIsLeaf)
-		{
-			// 리프 노드인 경우: 전체 비용 증가 계산
-			float TotalCostIncrease = CalculateCostIncrease(CurrentIndex, NewLeafAABB);
+			const float CentroidMin = GetAxisValue(InCentroidBox.Min, BestAxis);
+			const float BinScale = NumSAHBins * (1.0f - 1e-4f) / (GetAxisValue(InCentroidBox.Max, BestAxis) - CentroidMin);
+			auto MiddleIt = std::partition(TriangleIndices.begin() + Begin, TriangleIndices.begin() + End,
+				[&](int32 InTriangle)
+				{
+					const int32 BinIndex = std::min(NumSAHBins - 1,
+						static_cast<int32>((GetAxisValue(TriangleCentroids[InTriangle], BestAxis) - CentroidMin) * BinScale));
+					return BinIndex <= BestBin;
+				});
 
-			if (TotalCostIncrease < MinCostIncrease)
+			const int32 Middle = static_cast<int32>(MiddleIt - TriangleIndices.begin());
+			if (Middle == Begin || Middle == End)
 			{
-				MinCostIncrease = TotalCostIncrease;
-				BestSiblingIndex = CurrentIndex;
+				return Begin + Count / 2;
 			}
+			return Middle;
 		}
-		else
+
+		/**
+		 * @brief 따로 구축한 서브트리를 예약해 둔 루트 자리와 OutNodes 끝에 이어 붙인다
+		 * 서브트리 로컬 인덱스 0은 예약 노드로, 나머지는 OutNodes 뒤쪽으로 옮겨지도록 인덱스를 다시 매긴다
+		 */
+		static void MergeSubtree(TArray<FBuildNode>& OutNodes, const FPendingSubtree& InSubtree)
 		{
-			// 내부 노드인 경우: 자식들을 스택에 추가
-			// 하지만 Lower Bound가 현재 최적해보다 좋을 때만
+			const int32 BaseIndex = static_cast<int32>(OutNodes.size());
+			auto Remap = [&](int32 InLocalIndex)
+			{
+				if (InLocalIndex < 0)
+				{
+					return -1;
+				}
+				return InLocalIndex == 0 ? InSubtree.NodeIndex : BaseIndex + InLocalIndex - 1;
+			};
 
-			if (LowerBoundIncrease < MinCostIncrease)
+			for (int32 LocalIndex = 0; LocalIndex < static_cast<int32>(InSubtree.Nodes.size()); ++LocalIndex)
 			{
-				// 자식 노드들을 후보에 추가
-				if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
+				FBuildNode Node = InSubtree.Nodes[LocalIndex];
+				Node.Child1 = Remap(Node.Child1);
+				Node.Child2 = Remap(Node.Child2);
+
+				if (LocalIndex == 0)
 				{
-					CandidateStack.push_back(CurrentNode.Child1);
+					OutNodes[InSubtree.NodeIndex] = Node;
 				}
-				if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
+				else
 				{
-					CandidateStack.push_back(CurrentNode.Child2);
+					OutNodes.push_back(Node);
 				}
 			}
-			// else: 이 서브트리는 더 이상 탐색하지 않음 (Bound)
 		}
-	}
-
-	return BestSiblingIndex;
+	};
 }
 
-float FBVH::CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const
+namespace
 {
-	if (CandidateIndex < 0 || CandidateIndex >= static_cast<int32>(Nodes.size()))
+	// 4-wide 트리 깊이가 이 값의 1/3 이하이면 순회 스택을 힙 할당 없이 사용
+	constexpr int32 InlineTraversalStackSize = 96;
+
+	void SetEmptySlot(FBVHNode& InOutNode, int32 InSlot)
 	{
-		return FLT_MAX;
+		InOutNode.MinX[InSlot] = InOutNode.MinY[InSlot] = InOutNode.MinZ[InSlot] = 0.0f;
+		InOutNode.MaxX[InSlot] = InOutNode.MaxY[InSlot] = InOutNode.MaxZ[InSlot] = 0.0f;
+		InOutNode.ChildIndex[InSlot] = -1;
+		InOutNode.ChildTriangleCount[InSlot] = -1;
 	}
 
-	const FNode& CandidateNode = Nodes[CandidateIndex];
-	const FAABB& SiblingAABB = CandidateNode.Box;
+	void SetSlotBounds(FBVHNode& InOutNode, int32 InSlot, const FAABB& InBox)
+	{
+		InOutNode.MinX[InSlot] = InBox.Min.X;
+		InOutNode.MinY[InSlot] = InBox.Min.Y;
+		InOutNode.MinZ[InSlot] = InBox.Min.Z;
+		InOutNode.MaxX[InSlot] = InBox.Max.X;
+		InOutNode.MaxY[InSlot] = InBox.Max.Y;
+		InOutNode.MaxZ[InSlot] = InBox.Max.Z;
+	}
 
-	// 새 리프와 sibling을 묶는 새 internal node의 AABB 계산
-	FAABB CombinedAABB = Union(NewLeafAABB, SiblingAABB);
+	/**
+	 * @brief 이진 트리의 내부 노드 하나를 4-wide 노드로 접는다
+	 * 자식 중 표면적이 가장 큰 내부 노드를 그 자식 둘로 펼치는 과정을 슬롯 4개가 찰 때까지 반복한다
+	 * 노드는 전위 순서로 배치되므로 자식 노드 인덱스는 항상 부모보다 크다
+	 * @return OutNodes에 추가된 노드 인덱스
+	 */
+	int32 CollapseNode(const TArray<FBuildNode>& InBuildNodes, int32 InBuildIndex, int32 InDepth,
+		TArray<FBVHNode>& OutNodes, int32& InOutMaxDepth)
+	{
+		InOutMaxDepth = std::max(InOutMaxDepth, InDepth);
 
-	// Cost 증가 계산: 새 internal node의 surface area
-	// (기존 sibling의 cost는 leaf이므로 변화 없음)
-	float CostIncrease = CombinedAABB.GetSurfaceArea();
+		int32 Slots[4];
+		int32 NumSlots = 0;
+		const FBuildNode& BuildNode = InBuildNodes[InBuildIndex];
+		if (BuildNode.TriangleCount > 0)
+		{
+			// 루트 자체가 Leaf인 작은 메시
+			Slots[NumSlots++] = InBuildIndex;
+		}
+		else
+		{
+			Slots[NumSlots++] = BuildNode.Child1;
+			Slots[NumSlots++] = BuildNode.Child2;
+		}
 
-	// Sibling이 가지고 있던 부모 노드가 있다면
-	// 부모부터 루트까지 올라가며 추가 cost 계산
-	int32 AncestorIndex = CandidateNode.ParentIndex;
-	int32 CurrentChildIndex = CandidateIndex;
-	FAABB CurrentAABB = CombinedAABB;
-	while (AncestorIndex != -1 && AncestorIndex < static_cast<int32>(Nodes.size()))
-	{
-		const FNode& AncestorNode = Nodes[AncestorIndex];
+		while (NumSlots < 4)
+		{
+			int32 ExpandSlot = -1;
+			float LargestArea = -1.0f;
+			for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+			{
+				const FBuildNode& Candidate = InBuildNodes[Slots[Slot]];
+				const float Area = Candidate.Box.GetSurfaceArea();
+				if (Candidate.TriangleCount == 0 && Area > LargestArea)
+				{
+					LargestArea = Area;
+					ExpandSlot = Slot;
+				}
+			}
+
+			if (ExpandSlot < 0)
+			{
+				break;
+			}
+
+			const FBuildNode& Expanded = InBuildNodes[Slots[ExpandSlot]];
+			Slots[ExpandSlot] = Expanded.Child1;
+			Slots[NumSlots++] = Expanded.Child2;
+		}
 
-		// 형제 노드의 AABB와 합쳐서 새로운 조상 AABB 계산
-		int32 SiblingOfCurrentChildIndex = (AncestorNode.Child1 == CurrentChildIndex)
-			? AncestorNode.Child2
-			: AncestorNode.Child1;
+		const int32 NodeIndex = static_cast<int32>(OutNodes.size());
+		OutNodes.emplace_back();
 
-		if (SiblingOfCurrentChildIndex >= 0 && SiblingOfCurrentChildIndex < static_cast<int32>(Nodes.size()))
+		for (int32 Slot = 0; Slot < 4; ++Slot)
 		{
-			const FAABB& SiblingOfCurrentChild = Nodes[SiblingOfCurrentChildIndex].Box;
-			FAABB NewAncestorAABB = Union(CurrentAABB, SiblingOfCurrentChild);
-			CostIncrease += NewAncestorAABB.GetSurfaceArea() - AncestorNode.Box.GetSurfaceArea();
-			CurrentAABB = NewAncestorAABB;
+			if (Slot >= NumSlots)
+			{
+				SetEmptySlot(OutNodes[NodeIndex], Slot);
+				continue;
+			}
+
+			const FBuildNode& Child = InBuildNodes[Slots[Slot]];
+			int32 ChildIndex = Child.FirstTriangle;
+			if (Child.TriangleCount == 0)
+			{
+				// 재귀 중 OutNodes가 재할당될 수 있으므로 결과는 재귀가 끝난 뒤 기록
+				ChildIndex = CollapseNode(InBuildNodes, Slots[Slot], InDepth + 1, OutNodes, InOutMaxDepth);
+			}
+
+			FBVHNode& Node = OutNodes[NodeIndex];
+			SetSlotBounds(Node, Slot, Child.Box);
+			Node.ChildIndex[Slot] = ChildIndex;
+			Node.ChildTriangleCount[Slot] = Child.TriangleCount;
 		}
-		
-		CurrentChildIndex = AncestorIndex;
-		AncestorIndex = AncestorNode.ParentIndex;
-	}
 
-	return CostIncrease;
-}
+		return NodeIndex;
+	}
 
-void FBVH::InsertInternalNode(int32 NewLeafIndex, int32 SiblingIndex)
-{
-	// 새 부모(Internal) 노드 구성
-	FNode NewParent;
-	int32 OldParentIndex = Nodes[SiblingIndex].ParentIndex;
-	NewParent.ParentIndex = OldParentIndex;
-	NewParent.Child1 = SiblingIndex;
-	NewParent.Child2 = NewLeafIndex;
-	NewParent.bIsLeaf = false;
-	NewParent.TriangleBaseIndex = -1; // Internal 노드는 삼각형 인덱스 없음
-
-	// 부모 AABB는 두 자식의 합집합
-	FAABB NewLeafAABB = Nodes[NewLeafIndex].Box;
-	FAABB SiblingAABB = Nodes[SiblingIndex].Box;
-	NewParent.Box = Union(NewLeafAABB, SiblingAABB);
-
-	// 새 부모 노드를 push하고 인덱스 확정
-	int32 NewParentIndex = static_cast<int32>(Nodes.size());
-	NewParent.ObjectIndex = NewParentIndex;
-	Nodes.push_back(NewParent);
-
-	// 자식들의 부모 갱신
-	Nodes[SiblingIndex].ParentIndex = NewParentIndex;
-	Nodes[NewLeafIndex].ParentIndex = NewParentIndex;
-
-	// 이전 부모가 있었다면 그 부모의 자식 포인터를 새 부모로 교체
-	if (OldParentIndex != -1)
+	/**
+	 * @brief Ray-삼각형 교차 검사
+	 * UObjectPicker::IsRayTriangleCollided와 같은 Cramer 공식과 판정 기준을 사용해 피킹 결과가 달라지지 않도록 한다
+	 */
+	bool IntersectTriangle(const FBVHTriangle& InTriangle,
+		float InOriginX, float InOriginY, float InOriginZ,
+		float InDirectionX, float InDirectionY, float InDirectionZ,
+		float& OutDistance)
 	{
-		FNode& OldParent = Nodes[OldParentIndex];
-		if (OldParent.Child1 == SiblingIndex)
+		const FVector& E1 = InTriangle.Edge1;
+		const FVector& E2 = InTriangle.Edge2;
+
+		// Direction x E2
+		const float CrossE2RayX = InDirectionY * E2.Z - InDirectionZ * E2.Y;
+		const float CrossE2RayY = InDirectionZ * E2.X - InDirectionX * E2.Z;
+		const float CrossE2RayZ = InDirectionX * E2.Y - InDirectionY * E2.X;
+
+		const float Determinant = E1.X * CrossE2RayX + E1.Y * CrossE2RayY + E1.Z * CrossE2RayZ;
+		if (std::fabs(Determinant) <= 0.0001f)
 		{
-			OldParent.Child1 = NewParentIndex;
+			return false;
 		}
-		else if (OldParent.Child2 == SiblingIndex)
+		const float InverseDeterminant = 1.0f / Determinant;
+
+		const float ResultX = InOriginX - InTriangle.Vertex0.X;
+		const float ResultY = InOriginY - InTriangle.Vertex0.Y;
+		const float ResultZ = InOriginZ - InTriangle.Vertex0.Z;
+
+		const float V = (ResultX * CrossE2RayX + ResultY * CrossE2RayY + ResultZ * CrossE2RayZ) * InverseDeterminant;
+		if (V < 0.0f || V > 1.0f)
 		{
-			OldParent.Child2 = NewParentIndex;
+			return false;
 		}
-		else
+
+		// Result x E1
+		const float CrossE1ResultX = ResultY * E1.Z - ResultZ * E1.Y;
+		const float CrossE1ResultY = ResultZ * E1.X - ResultX * E1.Z;
+		const float CrossE1ResultZ = ResultX * E1.Y - ResultY * E1.X;
+
+		const float U = (InDirectionX * CrossE1ResultX + InDirectionY * CrossE1ResultY + InDirectionZ * CrossE1ResultZ) * InverseDeterminant;
+		if (U < 0.0f || U + V > 1.0f)
 		{
-			// 혹시 모를 오류 (OldParent가 SiblingIndex를 자식으로 가지고 있지 않는 경우) 대비
-			throw std::runtime_error("OldParent does not reference SiblingIndex as a child.");
+			return false;
 		}
+
+		OutDistance = (E2.X * CrossE1ResultX + E2.Y * CrossE1ResultY + E2.Z * CrossE1ResultZ) * InverseDeterminant;
+		return true;
 	}
-	// sibling이 루트였던 경우, 새 부모가 루트가 됨
-	else
+
+	float GetSafeInverse(float InValue)
 	{
-		RootIndex = NewParentIndex;
+		// 축과 평행한 Ray도 Slab 검사에서 NaN 없이 처리되도록 0 대신 아주 작은 값으로 나눈다
+		constexpr float MinMagnitude = 1e-12f;
+		return 1.0f / (std::fabs(InValue) > MinMagnitude ? InValue : (InValue < 0.0f ? -MinMagnitude : MinMagnitude));
 	}
 }
 
-void FBVH::RefitAncestors(int32 RefitStartIndex)
+FBVH::FBVH(FStaticMesh* InMesh)
 {
-	// 시작점의 부모부터 루트까지 올라가며 InternalBox를 리핏
-	if (RefitStartIndex < 0 || RefitStartIndex >= static_cast<int32>(Nodes.size()))
-	{
-		return;
-	}
-
-	int32 CurrentIndex = Nodes[RefitStartIndex].ParentIndex; // 부모부터 시작
-	while (CurrentIndex != -1)
-	{
-		FNode& Current = Nodes[CurrentIndex];
-		// 두 자식의 AABB 합집합으로 현재 InternalBox 갱신
-		FAABB Child1AABB = Nodes[Current.Child1].Box;
-		FAABB Child2AABB = Nodes[Current.Child2].Box;
-		Current.Box = Union(Child1AABB, Child2AABB);
-
-		CurrentIndex = Current.ParentIndex;
-	}
+	Build(InMesh);
+}
 
-	// 전체 비용 갱신
-	Cost = GetCost(RootIndex);
+void FBVH::Clear()
+{
+	Nodes.clear();
+	Triangles.clear();
+	MaxDepth = 0;
+	Cost = 0.0f;
 }
 
 bool FBVH::CheckValidity() const
 {
-	// 1. 루트의 인덱스가 유효한지 확인
-	if ((RootIndex < 0 && !Nodes.empty()) || RootIndex >= static_cast<int32>(Nodes.size()))
+	// 1. 비어있는 트리의 경우 값이 정상적인지 확인
+	if (Nodes.empty())
 	{
-		return false;
+		return Triangles.empty() && MaxDepth == 0;
 	}
 
-	// 2. 비어있는 트리의 경우 값이 정상적인지 확인
-	if (Nodes.empty())
+	// 2. 각 노드의 자식 슬롯이 올바른 대상을 가리키는지 확인
+	// 자식은 항상 부모보다 뒤에 있으므로 앞에서부터 깊이를 전파하면 순회 스택 크기를 정하는 MaxDepth도 함께 검증된다
+	TArray<int32> NodeDepths(Nodes.size(), 0);
+	NodeDepths[0] = 1;
+	int64 NumLeafTriangles = 0;
+	for (int32 NodeIndex = 0; NodeIndex < static_cast<int32>(Nodes.size()); ++NodeIndex)
 	{
-		if (RootIndex != -1 || Cost != 0.0f)
+		const FBVHNode& Node = Nodes[NodeIndex];
+		if (NodeDepths[NodeIndex] == 0 || NodeDepths[NodeIndex] > MaxDepth) // 루트에서 닿지 않거나 MaxDepth보다 깊은 노드
 		{
 			return false;
 		}
-	}
-
-	// 3. 각 노드의 부모-자식 관계가 일관적인지 확인
-	for (int32 i = 0; i < static_cast<int32>(Nodes.size()); ++i)
-	{
-		const FNode& Node = Nodes[i];
-		if (Node.bIsLeaf) // Leaf node 인 경우 자식이 없어야 함
+		bool bHasEmptySlot = false;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
 		{
-			if (Node.Child1 != -1 || Node.Child2 != -1)
-			{
-				return false;
-			}
-			if (Node.TriangleBaseIndex < 0 || Node.TriangleBaseIndex % 3 != 0)
+			const int32 ChildIndex = Node.ChildIndex[Slot];
+			const int32 TriangleCount = Node.ChildTriangleCount[Slot];
+
+			if (TriangleCount < 0) // 빈 슬롯은 항상 뒤쪽에 모여 있어야 함
 			{
-				return false; // 리프 노드는 반드시 유효한 인덱스 배열의 인덱스를 가져야 함
+				if (ChildIndex != -1)
+				{
+					return false;
+				}
+				bHasEmptySlot = true;
+				continue;
 			}
-		}
-		else // Internal Node 인 경우 자식이 있어야 함
-		{
-			if (Node.Child1 == -1 || Node.Child2 == -1)
+			if (bHasEmptySlot)
 			{
 				return false;
 			}
-			if (Node.TriangleBaseIndex != -1)
-			{
-				return false; // 내부 노드는 인덱스를 가져선 안됨
-			}
-			// 자식 노드들이 올바른 부모 인덱스를 가리키는지 확인
-			if (Node.Child1 < 0 || Node.Child1 >= static_cast<int32>(Nodes.size()) ||
-				Node.Child2 < 0 || Node.Child2 >= static_cast<int32>(Nodes.size()))
+
+			if (TriangleCount == 0) // 내부 노드는 전위 순서이므로 항상 부모보다 뒤에 있어야 함
 			{
-				return false;
+				if (ChildIndex <= NodeIndex || ChildIndex >= static_cast<int32>(Nodes.size()))
+				{
+					return false;
+				}
+				NodeDepths[ChildIndex] = std::max(NodeDepths[ChildIndex], NodeDepths[NodeIndex] + 1);
 			}
-			const FNode& Child1 = Nodes[Node.Child1];
-			const FNode& Child2 = Nodes[Node.Child2];
-			if (Child1.ParentIndex != i || Child2.ParentIndex != i)
+			else // Leaf는 삼각형 배열의 유효한 구간을 가져야 함
 			{
-				return false;
+				if (ChildIndex < 0 || static_cast<int64>(ChildIndex) + TriangleCount > static_cast<int64>(Triangles.size()))
+				{
+					return false;
+				}
+				NumLeafTriangles += TriangleCount;
 			}
 		}
 
-		// 부모 인덱스가 유효한지 확인 (루트는 제외)
-		if (Node.ParentIndex != -1)
+		if (Node.ChildTriangleCount[0] < 0) // 자식이 하나도 없는 노드
 		{
-			if (Node.ParentIndex < 0 || Node.ParentIndex >= static_cast<int32>(Nodes.size()))
-			{
-				return false;
-			}
+			return false;
 		}
-		else if (i != RootIndex) // 루트가 아닌데 부모가 없는 경우
+	}
+
+	// 3. 모든 삼각형이 정확히 하나의 Leaf에 속하고 메시 삼각형 번호가 범위 안에 있는지 확인
+	if (NumLeafTriangles != static_cast<int64>(Triangles.size()))
+	{
+		return false;
+	}
+	for (const FBVHTriangle& Triangle : Triangles)
+	{
+		if (Triangle.TriangleIndex < 0 || Triangle.TriangleIndex >= static_cast<int32>(Triangles.size()))
 		{
 			return false;
 		}
@@ -384,6 +540,15 @@ bool FBVH::CheckValidity() const
 	return true;
 }
 
+FArchive& operator<<(FArchive& Ar, FBVH& BVH)
+{
+	Ar << BVH.MaxDepth;
+	Ar << BVH.Cost;
+	Ar.SerializeBulk(BVH.Nodes);
+	Ar.SerializeBulk(BVH.Triangles);
+	return Ar;
+}
+
 FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2)
 {
 	FVector Min{
@@ -399,59 +564,144 @@ FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FN
 	return FAABB(Min, Max);
 }
 
-bool FBVH::TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const
+bool FBVH::RaycastClosest(const FRay& Ray, float MinDistance, float MaxDistance, FBVHRayHit& OutHit) const
 {
-	OutTriangleIndices.clear();
-	
-	// 빈 트리이거나 루트가 유효하지 않은 경우
-	if (RootIndex < 0 || RootIndex >= static_cast<int32>(Nodes.size()))
+	OutHit = FBVHRayHit();
+
+	// 빈 트리이거나 거리 범위가 유효하지 않은 경우
+	if (Nodes.empty() || MinDistance > MaxDistance)
 	{
-		return false; // Traverse failed
+		return false;
 	}
-	
-	// 스택을 사용한 반복적 순회로 구현 (재귀보다 성능상 유리)
-	TArray<int32> NodeStack;
-	NodeStack.push_back(RootIndex);
-	
-	while (!NodeStack.empty())
+
+	const float OriginX = Ray.Origin.X;
+	const float OriginY = Ray.Origin.Y;
+	const float OriginZ = Ray.Origin.Z;
+	const float DirectionX = Ray.Direction.X;
+	const float DirectionY = Ray.Direction.Y;
+	const float DirectionZ = Ray.Direction.Z;
+
+	const __m128 OriginX4 = _mm_set1_ps(OriginX);
+	const __m128 OriginY4 = _mm_set1_ps(OriginY);
+	const __m128 OriginZ4 = _mm_set1_ps(OriginZ);
+	const __m128 InverseDirectionX4 = _mm_set1_ps(GetSafeInverse(DirectionX));
+	const __m128 InverseDirectionY4 = _mm_set1_ps(GetSafeInverse(DirectionY));
+	const __m128 InverseDirectionZ4 = _mm_set1_ps(GetSafeInverse(DirectionZ));
+	const __m128 MinDistance4 = _mm_set1_ps(MinDistance);
+	const __m128i EmptySlotCount4 = _mm_set1_epi32(-1);
+
+	float ClosestDistance = MaxDistance;
+	int32 ClosestTriangle = -1;
+
+	/**
+	 * @brief 순회 대기 항목
+	 * @var TriangleCount 0이면 Index는 노드, 양수면 Index부터 시작하는 Leaf 삼각형 구간
+	 * @var EntryDistance 부모에서 계산한 이 자식 AABB의 진입 거리 (꺼낼 때 현재 최단 거리와 비교해 건너뜀)
+	 */
+	struct FTraversalEntry
 	{
-		int32 CurrentNodeIndex = NodeStack.back();
-		NodeStack.pop_back();
-		
-		const FNode& CurrentNode = Nodes[CurrentNodeIndex];
-		
-		// Ray와 현재 노드의 AABB 교차 검사
-		if (!CheckIntersectionRayBox(Ray, CurrentNode.Box))
-		{
-			continue; // AABB와 교차하지 않으면 이 노드의 자식들도 건너뜀
-		}
-		
-		if (CurrentNode.bIsLeaf)
+		int32 Index;
+		int32 TriangleCount;
+		float EntryDistance;
+	};
+
+	// 노드 하나를 꺼낼 때마다 최대 4개를 넣으므로 깊이당 3개씩 늘어난다
+	FTraversalEntry InlineStack[InlineTraversalStackSize];
+	TArray<FTraversalEntry> HeapStack;
+	FTraversalEntry* Stack = InlineStack;
+	const int32 RequiredStackSize = MaxDepth * 3 + 1;
+	if (RequiredStackSize > InlineTraversalStackSize)
+	{
+		HeapStack.resize(RequiredStackSize);
+		Stack = HeapStack.data();
+	}
+
+	int32 StackSize = 0;
+	Stack[StackSize++] = { 0, 0, MinDistance };
+
+	while (StackSize > 0)
+	{
+		const FTraversalEntry Entry = Stack[--StackSize];
+		if (Entry.EntryDistance > ClosestDistance)
 		{
-			// 리프 노드인 경우 삼각형 인덱스 추가
-			// ------------------------------------------------------------------------------------
-			// 주의: BVH 내부에서는 삼각형 인덱스 = 인덱스 배열에서 삼각형을 이루는 첫 인덱스의 위치이지만(Index buffer offset),
-			// BVH 외부에서는 삼각형 인덱스 = 인덱스 버퍼를 3개 단위로 묶었을 때의 삼각형 번호를 의미하므로(Triangle ordinal)
-			// 의미 통일을 위해 외부 반환시 3으로 나누어 사용
-			// ------------------------------------------------------------------------------------
-			OutTriangleIndices.push_back(CurrentNode.TriangleBaseIndex / 3);
+			continue; // 이미 더 가까운 교차를 찾았으므로 건너뜀
 		}
-		else
+
+		if (Entry.TriangleCount > 0)
 		{
-			// 내부 노드인 경우 자식들을 스택에 추가
-			// 자식 인덱스가 유효한지 확인
-			if (CurrentNode.Child1 >= 0 && CurrentNode.Child1 < static_cast<int32>(Nodes.size()))
+			for (int32 Offset = 0; Offset < Entry.TriangleCount; ++Offset)
 			{
-				NodeStack.push_back(CurrentNode.Child1);
+				const FBVHTriangle& Triangle = Triangles[Entry.Index + Offset];
+				float Distance;
+				if (IntersectTriangle(Triangle, OriginX, OriginY, OriginZ, DirectionX, DirectionY, DirectionZ, Distance)
+					&& Distance >= MinDistance && Distance < ClosestDistance)
+				{
+					ClosestDistance = Distance;
+					ClosestTriangle = Triangle.TriangleIndex;
+				}
 			}
-			if (CurrentNode.Child2 >= 0 && CurrentNode.Child2 < static_cast<int32>(Nodes.size()))
+			continue;
+		}
+
+		// 자식 4개의 Slab 검사를 한 번에 수행
+		const FBVHNode& Node = Nodes[Entry.Index];
+		const __m128 MinXDistance = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinX), OriginX4), InverseDirectionX4);
+		const __m128 MaxXDistance = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxX), OriginX4), InverseDirectionX4);
+		const __m128 MinYDistance = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinY), OriginY4), InverseDirectionY4);
+		const __m128 MaxYDistance = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxY), OriginY4), InverseDirectionY4);
+		const __m128 MinZDistance = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MinZ), OriginZ4), InverseDirectionZ4);
+		const __m128 MaxZDistance = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.MaxZ), OriginZ4), InverseDirectionZ4);
+
+		const __m128 NearDistance4 = _mm_max_ps(
+			_mm_max_ps(_mm_min_ps(MinXDistance, MaxXDistance), _mm_min_ps(MinYDistance, MaxYDistance)),
+			_mm_max_ps(_mm_min_ps(MinZDistance, MaxZDistance), MinDistance4));
+		const __m128 FarDistance4 = _mm_min_ps(
+			_mm_min_ps(_mm_max_ps(MinXDistance, MaxXDistance), _mm_max_ps(MinYDistance, MaxYDistance)),
+			_mm_min_ps(_mm_max_ps(MinZDistance, MaxZDistance), _mm_set1_ps(ClosestDistance)));
+
+		const __m128i TriangleCount4 = _mm_load_si128(reinterpret_cast<const __m128i*>(Node.ChildTriangleCount));
+		const int32 ValidMask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(TriangleCount4, EmptySlotCount4)));
+		const int32 HitMask = _mm_movemask_ps(_mm_cmple_ps(NearDistance4, FarDistance4)) & ValidMask;
+		if (HitMask == 0)
+		{
+			continue;
+		}
+
+		alignas(16) float NearDistances[4];
+		_mm_store_ps(NearDistances, NearDistance4);
+
+		// 진입 거리가 먼 자식부터 쌓아 가장 가까운 자식이 먼저 꺼내지도록 정렬
+		int32 HitSlots[4];
+		int32 NumHitSlots = 0;
+		for (int32 Slot = 0; Slot < 4; ++Slot)
+		{
+			if (HitMask & (1 << Slot))
 			{
-				NodeStack.push_back(CurrentNode.Child2);
+				int32 InsertIndex = NumHitSlots++;
+				while (InsertIndex > 0 && NearDistances[HitSlots[InsertIndex - 1]] < NearDistances[Slot])
+				{
+					HitSlots[InsertIndex] = HitSlots[InsertIndex - 1];
+					--InsertIndex;
+				}
+				HitSlots[InsertIndex] = Slot;
 			}
 		}
+
+		for (int32 HitIndex = 0; HitIndex < NumHitSlots; ++HitIndex)
+		{
+			const int32 Slot = HitSlots[HitIndex];
+			Stack[StackSize++] = { Node.ChildIndex[Slot], Node.ChildTriangleCount[Slot], NearDistances[Slot] };
+		}
 	}
-	
-	return true; // Traverse successful
+
+	if (ClosestTriangle < 0)
+	{
+		return false;
+	}
+
+	OutHit.Distance = ClosestDistance;
+	OutHit.TriangleIndex = ClosestTriangle;
+	return true;
 }
 
 void FBVH::Build(FStaticMesh* InMesh)
@@ -462,20 +712,91 @@ void FBVH::Build(FStaticMesh* InMesh)
 		return;
 	}
 	Clear();
-	Mesh = InMesh;
-	// 모든 삼각형에 대해 Leaf 노드 삽입
-	int32 TriangleCount = static_cast<int32>(Mesh->Indices.size()) / 3;
-	for (int32 i = 0; i < TriangleCount; ++i)
+
+	const int32 TriangleCount = static_cast<int32>(InMesh->Indices.size()) / 3;
+	if (TriangleCount == 0)
+	{
+		return;
+	}
+
+	// 1. 삼각형별 AABB와 중심을 미리 계산
+	FBVHBuilder Builder;
+	Builder.TriangleBounds.resize(TriangleCount);
+	Builder.TriangleCentroids.resize(TriangleCount);
+	Builder.TriangleIndices.resize(TriangleCount);
+	for (int32 Triangle = 0; Triangle < TriangleCount; ++Triangle)
+	{
+		const int32 TriangleBaseIndex = Triangle * 3;
+		const FNormalVertex& V0 = InMesh->Vertices[InMesh->Indices[TriangleBaseIndex]];
+		const FNormalVertex& V1 = InMesh->Vertices[InMesh->Indices[TriangleBaseIndex + 1]];
+		const FNormalVertex& V2 = InMesh->Vertices[InMesh->Indices[TriangleBaseIndex + 2]];
+
+		Builder.TriangleBounds[Triangle] = GetTriangleAABB(V0, V1, V2);
+		Builder.TriangleCentroids[Triangle] = Builder.TriangleBounds[Triangle].GetCenter();
+		Builder.TriangleIndices[Triangle] = Triangle;
+	}
+
+	// 2. 상위 레벨을 분할하면서 스레드당 여러 개가 나오도록 충분히 작아진 서브트리는 병렬 구축으로 미룸
+	FTaskGraph& TaskGraph = FTaskGraph::GetInstance();
+	const bool bCanBuildInParallel = TaskGraph.IsInitialized() && TaskGraph.GetNumWorkers() > 0
+		&& TriangleCount >= MinParallelSubtreeTriangles * 2;
+	if (bCanBuildInParallel)
+	{
+		Builder.DeferSubtreeThreshold = std::max(MinParallelSubtreeTriangles, TriangleCount / (TaskGraph.GetNumThreads() * 8));
+	}
+
+	TArray<FBuildNode> BuildNodes;
+	BuildNodes.reserve(static_cast<size_t>(TriangleCount) * 2);
+	const int32 BuildRootIndex = Builder.BuildSubtree(BuildNodes, 0, TriangleCount, bCanBuildInParallel);
+
+	// 3. 미뤄둔 서브트리는 각자 로컬 노드 배열에 구축한 뒤 순서대로 합쳐 결과를 결정적으로 유지
+	if (!Builder.PendingSubtrees.empty())
+	{
+		TaskGraph.ParallelFor(static_cast<int32>(Builder.PendingSubtrees.size()), [&Builder](int32 InSubtreeIndex)
+		{
+			FBVHBuilder::FPendingSubtree& Subtree = Builder.PendingSubtrees[InSubtreeIndex];
+			Subtree.Nodes.reserve(static_cast<size_t>(Subtree.End - Subtree.Begin) * 2);
+			Builder.BuildSubtree(Subtree.Nodes, Subtree.Begin, Subtree.End, false);
+		});
+
+		for (const FBVHBuilder::FPendingSubtree& Subtree : Builder.PendingSubtrees)
+		{
+			FBVHBuilder::MergeSubtree(BuildNodes, Subtree);
+		}
+	}
+
+	// 병렬 구축 시 노드 배열 순서가 달라지므로 합산 순서에 덜 민감하도록 double로 누적
+	double TotalSurfaceArea = 0.0;
+	for (const FBuildNode& BuildNode : BuildNodes)
+	{
+		TotalSurfaceArea += BuildNode.Box.GetSurfaceArea();
+	}
+	Cost = static_cast<float>(TotalSurfaceArea);
+
+	// 4. Leaf 구간 순서대로 삼각형을 복사해 Leaf가 연속된 삼각형 구간을 가리키도록 함
+	Triangles.resize(TriangleCount);
+	for (int32 Index = 0; Index < TriangleCount; ++Index)
 	{
-		int32 TriangleBaseIndex = i * 3;
-		InsertLeaf(TriangleBaseIndex);
+		const int32 Triangle = Builder.TriangleIndices[Index];
+		const FVector& P0 = InMesh->Vertices[InMesh->Indices[Triangle * 3]].Position;
+		const FVector& P1 = InMesh->Vertices[InMesh->Indices[Triangle * 3 + 1]].Position;
+		const FVector& P2 = InMesh->Vertices[InMesh->Indices[Triangle * 3 + 2]].Position;
+
+		FBVHTriangle& Out = Triangles[Index];
+		Out.Vertex0 = P0;
+		Out.Edge1 = P1 - P0;
+		Out.Edge2 = P2 - P0;
+		Out.TriangleIndex = Triangle;
 	}
-	// 전체 비용 계산
-	Cost = GetCost(RootIndex);
+
+	// 5. 이진 트리를 4-wide 노드로 접어 평탄화
+	Nodes.reserve(BuildNodes.size() / 2 + 1);
+	CollapseNode(BuildNodes, BuildRootIndex, 1, Nodes, MaxDepth);
+	Nodes.shrink_to_fit();
+
 	// 유효성 검사
 	if (!CheckValidity())
 	{
 		std::cerr << "FBVH::Build: BVH structure is invalid after build." << std::endl;
 	}
 }
-
@@ -2,18 +2,46 @@
 #include "pch.h"
 #include "Physics/Public/AABB.h"
 
-class UPrimitiveComponent;
 struct FStaticMesh;
+struct FArchive;
 
-struct FNode
+/**
+ * @brief 4-wide BVH 노드
+ * 자식 4개의 AABB를 축별 배열(SoA)로 저장해 SSE 한 번으로 4개의 Slab 검사를 수행한다
+ * ChildTriangleCount가 0이면 ChildIndex는 내부 노드 인덱스, 양수면 Leaf로 FBVH 삼각형 배열의 시작 위치, -1이면 빈 슬롯
+ */
+struct alignas(16) FBVHNode
 {
-	int32 ObjectIndex;
-	int32 ParentIndex;
-	int32 Child1;
-	int32 Child2;
-	bool bIsLeaf;
-	FAABB Box;
-	int32 TriangleBaseIndex; // �ε��� ���ۿ��� �ﰢ���� ���� �ε���
+	float MinX[4];
+	float MinY[4];
+	float MinZ[4];
+	float MaxX[4];
+	float MaxY[4];
+	float MaxZ[4];
+	int32 ChildIndex[4];
+	int32 ChildTriangleCount[4];
+};
+
+/**
+ * @brief Leaf에 저장하는 삼각형 (교차 검사에 바로 쓰도록 한 꼭짓점과 두 변으로 저장)
+ * @var TriangleIndex 원본 인덱스 버퍼 기준 삼각형 번호 (인덱스 버퍼를 3개 단위로 묶었을 때의 순번)
+ */
+struct FBVHTriangle
+{
+	FVector Vertex0;
+	FVector Edge1;
+	FVector Edge2;
+	int32 TriangleIndex;
+};
+
+/**
+ * @brief RaycastClosest 결과
+ * @var Distance Ray 방향 벡터 길이 기준 교차 거리 (t)
+ */
+struct FBVHRayHit
+{
+	float Distance = FLT_MAX;
+	int32 TriangleIndex = -1;
 };
 
 //  Phase Picking에 사용되는 BVH (Bounding Volume Hierarchy)
@@ -23,20 +51,21 @@ public:
 	FBVH() = default;
 	explicit FBVH(FStaticMesh* InMesh);
 
+	/**
+	* @brief Top-down Binned SAH로 이진 트리를 구축한 뒤 4-wide 노드로 접어 평탄화.
+	* @note 상위 레벨은 순차로 분할하고, 충분히 작아진 서브트리는 FTaskGraph로 병렬 구축한 뒤 하나의 노드 배열로 합친다.
+	* 병렬 여부와 관계없이 같은 메시는 항상 같은 트리가 만들어진다.
+	*/
 	void Build(FStaticMesh* InMesh);
-	int32 GetRootIndex() const { return RootIndex; }
-	int32 GetNodeCount() const { return static_cast<int32>(Nodes.size()); }
-	const FNode& GetNode(uint32 Index) const;
-	FNode& GetNode(uint32 Index);
 	void Clear();
 
-	/**
-	* @brief 서브트리의 cost(노드가 가진 AABB의 표면적 합)을 계산.
-	* @param SubTreeRootIndex: cost 계산 시작 노드 인덱스
-	* @param bInternalOnly: true로 설정하면 leaf의 코스트는 포함 안시킴
-	* @return cost 값
-	*/
-	float GetCost(int32 SubTreeRootIndex, bool bInternalOnly = false) const;
+	bool IsEmpty() const { return Nodes.empty(); }
+	int32 GetNodeCount() const { return static_cast<int32>(Nodes.size()); }
+	int32 GetTriangleCount() const { return static_cast<int32>(Triangles.size()); }
+	int32 GetMaxDepth() const { return MaxDepth; }
+
+	/** @brief 구축 시 이진 트리의 SAH 비용(노드 AABB 표면적 합) */
+	float GetCost() const { return Cost; }
 
 	/**
 	* @brief: 트리의 유효성 검사.
@@ -44,42 +73,23 @@ public:
 	bool CheckValidity() const;
 
 	/**
-	* @brief: Ray와 BVH를 순회하여 교차하는 삼각형들의 인덱스 리스트를 반환
+	* @brief: Ray와 가장 가까운 삼각형 교차를 찾음
+	* @note 가까운 자식부터 방문하고, 지금까지 찾은 가장 가까운 거리보다 먼 노드는 건너뛴다
 	* @param Ray: 교차 검사를 수행할 Ray (Local 좌표계)
-	* @param OutTriangleIndices: 교차하는 삼각형들의 base index 리스트 (output)
-	* @return: 교차하는 삼각형이 있으면 true, 없으면 false
+	* @param MinDistance, MaxDistance: 유효한 교차 거리(t) 범위
+	* @param OutHit: 가장 가까운 교차 정보 (output)
+	* @return: 범위 안에서 교차하는 삼각형이 있으면 true
 	*/
-	bool TraverseRay(const FRay& Ray, TArray<int32>& OutTriangleIndices) const;
+	bool RaycastClosest(const FRay& Ray, float MinDistance, float MaxDistance, FBVHRayHit& OutHit) const;
 
-	/**
-	* @brief: 새 리프 노드를 특정 노드의 형제로 추가했을 때 전체 뉱업 트리의 비용 증가량 계산
-	* @param CandidateIndex: 후보 형제 노드 인덱스
-	* @param NewLeafAABB: 새로운 리프 노드의 AABB
-	* @return: 비용 증가량
-	*/
-	float CalculateCostIncrease(int32 CandidateIndex, const FAABB& NewLeafAABB) const;
+	/** @brief 평탄화된 노드와 삼각형 배열을 그대로 직렬화 (Cooked 메시 캐시용, 로드 후 재구축 불필요) */
+	friend FArchive& operator<<(FArchive& Ar, FBVH& BVH);
 
 private:
-	/**
-	* @brief 새로운 leaf node를 삽입.
-	* @note cost가 가장 낮아지는 최적의 sibling node를 찾아서 삽입되도록 함.
-	* @return 삽입된 leaf node의 인덱스, 실패 시 -1 반환
-	*/
-	int32 InsertLeaf(int32 InTriangleBaseIndex);
-
-	// --- 새 leaf node 삽입 과정 보조 메소드들 ---
-
-	//@brief 새로운 leaf node가 추가되었을 때 cost가 가장 조금 증가하는 sibling node 탐색.
-	int32 FindBestSibling(const FAABB& NewLeafAABB);
-	//@brief 새로운 leaf node와 기존 sibling node를 묶는 internal node를 생성하고 트리에 삽입.
-	void InsertInternalNode(int32 LeafIndex, int32 SiblingIndex);
-	//@brief 주어진 노드의 '부모'부터 루트까지 올라가며 AABB Refit 수행.
-	void RefitAncestors(int32 RefitStartIndex);
-
-	FStaticMesh* Mesh = nullptr; // BVH 원본 메시
-	TArray<FNode> Nodes;
-	int32 RootIndex = -1;
+	TArray<FBVHNode> Nodes; // 0번이 루트
+	TArray<FBVHTriangle> Triangles; // Leaf마다 연속 구간을 차지
+	int32 MaxDepth = 0; // 루트를 1로 센 4-wide 트리 깊이 (순회 스택 크기 결정에 사용)
 	float Cost = 0.0f;
 };
 
-FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
\ No newline at end of file
+FAABB GetTriangleAABB(const FNormalVertex& V0, const FNormalVertex& V1, const FNormalVertex& V2);
@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "Global/BVH.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Core/Public/TaskGraph.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	constexpr const char* BenchmarkMeshPath = "Data/CrowdSeat.obj";
+	constexpr int32 NumMeasuredBuilds = 10;
+}
+
+/**
+ * @brief CrowdSeat.obj의 Binned SAH BVH 구축 시간을 1 → 논리 코어 수 스레드로 측정
+ * 측정 중에는 전역 Task Graph를 바꾸므로 다른 작업이 없는 상태에서 실행해야 한다
+ */
+IMPLEMENT_BENCHMARK(BVHBuild, "CrowdSeat.obj Binned SAH BVH 구축 시간 1~N 스레드")
+{
+	FStaticMesh* StaticMesh = FObjManager::LoadObjStaticMeshAsset(FName(BenchmarkMeshPath));
+	if (!StaticMesh)
+	{
+		UE_LOG_ERROR("  %s 로드 실패", BenchmarkMeshPath);
+		return;
+	}
+
+	FTaskGraph& TaskGraph = FTaskGraph::GetInstance();
+	const bool bWasInitialized = TaskGraph.IsInitialized();
+	const int32 PreviousNumWorkers = TaskGraph.GetNumWorkers();
+
+	const int32 MaxThreads = FPlatformMisc::NumberOfCores();
+	TArray<int32> ThreadCounts;
+	for (int32 NumThreads = 1; NumThreads < MaxThreads; NumThreads *= 2)
+	{
+		ThreadCounts.push_back(NumThreads);
+	}
+	ThreadCounts.push_back(MaxThreads);
+
+	TaskGraph.Shutdown();
+
+	UE_LOG("  Triangles: %zu", StaticMesh->Indices.size() / 3);
+	UE_LOG("  Threads | Build (ms) | Nodes (4-wide) | SAH Cost");
+	for (int32 NumThreads : ThreadCounts)
+	{
+		TaskGraph.Initialize(NumThreads - 1);
+
+		FScopeCycleCounter Counter;
+		for (int32 Build = 0; Build < NumMeasuredBuilds; ++Build)
+		{
+			StaticMesh->BVH.Build(StaticMesh);
+		}
+		const double BuildMilliseconds = Counter.Finish() / NumMeasuredBuilds;
+
+		UE_LOG("  %7d | %10.3f | %14d | %.1f",
+			NumThreads,
+			BuildMilliseconds,
+			StaticMesh->BVH.GetNodeCount(),
+			StaticMesh->BVH.GetCost());
+
+		TaskGraph.Shutdown();
+	}
+
+	if (bWasInitialized)
+	{
+		TaskGraph.Initialize(PreviousNumWorkers);
+	}
+}
@@ -0,0 +1,187 @@
+#include "pch.h"
+#include "Global/BVH.h"
+#include "Component/Mesh/Public/StaticMesh.h"
+#include "Manager/Asset/Public/ObjManager.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr const char* BenchmarkMeshPaths[] = {
+		"Data/CrowdSeat.obj",
+		"Data/SignalLight.obj",
+		"Data/Track.obj",
+		"Data/Shapes/Sphere.obj"
+	};
+	constexpr int32 NumMeasuredRays = 1000000;
+	// 전체 삼각형 검사는 느리므로 앞쪽 일부 Ray만 결과 비교와 시간 측정에 사용
+	constexpr int32 NumVerifiedRays = 10000;
+
+	/**
+	 * @brief 메시 AABB 바깥의 구면에서 출발해 AABB 내부의 임의 점을 향하는 Ray 생성
+	 * 대부분의 Ray가 루트 AABB를 통과하므로 실제 피킹과 같이 트리 깊숙이 내려가는 경우를 측정한다
+	 */
+	void GenerateRays(const FStaticMesh& InMesh, int32 InNumRays, std::mt19937& InRandom, TArray<FRay>& OutRays)
+	{
+		FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+		FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (const FNormalVertex& Vertex : InMesh.Vertices)
+		{
+			Min.X = std::min(Min.X, Vertex.Position.X);
+			Min.Y = std::min(Min.Y, Vertex.Position.Y);
+			Min.Z = std::min(Min.Z, Vertex.Position.Z);
+			Max.X = std::max(Max.X, Vertex.Position.X);
+			Max.Y = std::max(Max.Y, Vertex.Position.Y);
+			Max.Z = std::max(Max.Z, Vertex.Position.Z);
+		}
+
+		const FVector Center = (Min + Max) * 0.5f;
+		const float OriginRadius = std::max((Max - Min).Length(), 0.001f);
+
+		std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+		std::normal_distribution<float> Normal(0.0f, 1.0f);
+
+		OutRays.resize(InNumRays);
+		for (FRay& Ray : OutRays)
+		{
+			FVector OriginDirection(Normal(InRandom), Normal(InRandom), Normal(InRandom));
+			OriginDirection.Normalize();
+			const FVector Origin = Center + OriginDirection * OriginRadius;
+			const FVector Target(
+				Min.X + (Max.X - Min.X) * Unit(InRandom),
+				Min.Y + (Max.Y - Min.Y) * Unit(InRandom),
+				Min.Z + (Max.Z - Min.Z) * Unit(InRandom));
+
+			FVector Direction = Target - Origin;
+			Direction.Normalize();
+			Ray.Origin = FVector4(Origin, 1.0f);
+			Ray.Direction = FVector4(Direction, 0.0f);
+		}
+	}
+
+	/** @brief 모든 삼각형을 검사해 가장 가까운 교차 거리를 구함 (UObjectPicker와 같은 Cramer 공식) */
+	bool RaycastBruteForce(const FStaticMesh& InMesh, const FRay& InRay, float& OutDistance)
+	{
+		const FVector Origin(InRay.Origin.X, InRay.Origin.Y, InRay.Origin.Z);
+		const FVector Direction(InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z);
+
+		bool bIsHit = false;
+		OutDistance = FLT_MAX;
+		for (size_t Index = 0; Index + 2 < InMesh.Indices.size(); Index += 3)
+		{
+			const FVector& P0 = InMesh.Vertices[InMesh.Indices[Index]].Position;
+			const FVector E1 = InMesh.Vertices[InMesh.Indices[Index + 1]].Position - P0;
+			const FVector E2 = InMesh.Vertices[InMesh.Indices[Index + 2]].Position - P0;
+
+			const FVector CrossE2Ray = Direction.Cross(E2);
+			const float Determinant = E1.Dot(CrossE2Ray);
+			if (std::fabs(Determinant) <= 0.0001f)
+			{
+				continue;
+			}
+
+			const FVector Result = Origin - P0;
+			const float V = Result.Dot(CrossE2Ray) / Determinant;
+			if (V < 0.0f || V > 1.0f)
+			{
+				continue;
+			}
+
+			const FVector CrossE1Result = Result.Cross(E1);
+			const float U = Direction.Dot(CrossE1Result) / Determinant;
+			if (U < 0.0f || U + V > 1.0f)
+			{
+				continue;
+			}
+
+			const float Distance = E2.Dot(CrossE1Result) / Determinant;
+			if (Distance >= 0.0f && Distance < OutDistance)
+			{
+				OutDistance = Distance;
+				bIsHit = true;
+			}
+		}
+		return bIsHit;
+	}
+}
+
+/**
+ * @brief 프로젝트에서 가장 큰 메시들에 대해 무작위 Ray 1M개의 BVH 최근접 교차 검사 시간 측정
+ * 앞쪽 10k개는 전체 삼각형 검사와 결과를 비교하고 시간도 함께 측정한다
+ */
+IMPLEMENT_BENCHMARK(BVHPicking, "대형 메시 무작위 Ray 1M개 BVH 최근접 교차 vs 전체 삼각형 검사")
+{
+	std::mt19937 Random(20251017);
+	TArray<FRay> Rays;
+
+	UE_LOG("  Mesh                   | Triangles | BVH (ms/1M) | Mrays/s | Brute Force (ms/10k) | Speedup | Hits    | Mismatches");
+	for (const char* MeshPath : BenchmarkMeshPaths)
+	{
+		FStaticMesh* StaticMesh = FObjManager::LoadObjStaticMeshAsset(FName(MeshPath));
+		if (!StaticMesh || StaticMesh->Indices.empty())
+		{
+			UE_LOG_ERROR("  %s 로드 실패", MeshPath);
+			continue;
+		}
+		if (StaticMesh->BVH.IsEmpty())
+		{
+			StaticMesh->BVH.Build(StaticMesh);
+		}
+
+		GenerateRays(*StaticMesh, NumMeasuredRays, Random, Rays);
+
+		int32 NumHits = 0;
+		FScopeCycleCounter BVHCounter;
+		for (const FRay& Ray : Rays)
+		{
+			FBVHRayHit Hit;
+			if (StaticMesh->BVH.RaycastClosest(Ray, 0.0f, FLT_MAX, Hit))
+			{
+				++NumHits;
+			}
+		}
+		const double BVHMilliseconds = BVHCounter.Finish();
+		FBenchmarkRegistry::Consume(NumHits);
+
+		// 결과 검증용 BVH 거리는 시간 측정 밖에서 따로 구함
+		TArray<float> BVHDistances(NumVerifiedRays, -1.0f);
+		for (int32 RayIndex = 0; RayIndex < NumVerifiedRays; ++RayIndex)
+		{
+			FBVHRayHit Hit;
+			if (StaticMesh->BVH.RaycastClosest(Rays[RayIndex], 0.0f, FLT_MAX, Hit))
+			{
+				BVHDistances[RayIndex] = Hit.Distance;
+			}
+		}
+
+		int32 NumMismatches = 0;
+		FScopeCycleCounter BruteForceCounter;
+		for (int32 RayIndex = 0; RayIndex < NumVerifiedRays; ++RayIndex)
+		{
+			float Distance;
+			const float ExpectedDistance = RaycastBruteForce(*StaticMesh, Rays[RayIndex], Distance) ? Distance : -1.0f;
+			if (std::fabs(ExpectedDistance - BVHDistances[RayIndex]) > 0.0001f * std::max(1.0f, std::fabs(ExpectedDistance)))
+			{
+				++NumMismatches;
+			}
+		}
+		const double BruteForceMilliseconds = BruteForceCounter.Finish();
+
+		const double BVHMillisecondsPer10k = BVHMilliseconds * NumVerifiedRays / NumMeasuredRays;
+		UE_LOG("  %-22s | %9zu | %11.2f | %7.2f | %20.2f | %6.0fx | %7d | %d",
+			MeshPath,
+			StaticMesh->Indices.size() / 3,
+			BVHMilliseconds,
+			BVHMilliseconds > 0.0 ? NumMeasuredRays / (BVHMilliseconds * 1000.0) : 0.0,
+			BruteForceMilliseconds,
+			BVHMillisecondsPer10k > 0.0 ? BruteForceMilliseconds / BVHMillisecondsPer10k : 0.0,
+			NumHits,
+			NumMismatches);
+
+		if (NumMismatches > 0)
+		{
+			UE_LOG_ERROR("  %s: BVH 결과가 전체 삼각형 검사와 %d개 Ray에서 다름", MeshPath, NumMismatches);
+		}
+	}
+}
@@ -77,32 +77,14 @@ struct FRenderState
 	EFillMode FillMode = EFillMode::Solid;
 };
 
-/**
- * @brief 변환 정보를 담는 구조체
- */
-struct FTransform
-{
-	FVector Location = FVector(0.0f, 0.0f, 0.0f);
-	FVector Rotation = FVector(0.0f, 0.0f, 0.0f);
-	FVector Scale = FVector(1.0f, 1.0f, 1.0f);
-
-	FTransform() = default;
-
-	FTransform(const FVector& InLocation, const FVector& InRotation = FVector::ZeroVector(),
-		const FVector& InScale = FVector::OneVector())
-		: Location(InLocation), Rotation(InRotation), Scale(InScale)
-	{
-	}
-};
-
 /**
  * @brief 2차원 좌표의 정보를 담는 구조체
  */
 struct FPoint
 {
-	INT X = 0;
-	INT Y = 0;
-	constexpr FPoint(LONG InX, LONG InY) : X(InX), Y(InY)
+	int32 X = 0;
+	int32 Y = 0;
+	constexpr FPoint(int32 InX, int32 InY) : X(InX), Y(InY)
 	{
 	}
 };
@@ -112,13 +94,13 @@ struct FPoint
  */
 struct FRect
 {
-	LONG Left = 0;
-	LONG Top = 0;
-	LONG Width = 0;
-	LONG Height = 0;
+	int32 Left = 0;
+	int32 Top = 0;
+	int32 Width = 0;
+	int32 Height = 0;
 
-	LONG GetRight() const { return Left + Width; }
-	LONG GetBottom() const { return Top + Height; }
+	int32 GetRight() const { return Left + Width; }
+	int32 GetBottom() const { return Top + Height; }
 };
 
 struct FAmbientLightInfo
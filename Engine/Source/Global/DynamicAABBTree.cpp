@@ -0,0 +1,554 @@
+#include "pch.h"
+#include "Global/DynamicAABBTree.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	/**
+	 * @brief 순회용 스택 (균형 트리 높이는 로그이므로 보통 고정 버퍼 안에서 끝나고, 넘치면 힙 사용)
+	 * 음수로 저장한 값(~Index)은 절두체에 완전히 포함된 서브트리를 뜻한다
+	 */
+	class FTraversalStack
+	{
+	public:
+		void Push(int32 InValue)
+		{
+			if (Count < InlineCapacity)
+			{
+				InlineBuffer[Count] = InValue;
+			}
+			else
+			{
+				Overflow.push_back(InValue);
+			}
+			++Count;
+		}
+
+		int32 Pop()
+		{
+			--Count;
+			if (Count < InlineCapacity)
+			{
+				return InlineBuffer[Count];
+			}
+			const int32 Value = Overflow.back();
+			Overflow.pop_back();
+			return Value;
+		}
+
+		bool IsEmpty() const { return Count == 0; }
+
+	private:
+		static constexpr int32 InlineCapacity = 64;
+		int32 InlineBuffer[InlineCapacity];
+		int32 Count = 0;
+		TArray<int32> Overflow;
+	};
+
+	FVector ComponentMin(const FVector& InA, const FVector& InB)
+	{
+		return FVector(std::min(InA.X, InB.X), std::min(InA.Y, InB.Y), std::min(InA.Z, InB.Z));
+	}
+
+	FVector ComponentMax(const FVector& InA, const FVector& InB)
+	{
+		return FVector(std::max(InA.X, InB.X), std::max(InA.Y, InB.Y), std::max(InA.Z, InB.Z));
+	}
+
+	float GetSurfaceArea(const FVector& InMin, const FVector& InMax)
+	{
+		const FVector Extent = InMax - InMin;
+		return 2.0f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+	}
+
+	bool IsOverlapped(const FVector& InMinA, const FVector& InMaxA, const FVector& InMinB, const FVector& InMaxB)
+	{
+		return InMinA.X <= InMaxB.X && InMaxA.X >= InMinB.X
+			&& InMinA.Y <= InMaxB.Y && InMaxA.Y >= InMinB.Y
+			&& InMinA.Z <= InMaxB.Z && InMaxA.Z >= InMinB.Z;
+	}
+
+	bool IsContained(const FVector& InInnerMin, const FVector& InInnerMax, const FVector& InOuterMin, const FVector& InOuterMax)
+	{
+		return InInnerMin.X >= InOuterMin.X && InInnerMax.X <= InOuterMax.X
+			&& InInnerMin.Y >= InOuterMin.Y && InInnerMax.Y <= InOuterMax.Y
+			&& InInnerMin.Z >= InOuterMin.Z && InInnerMax.Z <= InOuterMax.Z;
+	}
+}
+
+bool FDynamicAABBTree::Insert(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive || Contains(InPrimitive)) { return false; }
+
+	const int32 LeafIndex = AllocateNode();
+	FDynamicAABBTreeNode& Leaf = Nodes[LeafIndex];
+	Leaf.Primitive = InPrimitive;
+	Leaf.Height = 0;
+
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+	SetFatBounds(Leaf, Min, Max);
+
+	InsertLeaf(LeafIndex);
+	InPrimitive->DynamicTreeLeafIndex = LeafIndex;
+	++NumPrimitives;
+	return true;
+}
+
+bool FDynamicAABBTree::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (!Contains(InPrimitive)) { return false; }
+
+	const int32 LeafIndex = InPrimitive->DynamicTreeLeafIndex;
+	RemoveLeaf(LeafIndex);
+	FreeNode(LeafIndex);
+
+	InPrimitive->DynamicTreeLeafIndex = -1;
+	--NumPrimitives;
+	return true;
+}
+
+bool FDynamicAABBTree::Update(UPrimitiveComponent* InPrimitive)
+{
+	if (!Contains(InPrimitive)) { return false; }
+
+	const int32 LeafIndex = InPrimitive->DynamicTreeLeafIndex;
+	FVector Min, Max;
+	InPrimitive->GetWorldAABB(Min, Max);
+
+	// Fat AABB 안에서 움직였다면 트리는 그대로 유효
+	if (IsContained(Min, Max, Nodes[LeafIndex].Min, Nodes[LeafIndex].Max))
+	{
+		return false;
+	}
+
+	RemoveLeaf(LeafIndex);
+	SetFatBounds(Nodes[LeafIndex], Min, Max);
+	InsertLeaf(LeafIndex);
+	return true;
+}
+
+bool FDynamicAABBTree::Contains(const UPrimitiveComponent* InPrimitive) const
+{
+	if (!InPrimitive) { return false; }
+
+	const int32 LeafIndex = InPrimitive->DynamicTreeLeafIndex;
+	return LeafIndex >= 0 && LeafIndex < static_cast<int32>(Nodes.size())
+		&& Nodes[LeafIndex].Height == 0
+		&& Nodes[LeafIndex].Primitive == InPrimitive;
+}
+
+void FDynamicAABBTree::Clear()
+{
+	for (FDynamicAABBTreeNode& Node : Nodes)
+	{
+		if (Node.Height == 0 && Node.Primitive)
+		{
+			Node.Primitive->DynamicTreeLeafIndex = -1;
+		}
+	}
+
+	Nodes.clear();
+	RootIndex = -1;
+	FreeListIndex = -1;
+	NumPrimitives = 0;
+}
+
+void FDynamicAABBTree::QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex < 0) { return; }
+
+	FTraversalStack Stack;
+	Stack.Push(RootIndex);
+	while (!Stack.IsEmpty())
+	{
+		const int32 Value = Stack.Pop();
+
+		// 완전히 포함된 서브트리는 검사 없이 Leaf만 수집
+		if (Value < 0)
+		{
+			const FDynamicAABBTreeNode& Node = Nodes[~Value];
+			if (Node.IsLeaf())
+			{
+				if (Node.Primitive->IsVisible())
+				{
+					OutPrimitives.push_back(Node.Primitive);
+				}
+				continue;
+			}
+			Stack.Push(~Node.Child1);
+			Stack.Push(~Node.Child2);
+			continue;
+		}
+
+		const FDynamicAABBTreeNode& Node = Nodes[Value];
+		const EBoundCheckResult Result = InFrustum.CheckIntersection(Node.GetBounds());
+		if (Result == EBoundCheckResult::Outside)
+		{
+			continue;
+		}
+		if (Result == EBoundCheckResult::Inside)
+		{
+			Stack.Push(~Value);
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			// Fat AABB가 걸쳐 있으면 실제 AABB로 다시 검사
+			FVector Min, Max;
+			Node.Primitive->GetWorldAABB(Min, Max);
+			if (Node.Primitive->IsVisible() && InFrustum.CheckIntersection(FAABB(Min, Max)) != EBoundCheckResult::Outside)
+			{
+				OutPrimitives.push_back(Node.Primitive);
+			}
+			continue;
+		}
+		Stack.Push(Node.Child1);
+		Stack.Push(Node.Child2);
+	}
+}
+
+void FDynamicAABBTree::QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex < 0) { return; }
+
+	FTraversalStack Stack;
+	Stack.Push(RootIndex);
+	while (!Stack.IsEmpty())
+	{
+		const FDynamicAABBTreeNode& Node = Nodes[Stack.Pop()];
+		if (!CheckIntersectionRayBox(InRay, Node.GetBounds()))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			FVector Min, Max;
+			Node.Primitive->GetWorldAABB(Min, Max);
+			if (CheckIntersectionRayBox(InRay, FAABB(Min, Max)))
+			{
+				OutPrimitives.push_back(Node.Primitive);
+			}
+			continue;
+		}
+		Stack.Push(Node.Child1);
+		Stack.Push(Node.Child2);
+	}
+}
+
+void FDynamicAABBTree::QueryAABB(const FAABB& InBounds, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	if (RootIndex < 0) { return; }
+
+	FTraversalStack Stack;
+	Stack.Push(RootIndex);
+	while (!Stack.IsEmpty())
+	{
+		const FDynamicAABBTreeNode& Node = Nodes[Stack.Pop()];
+		if (!IsOverlapped(Node.Min, Node.Max, InBounds.Min, InBounds.Max))
+		{
+			continue;
+		}
+
+		if (Node.IsLeaf())
+		{
+			FVector Min, Max;
+			Node.Primitive->GetWorldAABB(Min, Max);
+			if (IsOverlapped(Min, Max, InBounds.Min, InBounds.Max))
+			{
+				OutPrimitives.push_back(Node.Primitive);
+			}
+			continue;
+		}
+		Stack.Push(Node.Child1);
+		Stack.Push(Node.Child2);
+	}
+}
+
+void FDynamicAABBTree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount,
+	TArray<std::pair<float, UPrimitiveComponent*>>& OutPrimitives) const
+{
+	if (RootIndex < 0 || MaxPrimitiveCount == 0) { return; }
+
+	// 노드는 AABB까지의 거리, 실제 중심 거리를 계산한 Leaf는 ~Index로 넣어 같은 큐에서 순서를 정함
+	std::priority_queue<std::pair<float, int32>, std::vector<std::pair<float, int32>>, std::greater<std::pair<float, int32>>> NodeQueue;
+	NodeQueue.push({ Nodes[RootIndex].GetBounds().GetDistanceSquaredToPoint(FindPos), RootIndex });
+
+	uint32 NumFound = 0;
+	while (!NodeQueue.empty() && NumFound < MaxPrimitiveCount)
+	{
+		const std::pair<float, int32> Entry = NodeQueue.top();
+		NodeQueue.pop();
+
+		if (Entry.second < 0)
+		{
+			OutPrimitives.push_back({ Entry.first, Nodes[~Entry.second].Primitive });
+			++NumFound;
+			continue;
+		}
+
+		const FDynamicAABBTreeNode& Node = Nodes[Entry.second];
+		if (Node.IsLeaf())
+		{
+			FVector Min, Max;
+			Node.Primitive->GetWorldAABB(Min, Max);
+			NodeQueue.push({ FAABB(Min, Max).GetCenterDistanceSquared(FindPos), ~Entry.second });
+			continue;
+		}
+		NodeQueue.push({ Nodes[Node.Child1].GetBounds().GetDistanceSquaredToPoint(FindPos), Node.Child1 });
+		NodeQueue.push({ Nodes[Node.Child2].GetBounds().GetDistanceSquaredToPoint(FindPos), Node.Child2 });
+	}
+}
+
+void FDynamicAABBTree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	OutPrimitives.reserve(OutPrimitives.size() + NumPrimitives);
+	for (const FDynamicAABBTreeNode& Node : Nodes)
+	{
+		if (Node.Height == 0)
+		{
+			OutPrimitives.push_back(Node.Primitive);
+		}
+	}
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+	int32 NodeIndex;
+	if (FreeListIndex >= 0)
+	{
+		NodeIndex = FreeListIndex;
+		FreeListIndex = Nodes[NodeIndex].Parent;
+	}
+	else
+	{
+		NodeIndex = static_cast<int32>(Nodes.size());
+		Nodes.emplace_back();
+	}
+
+	FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+	Node.Primitive = nullptr;
+	Node.Parent = -1;
+	Node.Child1 = -1;
+	Node.Child2 = -1;
+	Node.Height = 0;
+	return NodeIndex;
+}
+
+void FDynamicAABBTree::FreeNode(int32 InNodeIndex)
+{
+	FDynamicAABBTreeNode& Node = Nodes[InNodeIndex];
+	Node.Primitive = nullptr;
+	Node.Child1 = -1;
+	Node.Child2 = -1;
+	Node.Height = -1;
+	Node.Parent = FreeListIndex;
+	FreeListIndex = InNodeIndex;
+}
+
+void FDynamicAABBTree::SetFatBounds(FDynamicAABBTreeNode& OutLeaf, const FVector& InMin, const FVector& InMax)
+{
+	const FVector Size = InMax - InMin;
+	const FVector Margin(
+		MinFatMargin + Size.X * FatMarginRatio,
+		MinFatMargin + Size.Y * FatMarginRatio,
+		MinFatMargin + Size.Z * FatMarginRatio);
+
+	OutLeaf.Min = InMin - Margin;
+	OutLeaf.Max = InMax + Margin;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 InLeafIndex)
+{
+	if (RootIndex < 0)
+	{
+		RootIndex = InLeafIndex;
+		Nodes[InLeafIndex].Parent = -1;
+		return;
+	}
+
+	// 1. 표면적 비용(새 부모 노드 + 조상이 커지는 만큼)이 가장 작은 형제 노드를 찾음
+	const FVector LeafMin = Nodes[InLeafIndex].Min;
+	const FVector LeafMax = Nodes[InLeafIndex].Max;
+
+	int32 SiblingIndex = RootIndex;
+	while (!Nodes[SiblingIndex].IsLeaf())
+	{
+		const FDynamicAABBTreeNode& Node = Nodes[SiblingIndex];
+
+		const float Area = GetSurfaceArea(Node.Min, Node.Max);
+		const float CombinedArea = GetSurfaceArea(ComponentMin(Node.Min, LeafMin), ComponentMax(Node.Max, LeafMax));
+
+		// 여기서 형제로 삼는 비용과, 더 내려갈 때 이 노드가 커지며 생기는 비용
+		const float Cost = 2.0f * CombinedArea;
+		const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+		auto GetDescendCost = [&](int32 InChildIndex)
+		{
+			const FDynamicAABBTreeNode& Child = Nodes[InChildIndex];
+			const float ChildCombinedArea = GetSurfaceArea(ComponentMin(Child.Min, LeafMin), ComponentMax(Child.Max, LeafMax));
+			return Child.IsLeaf()
+				? ChildCombinedArea + InheritanceCost
+				: ChildCombinedArea - GetSurfaceArea(Child.Min, Child.Max) + InheritanceCost;
+		};
+
+		const float Cost1 = GetDescendCost(Node.Child1);
+		const float Cost2 = GetDescendCost(Node.Child2);
+		if (Cost < Cost1 && Cost < Cost2)
+		{
+			break;
+		}
+
+		SiblingIndex = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+	}
+
+	// 2. 형제 자리에 새 부모를 만들고 형제와 Leaf를 자식으로 연결 (AllocateNode가 배열을 늘릴 수 있으므로 참조를 미리 잡지 않음)
+	const int32 OldParentIndex = Nodes[SiblingIndex].Parent;
+	const int32 NewParentIndex = AllocateNode();
+	FDynamicAABBTreeNode& NewParent = Nodes[NewParentIndex];
+	NewParent.Parent = OldParentIndex;
+	NewParent.Min = ComponentMin(Nodes[SiblingIndex].Min, LeafMin);
+	NewParent.Max = ComponentMax(Nodes[SiblingIndex].Max, LeafMax);
+	NewParent.Height = Nodes[SiblingIndex].Height + 1;
+	NewParent.Child1 = SiblingIndex;
+	NewParent.Child2 = InLeafIndex;
+
+	if (OldParentIndex >= 0)
+	{
+		FDynamicAABBTreeNode& OldParent = Nodes[OldParentIndex];
+		(OldParent.Child1 == SiblingIndex ? OldParent.Child1 : OldParent.Child2) = NewParentIndex;
+	}
+	else
+	{
+		RootIndex = NewParentIndex;
+	}
+	Nodes[SiblingIndex].Parent = NewParentIndex;
+	Nodes[InLeafIndex].Parent = NewParentIndex;
+
+	// 3. 위로 올라가며 AABB와 높이를 갱신
+	RefitAncestors(Nodes[InLeafIndex].Parent);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 InLeafIndex)
+{
+	if (InLeafIndex == RootIndex)
+	{
+		RootIndex = -1;
+		return;
+	}
+
+	// 부모를 없애고 형제를 조부모에 직접 연결
+	const int32 ParentIndex = Nodes[InLeafIndex].Parent;
+	const int32 GrandParentIndex = Nodes[ParentIndex].Parent;
+	const int32 SiblingIndex = Nodes[ParentIndex].Child1 == InLeafIndex ? Nodes[ParentIndex].Child2 : Nodes[ParentIndex].Child1;
+
+	Nodes[SiblingIndex].Parent = GrandParentIndex;
+	FreeNode(ParentIndex);
+	Nodes[InLeafIndex].Parent = -1;
+
+	if (GrandParentIndex >= 0)
+	{
+		FDynamicAABBTreeNode& GrandParent = Nodes[GrandParentIndex];
+		(GrandParent.Child1 == ParentIndex ? GrandParent.Child1 : GrandParent.Child2) = SiblingIndex;
+		RefitAncestors(GrandParentIndex);
+	}
+	else
+	{
+		RootIndex = SiblingIndex;
+	}
+}
+
+void FDynamicAABBTree::RefitAncestors(int32 InNodeIndex)
+{
+	int32 NodeIndex = InNodeIndex;
+	while (NodeIndex >= 0)
+	{
+		NodeIndex = Balance(NodeIndex);
+
+		FDynamicAABBTreeNode& Node = Nodes[NodeIndex];
+		const FDynamicAABBTreeNode& Child1 = Nodes[Node.Child1];
+		const FDynamicAABBTreeNode& Child2 = Nodes[Node.Child2];
+		Node.Height = 1 + std::max(Child1.Height, Child2.Height);
+		Node.Min = ComponentMin(Child1.Min, Child2.Min);
+		Node.Max = ComponentMax(Child1.Max, Child2.Max);
+
+		NodeIndex = Node.Parent;
+	}
+}
+
+int32 FDynamicAABBTree::Balance(int32 InNodeIndex)
+{
+	const int32 IndexA = InNodeIndex;
+	FDynamicAABBTreeNode& A = Nodes[IndexA];
+	if (A.IsLeaf() || A.Height < 2)
+	{
+		return IndexA;
+	}
+
+	const int32 IndexB = A.Child1;
+	const int32 IndexC = A.Child2;
+	FDynamicAABBTreeNode& B = Nodes[IndexB];
+	FDynamicAABBTreeNode& C = Nodes[IndexC];
+	const int32 HeightDifference = C.Height - B.Height;
+
+	// 높은 쪽 자식(Pivot)을 A 자리로 올리고, Pivot의 자식 중 낮은 쪽을 A에 넘김
+	auto Rotate = [this, IndexA, &A](int32 InPivotIndex, int32& OutASlot, const FDynamicAABBTreeNode& InOtherChild)
+	{
+		FDynamicAABBTreeNode& Pivot = Nodes[InPivotIndex];
+		const int32 IndexF = Pivot.Child1;
+		const int32 IndexG = Pivot.Child2;
+		FDynamicAABBTreeNode& F = Nodes[IndexF];
+		FDynamicAABBTreeNode& G = Nodes[IndexG];
+
+		Pivot.Child1 = IndexA;
+		Pivot.Parent = A.Parent;
+		A.Parent = InPivotIndex;
+
+		if (Pivot.Parent >= 0)
+		{
+			FDynamicAABBTreeNode& Parent = Nodes[Pivot.Parent];
+			(Parent.Child1 == IndexA ? Parent.Child1 : Parent.Child2) = InPivotIndex;
+		}
+		else
+		{
+			RootIndex = InPivotIndex;
+		}
+
+		const bool bIsFTaller = F.Height > G.Height;
+		const int32 IndexTaller = bIsFTaller ? IndexF : IndexG;
+		const int32 IndexShorter = bIsFTaller ? IndexG : IndexF;
+		FDynamicAABBTreeNode& Taller = Nodes[IndexTaller];
+		FDynamicAABBTreeNode& Shorter = Nodes[IndexShorter];
+
+		Pivot.Child2 = IndexTaller;
+		OutASlot = IndexShorter;
+		Shorter.Parent = IndexA;
+
+		A.Min = ComponentMin(InOtherChild.Min, Shorter.Min);
+		A.Max = ComponentMax(InOtherChild.Max, Shorter.Max);
+		A.Height = 1 + std::max(InOtherChild.Height, Shorter.Height);
+
+		Pivot.Min = ComponentMin(A.Min, Taller.Min);
+		Pivot.Max = ComponentMax(A.Max, Taller.Max);
+		Pivot.Height = 1 + std::max(A.Height, Taller.Height);
+	};
+
+	// C가 높으면 C를 올리고 A.Child2를 교체
+	if (HeightDifference > 1)
+	{
+		Rotate(IndexC, A.Child2, B);
+		return IndexC;
+	}
+
+	// B가 높으면 B를 올리고 A.Child1을 교체
+	if (HeightDifference < -1)
+	{
+		Rotate(IndexB, A.Child1, C);
+		return IndexB;
+	}
+
+	return IndexA;
+}
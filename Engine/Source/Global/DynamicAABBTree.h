@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Physics/Public/AABB.h"
+
+class UPrimitiveComponent;
+struct FFrustum;
+
+/**
+ * @brief FDynamicAABBTree 노드
+ * Leaf는 프리미티브 하나를 여유 공간을 더한(Fat) AABB로 감싸고, 내부 노드는 두 자식을 감싼다
+ * @var Parent 사용 중이 아닌 노드에서는 Free List의 다음 노드
+ * @var Height Leaf는 0, 빈 노드는 -1
+ */
+struct FDynamicAABBTreeNode
+{
+	FVector Min;
+	FVector Max;
+	UPrimitiveComponent* Primitive = nullptr;
+	int32 Parent = -1;
+	int32 Child1 = -1;
+	int32 Child2 = -1;
+	int32 Height = -1;
+
+	bool IsLeaf() const { return Child1 < 0; }
+	FAABB GetBounds() const { return FAABB(Min, Max); }
+};
+
+/**
+ * @brief 움직이는 프리미티브용 동적 AABB 트리 (이진 BVH)
+ * Leaf AABB를 여유 있게 키워 두므로 Fat AABB 안에서 움직이는 동안 Update는 아무것도 하지 않고,
+ * 벗어나면 Leaf만 떼어 표면적 비용이 가장 작은 위치에 다시 붙인 뒤 조상 AABB를 Refit하면서 회전으로 균형을 맞춘다
+ * 프리미티브는 자신의 Leaf 인덱스를 기억하므로 Update/Remove는 탐색 없이 수행된다
+ */
+class FDynamicAABBTree
+{
+public:
+	// Fat AABB 여유 = 최소 여유 + 크기 비례 여유 (축별)
+	static constexpr float MinFatMargin = 0.5f;
+	static constexpr float FatMarginRatio = 0.1f;
+
+	FDynamicAABBTree() = default;
+	~FDynamicAABBTree() = default;
+
+	/** @return 이미 들어 있거나 nullptr이면 false */
+	bool Insert(UPrimitiveComponent* InPrimitive);
+
+	bool Remove(UPrimitiveComponent* InPrimitive);
+
+	/**
+	 * @brief 움직인 프리미티브의 Leaf 갱신
+	 * @return Fat AABB를 벗어나 다시 삽입했으면 true (안에 있으면 O(1)로 false)
+	 */
+	bool Update(UPrimitiveComponent* InPrimitive);
+
+	bool Contains(const UPrimitiveComponent* InPrimitive) const;
+	void Clear();
+
+	/** @brief 절두체와 겹치는 보이는 프리미티브 수집 (Leaf는 실제 월드 AABB로 검사) */
+	void QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/** @brief Ray와 월드 AABB가 교차하는 프리미티브 수집 */
+	void QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/** @brief 월드 AABB가 InBounds와 겹치는 프리미티브 수집 */
+	void QueryAABB(const FAABB& InBounds, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/**
+	 * @brief FindPos에서 월드 AABB 중심까지 가까운 순서로 최대 MaxPrimitiveCount개 수집
+	 * 노드 AABB까지의 거리가 그 안의 모든 중심 거리의 하한이므로 최우선 탐색 결과는 정확한 거리 순서다
+	 * @param OutPrimitives (중심 거리 제곱, 프리미티브) 쌍을 가까운 순서로 뒤에 추가
+	 */
+	void FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount,
+		TArray<std::pair<float, UPrimitiveComponent*>>& OutPrimitives) const;
+
+	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	bool IsEmpty() const { return RootIndex < 0; }
+	int32 GetNumPrimitives() const { return NumPrimitives; }
+	int32 GetHeight() const { return RootIndex < 0 ? 0 : Nodes[RootIndex].Height; }
+	int32 GetRootIndex() const { return RootIndex; }
+	const FDynamicAABBTreeNode& GetNode(int32 InNodeIndex) const { return Nodes[InNodeIndex]; }
+
+private:
+	int32 AllocateNode();
+	void FreeNode(int32 InNodeIndex);
+
+	void SetFatBounds(FDynamicAABBTreeNode& OutLeaf, const FVector& InMin, const FVector& InMax);
+	void InsertLeaf(int32 InLeafIndex);
+	void RemoveLeaf(int32 InLeafIndex);
+
+	/** @brief InNodeIndex부터 루트까지 균형을 맞추며 AABB와 높이를 다시 계산 */
+	void RefitAncestors(int32 InNodeIndex);
+
+	/** @brief 두 자식 높이 차가 1보다 크면 회전하고, 그 자리의 새 노드 인덱스를 반환 */
+	int32 Balance(int32 InNodeIndex);
+
+	TArray<FDynamicAABBTreeNode> Nodes;
+	int32 RootIndex = -1;
+	int32 FreeListIndex = -1;
+	int32 NumPrimitives = 0;
+};
@@ -123,6 +123,21 @@ enum class EPrimitiveType : uint8
 };
 DECLARE_UINT8_ENUM_REFLECTION(EPrimitiveType)
 
+/**
+ * @brief Actor/Component Tick 그룹
+ * World Tick에서 그룹 순서대로 실행되며, 충돌 갱신은 DuringPhysics와 PostPhysics 사이에서 수행
+ */
+UENUM()
+enum class ETickingGroup : uint8
+{
+	PrePhysics, // 충돌 갱신 전에 위치를 확정해야 하는 Tick (기본값)
+	DuringPhysics, // 충돌 결과와 무관한 Tick
+	PostPhysics, // 이번 프레임의 충돌 결과를 사용하는 Tick
+
+	End
+};
+DECLARE_UINT8_ENUM_REFLECTION(ETickingGroup)
+
 /**
  * @brief RasterizerState Enum
  */
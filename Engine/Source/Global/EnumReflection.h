@@ -177,6 +177,15 @@ namespace EnumReflection
 		return RawName;
 	}
 
+	/**
+	 * enum 값마다 하나씩 생성되는 null-terminated 네임 저장소
+	 * constexpr 함수 내부 static 변수는 C++23부터 허용되므로 변수 템플릿으로 둔다
+	 */
+	template <typename EnumType, EnumType Value>
+	inline constexpr EnumNameHolder<EnumType, Value, GetEnumNameRaw<EnumType, Value>().size()> EnumNameStorage{
+		GetEnumNameRaw<EnumType, Value>()
+	};
+
 	/**
 	 * null-terminated enum 네임 반환
 	 */
@@ -186,10 +195,7 @@ namespace EnumReflection
 		constexpr auto RawName = GetEnumNameRaw<EnumType, Value>();
 		if (RawName.empty()) return "";
 
-		// 정확한 크기 계산
-		constexpr size_t NameSize = RawName.size();
-		static constexpr EnumNameHolder<EnumType, Value, NameSize> holder{RawName};
-		return holder.data;
+		return EnumNameStorage<EnumType, Value>.data;
 	}
 
 	/**
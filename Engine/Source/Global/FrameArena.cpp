@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "Global/FrameArena.h"
+
+FFrameArena& FFrameArena::GetInstance()
+{
+	static FFrameArena Instance;
+	return Instance;
+}
+
+FFrameArena::FFrameArena()
+	: OwnerThreadId(std::this_thread::get_id())
+{
+	BaseAddress = static_cast<uint8*>(FPlatformMemory::ReserveVirtual(ReservedSize));
+	if (BaseAddress && FPlatformMemory::CommitVirtual(BaseAddress, CommitBlockSize))
+	{
+		ReservedBytes = ReservedSize;
+		CommittedBytes = CommitBlockSize;
+	}
+	else
+	{
+		// 예약에 실패하면 모든 할당을 힙으로 대체 (Owns는 항상 false)
+		UE_LOG_ERROR("FrameArena: 가상 주소 범위를 예약하지 못했습니다");
+		if (BaseAddress)
+		{
+			FPlatformMemory::ReleaseVirtual(BaseAddress, ReservedSize);
+			BaseAddress = nullptr;
+		}
+	}
+	FrameStartHeapAllocations = FAllocationTracker::GetTotalCalls();
+}
+
+FFrameArena::~FFrameArena()
+{
+	if (BaseAddress)
+	{
+		FPlatformMemory::ReleaseVirtual(BaseAddress, ReservedSize);
+	}
+}
+
+void* FFrameArena::Allocate(size_t InSize, size_t InAlignment)
+{
+	if (!IsInOwnerThread() || !BaseAddress)
+	{
+		return nullptr;
+	}
+
+	const uintptr_t Base = reinterpret_cast<uintptr_t>(BaseAddress);
+	const uintptr_t Aligned = (Base + UsedBytes + InAlignment - 1) & ~(static_cast<uintptr_t>(InAlignment) - 1);
+	const size_t Offset = static_cast<size_t>(Aligned - Base);
+	if (Offset > ReservedBytes || InSize > ReservedBytes - Offset)
+	{
+		return nullptr;
+	}
+
+	// 확정한 범위를 넘으면 필요한 만큼 뒤쪽 페이지를 확정 (한 번 확정한 페이지는 다음 프레임에도 재사용)
+	const size_t NewUsed = Offset + InSize;
+	if (NewUsed > CommittedBytes)
+	{
+		const size_t NewCommitted = std::min(ReservedBytes, (NewUsed + CommitBlockSize - 1) / CommitBlockSize * CommitBlockSize);
+		if (!FPlatformMemory::CommitVirtual(BaseAddress + CommittedBytes, NewCommitted - CommittedBytes))
+		{
+			return nullptr;
+		}
+		CommittedBytes = NewCommitted;
+	}
+
+	UsedBytes = NewUsed;
+	return reinterpret_cast<void*>(Aligned);
+}
+
+void FFrameArena::Reset()
+{
+	LastFrameUsedBytes = UsedBytes;
+	PeakUsedBytes = std::max(PeakUsedBytes, LastFrameUsedBytes);
+	UsedBytes = 0;
+
+	LastFrameHeapAllocations = FAllocationTracker::GetTotalCalls() - FrameStartHeapAllocations;
+	FrameStartHeapAllocations = FAllocationTracker::GetTotalCalls();
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <thread>
+
+/**
+ * @brief 한 프레임 동안만 쓰는 임시 메모리를 위한 선형(Bump) 할당자
+ * 할당은 포인터를 앞으로 미는 것뿐이고 개별 해제는 하지 않으며, 프레임 끝의 Reset에서 한꺼번에 되돌린다
+ * 시작할 때 고정된 가상 주소 범위를 예약해 두고 모자랄 때만 뒤쪽 페이지를 확정하므로, 확정한 페이지를 재사용하는 정상 상태의 프레임은 힙 할당이 없다
+ * 게임(메인) 스레드 전용이며, 다른 스레드의 할당 요청이나 예약 범위를 넘는 요청에는 nullptr를 반환해 호출자가 힙으로 대체하게 한다
+ * @note Reset 이후에는 이전 프레임에 받은 메모리를 읽으면 안 되므로 프레임을 넘어 유지되는 객체에 저장하지 않는다
+ */
+class FFrameArena
+{
+public:
+	/** @brief 예약하는 가상 주소 범위 (물리 메모리는 쓴 만큼만 확정) */
+	static constexpr size_t ReservedSize = 256 * 1024 * 1024;
+	/** @brief 한 번에 확정하는 최소 크기 */
+	static constexpr size_t CommitBlockSize = 1024 * 1024;
+
+	static FFrameArena& GetInstance();
+
+	/** @return 게임 스레드가 아니거나 예약 범위가 모자라면 nullptr */
+	void* Allocate(size_t InSize, size_t InAlignment);
+
+	/**
+	 * @brief InMemory가 이 Arena의 예약 범위 안에 있는지 (TFrameAllocator가 해제 경로를 고를 때 사용)
+	 * 예약 범위는 생성 후 바뀌지 않으므로 어느 스레드에서 호출해도 안전하다
+	 */
+	bool Owns(const void* InMemory) const
+	{
+		const uint8* Memory = static_cast<const uint8*>(InMemory);
+		return Memory >= BaseAddress && Memory < BaseAddress + ReservedBytes;
+	}
+
+	/**
+	 * @brief 프레임 끝에서 호출: 모든 할당을 되돌리고 이번 프레임의 통계를 확정
+	 * 이후 받은 포인터는 모두 무효가 된다
+	 */
+	void Reset();
+
+	bool IsInOwnerThread() const { return std::this_thread::get_id() == OwnerThreadId; }
+
+	size_t GetUsedBytes() const { return UsedBytes; }
+	size_t GetCapacity() const { return CommittedBytes; }
+	size_t GetLastFrameUsedBytes() const { return LastFrameUsedBytes; }
+	size_t GetPeakUsedBytes() const { return PeakUsedBytes; }
+
+	/** @brief 직전 프레임 동안 전역 operator new가 호출된 횟수 (Arena 범위가 모자라 힙으로 대체된 할당 포함) */
+	uint64 GetLastFrameHeapAllocations() const { return LastFrameHeapAllocations; }
+
+private:
+	FFrameArena();
+	~FFrameArena();
+
+	FFrameArena(const FFrameArena&) = delete;
+	FFrameArena& operator=(const FFrameArena&) = delete;
+
+	// 생성자에서 한 번 정한 뒤 바뀌지 않음 (Owns가 잠금 없이 읽음)
+	uint8* BaseAddress = nullptr;
+	size_t ReservedBytes = 0;
+
+	// 게임 스레드만 읽고 씀
+	size_t CommittedBytes = 0;
+	size_t UsedBytes = 0;
+	std::thread::id OwnerThreadId;
+
+	size_t LastFrameUsedBytes = 0;
+	size_t PeakUsedBytes = 0;
+	uint64 FrameStartHeapAllocations = 0;
+	uint64 LastFrameHeapAllocations = 0;
+};
+
+/**
+ * @brief FFrameArena에서 메모리를 받는 STL 호환 할당자
+ * TFrameArray<T>(= TArray<T, TFrameAllocator<T>>)처럼 프레임 안에서 만들고 버리는 컨테이너에 사용한다
+ * 게임 스레드가 아니면 일반 힙으로 대체하고, 해제 시 Arena 소유 여부로 경로를 구분한다
+ */
+template <typename T>
+class TFrameAllocator
+{
+public:
+	using value_type = T;
+
+	TFrameAllocator() noexcept = default;
+
+	template <typename U>
+	TFrameAllocator(const TFrameAllocator<U>&) noexcept {}
+
+	T* allocate(size_t InCount)
+	{
+		if (void* Memory = FFrameArena::GetInstance().Allocate(InCount * sizeof(T), alignof(T)))
+		{
+			return static_cast<T*>(Memory);
+		}
+		return static_cast<T*>(::operator new(InCount * sizeof(T)));
+	}
+
+	void deallocate(T* InMemory, size_t /*InCount*/) noexcept
+	{
+		// Arena 메모리는 Reset에서 한꺼번에 회수 (Owns는 고정된 주소 범위만 비교하므로 워커 스레드에서도 안전)
+		if (!FFrameArena::GetInstance().Owns(InMemory))
+		{
+			::operator delete(InMemory);
+		}
+	}
+
+	template <typename U>
+	bool operator==(const TFrameAllocator<U>&) const noexcept { return true; }
+
+	template <typename U>
+	bool operator!=(const TFrameAllocator<U>&) const noexcept { return false; }
+};
+
+template <typename T>
+using TFrameArray = TArray<T, TFrameAllocator<T>>;
@@ -1,5 +1,10 @@
 #pragma once
 
+#if !PLATFORM_WINDOWS
+#include <codecvt>
+#include <locale>
+#endif
+
 using std::string;
 using std::wstring;
 
@@ -63,6 +68,7 @@ void SafeRelease(T*& ComObj)
  */
 static FString WideStringToString(const wstring& InString)
 {
+#if PLATFORM_WINDOWS
 	int32 ByteNumber = WideCharToMultiByte(CP_UTF8, 0,
 	                                     InString.c_str(), -1, nullptr, 0, nullptr, nullptr);
 
@@ -72,6 +78,10 @@ static FString WideStringToString(const wstring& InString)
 	                    InString.c_str(), -1, OutString.data(), ByteNumber, nullptr, nullptr);
 
 	return OutString;
+#else
+	std::wstring_convert<std::codecvt_utf8<wchar_t>> Converter;
+	return Converter.to_bytes(InString);
+#endif
 }
 
 /**
@@ -81,6 +91,7 @@ static FString WideStringToString(const wstring& InString)
  */
 static wstring StringToWideString(const FString& InString)
 {
+#if PLATFORM_WINDOWS
 	// 필요한 와이드 문자의 개수를 계산
 	int32 WideCharNumber = MultiByteToWideChar(CP_UTF8, 0,
 										  InString.c_str(), -1, nullptr, 0);
@@ -96,6 +107,10 @@ static wstring StringToWideString(const FString& InString)
 	OutString.resize(WideCharNumber - 1);
 
 	return OutString;
+#else
+	std::wstring_convert<std::codecvt_utf8<wchar_t>> Converter;
+	return Converter.from_bytes(InString);
+#endif
 }
 
 /**
@@ -111,6 +126,7 @@ static string ConvertCP949ToUTF8(const char* InANSIString)
 		return "";
 	}
 
+#if PLATFORM_WINDOWS
 	// CP949 -> UTF-8 변환
 	int WideCharacterSize = MultiByteToWideChar(CP_ACP, 0, InANSIString, -1, nullptr, 0);
 	if (WideCharacterSize == 0)
@@ -137,4 +153,8 @@ static string ConvertCP949ToUTF8(const char* InANSIString)
 	}
 
 	return UTF8String;
+#else
+	// Windows 이외의 플랫폼은 시스템 멀티바이트 인코딩이 UTF-8
+	return InANSIString;
+#endif
 }
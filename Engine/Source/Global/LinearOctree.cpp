@@ -0,0 +1,343 @@
+#include "pch.h"
+#include "Global/LinearOctree.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+
+namespace
+{
+	constexpr uint32 GridResolution = 1u << FLinearOctree::MaxDepth;
+
+	// 루트가 한 축으로 납작해도 양자화가 가능하도록 보장하는 최소 반 크기
+	constexpr float MinRootHalfExtent = 0.5f;
+
+	/** @brief 10비트 정수의 비트 사이에 0을 두 개씩 끼워 넣음 (Morton 인코딩용) */
+	uint32 SpreadBits(uint32 InValue)
+	{
+		InValue &= 0x000003ff;
+		InValue = (InValue | (InValue << 16)) & 0xff0000ff;
+		InValue = (InValue | (InValue << 8)) & 0x0300f00f;
+		InValue = (InValue | (InValue << 4)) & 0x030c30c3;
+		InValue = (InValue | (InValue << 2)) & 0x09249249;
+		return InValue;
+	}
+
+	/** @brief 자식 번호 규칙(bit 0: +X, bit 1: +Y, bit 2: +Z)과 같은 순서로 비트를 섞음 */
+	uint32 EncodeMorton(uint32 InX, uint32 InY, uint32 InZ)
+	{
+		return SpreadBits(InX) | (SpreadBits(InY) << 1) | (SpreadBits(InZ) << 2);
+	}
+
+	uint32 QuantizeAxis(float InValue, float InRootMin, float InRootSize)
+	{
+		const float Cell = (InValue - InRootMin) / InRootSize * static_cast<float>(GridResolution);
+		if (Cell <= 0.0f) { return 0; }
+		return std::min(static_cast<uint32>(Cell), GridResolution - 1);
+	}
+
+	/** @brief 프리미티브 반 크기가 셀 반 크기 이하가 되는 가장 깊은 깊이 */
+	int32 ComputeFitDepth(const FVector& InHalfSize, const FVector& InRootHalfExtent)
+	{
+		FVector CellHalfExtent = InRootHalfExtent;
+		int32 Depth = 0;
+		while (Depth < FLinearOctree::MaxDepth
+			&& InHalfSize.X <= CellHalfExtent.X * 0.5f
+			&& InHalfSize.Y <= CellHalfExtent.Y * 0.5f
+			&& InHalfSize.Z <= CellHalfExtent.Z * 0.5f)
+		{
+			CellHalfExtent = CellHalfExtent * 0.5f;
+			++Depth;
+		}
+		return Depth;
+	}
+
+	/** @brief CheckIntersectionRayBox와 같은 Slab 검사를 역방향 벡터를 미리 구해 반복 수행 */
+	struct FRaySlab
+	{
+		float Origin[3];
+		float InverseDirection[3];
+		bool bIsParallel[3];
+
+		explicit FRaySlab(const FRay& InRay)
+		{
+			const float Direction[3] = { InRay.Direction.X, InRay.Direction.Y, InRay.Direction.Z };
+			Origin[0] = InRay.Origin.X;
+			Origin[1] = InRay.Origin.Y;
+			Origin[2] = InRay.Origin.Z;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				bIsParallel[Axis] = std::fabs(Direction[Axis]) < MATH_EPSILON;
+				InverseDirection[Axis] = bIsParallel[Axis] ? 0.0f : 1.0f / Direction[Axis];
+			}
+		}
+
+		bool Intersects(const FVector& InMin, const FVector& InMax) const
+		{
+			const float BoxMin[3] = { InMin.X, InMin.Y, InMin.Z };
+			const float BoxMax[3] = { InMax.X, InMax.Y, InMax.Z };
+
+			float TMin = -FLT_MAX;
+			float TMax = FLT_MAX;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				if (bIsParallel[Axis])
+				{
+					if (Origin[Axis] < BoxMin[Axis] || Origin[Axis] > BoxMax[Axis]) { return false; }
+					continue;
+				}
+
+				float T1 = (BoxMin[Axis] - Origin[Axis]) * InverseDirection[Axis];
+				float T2 = (BoxMax[Axis] - Origin[Axis]) * InverseDirection[Axis];
+				if (T1 > T2) { std::swap(T1, T2); }
+
+				TMin = std::max(TMin, T1);
+				TMax = std::min(TMax, T2);
+				if (TMax < TMin) { return false; }
+			}
+			return TMax >= 0.0f;
+		}
+	};
+
+	bool IsOverlapped(const FVector& InMinA, const FVector& InMaxA, const FVector& InMinB, const FVector& InMaxB)
+	{
+		return InMinA.X <= InMaxB.X && InMaxA.X >= InMinB.X
+			&& InMinA.Y <= InMaxB.Y && InMaxA.Y >= InMinB.Y
+			&& InMinA.Z <= InMaxB.Z && InMaxA.Z >= InMinB.Z;
+	}
+
+	bool IsContained(const FVector& InInnerMin, const FVector& InInnerMax, const FVector& InOuterMin, const FVector& InOuterMax)
+	{
+		return InInnerMin.X >= InOuterMin.X && InInnerMax.X <= InOuterMax.X
+			&& InInnerMin.Y >= InOuterMin.Y && InInnerMax.Y <= InOuterMax.Y
+			&& InInnerMin.Z >= InOuterMin.Z && InInnerMax.Z <= InOuterMax.Z;
+	}
+
+	void AppendVisible(const TArray<UPrimitiveComponent*>& InPrimitives, int32 InBegin, int32 InEnd, TArray<UPrimitiveComponent*>& OutPrimitives)
+	{
+		for (int32 Index = InBegin; Index < InEnd; ++Index)
+		{
+			if (InPrimitives[Index]->IsVisible())
+			{
+				OutPrimitives.push_back(InPrimitives[Index]);
+			}
+		}
+	}
+}
+
+void FLinearOctree::Build(const TArray<UPrimitiveComponent*>& InPrimitives)
+{
+	Clear();
+
+	// 1. 프리미티브 AABB와 루트 영역 계산
+	TArray<FBuildEntry> Entries;
+	Entries.reserve(InPrimitives.size());
+
+	FVector RootMin(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+	FVector RootMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (UPrimitiveComponent* Primitive : InPrimitives)
+	{
+		if (!Primitive) { continue; }
+
+		FBuildEntry Entry;
+		Primitive->GetWorldAABB(Entry.Min, Entry.Max);
+		Entry.Primitive = Primitive;
+		Entries.push_back(Entry);
+
+		RootMin = FVector(std::min(RootMin.X, Entry.Min.X), std::min(RootMin.Y, Entry.Min.Y), std::min(RootMin.Z, Entry.Min.Z));
+		RootMax = FVector(std::max(RootMax.X, Entry.Max.X), std::max(RootMax.Y, Entry.Max.Y), std::max(RootMax.Z, Entry.Max.Z));
+	}
+
+	if (Entries.empty()) { return; }
+
+	const FVector RootCenter = (RootMin + RootMax) * 0.5f;
+	FVector RootHalfExtent = (RootMax - RootMin) * 0.5f;
+	RootHalfExtent.X = std::max(RootHalfExtent.X, MinRootHalfExtent);
+	RootHalfExtent.Y = std::max(RootHalfExtent.Y, MinRootHalfExtent);
+	RootHalfExtent.Z = std::max(RootHalfExtent.Z, MinRootHalfExtent);
+	const FVector QuantizeMin = RootCenter - RootHalfExtent;
+	const FVector QuantizeSize = RootHalfExtent * 2.0f;
+
+	// 2. 중심의 최대 깊이 셀 좌표로 Morton 코드를 만들고 정렬 (같은 셀 접두사를 가진 프리미티브가 연속 구간이 됨)
+	for (FBuildEntry& Entry : Entries)
+	{
+		const FVector Center = (Entry.Min + Entry.Max) * 0.5f;
+		Entry.MortonCode = EncodeMorton(
+			QuantizeAxis(Center.X, QuantizeMin.X, QuantizeSize.X),
+			QuantizeAxis(Center.Y, QuantizeMin.Y, QuantizeSize.Y),
+			QuantizeAxis(Center.Z, QuantizeMin.Z, QuantizeSize.Z));
+		Entry.FitDepth = ComputeFitDepth((Entry.Max - Entry.Min) * 0.5f, RootHalfExtent);
+	}
+
+	std::sort(Entries.begin(), Entries.end(), [](const FBuildEntry& A, const FBuildEntry& B)
+	{
+		return A.MortonCode < B.MortonCode;
+	});
+
+	// 3. 위에서부터 분할하며 깊이 우선 순서로 노드를 추가
+	BuildNode(Entries, 0, static_cast<int32>(Entries.size()), 0, 0);
+
+	// 4. 분할 중 재배치된 최종 순서로 프리미티브와 AABB를 복사
+	Primitives.reserve(Entries.size());
+	PrimitiveMins.reserve(Entries.size());
+	PrimitiveMaxs.reserve(Entries.size());
+	for (const FBuildEntry& Entry : Entries)
+	{
+		Primitives.push_back(Entry.Primitive);
+		PrimitiveMins.push_back(Entry.Min);
+		PrimitiveMaxs.push_back(Entry.Max);
+	}
+}
+
+void FLinearOctree::BuildNode(TArray<FBuildEntry>& InOutEntries, int32 InBegin, int32 InEnd, uint32 InMortonCode, int32 InDepth)
+{
+	const int32 NodeIndex = static_cast<int32>(Nodes.size());
+	Nodes.emplace_back();
+	Nodes[NodeIndex].FirstPrimitive = InBegin;
+	Nodes[NodeIndex].MortonCode = InMortonCode;
+	Nodes[NodeIndex].Depth = InDepth;
+
+	// 1. 충분히 적거나 최대 깊이면 Leaf, 아니면 자식 셀에 들어가지 못하는 큰 프리미티브만 앞쪽으로 모아 이 노드에 남김
+	int32 ChildBegin = InEnd;
+	if (InEnd - InBegin > MaxPrimitivesPerLeaf && InDepth < MaxDepth)
+	{
+		const auto Middle = std::stable_partition(InOutEntries.begin() + InBegin, InOutEntries.begin() + InEnd,
+			[InDepth](const FBuildEntry& Entry) { return Entry.FitDepth <= InDepth; });
+		ChildBegin = static_cast<int32>(Middle - InOutEntries.begin());
+	}
+	Nodes[NodeIndex].NumPrimitives = ChildBegin - InBegin;
+
+	FVector Min(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+	FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (int32 Index = InBegin; Index < ChildBegin; ++Index)
+	{
+		const FBuildEntry& Entry = InOutEntries[Index];
+		Min = FVector(std::min(Min.X, Entry.Min.X), std::min(Min.Y, Entry.Min.Y), std::min(Min.Z, Entry.Min.Z));
+		Max = FVector(std::max(Max.X, Entry.Max.X), std::max(Max.Y, Entry.Max.Y), std::max(Max.Z, Entry.Max.Z));
+	}
+
+	// 2. 나머지는 Morton 정렬 상태이므로 다음 깊이의 3비트가 같은 구간이 곧 자식 셀
+	const int32 Shift = 3 * (MaxDepth - InDepth - 1);
+	while (ChildBegin < InEnd)
+	{
+		const uint32 ChildSlot = (InOutEntries[ChildBegin].MortonCode >> Shift) & 7;
+		const auto ChildEndIt = std::partition_point(InOutEntries.begin() + ChildBegin, InOutEntries.begin() + InEnd,
+			[Shift, ChildSlot](const FBuildEntry& Entry) { return ((Entry.MortonCode >> Shift) & 7) <= ChildSlot; });
+		const int32 ChildEnd = static_cast<int32>(ChildEndIt - InOutEntries.begin());
+
+		const int32 ChildIndex = static_cast<int32>(Nodes.size());
+		BuildNode(InOutEntries, ChildBegin, ChildEnd, (InMortonCode << 3) | ChildSlot, InDepth + 1);
+
+		const FLinearOctreeNode& Child = Nodes[ChildIndex];
+		Min = FVector(std::min(Min.X, Child.Min.X), std::min(Min.Y, Child.Min.Y), std::min(Min.Z, Child.Min.Z));
+		Max = FVector(std::max(Max.X, Child.Max.X), std::max(Max.Y, Child.Max.Y), std::max(Max.Z, Child.Max.Z));
+
+		ChildBegin = ChildEnd;
+	}
+
+	FLinearOctreeNode& Node = Nodes[NodeIndex];
+	Node.Min = Min;
+	Node.Max = Max;
+	Node.SubtreePrimitiveEnd = InEnd;
+	Node.SubtreeEnd = static_cast<int32>(Nodes.size());
+}
+
+void FLinearOctree::Clear()
+{
+	Nodes.clear();
+	Primitives.clear();
+	PrimitiveMins.clear();
+	PrimitiveMaxs.clear();
+}
+
+void FLinearOctree::QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const int32 NumNodes = static_cast<int32>(Nodes.size());
+	int32 NodeIndex = 0;
+	while (NodeIndex < NumNodes)
+	{
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		const EBoundCheckResult Result = InFrustum.CheckIntersection(FAABB(Node.Min, Node.Max));
+
+		// 밖이면 서브트리 전체를 건너뛰고, 완전히 안이면 서브트리 프리미티브 구간을 통째로 추가
+		if (Result == EBoundCheckResult::Outside)
+		{
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+		if (Result == EBoundCheckResult::Inside)
+		{
+			AppendVisible(Primitives, Node.FirstPrimitive, Node.SubtreePrimitiveEnd, OutPrimitives);
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+
+		// 걸쳐 있으면 이 노드의 프리미티브만 개별 검사하고 첫 자식(다음 노드)으로 진행
+		const int32 End = Node.FirstPrimitive + Node.NumPrimitives;
+		for (int32 Index = Node.FirstPrimitive; Index < End; ++Index)
+		{
+			if (Primitives[Index]->IsVisible()
+				&& InFrustum.CheckIntersection(FAABB(PrimitiveMins[Index], PrimitiveMaxs[Index])) != EBoundCheckResult::Outside)
+			{
+				OutPrimitives.push_back(Primitives[Index]);
+			}
+		}
+		++NodeIndex;
+	}
+}
+
+void FLinearOctree::QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const FRaySlab Slab(InRay);
+
+	const int32 NumNodes = static_cast<int32>(Nodes.size());
+	int32 NodeIndex = 0;
+	while (NodeIndex < NumNodes)
+	{
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		if (!Slab.Intersects(Node.Min, Node.Max))
+		{
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+
+		const int32 End = Node.FirstPrimitive + Node.NumPrimitives;
+		for (int32 Index = Node.FirstPrimitive; Index < End; ++Index)
+		{
+			if (Slab.Intersects(PrimitiveMins[Index], PrimitiveMaxs[Index]))
+			{
+				OutPrimitives.push_back(Primitives[Index]);
+			}
+		}
+		++NodeIndex;
+	}
+}
+
+void FLinearOctree::QueryAABB(const FAABB& InBounds, TArray<UPrimitiveComponent*>& OutPrimitives) const
+{
+	const int32 NumNodes = static_cast<int32>(Nodes.size());
+	int32 NodeIndex = 0;
+	while (NodeIndex < NumNodes)
+	{
+		const FLinearOctreeNode& Node = Nodes[NodeIndex];
+		if (!IsOverlapped(Node.Min, Node.Max, InBounds.Min, InBounds.Max))
+		{
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+		if (IsContained(Node.Min, Node.Max, InBounds.Min, InBounds.Max))
+		{
+			OutPrimitives.insert(OutPrimitives.end(), Primitives.begin() + Node.FirstPrimitive, Primitives.begin() + Node.SubtreePrimitiveEnd);
+			NodeIndex = Node.SubtreeEnd;
+			continue;
+		}
+
+		const int32 End = Node.FirstPrimitive + Node.NumPrimitives;
+		for (int32 Index = Node.FirstPrimitive; Index < End; ++Index)
+		{
+			if (IsOverlapped(PrimitiveMins[Index], PrimitiveMaxs[Index], InBounds.Min, InBounds.Max))
+			{
+				OutPrimitives.push_back(Primitives[Index]);
+			}
+		}
+		++NodeIndex;
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Physics/Public/AABB.h"
+
+class UPrimitiveComponent;
+struct FFrustum;
+
+/**
+ * @brief FLinearOctree 노드
+ * 노드는 깊이 우선(Morton) 순서로 배열에 놓이므로 첫 자식은 항상 바로 다음 인덱스이고, 서브트리는 [자신, SubtreeEnd) 구간을 차지한다
+ * 프리미티브도 같은 순서로 정렬되어 있어 서브트리의 프리미티브는 [FirstPrimitive, SubtreePrimitiveEnd) 연속 구간이다
+ * @var Min, Max 서브트리 프리미티브 전체를 감싸는 AABB
+ * @var NumPrimitives 자식 셀에 들어가지 못해 이 노드에 직접 속한 프리미티브 수 (FirstPrimitive부터)
+ * @var MortonCode 루트부터 이 노드까지의 자식 번호(3비트씩)를 이어 붙인 위치 코드
+ */
+struct FLinearOctreeNode
+{
+	FVector Min;
+	FVector Max;
+	int32 FirstPrimitive = 0;
+	int32 NumPrimitives = 0;
+	int32 SubtreePrimitiveEnd = 0;
+	int32 SubtreeEnd = 0;
+	uint32 MortonCode = 0;
+	int32 Depth = 0;
+};
+
+/**
+ * @brief 한 배열에 Morton 순서로 저장한 정적 Octree
+ * 자식 포인터 없이 "다음 노드 = 첫 자식, SubtreeEnd = 다음 형제"로 주소를 계산하므로 쿼리는 스택/큐 할당 없이 배열을 앞으로만 훑는다
+ * 프리미티브의 월드 AABB는 빌드 시 복사해 두므로 쿼리 중 컴포넌트를 역참조하지 않는다 (가시성 검사 제외)
+ * 빌드 이후 움직인 프리미티브는 반영되지 않으므로 정적 프리미티브 전용이며, 바뀌면 Build를 다시 호출한다
+ */
+class FLinearOctree
+{
+public:
+	static constexpr int32 MaxDepth = 10; // Morton 코드 축당 10비트 (30비트)
+	static constexpr int32 MaxPrimitivesPerLeaf = 16;
+
+	FLinearOctree() = default;
+	~FLinearOctree() = default;
+
+	/** @brief 프리미티브를 셀 중심 Morton 코드로 정렬한 뒤 위에서부터 분할해 노드 배열을 구성 */
+	void Build(const TArray<UPrimitiveComponent*>& InPrimitives);
+	void Clear();
+
+	/** @brief 절두체와 겹치는 보이는 프리미티브 수집 (완전히 포함된 서브트리는 연속 구간을 통째로 추가) */
+	void QueryFrustum(const FFrustum& InFrustum, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/** @brief Ray와 AABB가 교차하는 프리미티브 수집 (Picking 후보) */
+	void QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	/** @brief AABB와 겹치는 프리미티브 수집 */
+	void QueryAABB(const FAABB& InBounds, TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+	bool IsEmpty() const { return Nodes.empty(); }
+	int32 GetNumNodes() const { return static_cast<int32>(Nodes.size()); }
+	int32 GetNumPrimitives() const { return static_cast<int32>(Primitives.size()); }
+	const FLinearOctreeNode& GetNode(int32 InNodeIndex) const { return Nodes[InNodeIndex]; }
+	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
+
+private:
+	/** @brief 빌드 중 프리미티브 한 개의 정렬 키와 AABB */
+	struct FBuildEntry
+	{
+		uint32 MortonCode;
+		int32 FitDepth; // 크기상 들어갈 수 있는 가장 깊은 셀 깊이
+		FVector Min;
+		FVector Max;
+		UPrimitiveComponent* Primitive;
+	};
+
+	void BuildNode(TArray<FBuildEntry>& InOutEntries, int32 InBegin, int32 InEnd, uint32 InMortonCode, int32 InDepth);
+
+	TArray<FLinearOctreeNode> Nodes; // 0번이 루트
+	TArray<UPrimitiveComponent*> Primitives; // 노드 순서대로 정렬
+	TArray<FVector> PrimitiveMins; // Primitives와 같은 순서의 월드 AABB
+	TArray<FVector> PrimitiveMaxs;
+};
@@ -0,0 +1,268 @@
+#include "pch.h"
+#include "Global/LinearOctree.h"
+#include "Global/Octree.h"
+#include "Level/Public/World.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Shape/Public/BoxComponent.h"
+#include "Optimization/Public/ViewVolumeCuller.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumPrimitives = 100000;
+	constexpr int32 NumFrustumQueries = 1000;
+	constexpr int32 NumVerifiedFrustumQueries = 100;
+	constexpr int32 NumRayQueries = 100000;
+
+	// 프리미티브 간 평균 간격과, 여러 셀에 걸치는 큰 프리미티브 비율
+	constexpr float PrimitiveSpacing = 4.0f;
+	constexpr float LargePrimitiveRatio = 0.02f;
+
+	constexpr float CameraFovY = 60.0f;
+	constexpr float CameraAspect = 16.0f / 9.0f;
+	constexpr float CameraNearZ = 0.1f;
+	constexpr float CameraFarZ = 100.0f;
+
+	/**
+	 * @brief 크기가 제각각인 Box N개를 가진 Actor 하나로 구성한 합성 레벨 생성
+	 * SceneComponent가 GWorld의 Level을 참조하므로 호출 전후로 GWorld를 관리해야 한다
+	 */
+	UWorld* CreateBenchmarkWorld(std::mt19937& InRandom, float& OutHalfRange, TArray<UPrimitiveComponent*>& OutPrimitives)
+	{
+		UWorld* World = NewObject<UWorld>();
+		World->SetWorldType(EWorldType::Game);
+		GWorld = World;
+		World->CreateNewLevel();
+
+		AActor* BoxOwner = World->SpawnActor(AActor::StaticClass());
+		OutHalfRange = std::cbrt(static_cast<float>(NumPrimitives)) * PrimitiveSpacing * 0.5f;
+		std::uniform_real_distribution<float> Position(-OutHalfRange, OutHalfRange);
+		std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+		std::uniform_real_distribution<float> SmallExtent(0.5f, 2.0f);
+		std::uniform_real_distribution<float> LargeExtent(5.0f, 25.0f);
+
+		OutPrimitives.clear();
+		OutPrimitives.reserve(NumPrimitives);
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			UBoxComponent* Box = BoxOwner->CreateDefaultSubobject<UBoxComponent>();
+			// ShapeComponent는 기본적으로 숨김이고 두 트리 모두 숨김 프리미티브를 건너뛰므로 보이게 설정
+			Box->SetVisibility(true);
+			std::uniform_real_distribution<float>& Extent = Unit(InRandom) < LargePrimitiveRatio ? LargeExtent : SmallExtent;
+			Box->SetBoxExtent(FVector(Extent(InRandom), Extent(InRandom), Extent(InRandom)));
+			Box->SetRelativeLocation(FVector(Position(InRandom), Position(InRandom), Position(InRandom)));
+			OutPrimitives.push_back(Box);
+		}
+
+		return World;
+	}
+
+	/** @brief 레벨 내부 임의 위치에서 임의 방향을 보는 원근 카메라 (UCamera::UpdateMatrixByPers와 같은 행렬) */
+	FCameraConstants CreateRandomCamera(float InHalfRange, std::mt19937& InRandom)
+	{
+		std::uniform_real_distribution<float> Position(-InHalfRange, InHalfRange);
+		std::normal_distribution<float> Normal(0.0f, 1.0f);
+
+		const FVector Location(Position(InRandom), Position(InRandom), Position(InRandom));
+		FVector Forward(Normal(InRandom), Normal(InRandom), Normal(InRandom));
+		Forward.Normalize();
+		const FVector WorldUp = std::fabs(Forward.Z) < 0.99f ? FVector(0.0f, 0.0f, 1.0f) : FVector(1.0f, 0.0f, 0.0f);
+		FVector Right = WorldUp.Cross(Forward);
+		Right.Normalize();
+		const FVector Up = Forward.Cross(Right);
+
+		FCameraConstants Constants;
+		Constants.View = FMatrix::TranslationMatrixInverse(Location) * FMatrix(Right, Up, Forward).Transpose();
+
+		const float F = 1.0f / std::tan(FVector::GetDegreeToRadian(CameraFovY) * 0.5f);
+		FMatrix P = FMatrix::Identity();
+		P.Data[0][0] = F / CameraAspect;
+		P.Data[1][1] = F;
+		P.Data[2][2] = CameraFarZ / (CameraFarZ - CameraNearZ);
+		P.Data[2][3] = 1.0f;
+		P.Data[3][2] = (-CameraNearZ * CameraFarZ) / (CameraFarZ - CameraNearZ);
+		P.Data[3][3] = 0.0f;
+		Constants.Projection = P;
+
+		Constants.ViewWorldLocation = Location;
+		Constants.NearClip = CameraNearZ;
+		Constants.FarClip = CameraFarZ;
+		return Constants;
+	}
+
+	/** @brief 레벨 바깥 구면에서 출발해 레벨 내부 임의 점을 향하는 Ray (에디터 피킹처럼 레벨 전체를 가로지름) */
+	FRay CreateRandomRay(float InHalfRange, std::mt19937& InRandom)
+	{
+		std::uniform_real_distribution<float> Position(-InHalfRange, InHalfRange);
+		std::normal_distribution<float> Normal(0.0f, 1.0f);
+
+		FVector OriginDirection(Normal(InRandom), Normal(InRandom), Normal(InRandom));
+		OriginDirection.Normalize();
+		const FVector Origin = OriginDirection * (InHalfRange * 2.0f);
+		FVector Direction = FVector(Position(InRandom), Position(InRandom), Position(InRandom)) - Origin;
+		Direction.Normalize();
+
+		FRay Ray;
+		Ray.Origin = FVector4(Origin, 1.0f);
+		Ray.Direction = FVector4(Direction, 0.0f);
+		return Ray;
+	}
+
+	bool HasSameElements(TArray<UPrimitiveComponent*> InA, TArray<UPrimitiveComponent*> InB)
+	{
+		std::sort(InA.begin(), InA.end());
+		std::sort(InB.begin(), InB.end());
+		return InA == InB;
+	}
+}
+
+/**
+ * @brief 100k 프리미티브 합성 레벨에서 Morton 순서 FLinearOctree와 노드 풀 FOctree의 절두체/Ray 쿼리 처리량 비교
+ * 절두체 결과는 두 트리가 같아야 하며, Ray는 FOctree가 노드 단위 후보를 반환하고 FLinearOctree는 프리미티브 AABB까지 검사하므로 후보 수를 함께 출력한다
+ */
+IMPLEMENT_BENCHMARK(LinearOctree, "100k 프리미티브 절두체/Ray 쿼리: Morton 순서 Linear Octree vs FOctree")
+{
+	UWorld* PreviousWorld = GWorld;
+	std::mt19937 Random(20251017);
+
+	float HalfRange = 0.0f;
+	TArray<UPrimitiveComponent*> Primitives;
+	UWorld* World = CreateBenchmarkWorld(Random, HalfRange, Primitives);
+
+	// 1. 같은 프리미티브로 두 트리 구축
+	FOctree PointerOctree;
+	FVector Min, Max;
+	FAABB LevelBounds;
+	for (size_t Index = 0; Index < Primitives.size(); ++Index)
+	{
+		Primitives[Index]->GetWorldAABB(Min, Max);
+		LevelBounds = Index == 0 ? FAABB(Min, Max) : Union(LevelBounds, FAABB(Min, Max));
+	}
+
+	FScopeCycleCounter PointerBuildCounter;
+	PointerOctree.GrowToInclude(LevelBounds);
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		PointerOctree.Insert(Primitive);
+	}
+	const double PointerBuildMilliseconds = PointerBuildCounter.Finish();
+
+	FLinearOctree LinearOctree;
+	FScopeCycleCounter LinearBuildCounter;
+	LinearOctree.Build(Primitives);
+	const double LinearBuildMilliseconds = LinearBuildCounter.Finish();
+
+	UE_LOG("  Primitives: %d, Linear Nodes: %d", NumPrimitives, LinearOctree.GetNumNodes());
+	UE_LOG("  Build (ms): FOctree %.3f, FLinearOctree %.3f", PointerBuildMilliseconds, LinearBuildMilliseconds);
+
+	// 2. 절두체 쿼리 (FOctree는 에디터 카메라와 같은 ViewVolumeCuller 경로)
+	TArray<FCameraConstants> Cameras;
+	Cameras.reserve(NumFrustumQueries);
+	for (int32 Query = 0; Query < NumFrustumQueries; ++Query)
+	{
+		Cameras.push_back(CreateRandomCamera(HalfRange, Random));
+	}
+
+	ViewVolumeCuller Culler;
+	TArray<UPrimitiveComponent*> Visible;
+	auto QueryLinearFrustum = [&LinearOctree, &Visible](const FCameraConstants& InCamera)
+	{
+		Visible.clear();
+		FFrustum Frustum;
+		if (Frustum.SetFromViewProjection(InCamera.View * InCamera.Projection))
+		{
+			LinearOctree.QueryFrustum(Frustum, Visible);
+		}
+	};
+
+	uint64 NumPointerVisible = 0;
+	FScopeCycleCounter PointerFrustumCounter;
+	for (const FCameraConstants& Camera : Cameras)
+	{
+		Culler.Cull(&PointerOctree, nullptr, Camera);
+		NumPointerVisible += Culler.GetRenderableObjects().size();
+	}
+	const double PointerFrustumMilliseconds = PointerFrustumCounter.Finish();
+
+	uint64 NumLinearVisible = 0;
+	FScopeCycleCounter LinearFrustumCounter;
+	for (const FCameraConstants& Camera : Cameras)
+	{
+		QueryLinearFrustum(Camera);
+		NumLinearVisible += Visible.size();
+	}
+	const double LinearFrustumMilliseconds = LinearFrustumCounter.Finish();
+
+	// 측정과 별도로 앞쪽 일부 카메라에서 두 트리의 결과 집합 비교
+	// 결과가 모두 비어 있으면 두 빈 집합을 비교하게 되므로 검증 실패로 처리
+	int32 NumFrustumMismatches = 0;
+	uint64 NumVerifiedVisible = 0;
+	for (int32 Query = 0; Query < NumVerifiedFrustumQueries; ++Query)
+	{
+		Culler.Cull(&PointerOctree, nullptr, Cameras[Query]);
+		QueryLinearFrustum(Cameras[Query]);
+		NumVerifiedVisible += Visible.size();
+		if (!HasSameElements(Culler.GetRenderableObjects(), Visible))
+		{
+			++NumFrustumMismatches;
+		}
+	}
+	if (NumFrustumMismatches > 0)
+	{
+		UE_LOG_ERROR("  절두체 결과 불일치: %d / %d", NumFrustumMismatches, NumVerifiedFrustumQueries);
+	}
+	if (NumVerifiedVisible == 0)
+	{
+		UE_LOG_ERROR("  절두체 검증 실패: %d개 카메라 모두 보이는 프리미티브가 없습니다", NumVerifiedFrustumQueries);
+	}
+
+	// 3. Ray 쿼리 (FOctree는 UObjectPicker::FindCandidateFromOctree와 같은 FOctree::QueryRay 경로)
+	TArray<FRay> Rays;
+	Rays.reserve(NumRayQueries);
+	for (int32 Query = 0; Query < NumRayQueries; ++Query)
+	{
+		Rays.push_back(CreateRandomRay(HalfRange, Random));
+	}
+
+	TArray<UPrimitiveComponent*> Candidates;
+	uint64 NumPointerCandidates = 0;
+	FScopeCycleCounter PointerRayCounter;
+	for (const FRay& Ray : Rays)
+	{
+		Candidates.clear();
+		PointerOctree.QueryRay(Ray, Candidates);
+		NumPointerCandidates += Candidates.size();
+	}
+	const double PointerRayMilliseconds = PointerRayCounter.Finish();
+
+	uint64 NumLinearCandidates = 0;
+	FScopeCycleCounter LinearRayCounter;
+	for (const FRay& Ray : Rays)
+	{
+		Candidates.clear();
+		LinearOctree.QueryRay(Ray, Candidates);
+		NumLinearCandidates += Candidates.size();
+	}
+	const double LinearRayMilliseconds = LinearRayCounter.Finish();
+
+	FBenchmarkRegistry::Consume(NumPointerVisible + NumLinearVisible + NumPointerCandidates + NumLinearCandidates);
+
+	UE_LOG("  Query   | FOctree (queries/s) | FLinearOctree (queries/s) | Speedup | Avg Results (FOctree / Linear)");
+	UE_LOG("  Frustum | %19.0f | %25.0f | %6.1fx | %.1f / %.1f",
+		NumFrustumQueries / (PointerFrustumMilliseconds * 0.001),
+		NumFrustumQueries / (LinearFrustumMilliseconds * 0.001),
+		LinearFrustumMilliseconds > 0.0 ? PointerFrustumMilliseconds / LinearFrustumMilliseconds : 0.0,
+		static_cast<double>(NumPointerVisible) / NumFrustumQueries,
+		static_cast<double>(NumLinearVisible) / NumFrustumQueries);
+	UE_LOG("  Ray     | %19.0f | %25.0f | %6.1fx | %.1f / %.1f",
+		NumRayQueries / (PointerRayMilliseconds * 0.001),
+		NumRayQueries / (LinearRayMilliseconds * 0.001),
+		LinearRayMilliseconds > 0.0 ? PointerRayMilliseconds / LinearRayMilliseconds : 0.0,
+		static_cast<double>(NumPointerCandidates) / NumRayQueries,
+		static_cast<double>(NumLinearCandidates) / NumRayQueries);
+
+	SafeDelete(World);
+	GWorld = PreviousWorld;
+}
@@ -2,6 +2,19 @@
 
 #define DT UTimeManager::GetInstance().GetDeltaTime()
 
+#ifdef IS_HEADLESS
+// Headless 빌드에는 UConsoleWindow가 없으므로 표준 출력으로만 기록
+#define UE_LOG(fmt, ...) printf(fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_INFO(fmt, ...) printf("[INFO] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_WARNING(fmt, ...) printf("[WARNING] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_ERROR(fmt, ...) printf("[ERROR] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_SUCCESS(fmt, ...) printf("[SUCCESS] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_SYSTEM(fmt, ...) printf("[SYSTEM] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_DEBUG(fmt, ...) printf("[DEBUG] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_COMMAND(fmt, ...) printf("[CMD] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_TERMINAL(fmt, ...) printf("[TERMINAL] " fmt "\n", ##__VA_ARGS__)
+#define UE_LOG_TERMINAL_ERROR(fmt, ...) printf("[TERMINAL_ERROR] " fmt "\n", ##__VA_ARGS__)
+#else
 // UE_LOG Macro 시스템
 // 기본 UE_LOG (Info 타입)
 #define UE_LOG(fmt, ...) \
@@ -84,7 +97,7 @@
             UConsoleWindow::GetInstance().AddLog(ELogType::TerminalError, "" fmt, ##__VA_ARGS__); \
         } catch(...) {} \
     } while(0)
-
+#endif // IS_HEADLESS
 
 /**
  * @brief UENUM 매크로 시스템
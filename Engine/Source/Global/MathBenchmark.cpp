@@ -0,0 +1,424 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumPoints = 1 << 18;
+	constexpr int32 NumTransformPasses = 16;
+	constexpr int32 NumMatrices = 1 << 16;
+	constexpr int32 NumMatrixPasses = 16;
+
+	const char* GetSIMDLevelName(EMathSIMDLevel InLevel)
+	{
+		switch (InLevel)
+		{
+		case EMathSIMDLevel::Scalar: return "Scalar";
+		case EMathSIMDLevel::SSE: return "SSE   ";
+		case EMathSIMDLevel::AVX2: return "AVX2  ";
+		}
+		return "?";
+	}
+
+	/** @brief 배치 API 이전 호출부처럼 점마다 FVector4(P, 1)을 만들어 TransformVector4 후 xyz만 사용 (TransformBoundingBox) */
+	void LegacyTransformPoints(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, int32 InCount)
+	{
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			const FVector4 Transformed = InMatrix.TransformVector4(FVector4(InPoints[Index], 1.0f));
+			OutPoints[Index] = FVector(Transformed.X, Transformed.Y, Transformed.Z);
+		}
+	}
+
+	/** @brief 이전 COcclusionCuller::Project의 투영 부분 (점마다 FVector4 * FMatrix 후 W로 나눔) */
+	void LegacyProjectPoints(const FMatrix& InMatrix, const FVector* InPoints, FVector4* OutPoints, int32 InCount)
+	{
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			FVector4 ClipPos = FVector4(InPoints[Index], 1.0f) * InMatrix;
+			if (ClipPos.W != 0.0f)
+			{
+				ClipPos.X /= ClipPos.W;
+				ClipPos.Y /= ClipPos.W;
+				ClipPos.Z /= ClipPos.W;
+			}
+			OutPoints[Index] = ClipPos;
+		}
+	}
+
+	/** @brief 이전 FMatrix::Inverse (3x3 여인수 + 이동 성분, 아핀 행렬 전용) */
+	FMatrix LegacyAffineInverse(const FMatrix& InMatrix)
+	{
+		const float (*Data)[4] = InMatrix.Data;
+		FMatrix Result;
+
+		float Det = Data[0][0] * (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1])
+			- Data[0][1] * (Data[1][0] * Data[2][2] - Data[1][2] * Data[2][0])
+			+ Data[0][2] * (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0]);
+
+		if (std::abs(Det) < 1e-6f)
+		{
+			return FMatrix::Identity();
+		}
+
+		float InvDet = 1.0f / Det;
+
+		Result.Data[0][0] = (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1]) * InvDet;
+		Result.Data[0][1] = (Data[0][2] * Data[2][1] - Data[0][1] * Data[2][2]) * InvDet;
+		Result.Data[0][2] = (Data[0][1] * Data[1][2] - Data[0][2] * Data[1][1]) * InvDet;
+		Result.Data[0][3] = 0.0f;
+
+		Result.Data[1][0] = (Data[1][2] * Data[2][0] - Data[1][0] * Data[2][2]) * InvDet;
+		Result.Data[1][1] = (Data[0][0] * Data[2][2] - Data[0][2] * Data[2][0]) * InvDet;
+		Result.Data[1][2] = (Data[0][2] * Data[1][0] - Data[0][0] * Data[1][2]) * InvDet;
+		Result.Data[1][3] = 0.0f;
+
+		Result.Data[2][0] = (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0]) * InvDet;
+		Result.Data[2][1] = (Data[0][1] * Data[2][0] - Data[0][0] * Data[2][1]) * InvDet;
+		Result.Data[2][2] = (Data[0][0] * Data[1][1] - Data[0][1] * Data[1][0]) * InvDet;
+		Result.Data[2][3] = 0.0f;
+
+		Result.Data[3][0] = -(Data[3][0] * Result.Data[0][0] + Data[3][1] * Result.Data[1][0] + Data[3][2] * Result.Data[2][0]);
+		Result.Data[3][1] = -(Data[3][0] * Result.Data[0][1] + Data[3][1] * Result.Data[1][1] + Data[3][2] * Result.Data[2][1]);
+		Result.Data[3][2] = -(Data[3][0] * Result.Data[0][2] + Data[3][1] * Result.Data[1][2] + Data[3][2] * Result.Data[2][2]);
+		Result.Data[3][3] = 1.0f;
+
+		return Result;
+	}
+
+	/** @brief SSE 도입 이전의 스칼라 행렬 곱 */
+	FMatrix LegacyMultiply(const FMatrix& InA, const FMatrix& InB)
+	{
+		FMatrix Result;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				Result.Data[Row][Column] = InA.Data[Row][0] * InB.Data[0][Column] + InA.Data[Row][1] * InB.Data[1][Column]
+					+ InA.Data[Row][2] * InB.Data[2][Column] + InA.Data[Row][3] * InB.Data[3][Column];
+			}
+		}
+		return Result;
+	}
+
+	/** @brief 회전 + 비균등 스케일 + 이동으로 만든 아핀 행렬 (월드/뷰 행렬과 같은 형태) */
+	FMatrix MakeRandomAffineMatrix(std::mt19937& InRandom)
+	{
+		std::uniform_real_distribution<float> Angle(-PI, PI);
+		std::uniform_real_distribution<float> Scale(0.5f, 2.0f);
+		std::uniform_real_distribution<float> Offset(-100.0f, 100.0f);
+		return FMatrix::ScaleMatrix(FVector(Scale(InRandom), Scale(InRandom), Scale(InRandom)))
+			* FMatrix::RotationMatrix(FVector(Angle(InRandom), Angle(InRandom), Angle(InRandom)))
+			* FMatrix::TranslationMatrix(FVector(Offset(InRandom), Offset(InRandom), Offset(InRandom)));
+	}
+
+	double SumComponents(const FVector* InPoints, int32 InCount)
+	{
+		double Sum = 0.0;
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			Sum += InPoints[Index].X + InPoints[Index].Y + InPoints[Index].Z;
+		}
+		return Sum;
+	}
+
+	float MaxDifference(const FVector* InA, const FVector* InB, int32 InCount)
+	{
+		float MaxDiff = 0.0f;
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			MaxDiff = std::max(MaxDiff, std::abs(InA[Index].X - InB[Index].X));
+			MaxDiff = std::max(MaxDiff, std::abs(InA[Index].Y - InB[Index].Y));
+			MaxDiff = std::max(MaxDiff, std::abs(InA[Index].Z - InB[Index].Z));
+		}
+		return MaxDiff;
+	}
+
+	/** @return 지원하는 배치 경로 (Scalar, SSE, AVX2 순) */
+	TArray<EMathSIMDLevel> GetAvailableSIMDLevels()
+	{
+		TArray<EMathSIMDLevel> Levels = { EMathSIMDLevel::Scalar, EMathSIMDLevel::SSE };
+		if (FPlatformMisc::SupportsAVX2())
+		{
+			Levels.push_back(EMathSIMDLevel::AVX2);
+		}
+		return Levels;
+	}
+}
+
+/**
+ * @brief 점 배열 변환/투영을 점 단위 호출과 배치 API의 각 SIMD 경로로 비교
+ * 점 수는 오클루더/그림자 경계 계산 몇 프레임 분량, 결과는 점 단위 호출 결과와 대조한다
+ */
+IMPLEMENT_BENCHMARK(MathBatchTransform, "FVector 배열 변환/투영: 점 단위 호출 vs TransformPositions/TransformVectors/ProjectPoints (Scalar/SSE/AVX2)")
+{
+	std::mt19937 Random(2024);
+	std::uniform_real_distribution<float> Coordinate(-500.0f, 500.0f);
+
+	TArray<FVector> Points(NumPoints);
+	for (FVector& Point : Points)
+	{
+		Point = FVector(Coordinate(Random), Coordinate(Random), Coordinate(Random));
+	}
+
+	const FMatrix World = MakeRandomAffineMatrix(Random);
+	const FMatrix ViewProj = FMatrix::CreateLookAtLH(FVector(-800.0f, 0.0f, 300.0f), FVector(0.0f, 0.0f, 0.0f), FVector(0.0f, 0.0f, 1.0f))
+		* FMatrix::CreatePerspectiveFovLH(PI / 3.0f, 16.0f / 9.0f, 0.1f, 5000.0f);
+
+	TArray<FVector> ReferencePositions(NumPoints);
+	TArray<FVector> ReferenceVectors(NumPoints);
+	TArray<FVector4> ReferenceProjected(NumPoints);
+	TArray<FVector> OutPositions(NumPoints);
+	TArray<FVector4> OutProjected(NumPoints);
+
+	double Checksum = 0.0;
+	const double TotalPoints = static_cast<double>(NumPoints) * NumTransformPasses;
+
+	// 점 단위 호출
+	FScopeCycleCounter LegacyPositionCounter;
+	for (int32 Pass = 0; Pass < NumTransformPasses; ++Pass)
+	{
+		LegacyTransformPoints(World, Points.data(), ReferencePositions.data(), NumPoints);
+		Checksum += ReferencePositions[Pass].X;
+	}
+	const double LegacyPositionMilliseconds = LegacyPositionCounter.Finish();
+
+	FScopeCycleCounter LegacyVectorCounter;
+	for (int32 Pass = 0; Pass < NumTransformPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			ReferenceVectors[Index] = World.TransformVector(Points[Index]);
+		}
+		Checksum += ReferenceVectors[Pass].X;
+	}
+	const double LegacyVectorMilliseconds = LegacyVectorCounter.Finish();
+
+	FScopeCycleCounter LegacyProjectCounter;
+	for (int32 Pass = 0; Pass < NumTransformPasses; ++Pass)
+	{
+		LegacyProjectPoints(ViewProj, Points.data(), ReferenceProjected.data(), NumPoints);
+		Checksum += ReferenceProjected[Pass].X;
+	}
+	const double LegacyProjectMilliseconds = LegacyProjectCounter.Finish();
+
+	UE_LOG("  %d points x %d passes", NumPoints, NumTransformPasses);
+	UE_LOG("  Method | Position (ns/pt) | Vector (ns/pt) | Project (ns/pt) | Max |diff|");
+	UE_LOG("  Legacy | %16.2f | %14.2f | %15.2f |", LegacyPositionMilliseconds * 1.0e6 / TotalPoints,
+		LegacyVectorMilliseconds * 1.0e6 / TotalPoints, LegacyProjectMilliseconds * 1.0e6 / TotalPoints);
+
+	const EMathSIMDLevel PreviousLevel = FMatrix::GetSIMDLevel();
+	for (EMathSIMDLevel Level : GetAvailableSIMDLevels())
+	{
+		FMatrix::SetSIMDLevel(Level);
+
+		FScopeCycleCounter PositionCounter;
+		for (int32 Pass = 0; Pass < NumTransformPasses; ++Pass)
+		{
+			World.TransformPositions(Points.data(), OutPositions.data(), NumPoints);
+			Checksum += OutPositions[Pass].X;
+		}
+		const double PositionMilliseconds = PositionCounter.Finish();
+		float MaxDiff = MaxDifference(ReferencePositions.data(), OutPositions.data(), NumPoints);
+
+		FScopeCycleCounter VectorCounter;
+		for (int32 Pass = 0; Pass < NumTransformPasses; ++Pass)
+		{
+			World.TransformVectors(Points.data(), OutPositions.data(), NumPoints);
+			Checksum += OutPositions[Pass].X;
+		}
+		const double VectorMilliseconds = VectorCounter.Finish();
+		MaxDiff = std::max(MaxDiff, MaxDifference(ReferenceVectors.data(), OutPositions.data(), NumPoints));
+
+		FScopeCycleCounter ProjectCounter;
+		for (int32 Pass = 0; Pass < NumTransformPasses; ++Pass)
+		{
+			ViewProj.ProjectPoints(Points.data(), OutProjected.data(), NumPoints);
+			Checksum += OutProjected[Pass].X;
+		}
+		const double ProjectMilliseconds = ProjectCounter.Finish();
+
+		// 투영 결과는 카메라 뒤/근처 점에서 값이 커지므로 W가 충분히 큰 점만 NDC 차이를 본다
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			const FVector4& Reference = ReferenceProjected[Index];
+			const FVector4& Projected = OutProjected[Index];
+			if (Reference.W > 1.0f)
+			{
+				MaxDiff = std::max(MaxDiff, std::abs(Reference.X - Projected.X));
+				MaxDiff = std::max(MaxDiff, std::abs(Reference.Y - Projected.Y));
+				MaxDiff = std::max(MaxDiff, std::abs(Reference.Z - Projected.Z));
+			}
+		}
+
+		UE_LOG("  %s | %16.2f | %14.2f | %15.2f | %.2e", GetSIMDLevelName(Level), PositionMilliseconds * 1.0e6 / TotalPoints,
+			VectorMilliseconds * 1.0e6 / TotalPoints, ProjectMilliseconds * 1.0e6 / TotalPoints, MaxDiff);
+		if (MaxDiff > 1e-2f)
+		{
+			UE_LOG_ERROR("  %s 결과가 점 단위 호출과 다릅니다 (Max |diff| %f)", GetSIMDLevelName(Level), MaxDiff);
+		}
+	}
+	FMatrix::SetSIMDLevel(PreviousLevel);
+
+	Checksum += SumComponents(OutPositions.data(), NumPoints);
+	FBenchmarkRegistry::Consume(static_cast<uint64>(std::abs(Checksum)));
+}
+
+/**
+ * @brief 4x4 역행렬: 이전 스칼라 아핀 역행렬 vs SSE 2x2 블록 역행렬
+ * 아핀 행렬에서는 두 결과가 같아야 하고, 투영 행렬은 새 구현만 올바르게 뒤집는다
+ */
+IMPLEMENT_BENCHMARK(MathMatrixInverse, "FMatrix::Inverse: 이전 스칼라 아핀 역행렬 vs SSE 일반 4x4 역행렬")
+{
+	std::mt19937 Random(7);
+	TArray<FMatrix> Matrices(NumMatrices);
+	for (FMatrix& Matrix : Matrices)
+	{
+		Matrix = MakeRandomAffineMatrix(Random);
+	}
+
+	TArray<FMatrix> LegacyResults(NumMatrices);
+	TArray<FMatrix> Results(NumMatrices);
+
+	FScopeCycleCounter LegacyCounter;
+	for (int32 Pass = 0; Pass < NumMatrixPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			LegacyResults[Index] = LegacyAffineInverse(Matrices[Index]);
+		}
+	}
+	const double LegacyMilliseconds = LegacyCounter.Finish();
+
+	FScopeCycleCounter SIMDCounter;
+	for (int32 Pass = 0; Pass < NumMatrixPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			Results[Index] = Matrices[Index].Inverse();
+		}
+	}
+	const double SIMDMilliseconds = SIMDCounter.Finish();
+
+	float MaxDiff = 0.0f;
+	double Checksum = 0.0;
+	for (int32 Index = 0; Index < NumMatrices; ++Index)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				MaxDiff = std::max(MaxDiff, std::abs(LegacyResults[Index].Data[Row][Column] - Results[Index].Data[Row][Column]));
+				Checksum += Results[Index].Data[Row][Column];
+			}
+		}
+	}
+
+	// 투영 행렬은 이전 구현이 W 열을 무시하므로 M * Inverse(M)이 항등행렬이 되는지만 확인
+	const FMatrix Projection = FMatrix::CreatePerspectiveFovLH(PI / 3.0f, 16.0f / 9.0f, 0.1f, 5000.0f);
+	const FMatrix ProjectionIdentity = Projection * Projection.Inverse();
+	float ProjectionError = 0.0f;
+	for (int32 Row = 0; Row < 4; ++Row)
+	{
+		for (int32 Column = 0; Column < 4; ++Column)
+		{
+			ProjectionError = std::max(ProjectionError, std::abs(ProjectionIdentity.Data[Row][Column] - (Row == Column ? 1.0f : 0.0f)));
+		}
+	}
+
+	FBenchmarkRegistry::Consume(static_cast<uint64>(std::abs(Checksum)));
+	if (MaxDiff > 1e-3f)
+	{
+		UE_LOG_ERROR("  아핀 역행렬 결과 불일치: Max |diff| %f", MaxDiff);
+	}
+	if (ProjectionError > 1e-3f)
+	{
+		UE_LOG_ERROR("  투영 행렬 역행렬 오차: %f", ProjectionError);
+	}
+
+	const double TotalInverses = static_cast<double>(NumMatrices) * NumMatrixPasses;
+	UE_LOG("  %d affine matrices x %d passes", NumMatrices, NumMatrixPasses);
+	UE_LOG("  Method | Total (ms) | ns/inverse");
+	UE_LOG("  Legacy | %10.3f | %10.2f", LegacyMilliseconds, LegacyMilliseconds * 1.0e6 / TotalInverses);
+	UE_LOG("  SSE    | %10.3f | %10.2f", SIMDMilliseconds, SIMDMilliseconds * 1.0e6 / TotalInverses);
+	UE_LOG("  Max |diff| vs legacy %.2e, projection M * M^-1 error %.2e", MaxDiff, ProjectionError);
+}
+
+/**
+ * @brief 행렬 곱과 FVector4 * FMatrix의 스칼라 구현 대비 SIMD 구현 비용
+ */
+IMPLEMENT_BENCHMARK(MathMatrixMultiply, "FMatrix 곱 / FVector4 * FMatrix: 스칼라 vs SSE")
+{
+	std::mt19937 Random(11);
+	TArray<FMatrix> Matrices(NumMatrices);
+	for (FMatrix& Matrix : Matrices)
+	{
+		Matrix = MakeRandomAffineMatrix(Random);
+	}
+
+	std::uniform_real_distribution<float> Coordinate(-500.0f, 500.0f);
+	TArray<FVector4> Vectors(NumMatrices);
+	for (FVector4& Vector : Vectors)
+	{
+		Vector = FVector4(Coordinate(Random), Coordinate(Random), Coordinate(Random), 1.0f);
+	}
+
+	// 앞뒤 행렬을 곱해 누적 (계층 트랜스폼 결합과 같은 패턴)
+	double ScalarChecksum = 0.0;
+	FScopeCycleCounter ScalarMultiplyCounter;
+	for (int32 Pass = 0; Pass < NumMatrixPasses; ++Pass)
+	{
+		for (int32 Index = 1; Index < NumMatrices; ++Index)
+		{
+			ScalarChecksum += LegacyMultiply(Matrices[Index - 1], Matrices[Index]).Data[3][0];
+		}
+	}
+	const double ScalarMultiplyMilliseconds = ScalarMultiplyCounter.Finish();
+
+	double SIMDChecksum = 0.0;
+	FScopeCycleCounter SIMDMultiplyCounter;
+	for (int32 Pass = 0; Pass < NumMatrixPasses; ++Pass)
+	{
+		for (int32 Index = 1; Index < NumMatrices; ++Index)
+		{
+			SIMDChecksum += (Matrices[Index - 1] * Matrices[Index]).Data[3][0];
+		}
+	}
+	const double SIMDMultiplyMilliseconds = SIMDMultiplyCounter.Finish();
+
+	double ScalarVectorChecksum = 0.0;
+	FScopeCycleCounter ScalarVectorCounter;
+	for (int32 Pass = 0; Pass < NumMatrixPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			ScalarVectorChecksum += FMatrix::VectorMultiply(Vectors[Index], Matrices[Index]).X;
+		}
+	}
+	const double ScalarVectorMilliseconds = ScalarVectorCounter.Finish();
+
+	double SIMDVectorChecksum = 0.0;
+	FScopeCycleCounter SIMDVectorCounter;
+	for (int32 Pass = 0; Pass < NumMatrixPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumMatrices; ++Index)
+		{
+			SIMDVectorChecksum += (Vectors[Index] * Matrices[Index]).X;
+		}
+	}
+	const double SIMDVectorMilliseconds = SIMDVectorCounter.Finish();
+
+	FBenchmarkRegistry::Consume(static_cast<uint64>(std::abs(ScalarChecksum + SIMDChecksum + ScalarVectorChecksum + SIMDVectorChecksum)));
+	const double RelativeError = std::abs(ScalarChecksum - SIMDChecksum) / std::max(1.0, std::abs(ScalarChecksum));
+	if (RelativeError > 1e-4)
+	{
+		UE_LOG_ERROR("  행렬 곱 결과 불일치: Scalar %f, SSE %f", ScalarChecksum, SIMDChecksum);
+	}
+
+	const double TotalOperations = static_cast<double>(NumMatrices) * NumMatrixPasses;
+	UE_LOG("  %d matrices x %d passes", NumMatrices, NumMatrixPasses);
+	UE_LOG("  Operation         | Scalar (ns/op) | SSE (ns/op)");
+	UE_LOG("  FMatrix * FMatrix | %14.2f | %11.2f", ScalarMultiplyMilliseconds * 1.0e6 / TotalOperations, SIMDMultiplyMilliseconds * 1.0e6 / TotalOperations);
+	UE_LOG("  FVector4 * FMatrix| %14.2f | %11.2f", ScalarVectorMilliseconds * 1.0e6 / TotalOperations, SIMDVectorMilliseconds * 1.0e6 / TotalOperations);
+}
@@ -1,5 +1,7 @@
 #include "pch.h"
 
+#include <immintrin.h>
+
 
 FMatrix FMatrix::UEToDx = FMatrix(
 	{
@@ -182,12 +184,12 @@ FMatrix FMatrix::RotationMatrix(const FVector& InOtherVector)
 
 	float SP, SY, SR;
 	float CP, CY, CR;
-	SP = std::sinf(pitch);
-	CP = std::cosf(pitch);
-	SY = std::sinf(yaw);
-	CY = std::cosf(yaw);
-	SR = std::sinf(roll);
-	CR = std::cosf(roll);
+	SP = std::sin(pitch);
+	CP = std::cos(pitch);
+	SY = std::sin(yaw);
+	CY = std::cos(yaw);
+	SR = std::sin(roll);
+	CR = std::cos(roll);
 
 	// UE 표준 (Reference: RotationTranslationMatrix.h:72-85)
 	FMatrix Result;
@@ -235,8 +237,8 @@ FMatrix FMatrix::RotationMatrixInverse(const FVector& InOtherVector)
 FMatrix FMatrix::RotationX(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[1][1] = C;
 	Result.Data[1][2] = S;
@@ -252,8 +254,8 @@ FMatrix FMatrix::RotationX(float Radian)
 FMatrix FMatrix::RotationY(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	Result.Data[0][0] = C;
 	Result.Data[0][2] = -S;
@@ -269,8 +271,8 @@ FMatrix FMatrix::RotationY(float Radian)
 FMatrix FMatrix::RotationZ(float Radian)
 {
 	FMatrix Result = FMatrix::Identity();
-	const float C = std::cosf(Radian);
-	const float S = std::sinf(Radian);
+	const float C = std::cos(Radian);
+	const float S = std::sin(Radian);
 
 	// Left-Handed 좌표계에서 Z축 회전
 	Result.Data[0][0] = C;
@@ -465,39 +467,72 @@ FMatrix FMatrix::CreateFromRotator(const FRotator& InRotator)
 
 FMatrix FMatrix::Inverse() const
 {
-    FMatrix Result;
-
-    float Det = Data[0][0] * (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1])
-              - Data[0][1] * (Data[1][0] * Data[2][2] - Data[1][2] * Data[2][0])
-              + Data[0][2] * (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0]);
-
-    if (std::abs(Det) < 1e-6f)
+    // 블록 행렬 M = | A B |, 각 블록은 2x2 행렬을 (m00, m01, m10, m11) 순서로 __m128 하나에 담는다
+    //              | C D |
+    // M^-1 = 1/|M| * | X# Y# |  (X# = |D|A - B(D#C), W# = |A|D - C(A#B), ...)
+    //                | Z# W# |
+    const __m128 A = _mm_movelh_ps(V[0], V[1]);
+    const __m128 B = _mm_movehl_ps(V[1], V[0]);
+    const __m128 C = _mm_movelh_ps(V[2], V[3]);
+    const __m128 D = _mm_movehl_ps(V[3], V[2]);
+
+    // (|A|, |B|, |C|, |D|)
+    const __m128 DetSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(V[0], V[2], _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(V[1], V[3], _MM_SHUFFLE(3, 1, 3, 1))),
+        _mm_mul_ps(_mm_shuffle_ps(V[0], V[2], _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(V[1], V[3], _MM_SHUFFLE(2, 0, 2, 0))));
+    const __m128 DetA = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 DetB = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 DetC = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 DetD = _mm_shuffle_ps(DetSub, DetSub, _MM_SHUFFLE(3, 3, 3, 3));
+
+    // 2x2 곱 L*R, 수반행렬 곱 L#*R, L*R#
+    auto Mat2Mul = [](__m128 L, __m128 R)
+    {
+        return _mm_add_ps(_mm_mul_ps(L, _mm_shuffle_ps(R, R, _MM_SHUFFLE(3, 0, 3, 0))),
+            _mm_mul_ps(_mm_shuffle_ps(L, L, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(R, R, _MM_SHUFFLE(1, 2, 1, 2))));
+    };
+    auto Mat2AdjMul = [](__m128 L, __m128 R)
+    {
+        return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(L, L, _MM_SHUFFLE(0, 0, 3, 3)), R),
+            _mm_mul_ps(_mm_shuffle_ps(L, L, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(R, R, _MM_SHUFFLE(1, 0, 3, 2))));
+    };
+    auto Mat2MulAdj = [](__m128 L, __m128 R)
+    {
+        return _mm_sub_ps(_mm_mul_ps(L, _mm_shuffle_ps(R, R, _MM_SHUFFLE(0, 3, 0, 3))),
+            _mm_mul_ps(_mm_shuffle_ps(L, L, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(R, R, _MM_SHUFFLE(1, 2, 1, 2))));
+    };
+
+    const __m128 DC = Mat2AdjMul(D, C);
+    const __m128 AB = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(DetD, A), Mat2Mul(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(DetA, D), Mat2Mul(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(DetB, C), Mat2MulAdj(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(DetC, B), Mat2MulAdj(A, DC));
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    __m128 Trace = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+    Trace = _mm_add_ps(Trace, _mm_shuffle_ps(Trace, Trace, _MM_SHUFFLE(2, 3, 0, 1)));
+    Trace = _mm_add_ps(Trace, _mm_shuffle_ps(Trace, Trace, _MM_SHUFFLE(1, 0, 3, 2)));
+    const __m128 DetM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(DetA, DetD), _mm_mul_ps(DetB, DetC)), Trace);
+
+    if (std::abs(_mm_cvtss_f32(DetM)) < 1e-6f)
     {
         return FMatrix::Identity();
     }
 
-    float InvDet = 1.0f / Det;
-
-    Result.Data[0][0] = (Data[1][1] * Data[2][2] - Data[1][2] * Data[2][1]) * InvDet;
-    Result.Data[0][1] = (Data[0][2] * Data[2][1] - Data[0][1] * Data[2][2]) * InvDet;
-    Result.Data[0][2] = (Data[0][1] * Data[1][2] - Data[0][2] * Data[1][1]) * InvDet;
-    Result.Data[0][3] = 0.0f;
-
-    Result.Data[1][0] = (Data[1][2] * Data[2][0] - Data[1][0] * Data[2][2]) * InvDet;
-    Result.Data[1][1] = (Data[0][0] * Data[2][2] - Data[0][2] * Data[2][0]) * InvDet;
-    Result.Data[1][2] = (Data[0][2] * Data[1][0] - Data[0][0] * Data[1][2]) * InvDet;
-    Result.Data[1][3] = 0.0f;
-
-    Result.Data[2][0] = (Data[1][0] * Data[2][1] - Data[1][1] * Data[2][0]) * InvDet;
-    Result.Data[2][1] = (Data[0][1] * Data[2][0] - Data[0][0] * Data[2][1]) * InvDet;
-    Result.Data[2][2] = (Data[0][0] * Data[1][1] - Data[0][1] * Data[1][0]) * InvDet;
-    Result.Data[2][3] = 0.0f;
-
-    Result.Data[3][0] = -(Result.Data[0][0] * Data[3][0] + Result.Data[1][0] * Data[3][1] + Result.Data[2][0] * Data[3][2]);
-    Result.Data[3][1] = -(Result.Data[0][1] * Data[3][0] + Result.Data[1][1] * Data[3][1] + Result.Data[2][1] * Data[3][2]);
-    Result.Data[3][2] = -(Result.Data[0][2] * Data[3][0] + Result.Data[1][2] * Data[3][1] + Result.Data[2][2] * Data[3][2]);
-    Result.Data[3][3] = 1.0f;
+    // 수반행렬 부호 (+, -, -, +)를 역행렬식에 합쳐서 곱한다
+    const __m128 InvDetM = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), DetM);
+    X = _mm_mul_ps(X, InvDetM);
+    Y = _mm_mul_ps(Y, InvDetM);
+    Z = _mm_mul_ps(Z, InvDetM);
+    W = _mm_mul_ps(W, InvDetM);
 
+    // 수반행렬의 전치 배치와 행 저장 순서를 한 번의 셔플로 처리
+    FMatrix Result;
+    Result.V[0] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3));
+    Result.V[1] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+    Result.V[2] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3));
+    Result.V[3] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
     return Result;
 }
 
@@ -605,3 +640,340 @@ FMatrix FMatrix::CreateTranslation(const FVector& Translation)
 {
     return TranslationMatrix(Translation);
 }
+
+//
+// 배치 변환 커널
+// 입력은 FVector 배열(AoS)이며, 4개(SSE) 또는 8개(AVX2)씩 X/Y/Z 레지스터로 풀어서(SoA) 계산한 뒤 다시 AoS로 저장한다
+// 묶음에 못 미치는 나머지는 단일 점 함수로 처리한다
+//
+namespace
+{
+    static_assert(sizeof(FVector) == sizeof(float) * 3, "배치 커널은 FVector가 float 3개로 빈틈없이 놓여 있다고 가정합니다");
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define MATH_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+    // MSVC는 /arch 설정과 관계없이 AVX 인트린식을 컴파일하므로 실행 시점 분기만으로 충분
+    #define MATH_AVX2_TARGET
+#endif
+
+    EMathSIMDLevel& GetMutableSIMDLevel()
+    {
+        static EMathSIMDLevel Level = FPlatformMisc::SupportsAVX2() ? EMathSIMDLevel::AVX2 : EMathSIMDLevel::SSE;
+        return Level;
+    }
+
+    /**
+     * @brief 행렬의 각 원소를 레인 전체에 복제해 둔 것 (루프 밖에서 한 번만 만든다)
+     * __m128/__m256을 템플릿 인자로 넘기면 정렬 속성이 무시되므로 폭마다 따로 정의
+     */
+    struct FBroadcastMatrixSSE
+    {
+        __m128 M[4][4];
+    };
+
+    FBroadcastMatrixSSE BroadcastSSE(const FMatrix& InMatrix)
+    {
+        FBroadcastMatrixSSE Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = _mm_set1_ps(InMatrix.Data[Row][Column]);
+            }
+        }
+        return Result;
+    }
+
+    /** @brief 점 4개 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3)를 X/Y/Z로 분리 */
+    inline void LoadPoints4(const FVector* InPoints, __m128& OutX, __m128& OutY, __m128& OutZ)
+    {
+        const float* Source = &InPoints->X;
+        const __m128 A0 = _mm_loadu_ps(Source);
+        const __m128 A1 = _mm_loadu_ps(Source + 4);
+        const __m128 A2 = _mm_loadu_ps(Source + 8);
+
+        OutX = _mm_shuffle_ps(_mm_shuffle_ps(A0, A0, _MM_SHUFFLE(0, 3, 0, 0)), _mm_shuffle_ps(A1, A2, _MM_SHUFFLE(0, 1, 0, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutY = _mm_shuffle_ps(_mm_shuffle_ps(A0, A1, _MM_SHUFFLE(0, 0, 0, 1)), _mm_shuffle_ps(A1, A2, _MM_SHUFFLE(0, 2, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutZ = _mm_shuffle_ps(_mm_shuffle_ps(A0, A1, _MM_SHUFFLE(0, 1, 0, 2)), _mm_shuffle_ps(A2, A2, _MM_SHUFFLE(0, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    /** @brief LoadPoints4의 역변환 */
+    inline void StorePoints4(__m128 InX, __m128 InY, __m128 InZ, FVector* OutPoints)
+    {
+        float* Destination = &OutPoints->X;
+        _mm_storeu_ps(Destination, _mm_shuffle_ps(_mm_shuffle_ps(InX, InY, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(InZ, InX, _MM_SHUFFLE(0, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(Destination + 4, _mm_shuffle_ps(_mm_shuffle_ps(InY, InZ, _MM_SHUFFLE(0, 1, 0, 1)), _mm_shuffle_ps(InX, InY, _MM_SHUFFLE(0, 2, 0, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(Destination + 8, _mm_shuffle_ps(_mm_shuffle_ps(InZ, InX, _MM_SHUFFLE(0, 3, 0, 2)), _mm_shuffle_ps(InY, InZ, _MM_SHUFFLE(0, 3, 0, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+    /** @brief 열 InColumn에 대해 X*M0c + Y*M1c + Z*M2c (+ M3c) */
+    template <bool bAddTranslation>
+    inline __m128 TransformColumnSSE(const FBroadcastMatrixSSE& InMatrix, int32 InColumn, __m128 InX, __m128 InY, __m128 InZ)
+    {
+        __m128 Result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(InX, InMatrix.M[0][InColumn]), _mm_mul_ps(InY, InMatrix.M[1][InColumn])), _mm_mul_ps(InZ, InMatrix.M[2][InColumn]));
+        if (bAddTranslation)
+        {
+            Result = _mm_add_ps(Result, InMatrix.M[3][InColumn]);
+        }
+        return Result;
+    }
+
+    /** @return 처리한 점 수 (4의 배수) */
+    template <bool bIsPosition>
+    int32 TransformBatchSSE(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, int32 InCount)
+    {
+        const FBroadcastMatrixSSE M = BroadcastSSE(InMatrix);
+
+        int32 Index = 0;
+        for (; Index + 4 <= InCount; Index += 4)
+        {
+            __m128 X, Y, Z;
+            LoadPoints4(InPoints + Index, X, Y, Z);
+            StorePoints4(
+                TransformColumnSSE<bIsPosition>(M, 0, X, Y, Z),
+                TransformColumnSSE<bIsPosition>(M, 1, X, Y, Z),
+                TransformColumnSSE<bIsPosition>(M, 2, X, Y, Z),
+                OutPoints + Index);
+        }
+        return Index;
+    }
+
+    int32 ProjectBatchSSE(const FMatrix& InMatrix, const FVector* InPoints, FVector4* OutPoints, int32 InCount)
+    {
+        const FBroadcastMatrixSSE M = BroadcastSSE(InMatrix);
+        const __m128 Zero = _mm_setzero_ps();
+        const __m128 One = _mm_set1_ps(1.0f);
+
+        int32 Index = 0;
+        for (; Index + 4 <= InCount; Index += 4)
+        {
+            __m128 X, Y, Z;
+            LoadPoints4(InPoints + Index, X, Y, Z);
+            __m128 ClipX = TransformColumnSSE<true>(M, 0, X, Y, Z);
+            __m128 ClipY = TransformColumnSSE<true>(M, 1, X, Y, Z);
+            __m128 ClipZ = TransformColumnSSE<true>(M, 2, X, Y, Z);
+            __m128 ClipW = TransformColumnSSE<true>(M, 3, X, Y, Z);
+
+            // W가 0인 레인은 1로 나눠 원래 값을 유지
+            const __m128 NonZeroMask = _mm_cmpneq_ps(ClipW, Zero);
+            const __m128 SafeW = _mm_or_ps(_mm_and_ps(NonZeroMask, ClipW), _mm_andnot_ps(NonZeroMask, One));
+            ClipX = _mm_div_ps(ClipX, SafeW);
+            ClipY = _mm_div_ps(ClipY, SafeW);
+            ClipZ = _mm_div_ps(ClipZ, SafeW);
+
+            _MM_TRANSPOSE4_PS(ClipX, ClipY, ClipZ, ClipW);
+            _mm_storeu_ps(&OutPoints[Index + 0].X, ClipX);
+            _mm_storeu_ps(&OutPoints[Index + 1].X, ClipY);
+            _mm_storeu_ps(&OutPoints[Index + 2].X, ClipZ);
+            _mm_storeu_ps(&OutPoints[Index + 3].X, ClipW);
+        }
+        return Index;
+    }
+
+    struct FBroadcastMatrixAVX2
+    {
+        __m256 M[4][4];
+    };
+
+    MATH_AVX2_TARGET FBroadcastMatrixAVX2 BroadcastAVX2(const FMatrix& InMatrix)
+    {
+        FBroadcastMatrixAVX2 Result;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Column = 0; Column < 4; ++Column)
+            {
+                Result.M[Row][Column] = _mm256_set1_ps(InMatrix.Data[Row][Column]);
+            }
+        }
+        return Result;
+    }
+
+    /**
+     * @brief 점 8개 (float 24개)를 X/Y/Z로 분리
+     * 세 레지스터를 같은 인덱스로 치환하면 각 채널이 놓일 자리가 겹치지 않으므로 블렌드 두 번으로 합칠 수 있다
+     */
+    MATH_AVX2_TARGET inline void LoadPoints8(const FVector* InPoints, __m256& OutX, __m256& OutY, __m256& OutZ)
+    {
+        const float* Source = &InPoints->X;
+        const __m256 A0 = _mm256_loadu_ps(Source);
+        const __m256 A1 = _mm256_loadu_ps(Source + 8);
+        const __m256 A2 = _mm256_loadu_ps(Source + 16);
+
+        const __m256i IndexX = _mm256_setr_epi32(0, 3, 6, 1, 4, 7, 2, 5);
+        const __m256i IndexY = _mm256_setr_epi32(1, 4, 7, 2, 5, 0, 3, 6);
+        const __m256i IndexZ = _mm256_setr_epi32(2, 5, 0, 3, 6, 1, 4, 7);
+
+        OutX = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(A0, IndexX), _mm256_permutevar8x32_ps(A1, IndexX), 0x38), _mm256_permutevar8x32_ps(A2, IndexX), 0xC0);
+        OutY = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(A0, IndexY), _mm256_permutevar8x32_ps(A1, IndexY), 0x18), _mm256_permutevar8x32_ps(A2, IndexY), 0xE0);
+        OutZ = _mm256_blend_ps(_mm256_blend_ps(_mm256_permutevar8x32_ps(A0, IndexZ), _mm256_permutevar8x32_ps(A1, IndexZ), 0x1C), _mm256_permutevar8x32_ps(A2, IndexZ), 0xE0);
+    }
+
+    /** @brief LoadPoints8의 역변환 */
+    MATH_AVX2_TARGET inline void StorePoints8(__m256 InX, __m256 InY, __m256 InZ, FVector* OutPoints)
+    {
+        float* Destination = &OutPoints->X;
+        const __m256i Index0 = _mm256_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2);
+        const __m256i Index1 = _mm256_setr_epi32(2, 3, 3, 3, 4, 4, 4, 5);
+        const __m256i Index2 = _mm256_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7);
+
+        // 각 출력에서 첫 채널은 0, 3, 6번, 둘째 채널은 1, 4, 7번(0x92), 셋째 채널은 2, 5번(0x24) 자리
+        _mm256_storeu_ps(Destination, _mm256_blend_ps(_mm256_blend_ps(
+            _mm256_permutevar8x32_ps(InX, Index0), _mm256_permutevar8x32_ps(InY, Index0), 0x92), _mm256_permutevar8x32_ps(InZ, Index0), 0x24));
+        _mm256_storeu_ps(Destination + 8, _mm256_blend_ps(_mm256_blend_ps(
+            _mm256_permutevar8x32_ps(InZ, Index1), _mm256_permutevar8x32_ps(InX, Index1), 0x92), _mm256_permutevar8x32_ps(InY, Index1), 0x24));
+        _mm256_storeu_ps(Destination + 16, _mm256_blend_ps(_mm256_blend_ps(
+            _mm256_permutevar8x32_ps(InY, Index2), _mm256_permutevar8x32_ps(InZ, Index2), 0x92), _mm256_permutevar8x32_ps(InX, Index2), 0x24));
+    }
+
+    template <bool bAddTranslation>
+    MATH_AVX2_TARGET inline __m256 TransformColumnAVX2(const FBroadcastMatrixAVX2& InMatrix, int32 InColumn, __m256 InX, __m256 InY, __m256 InZ)
+    {
+        const __m256 Base = bAddTranslation ? InMatrix.M[3][InColumn] : _mm256_setzero_ps();
+        return _mm256_fmadd_ps(InX, InMatrix.M[0][InColumn], _mm256_fmadd_ps(InY, InMatrix.M[1][InColumn], _mm256_fmadd_ps(InZ, InMatrix.M[2][InColumn], Base)));
+    }
+
+    /** @return 처리한 점 수 (8의 배수) */
+    template <bool bIsPosition>
+    MATH_AVX2_TARGET int32 TransformBatchAVX2(const FMatrix& InMatrix, const FVector* InPoints, FVector* OutPoints, int32 InCount)
+    {
+        const FBroadcastMatrixAVX2 M = BroadcastAVX2(InMatrix);
+
+        int32 Index = 0;
+        for (; Index + 8 <= InCount; Index += 8)
+        {
+            __m256 X, Y, Z;
+            LoadPoints8(InPoints + Index, X, Y, Z);
+            StorePoints8(
+                TransformColumnAVX2<bIsPosition>(M, 0, X, Y, Z),
+                TransformColumnAVX2<bIsPosition>(M, 1, X, Y, Z),
+                TransformColumnAVX2<bIsPosition>(M, 2, X, Y, Z),
+                OutPoints + Index);
+        }
+
+        _mm256_zeroupper();
+        return Index;
+    }
+
+    MATH_AVX2_TARGET int32 ProjectBatchAVX2(const FMatrix& InMatrix, const FVector* InPoints, FVector4* OutPoints, int32 InCount)
+    {
+        const FBroadcastMatrixAVX2 M = BroadcastAVX2(InMatrix);
+        const __m256 Zero = _mm256_setzero_ps();
+        const __m256 One = _mm256_set1_ps(1.0f);
+
+        int32 Index = 0;
+        for (; Index + 8 <= InCount; Index += 8)
+        {
+            __m256 X, Y, Z;
+            LoadPoints8(InPoints + Index, X, Y, Z);
+            const __m256 ClipW = TransformColumnAVX2<true>(M, 3, X, Y, Z);
+            const __m256 SafeW = _mm256_blendv_ps(One, ClipW, _mm256_cmp_ps(ClipW, Zero, _CMP_NEQ_OQ));
+            const __m256 ClipX = _mm256_div_ps(TransformColumnAVX2<true>(M, 0, X, Y, Z), SafeW);
+            const __m256 ClipY = _mm256_div_ps(TransformColumnAVX2<true>(M, 1, X, Y, Z), SafeW);
+            const __m256 ClipZ = _mm256_div_ps(TransformColumnAVX2<true>(M, 2, X, Y, Z), SafeW);
+
+            // 128비트 레인별 4x4 전치: 레인 0은 점 0~3, 레인 1은 점 4~7
+            const __m256 XY0 = _mm256_unpacklo_ps(ClipX, ClipY);
+            const __m256 XY1 = _mm256_unpackhi_ps(ClipX, ClipY);
+            const __m256 ZW0 = _mm256_unpacklo_ps(ClipZ, ClipW);
+            const __m256 ZW1 = _mm256_unpackhi_ps(ClipZ, ClipW);
+            const __m256 P04 = _mm256_shuffle_ps(XY0, ZW0, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 P15 = _mm256_shuffle_ps(XY0, ZW0, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 P26 = _mm256_shuffle_ps(XY1, ZW1, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 P37 = _mm256_shuffle_ps(XY1, ZW1, _MM_SHUFFLE(3, 2, 3, 2));
+
+            float* Destination = &OutPoints[Index].X;
+            _mm256_storeu_ps(Destination, _mm256_permute2f128_ps(P04, P15, 0x20));
+            _mm256_storeu_ps(Destination + 8, _mm256_permute2f128_ps(P26, P37, 0x20));
+            _mm256_storeu_ps(Destination + 16, _mm256_permute2f128_ps(P04, P15, 0x31));
+            _mm256_storeu_ps(Destination + 24, _mm256_permute2f128_ps(P26, P37, 0x31));
+        }
+
+        _mm256_zeroupper();
+        return Index;
+    }
+
+    /** @brief 배치 커널과 같은 연산 순서의 단일 점 투영 */
+    FVector4 ProjectPoint(const FMatrix& InMatrix, const FVector& InPoint)
+    {
+        const float (*M)[4] = InMatrix.Data;
+        const float W = InPoint.X * M[0][3] + InPoint.Y * M[1][3] + InPoint.Z * M[2][3] + M[3][3];
+        const float SafeW = W != 0.0f ? W : 1.0f;
+        return FVector4(
+            (InPoint.X * M[0][0] + InPoint.Y * M[1][0] + InPoint.Z * M[2][0] + M[3][0]) / SafeW,
+            (InPoint.X * M[0][1] + InPoint.Y * M[1][1] + InPoint.Z * M[2][1] + M[3][1]) / SafeW,
+            (InPoint.X * M[0][2] + InPoint.Y * M[1][2] + InPoint.Z * M[2][2] + M[3][2]) / SafeW,
+            W);
+    }
+}
+
+EMathSIMDLevel FMatrix::GetSIMDLevel()
+{
+    return GetMutableSIMDLevel();
+}
+
+void FMatrix::SetSIMDLevel(EMathSIMDLevel InLevel)
+{
+    if (InLevel == EMathSIMDLevel::AVX2 && !FPlatformMisc::SupportsAVX2())
+    {
+        InLevel = EMathSIMDLevel::SSE;
+    }
+    GetMutableSIMDLevel() = InLevel;
+}
+
+void FMatrix::TransformPositions(const FVector* InPoints, FVector* OutPoints, int32 InCount) const
+{
+    const EMathSIMDLevel Level = GetMutableSIMDLevel();
+    int32 NumDone = 0;
+    if (Level == EMathSIMDLevel::AVX2)
+    {
+        NumDone = TransformBatchAVX2<true>(*this, InPoints, OutPoints, InCount);
+    }
+    if (Level != EMathSIMDLevel::Scalar)
+    {
+        NumDone += TransformBatchSSE<true>(*this, InPoints + NumDone, OutPoints + NumDone, InCount - NumDone);
+    }
+
+    for (int32 Index = NumDone; Index < InCount; ++Index)
+    {
+        OutPoints[Index] = TransformPosition(InPoints[Index]);
+    }
+}
+
+void FMatrix::TransformVectors(const FVector* InVectors, FVector* OutVectors, int32 InCount) const
+{
+    const EMathSIMDLevel Level = GetMutableSIMDLevel();
+    int32 NumDone = 0;
+    if (Level == EMathSIMDLevel::AVX2)
+    {
+        NumDone = TransformBatchAVX2<false>(*this, InVectors, OutVectors, InCount);
+    }
+    if (Level != EMathSIMDLevel::Scalar)
+    {
+        NumDone += TransformBatchSSE<false>(*this, InVectors + NumDone, OutVectors + NumDone, InCount - NumDone);
+    }
+
+    for (int32 Index = NumDone; Index < InCount; ++Index)
+    {
+        OutVectors[Index] = TransformVector(InVectors[Index]);
+    }
+}
+
+void FMatrix::ProjectPoints(const FVector* InPoints, FVector4* OutPoints, int32 InCount) const
+{
+    const EMathSIMDLevel Level = GetMutableSIMDLevel();
+    int32 NumDone = 0;
+    if (Level == EMathSIMDLevel::AVX2)
+    {
+        NumDone = ProjectBatchAVX2(*this, InPoints, OutPoints, InCount);
+    }
+    if (Level != EMathSIMDLevel::Scalar)
+    {
+        NumDone += ProjectBatchSSE(*this, InPoints + NumDone, OutPoints + NumDone, InCount - NumDone);
+    }
+
+    for (int32 Index = NumDone; Index < InCount; ++Index)
+    {
+        OutPoints[Index] = ProjectPoint(*this, InPoints[Index]);
+    }
+}
@@ -5,6 +5,16 @@ struct FVector;
 struct FVector4;
 struct FQuaternion;
 
+/**
+ * @brief 배치 변환 커널(TransformPositions 등)이 사용하는 SIMD 경로
+ */
+enum class EMathSIMDLevel : uint8
+{
+	Scalar,
+	SSE,
+	AVX2
+};
+
 struct FMatrix
 {
 	/**
@@ -116,6 +126,11 @@ struct FMatrix
 	static FMatrix CreateLookAtLH(const FVector& Eye, const FVector& Target, const FVector& Up);
 	
 	FMatrix Transpose() const;
+
+	/**
+	* @brief 일반 4x4 역행렬 (SSE 2x2 블록 분해)
+	* 행렬식이 0에 가까우면 항등행렬을 반환
+	*/
 	FMatrix Inverse() const;
 
 	FVector GetLocation() const;
@@ -127,6 +142,30 @@ struct FMatrix
 	FVector4 TransformVector4(const FVector4& V) const;
 	FVector TransformVector(const FVector& V) const;
 
+	/**
+	* @brief 점 배열을 한 번에 변환 (W = 1, TransformPosition과 같은 결과)
+	* InPoints와 OutPoints는 같은 배열이어도 된다
+	*/
+	void TransformPositions(const FVector* InPoints, FVector* OutPoints, int32 InCount) const;
+
+	/**
+	* @brief 방향 벡터 배열을 한 번에 변환 (W = 0, TransformVector와 같은 결과)
+	*/
+	void TransformVectors(const FVector* InVectors, FVector* OutVectors, int32 InCount) const;
+
+	/**
+	* @brief 점 배열을 동차 좌표로 변환한 뒤 W로 나눔
+	* OutPoints[i] = (X/W, Y/W, Z/W, W), W가 0이면 나누지 않으므로 유효성(W > 0 등)은 호출자가 W로 판단한다
+	*/
+	void ProjectPoints(const FVector* InPoints, FVector4* OutPoints, int32 InCount) const;
+
+	/**
+	* @brief 배치 커널의 SIMD 경로 (처음 사용할 때 CPU를 조사해 AVX2 > SSE 순서로 선택)
+	* SetSIMDLevel은 벤치마크/검증용이며, CPU가 지원하지 않는 경로를 요청하면 지원하는 최고 경로로 낮춘다
+	*/
+	static EMathSIMDLevel GetSIMDLevel();
+	static void SetSIMDLevel(EMathSIMDLevel InLevel);
+
 	// Additional projection matrix creation functions
 	static FMatrix CreatePerspectiveLH(float Width, float Height, float Near, float Far);
 	static FMatrix CreatePerspectiveFovLH(float FovY, float AspectRatio, float Near, float Far);
@@ -1,79 +1,461 @@
 #include "pch.h"
 #include "Global/Memory.h"
 
+#include <atomic>
+#include <cstring>
 #include <new>
 
+#if PLATFORM_WINDOWS
+#include <intrin.h>
+#endif
+
 using std::align_val_t;
 
-// XXX(KHJ): Atomic 처리할 필요가 있을까?
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+namespace
+{
+	constexpr int32 MaxTrackedThreads = 64;
+	constexpr int32 SharedCountersIndex = MaxTrackedThreads;
 
-/**
- * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
- * @param InSize 할당 size
- * @return 할당한 공간에서 할당 공간 정보를 저장한 헤더를 제외한 나머지 공간의 첫 메모리 주소
- */
-void* operator new(size_t InSize)
+	/**
+	 * @brief 스레드 하나의 할당 카운터
+	 * 슬롯을 차지한 스레드만 기록하므로 RMW 원자 연산 없이 relaxed load/store로 갱신한다
+	 * 다른 스레드가 할당한 블록을 해제하면 해제한 스레드의 값이 음수가 될 수 있으며, 합계만 의미가 있다
+	 * 멤버 초기화를 두지 않아 정적 초기화 이전의 할당에서도 0으로 채워진 상태로 안전하게 쓸 수 있다
+	 */
+	struct alignas(64) FThreadAllocationCounters
+	{
+		std::atomic<int64> Bytes;
+		std::atomic<int64> Count;
+		std::atomic<uint64> Calls;
+		std::atomic<uint64> SizeClassCounts[NumAllocationSizeClasses];
+		std::atomic<uint64> TagCounts[MaxAllocationTags];
+		std::atomic<uint64> TagBytes[MaxAllocationTags];
+	};
+
+	// 마지막 슬롯은 MaxTrackedThreads를 넘는 스레드들이 fetch_add로 함께 쓰는 공유 슬롯
+	FThreadAllocationCounters GThreadCounters[MaxTrackedThreads + 1];
+	std::atomic<int32> GNumClaimedSlots;
+
+	// 종료한 스레드가 반납한 슬롯 (카운터 값은 그대로 두고 다음 스레드가 이어서 누적)
+	int32 GFreeSlots[MaxTrackedThreads];
+	int32 GNumFreeSlots;
+	std::atomic<int32> GNumActiveSlots;
+	std::atomic<bool> GSlotLock;
+
+	// 태그 이름은 등록만 되고 지워지지 않으므로 읽는 쪽은 개수만 확인하면 된다
+	const char* GTagNames[MaxAllocationTags] = { "Untagged" };
+	std::atomic<int32> GNumTags{ 1 };
+	std::atomic<bool> GTagRegistryLock;
+
+	// 샘플 링 버퍼 (샘플링은 드물게 일어나므로 스핀 락 하나로 보호)
+	FAllocationSample GSamples[MaxAllocationSamples];
+	uint64 GNumSamplesWritten;
+	std::atomic<bool> GSampleLock;
+	std::atomic<uint32> GSampleInterval;
+
+	/**
+	 * @brief 스레드별 상태 (모두 상수 초기화되므로 TLS 초기화 비용이 없음)
+	 */
+	struct FThreadAllocationState
+	{
+		int32 SlotIndex = -1;
+		int32 Tag = UntaggedAllocationTag;
+		uint32 AllocationsUntilSample = 0;
+		// 콜스택 캡처 중 일어난 할당(심볼 로더 등)이 다시 샘플링되지 않도록 막음
+		bool bIsSampling = false;
+	};
+	thread_local FThreadAllocationState GThreadState;
+
+	void Lock(std::atomic<bool>& InLock)
+	{
+		while (InLock.exchange(true, std::memory_order_acquire))
+		{
+			FPlatformMisc::CpuPause();
+		}
+	}
+
+	void Unlock(std::atomic<bool>& InLock)
+	{
+		InLock.store(false, std::memory_order_release);
+	}
+
+	/**
+	 * @brief 스레드 종료 시 GThreadState의 슬롯을 반납
+	 * 스레드가 생성/종료를 반복해도 슬롯 64개가 바닥나지 않도록 반납된 슬롯을 다음 스레드가 재사용한다
+	 * 락의 acquire/release가 이전 스레드의 relaxed store를 다음 소유 스레드에 보이게 한다
+	 */
+	struct FThreadSlotReleaser
+	{
+		~FThreadSlotReleaser()
+		{
+			const int32 SlotIndex = GThreadState.SlotIndex;
+			if (SlotIndex < 0 || SlotIndex == SharedCountersIndex)
+			{
+				return;
+			}
+
+			// 이후 다른 TLS 소멸자에서 일어나는 할당/해제는 공유 슬롯에 기록
+			GThreadState.SlotIndex = SharedCountersIndex;
+
+			Lock(GSlotLock);
+			GFreeSlots[GNumFreeSlots++] = SlotIndex;
+			Unlock(GSlotLock);
+			GNumActiveSlots.fetch_sub(1, std::memory_order_relaxed);
+		}
+	};
+	thread_local FThreadSlotReleaser GThreadSlotReleaser;
+
+	int32 ClaimSlot()
+	{
+		int32 SlotIndex = SharedCountersIndex;
+
+		Lock(GSlotLock);
+		if (GNumFreeSlots > 0)
+		{
+			SlotIndex = GFreeSlots[--GNumFreeSlots];
+		}
+		Unlock(GSlotLock);
+
+		if (SlotIndex == SharedCountersIndex)
+		{
+			const int32 Claimed = GNumClaimedSlots.fetch_add(1, std::memory_order_relaxed);
+			if (Claimed >= MaxTrackedThreads)
+			{
+				return SharedCountersIndex;
+			}
+			SlotIndex = Claimed;
+		}
+
+		// 첫 접근에서 소멸자가 등록되도록 TLS 객체를 사용
+		(void)&GThreadSlotReleaser;
+		GNumActiveSlots.fetch_add(1, std::memory_order_relaxed);
+		return SlotIndex;
+	}
+
+	FThreadAllocationCounters& GetThreadCounters(FThreadAllocationState& InState, bool& bOutShared)
+	{
+		if (InState.SlotIndex < 0)
+		{
+			InState.SlotIndex = ClaimSlot();
+		}
+
+		bOutShared = InState.SlotIndex == SharedCountersIndex;
+		return GThreadCounters[InState.SlotIndex];
+	}
+
+	template <typename T>
+	void AddCounter(std::atomic<T>& InCounter, T InDelta, bool bInShared)
+	{
+		if (bInShared)
+		{
+			InCounter.fetch_add(InDelta, std::memory_order_relaxed);
+		}
+		else
+		{
+			InCounter.store(InCounter.load(std::memory_order_relaxed) + InDelta, std::memory_order_relaxed);
+		}
+	}
+
+	int32 GetSizeClass(size_t InSize)
+	{
+		if (InSize <= MinAllocationSizeClassBytes)
+		{
+			return 0;
+		}
+
+		// 마지막 구간보다 큰 값은 잘라서 32비트 비트 스캔으로 충분하게 한다
+		constexpr size_t MaxBoundedSize = MinAllocationSizeClassBytes << (NumAllocationSizeClasses - 2);
+		const uint32 Value = static_cast<uint32>(std::min(InSize - 1, MaxBoundedSize));
+#if PLATFORM_WINDOWS
+		unsigned long HighestBit;
+		_BitScanReverse(&HighestBit, Value);
+		const int32 NumBits = static_cast<int32>(HighestBit) + 1;
+#else
+		const int32 NumBits = 32 - __builtin_clz(Value);
+#endif
+		// 16B = 2^4 이므로 (InSize - 1)의 비트 수 - 4가 구간 번호
+		return NumBits - 4;
+	}
+
+	void RecordSample(FThreadAllocationState& InState, size_t InRequestedSize)
+	{
+		InState.bIsSampling = true;
+
+		FAllocationSample Sample;
+		// RecordSample, RecordAllocation, operator new 프레임은 제외
+		Sample.NumFrames = FPlatformMisc::CaptureCallstack(Sample.Frames, MaxAllocationSampleFrames, 3);
+		Sample.Tag = InState.Tag;
+		Sample.Size = InRequestedSize;
+
+		Lock(GSampleLock);
+		GSamples[GNumSamplesWritten % MaxAllocationSamples] = Sample;
+		++GNumSamplesWritten;
+		Unlock(GSampleLock);
+
+		InState.bIsSampling = false;
+	}
+
+	void RecordAllocation(size_t InRequestedSize, size_t InBlockSize)
+	{
+		FThreadAllocationState& State = GThreadState;
+		bool bShared;
+		FThreadAllocationCounters& Counters = GetThreadCounters(State, bShared);
+		AddCounter<int64>(Counters.Bytes, static_cast<int64>(InBlockSize), bShared);
+		AddCounter<int64>(Counters.Count, 1, bShared);
+		AddCounter<uint64>(Counters.Calls, 1, bShared);
+		AddCounter<uint64>(Counters.SizeClassCounts[GetSizeClass(InRequestedSize)], 1, bShared);
+		AddCounter<uint64>(Counters.TagCounts[State.Tag], 1, bShared);
+		AddCounter<uint64>(Counters.TagBytes[State.Tag], static_cast<uint64>(InRequestedSize), bShared);
+
+		const uint32 SampleInterval = GSampleInterval.load(std::memory_order_relaxed);
+		if (SampleInterval > 0 && !State.bIsSampling)
+		{
+			if (State.AllocationsUntilSample == 0 || State.AllocationsUntilSample > SampleInterval)
+			{
+				State.AllocationsUntilSample = SampleInterval;
+				RecordSample(State, InRequestedSize);
+			}
+			--State.AllocationsUntilSample;
+		}
+	}
+
+	void RecordFree(size_t InBlockSize)
+	{
+		bool bShared;
+		FThreadAllocationCounters& Counters = GetThreadCounters(GThreadState, bShared);
+		AddCounter<int64>(Counters.Bytes, -static_cast<int64>(InBlockSize), bShared);
+		AddCounter<int64>(Counters.Count, -1, bShared);
+	}
+}
+
+FAllocationStats FAllocationTracker::GetStats()
 {
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	FAllocationStats Stats;
+	int64 Bytes = 0;
+	int64 Count = 0;
+	for (const FThreadAllocationCounters& Counters : GThreadCounters)
+	{
+		Bytes += Counters.Bytes.load(std::memory_order_relaxed);
+		Count += Counters.Count.load(std::memory_order_relaxed);
+		Stats.TotalCalls += Counters.Calls.load(std::memory_order_relaxed);
+		for (int32 SizeClass = 0; SizeClass < NumAllocationSizeClasses; ++SizeClass)
+		{
+			Stats.SizeClassCounts[SizeClass] += Counters.SizeClassCounts[SizeClass].load(std::memory_order_relaxed);
+		}
+		for (int32 Tag = 0; Tag < MaxAllocationTags; ++Tag)
+		{
+			Stats.TagCounts[Tag] += Counters.TagCounts[Tag].load(std::memory_order_relaxed);
+			Stats.TagBytes[Tag] += Counters.TagBytes[Tag].load(std::memory_order_relaxed);
+		}
+	}
 
-	// Debug Print
-	// printf("New: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        InSize, TotalAllocationBytes, TotalAllocationCount);
+	// 다른 스레드가 갱신하는 도중에 읽으면 합계가 잠깐 음수일 수 있음
+	Stats.CurrentBytes = static_cast<uint64>(std::max<int64>(Bytes, 0));
+	Stats.CurrentCount = static_cast<uint64>(std::max<int64>(Count, 0));
+	return Stats;
+}
 
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(malloc(sizeof(AllocHeader) + InSize));
-	MemoryHeader->size = InSize;
-	MemoryHeader->bIsAligned = false;
+uint64 FAllocationTracker::GetCurrentBytes()
+{
+	int64 Bytes = 0;
+	for (const FThreadAllocationCounters& Counters : GThreadCounters)
+	{
+		Bytes += Counters.Bytes.load(std::memory_order_relaxed);
+	}
+	return static_cast<uint64>(std::max<int64>(Bytes, 0));
+}
 
-	return MemoryHeader + 1;
+uint64 FAllocationTracker::GetCurrentCount()
+{
+	int64 Count = 0;
+	for (const FThreadAllocationCounters& Counters : GThreadCounters)
+	{
+		Count += Counters.Count.load(std::memory_order_relaxed);
+	}
+	return static_cast<uint64>(std::max<int64>(Count, 0));
 }
 
-/**
- * @brief 오버로드된 함수로 생성 처리한 메모리 공간을 할당 해제하는 함수
- * @param InMemory 처음에 객체 할당용으로 제공된 메모리 주소
- */
-void operator delete(void* InMemory) noexcept
+uint64 FAllocationTracker::GetTotalCalls()
 {
-	if (!InMemory)
+	uint64 Calls = 0;
+	for (const FThreadAllocationCounters& Counters : GThreadCounters)
 	{
-		return;
+		Calls += Counters.Calls.load(std::memory_order_relaxed);
+	}
+	return Calls;
+}
+
+size_t FAllocationTracker::GetSizeClassUpperBound(int32 InSizeClass)
+{
+	if (InSizeClass < 0 || InSizeClass >= NumAllocationSizeClasses - 1)
+	{
+		return 0;
 	}
+	return MinAllocationSizeClassBytes << InSizeClass;
+}
+
+void FAllocationTracker::LogStats()
+{
+#if ENABLE_ALLOCATION_TRACKING
+	const FAllocationStats Stats = GetStats();
+	UE_LOG("Memory: %.2f MB in %llu blocks, %llu allocations total, %d threads tracked",
+		static_cast<double>(Stats.CurrentBytes) / (1024.0 * 1024.0),
+		static_cast<unsigned long long>(Stats.CurrentCount),
+		static_cast<unsigned long long>(Stats.TotalCalls),
+		GNumActiveSlots.load(std::memory_order_relaxed));
+
+	for (int32 SizeClass = 0; SizeClass < NumAllocationSizeClasses; ++SizeClass)
+	{
+		if (Stats.SizeClassCounts[SizeClass] == 0)
+		{
+			continue;
+		}
 
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(InMemory) - 1;
-	size_t MemoryAllocSize = MemoryHeader->size;
+		const double Percent = Stats.TotalCalls > 0
+			? 100.0 * static_cast<double>(Stats.SizeClassCounts[SizeClass]) / static_cast<double>(Stats.TotalCalls)
+			: 0.0;
+		const size_t UpperBound = GetSizeClassUpperBound(SizeClass);
+		if (UpperBound > 0)
+		{
+			UE_LOG("Memory:   <= %8zu B | %12llu | %5.1f%%", UpperBound,
+				static_cast<unsigned long long>(Stats.SizeClassCounts[SizeClass]), Percent);
+		}
+		else
+		{
+			UE_LOG("Memory:    > %8zu B | %12llu | %5.1f%%",
+				GetSizeClassUpperBound(NumAllocationSizeClasses - 2),
+				static_cast<unsigned long long>(Stats.SizeClassCounts[SizeClass]), Percent);
+		}
+	}
+#else
+	UE_LOG("Memory: 할당 추적이 꺼져 있습니다 (ENABLE_ALLOCATION_TRACKING 0)");
+#endif
+}
 
-	// Debug Print
-	// printf("Delete: Size=%zu, TotalBytes=%u, TotalCount=%u\n",
-	//        MemoryAllocSize, TotalAllocationBytes, TotalAllocationCount);
+int32 FAllocationTracker::RegisterTag(const char* InName)
+{
+	Lock(GTagRegistryLock);
 
-	if (TotalAllocationCount > 0)
+	int32 Tag = UntaggedAllocationTag;
+	const int32 NumTags = GNumTags.load(std::memory_order_relaxed);
+	for (int32 Index = 0; Index < NumTags; ++Index)
 	{
-		--TotalAllocationCount;
+		if (strcmp(GTagNames[Index], InName) == 0)
+		{
+			Tag = Index;
+			break;
+		}
 	}
-	else
+
+	if (Tag == UntaggedAllocationTag && strcmp(GTagNames[UntaggedAllocationTag], InName) != 0)
 	{
-		assert(!u8"allocation 처리한 객체보다 더 많은 수를 해제할 수 없음");
+		if (NumTags < MaxAllocationTags)
+		{
+			// 이름은 ALLOC_SCOPE의 문자열 리터럴이므로 복사하지 않고 보관
+			Tag = NumTags;
+			GTagNames[Tag] = InName;
+			GNumTags.store(NumTags + 1, std::memory_order_release);
+		}
+		else
+		{
+			UE_LOG_ERROR("Memory: 할당 태그가 가득 찼습니다 (%d개). %s는 Untagged로 집계됩니다", MaxAllocationTags, InName);
+		}
 	}
 
-	if (TotalAllocationBytes >= MemoryAllocSize)
+	Unlock(GTagRegistryLock);
+	return Tag;
+}
+
+const char* FAllocationTracker::GetTagName(int32 InTag)
+{
+	if (InTag < 0 || InTag >= GNumTags.load(std::memory_order_acquire))
 	{
-		TotalAllocationBytes -= static_cast<uint32>(MemoryAllocSize);
+		return "Unknown";
 	}
-	else
+	return GTagNames[InTag];
+}
+
+int32 FAllocationTracker::GetNumTags()
+{
+	return GNumTags.load(std::memory_order_acquire);
+}
+
+int32 FAllocationTracker::SetThreadTag(int32 InTag)
+{
+	FThreadAllocationState& State = GThreadState;
+	const int32 PreviousTag = State.Tag;
+	State.Tag = InTag;
+	return PreviousTag;
+}
+
+void FAllocationTracker::SetSampleInterval(uint32 InInterval)
+{
+	GSampleInterval.store(InInterval, std::memory_order_relaxed);
+}
+
+uint32 FAllocationTracker::GetSampleInterval()
+{
+	return GSampleInterval.load(std::memory_order_relaxed);
+}
+
+int32 FAllocationTracker::CopyRecentSamples(FAllocationSample* OutSamples, int32 InMaxSamples)
+{
+	Lock(GSampleLock);
+
+	const uint64 NumAvailable = std::min<uint64>(GNumSamplesWritten, MaxAllocationSamples);
+	const int32 NumCopied = static_cast<int32>(std::min<uint64>(NumAvailable, static_cast<uint64>(std::max(InMaxSamples, 0))));
+	// 가장 최근 것부터 거슬러 올라가며 복사
+	for (int32 Index = 0; Index < NumCopied; ++Index)
 	{
-		assert(!u8"allocation 처리한 메모리보다 더 많은 양의 메모리를 해제할 수 없음");
+		OutSamples[Index] = GSamples[(GNumSamplesWritten - 1 - Index) % MaxAllocationSamples];
 	}
 
-	if (MemoryHeader->bIsAligned)
+	Unlock(GSampleLock);
+	return NumCopied;
+}
+
+#if ENABLE_ALLOCATION_TRACKING
+
+/**
+ * @brief 전역 메모리 관리를 위한 메모리 할당자 오버로딩 함수
+ * 블록 앞에 헤더를 두지 않고, 해제 시 할당자에 블록의 실제 크기를 조회해 통계를 맞춘다
+ * @param InSize 할당 size
+ * @return 할당한 메모리 주소
+ */
+void* operator new(size_t InSize)
+{
+	void* Memory = malloc(InSize > 0 ? InSize : 1);
+	if (!Memory)
 	{
-		_aligned_free(MemoryHeader);
+		throw std::bad_alloc();
 	}
-	else
+
+	RecordAllocation(InSize, FPlatformMemory::GetAllocationSize(Memory));
+	return Memory;
+}
+
+/**
+ * @brief 오버로드된 함수로 생성 처리한 메모리 공간을 할당 해제하는 함수
+ * @param InMemory 처음에 객체 할당용으로 제공된 메모리 주소
+ */
+void operator delete(void* InMemory) noexcept
+{
+	if (!InMemory)
 	{
-		free(MemoryHeader);
+		return;
 	}
+
+	RecordFree(FPlatformMemory::GetAllocationSize(InMemory));
+	free(InMemory);
+}
+
+/**
+ * @brief 크기를 아는 delete (C++14 sized deallocation)
+ * 실제 블록 크기는 할당자에서 다시 읽으므로 단일 객체 delete로 넘긴다
+ */
+void operator delete(void* InMemory, size_t /*InSize*/) noexcept
+{
+	::operator delete(InMemory);
 }
 
 /**
@@ -96,37 +478,47 @@ void operator delete[](void* InMemory) noexcept
 	::operator delete(InMemory);
 }
 
+void operator delete[](void* InMemory, size_t /*InSize*/) noexcept
+{
+	::operator delete(InMemory);
+}
+
 // C++17에서 추가로 제공된 Align된 메모리에 대한 오버로딩 함수
-// SIMD 타입이 추후 필요한 것으로 보고 미리 구현해 둠
+// 정렬 블록은 항상 정렬 버전의 delete로 해제되므로 일반 블록과 구분하는 표시가 필요 없다
 
 void* operator new(size_t InSize, align_val_t InAlignment)
 {
-	size_t Alignment = static_cast<size_t>(InAlignment);
-
-	++TotalAllocationCount;
-	TotalAllocationBytes += static_cast<uint32>(InSize);
+	const size_t Alignment = static_cast<size_t>(InAlignment);
 
-	// XXX(KHJ): 헤더 크기도 정렬에 맞춰 패딩을 고려해야 할 수 있음
-	size_t TotalSize = sizeof(AllocHeader) + InSize;
+	void* Memory = FPlatformMemory::AlignedMalloc(InSize > 0 ? InSize : 1, Alignment);
+	if (!Memory)
+	{
+		throw std::bad_alloc();
+	}
 
-	// aligned_alloc 사용
-	// 크기는 정렬값의 배수로 처리해야 함
-	size_t AlignedTotalSize = (TotalSize + Alignment - 1) & ~(Alignment - 1);
+	RecordAllocation(InSize, FPlatformMemory::GetAlignedAllocationSize(Memory, Alignment));
+	return Memory;
+}
 
-#ifdef _MSC_VER
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(_aligned_malloc(AlignedTotalSize, Alignment));
-#else
-	AllocHeader* MemoryHeader = static_cast<AllocHeader*>(aligned_malloc(Alignment, AlignedTotalSize));
-#endif
+void operator delete(void* InMemory, align_val_t InAlignment) noexcept
+{
+	if (!InMemory)
+	{
+		return;
+	}
 
-	// 실제 할당된 크기를 저장
-	MemoryHeader->size = InSize;
-	MemoryHeader->bIsAligned = true;
+	RecordFree(FPlatformMemory::GetAlignedAllocationSize(InMemory, static_cast<size_t>(InAlignment)));
+	FPlatformMemory::AlignedFree(InMemory);
+}
 
-	return MemoryHeader + 1;
+void* operator new[](size_t InSize, align_val_t InAlignment)
+{
+	return ::operator new(InSize, InAlignment);
 }
 
-void operator delete(void* InMemory, align_val_t InAlignment) noexcept
+void operator delete[](void* InMemory, align_val_t InAlignment) noexcept
 {
-	::operator delete(InMemory);
+	::operator delete(InMemory, InAlignment);
 }
+
+#endif
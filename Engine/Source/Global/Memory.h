@@ -1,11 +1,114 @@
 #pragma once
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+/**
+ * 전역 operator new/delete 할당 추적 스위치
+ * 0이면 오버로딩을 정의하지 않아 표준 할당자를 그대로 쓰고, FAllocationTracker는 모두 0을 반환한다
+ */
+#ifndef ENABLE_ALLOCATION_TRACKING
+#define ENABLE_ALLOCATION_TRACKING 1
+#endif
 
-struct AllocHeader
+// 할당 크기 구간: 16B 이하, 32B 이하, ... 1MB 이하 (2의 거듭제곱 단위) + 1MB 초과
+constexpr size_t MinAllocationSizeClassBytes = 16;
+constexpr int32 NumAllocationSizeClasses = 18;
+
+// ALLOC_SCOPE 태그 최대 개수 (0번은 태그 밖의 할당을 모으는 Untagged)
+constexpr int32 MaxAllocationTags = 64;
+constexpr int32 UntaggedAllocationTag = 0;
+
+// 샘플링된 할당 하나에 저장하는 콜스택 깊이와 보관하는 최근 샘플 수
+constexpr int32 MaxAllocationSampleFrames = 16;
+constexpr int32 MaxAllocationSamples = 1024;
+
+/**
+ * @brief 모든 스레드의 할당 카운터를 합산한 결과
+ */
+struct FAllocationStats
+{
+	// 살아 있는 블록의 실제 크기 합 (할당자가 돌려준 사용 가능 크기 기준)
+	uint64 CurrentBytes = 0;
+	uint64 CurrentCount = 0;
+	// operator new 누적 호출 횟수 (해제해도 줄지 않으며 프레임별 할당 횟수 측정에 사용)
+	uint64 TotalCalls = 0;
+	// 요청 크기 구간별 누적 할당 횟수
+	uint64 SizeClassCounts[NumAllocationSizeClasses] = {};
+	// 태그별 누적 할당 횟수와 바이트 (요청 크기 기준, 해제해도 줄지 않음)
+	uint64 TagCounts[MaxAllocationTags] = {};
+	uint64 TagBytes[MaxAllocationTags] = {};
+};
+
+/**
+ * @brief 샘플링으로 콜스택을 기록한 할당 하나
+ */
+struct FAllocationSample
 {
-	size_t size;
-	bool bIsAligned;
+	void* Frames[MaxAllocationSampleFrames];
+	int32 NumFrames;
+	int32 Tag;
+	uint64 Size;
+};
+
+/**
+ * @brief 전역 operator new/delete 할당 통계
+ * 각 스레드는 자기 카운터만 경합 없이 갱신하고, 조회할 때 모든 스레드의 카운터를 합산한다
+ */
+struct FAllocationTracker
+{
+	static FAllocationStats GetStats();
+
+	static uint64 GetCurrentBytes();
+	static uint64 GetCurrentCount();
+	static uint64 GetTotalCalls();
+
+	/** @return 크기 구간의 상한 (마지막 구간은 상한이 없으므로 0) */
+	static size_t GetSizeClassUpperBound(int32 InSizeClass);
+
+	/** @brief 현재 사용량과 크기 구간별 할당 횟수를 로그로 출력 */
+	static void LogStats();
+
+	/**
+	 * @brief 태그 이름을 등록하고 번호를 반환 (같은 이름은 같은 번호)
+	 * @return 태그가 가득 찼으면 UntaggedAllocationTag
+	 */
+	static int32 RegisterTag(const char* InName);
+	static const char* GetTagName(int32 InTag);
+	static int32 GetNumTags();
+
+	/** @brief 현재 스레드의 할당 태그를 바꾸고 이전 태그를 반환 (ALLOC_SCOPE에서 사용) */
+	static int32 SetThreadTag(int32 InTag);
+
+	/**
+	 * @brief 스레드마다 InInterval번째 할당의 콜스택을 기록 (0이면 샘플링 끔)
+	 * 샘플은 최근 MaxAllocationSamples개만 링 버퍼에 남는다
+	 */
+	static void SetSampleInterval(uint32 InInterval);
+	static uint32 GetSampleInterval();
+
+	/** @return OutSamples에 복사한 최근 샘플 수 */
+	static int32 CopyRecentSamples(FAllocationSample* OutSamples, int32 InMaxSamples);
+};
+
+/**
+ * @brief 범위 안의 전역 할당을 태그에 귀속시키는 RAII 객체
+ * 중첩되면 가장 안쪽 태그가 우선하며, 스레드별로 따로 동작한다
+ */
+class FAllocScope
+{
+public:
+	explicit FAllocScope(int32 InTag) : PreviousTag(FAllocationTracker::SetThreadTag(InTag)) {}
+	~FAllocScope() { FAllocationTracker::SetThreadTag(PreviousTag); }
+
+	FAllocScope(const FAllocScope&) = delete;
+	FAllocScope& operator=(const FAllocScope&) = delete;
+
+private:
+	int32 PreviousTag;
 };
 
+#if ENABLE_ALLOCATION_TRACKING
+	#define ALLOC_SCOPE(Tag) \
+		static const int32 Tag##AllocTag = FAllocationTracker::RegisterTag(#Tag); \
+		FAllocScope Tag##AllocScope(Tag##AllocTag);
+#else
+	#define ALLOC_SCOPE(Tag)
+#endif
@@ -3,10 +3,11 @@
 #include "Component/Public/UUIDTextComponent.h"
 #include "Component/Public/PrimitiveComponent.h"
 
-#include "Level/Public/Level.h"
-
 namespace
 {
+	// 루트가 한 점으로 줄어들지 않도록 보장하는 최소 반 크기
+	constexpr float MinRootHalfExtent = 0.5f;
+
 	FAABB GetPrimitiveBoundingBox(UPrimitiveComponent* InPrimitive)
 	{
 		FVector Min, Max;
@@ -14,33 +15,57 @@ namespace
 
 		return FAABB(Min, Max);
 	}
+
+	bool IsInsideCell(const FOctreeNode& InNode, const FVector& InPoint)
+	{
+		return std::fabs(InPoint.X - InNode.Center.X) <= InNode.HalfExtent.X
+			&& std::fabs(InPoint.Y - InNode.Center.Y) <= InNode.HalfExtent.Y
+			&& std::fabs(InPoint.Z - InNode.Center.Z) <= InNode.HalfExtent.Z;
+	}
+
+	/** @brief 반 크기가 자식 셀 이하인지 (중심이 자식 셀 안에 있으면 자식의 LooseBounds에 완전히 포함됨) */
+	bool FitsInChild(const FOctreeNode& InNode, const FVector& InHalfSize)
+	{
+		return InHalfSize.X <= InNode.HalfExtent.X * 0.5f
+			&& InHalfSize.Y <= InNode.HalfExtent.Y * 0.5f
+			&& InHalfSize.Z <= InNode.HalfExtent.Z * 0.5f;
+	}
+
+	/** @brief 중심이 속한 자식 번호 (bit 0: +X, bit 1: +Y, bit 2: +Z) */
+	int32 GetChildSlot(const FOctreeNode& InNode, const FVector& InPoint)
+	{
+		return (InPoint.X >= InNode.Center.X ? 1 : 0)
+			| (InPoint.Y >= InNode.Center.Y ? 2 : 0)
+			| (InPoint.Z >= InNode.Center.Z ? 4 : 0);
+	}
 }
 
 FOctree::FOctree()
-	: BoundingVolume(), Depth(0)
+	: FOctree(FAABB())
 {
-	Children.resize(8);
 }
 
-FOctree::FOctree(const FAABB& InBoundingBox, int InDepth)
-	: BoundingVolume(InBoundingBox), Depth(InDepth)
+FOctree::FOctree(const FAABB& InRootBounds)
 {
-	Children.resize(8);
+	Nodes.resize(1);
+	InitializeNode(Nodes[RootNodeIndex], InRootBounds.GetCenter(), (InRootBounds.Max - InRootBounds.Min) * 0.5f, -1, 0);
 }
 
-FOctree::FOctree(const FVector& InPosition, float InSize, int InDepth)
-	: Depth(InDepth)
+FOctree::~FOctree()
 {
-	const float HalfSize = InSize * 0.5f;
-	BoundingVolume.Min = InPosition - FVector(HalfSize, HalfSize, HalfSize);
-	BoundingVolume.Max = InPosition + FVector(HalfSize, HalfSize, HalfSize);
-	Children.resize(8);
+	// 프리미티브가 이미 해제되었을 수 있으므로 Back-pointer는 건드리지 않음
+	Nodes.clear();
 }
 
-FOctree::~FOctree()
+void FOctree::InitializeNode(FOctreeNode& OutNode, const FVector& InCenter, const FVector& InHalfExtent, int32 InParent, int32 InDepth)
 {
-	Primitives.clear();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	OutNode.Center = InCenter;
+	OutNode.HalfExtent = InHalfExtent;
+	OutNode.LooseBounds = FAABB(InCenter - InHalfExtent * 2.0f, InCenter + InHalfExtent * 2.0f);
+	OutNode.Parent = InParent;
+	OutNode.FirstChild = -1;
+	OutNode.Depth = InDepth;
+	OutNode.Primitives.clear();
 }
 
 bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
@@ -48,146 +73,195 @@ bool FOctree::Insert(UPrimitiveComponent* InPrimitive)
 	// nullptr 체크
 	if (!InPrimitive) { return false; }
 
-	// 0. 영역 내에 객체가 없으면 종료
-	if (BoundingVolume.IsIntersected(GetPrimitiveBoundingBox(InPrimitive)) == false) { return false; }
+	// 이미 들어 있다면 위치만 갱신
+	if (IsInOctree(InPrimitive)) { return Update(InPrimitive); }
+
+	// 0. 루트 영역 밖이면 종료
+	const int32 NodeIndex = FindTargetNode(GetPrimitiveBoundingBox(InPrimitive));
+	if (NodeIndex < 0) { return false; }
+
+	// 1. 대상 노드에 추가하고, 리프가 가득 찼다면 분할
+	AddToNode(NodeIndex, InPrimitive);
+	++NumPrimitives;
 
-	if (IsLeaf())
+	const FOctreeNode& Node = Nodes[NodeIndex];
+	if (Node.IsLeafNode() && Node.Primitives.size() > MAX_PRIMITIVES && Node.Depth < MAX_DEPTH)
 	{
-		// 리프 노드이며, 여유 공간이 있거나 최대 깊이에 도달했다면
-		if (Primitives.size() < MAX_PRIMITIVES || Depth == MAX_DEPTH)
-		{
-			Primitives.push_back(InPrimitive); // 해당 객체를 추가한다
-			return true;
-		}
-		else // 여유 공간이 없고, 최대 깊이에 도달하지 않았다면
-		{
-			// 분할 및 재귀적 추가를 한다
-			Subdivide(InPrimitive);
-			return true;
-		}
+		Subdivide(NodeIndex);
 	}
-	else
-	{
-		for (int Index = 0; Index < 8; ++Index)
-		{
-			// 자식 노드를 보유하고 있고, 영역 내에 해당 객체가 존재한다면
-			if (Children[Index] && Children[Index]->BoundingVolume.IsContains(GetPrimitiveBoundingBox(InPrimitive)))
-			{
-				return Children[Index]->Insert(InPrimitive); // 자식 노드에게 넘겨준다
-			}
-		}
+	return true;
+}
+
+bool FOctree::Update(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive) { return false; }
+
+	if (!IsInOctree(InPrimitive)) { return Insert(InPrimitive); }
 
-		Primitives.push_back(InPrimitive);
+	// 현재 노드에 그대로 속한다면 O(1)로 종료
+	if (ShouldStayInNode(Nodes[InPrimitive->OctreeNodeIndex], GetPrimitiveBoundingBox(InPrimitive)))
+	{
 		return true;
 	}
 
-	return false;
+	Remove(InPrimitive);
+	return Insert(InPrimitive);
 }
 
 bool FOctree::Remove(UPrimitiveComponent* InPrimitive)
 {
-	if (InPrimitive == nullptr) { return false; }
+	if (!IsInOctree(InPrimitive)) { return false; }
+
+	const int32 NodeIndex = InPrimitive->OctreeNodeIndex;
+	RemoveFromNode(InPrimitive);
+	--NumPrimitives;
 
-	// 경계 검사를 수행하지 않고 바로 탐색 시작
-    
-	// 1-A. 리프 노드인 경우 (현재 노드만 검사하면 됨)
-	if (IsLeaf())
+	// 프리미티브 수가 줄어든 조상 노드 중 자식을 합칠 수 있는 노드를 아래에서부터 병합
+	int32 MergeIndex = Nodes[NodeIndex].IsLeafNode() ? Nodes[NodeIndex].Parent : NodeIndex;
+	while (MergeIndex >= 0)
 	{
-		// O(N) 탐색을 통해 프리미티브 목록에서 제거를 시도합니다.
-		if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
+		TryMerge(MergeIndex);
+		if (!Nodes[MergeIndex].IsLeafNode())
 		{
-			*It = std::move(Primitives.back());
-			Primitives.pop_back();
-			return true;
+			break; // 병합되지 않았다면 위쪽 노드도 병합 조건을 만족하지 않음
 		}
-		return false; // 리프 노드에서 발견하지 못했으므로 탐색 종료
+		MergeIndex = Nodes[MergeIndex].Parent;
 	}
-    
-	// 1-B. 자식 노드가 있는 경우 (내부 노드)
-	else
+	return true;
+}
+
+void FOctree::Clear()
+{
+	for (FOctreeNode& Node : Nodes)
 	{
-		// 2. 현재 노드의 Primitives 목록에서 제거 시도 (선택 사항: 일부 트리는 내부 노드에도 프리미티브를 저장함)
-		if (auto It = std::find(Primitives.begin(), Primitives.end(), InPrimitive); It != Primitives.end())
+		for (UPrimitiveComponent* Primitive : Node.Primitives)
 		{
-			*It = std::move(Primitives.back());
-			Primitives.pop_back();
-			return true; // 현재 노드에서 제거 완료
+			Primitive->OctreeNodeIndex = -1;
+			Primitive->OctreeElementIndex = -1;
 		}
-       
-		// 3. 자식 노드 순회 (원래 등록되었을 위치를 재귀적으로 탐색)
-		bool bIsRemoved = false;
+	}
 
-		for (int Index = 0; Index < 8; ++Index)
-		{
-			// 💡 Children[Index]->Remove(InPrimitive) 호출 시, 
-			//    자식 노드 내부에서 다시 경계 검사가 수행되지 않도록 보장해야 합니다.
-			if (Children[Index] && Children[Index]->Remove(InPrimitive))
-			{
-				bIsRemoved = true;
-				break;
-			}
-		}
+	Nodes.resize(1);
+	Nodes[RootNodeIndex].Primitives.clear();
+	Nodes[RootNodeIndex].FirstChild = -1;
+	FreeChildBlocks.clear();
+	NumPrimitives = 0;
+}
 
-		// 4. 자식 노드에서 무언가 제거되었다면, 현재 노드를 합칠 수 있는지 검사
-		if (bIsRemoved) { TryMerge(); }
+void FOctree::Rebuild(const FAABB& InRootBounds)
+{
+	TArray<UPrimitiveComponent*> Primitives;
+	Primitives.reserve(NumPrimitives);
+	GetAllPrimitives(Primitives);
+
+	Clear();
+	InitializeNode(Nodes[RootNodeIndex], InRootBounds.GetCenter(), (InRootBounds.Max - InRootBounds.Min) * 0.5f, -1, 0);
 
-		return bIsRemoved;
+	// 새 루트 밖에 있는 프리미티브는 트리에서 빠진 상태로 남음 (IsInOctree == false)
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		Insert(Primitive);
 	}
+}
+
+void FOctree::GrowToInclude(const FAABB& InBounds)
+{
+	const FOctreeNode& Root = Nodes[RootNodeIndex];
+	const bool bIsEmptyRoot = Root.HalfExtent.X <= 0.0f && Root.HalfExtent.Y <= 0.0f && Root.HalfExtent.Z <= 0.0f;
 
+	// 처음에는 주어진 영역에 딱 맞추고, 이후로는 축마다 최소 두 배씩 키움
+	const FAABB Required = bIsEmptyRoot ? InBounds : Union(Root.GetCellBounds(), InBounds);
+	FVector HalfExtent = (Required.Max - Required.Min) * 0.5f;
+	if (!bIsEmptyRoot)
+	{
+		HalfExtent.X = std::max(HalfExtent.X, Root.HalfExtent.X * 2.0f);
+		HalfExtent.Y = std::max(HalfExtent.Y, Root.HalfExtent.Y * 2.0f);
+		HalfExtent.Z = std::max(HalfExtent.Z, Root.HalfExtent.Z * 2.0f);
+	}
+	HalfExtent.X = std::max(HalfExtent.X, MinRootHalfExtent);
+	HalfExtent.Y = std::max(HalfExtent.Y, MinRootHalfExtent);
+	HalfExtent.Z = std::max(HalfExtent.Z, MinRootHalfExtent);
+
+	const FVector Center = Required.GetCenter();
+	Rebuild(FAABB(Center - HalfExtent, Center + HalfExtent));
 }
 
-void FOctree::Clear()
+bool FOctree::IsInOctree(const UPrimitiveComponent* InPrimitive) const
 {
-	Primitives.clear();
-	for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	if (!InPrimitive) { return false; }
+
+	const int32 NodeIndex = InPrimitive->OctreeNodeIndex;
+	const int32 ElementIndex = InPrimitive->OctreeElementIndex;
+	return NodeIndex >= 0 && NodeIndex < static_cast<int32>(Nodes.size())
+		&& ElementIndex >= 0 && ElementIndex < static_cast<int32>(Nodes[NodeIndex].Primitives.size())
+		&& Nodes[NodeIndex].Primitives[ElementIndex] == InPrimitive;
 }
 
-void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const
+void FOctree::GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives, int32 InNodeIndex) const
 {
+	const FOctreeNode& Node = Nodes[InNodeIndex];
+
 	// 1. 현재 노드가 가진 프리미티브를 결과 배열에 추가합니다.
-	OutPrimitives.insert(OutPrimitives.end(), Primitives.begin(), Primitives.end());
+	OutPrimitives.insert(OutPrimitives.end(), Node.Primitives.begin(), Node.Primitives.end());
 
 	// 2. 리프 노드가 아니라면, 모든 자식 노드에 대해 재귀적으로 함수를 호출합니다.
-	if (!IsLeaf())
+	if (!Node.IsLeafNode())
+	{
+		for (int32 Child = Node.FirstChild; Child < Node.FirstChild + NumChildren; ++Child)
+		{
+			GetAllPrimitives(OutPrimitives, Child);
+		}
+	}
+}
+
+bool FOctree::QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives, int32 InNodeIndex) const
+{
+	const FOctreeNode& Node = Nodes[InNodeIndex];
+
+	// 1. 레이가 현재 노드와 겹치지 않으면 검사 생략.
+	if (!CheckIntersectionRayBox(InRay, Node.GetBoundingVolume()))
+	{
+		return false;
+	}
+
+	// 2. 현재 노드와 레이가 교차하므로, 이 노드에 직접 포함된 프리미티브들을 후보에 추가합니다.
+	OutPrimitives.insert(OutPrimitives.end(), Node.Primitives.begin(), Node.Primitives.end());
+
+	// 3. 리프 노드가 아니라면, 자식 노드를 재귀적으로 탐색합니다.
+	if (!Node.IsLeafNode())
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		for (int32 Child = Node.FirstChild; Child < Node.FirstChild + NumChildren; ++Child)
 		{
-			if (Children[Index]) { Children[Index]->GetAllPrimitives(OutPrimitives); }
+			QueryRay(InRay, OutPrimitives, Child);
 		}
 	}
+
+	return true;
 }
 
-TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount)
+TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount) const
 {
-	TArray<UPrimitiveComponent*> Candidates = GWorld->GetLevel()->GetDynamicPrimitives();
+	TArray<UPrimitiveComponent*> Candidates;
 	Candidates.reserve(MaxPrimitiveCount);
 	FNodeQueue NodeQueue;
 
-	float RootDistance = this->GetBoundingVolume().GetCenterDistanceSquared(FindPos);
-	NodeQueue.push({ RootDistance, this });
+	float RootDistance = GetRootNode().GetBoundingVolume().GetCenterDistanceSquared(FindPos);
+	NodeQueue.push({ RootDistance, RootNodeIndex });
 
 	while (!NodeQueue.empty() && Candidates.size() < MaxPrimitiveCount)
 	{
-		FOctree* CurrentNode = NodeQueue.top().second;
+		const FOctreeNode& CurrentNode = Nodes[NodeQueue.top().second];
 		NodeQueue.pop();
 
-		if (CurrentNode->IsLeafNode())
-		{
-			for (UPrimitiveComponent* Primitive : CurrentNode->GetPrimitives())
-			{
-				Candidates.push_back(Primitive);
-			}
-		}
-		else
+		// Loose Octree는 내부 노드도 프리미티브를 가짐
+		Candidates.insert(Candidates.end(), CurrentNode.Primitives.begin(), CurrentNode.Primitives.end());
+
+		if (!CurrentNode.IsLeafNode())
 		{
-			for (int i = 0; i < 8; ++i)
+			for (int32 Child = CurrentNode.FirstChild; Child < CurrentNode.FirstChild + NumChildren; ++Child)
 			{
-				FOctree* Child = CurrentNode->Children[i];
-				if (Child)
-				{
-					float ChildDistance = Child->GetBoundingVolume().GetCenterDistanceSquared(FindPos);
-					NodeQueue.push({ ChildDistance, Child });
-				}
+				float ChildDistance = Nodes[Child].GetBoundingVolume().GetCenterDistanceSquared(FindPos);
+				NodeQueue.push({ ChildDistance, Child });
 			}
 		}
 	}
@@ -195,96 +269,154 @@ TArray<UPrimitiveComponent*> FOctree::FindNearestPrimitives(const FVector& FindP
 	return Candidates;
 }
 
-void FOctree::Subdivide(UPrimitiveComponent* InPrimitive)
+/**
+ * @brief 프리미티브가 들어갈 가장 깊은 기존 노드를 찾음
+ * 중심을 따라 내려가되 자식 셀보다 큰 프리미티브는 현재 노드에 남긴다
+ * @return 루트 영역 밖이면 -1
+ */
+int32 FOctree::FindTargetNode(const FAABB& InBounds) const
 {
-	const FVector& Min = BoundingVolume.Min;
-	const FVector& Max = BoundingVolume.Max;
-	const FVector Center = (Min + Max) * 0.5f;
-
-	Children[0] = new FOctree(FAABB(FVector(Min.X, Center.Y, Min.Z), FVector(Center.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Left
-	Children[1] = new FOctree(FAABB(FVector(Center.X, Center.Y, Min.Z), FVector(Max.X, Max.Y, Center.Z)), Depth + 1); // Top-Back-Right
-	Children[2] = new FOctree(FAABB(FVector(Min.X, Center.Y, Center.Z), FVector(Center.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Left
-	Children[3] = new FOctree(FAABB(FVector(Center.X, Center.Y, Center.Z), FVector(Max.X, Max.Y, Max.Z)), Depth + 1); // Top-Front-Right
-	Children[4] = new FOctree(FAABB(FVector(Min.X, Min.Y, Min.Z), FVector(Center.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Left
-	Children[5] = new FOctree(FAABB(FVector(Center.X, Min.Y, Min.Z), FVector(Max.X, Center.Y, Center.Z)), Depth + 1); // Bottom-Back-Right
-	Children[6] = new FOctree(FAABB(FVector(Min.X, Min.Y, Center.Z), FVector(Center.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Left
-	Children[7] = new FOctree(FAABB(FVector(Center.X, Min.Y, Center.Z), FVector(Max.X, Center.Y, Max.Z)), Depth + 1); // Bottom-Front-Right
-
-	TArray<UPrimitiveComponent*> primitivesToMove = Primitives;
-	primitivesToMove.push_back(InPrimitive);
-	Primitives.clear();
-
-	for (UPrimitiveComponent* prim : primitivesToMove)
+	const FVector Center = InBounds.GetCenter();
+	const FVector HalfSize = (InBounds.Max - InBounds.Min) * 0.5f;
+
+	const FOctreeNode& Root = Nodes[RootNodeIndex];
+	if (!IsInsideCell(Root, Center) || !Root.LooseBounds.IsContains(InBounds))
+	{
+		return -1;
+	}
+
+	int32 NodeIndex = RootNodeIndex;
+	while (!Nodes[NodeIndex].IsLeafNode() && FitsInChild(Nodes[NodeIndex], HalfSize))
 	{
-		Insert(prim);
+		const FOctreeNode& Node = Nodes[NodeIndex];
+		NodeIndex = Node.FirstChild + GetChildSlot(Node, Center);
 	}
+	return NodeIndex;
 }
 
-void FOctree::TryMerge()
+bool FOctree::ShouldStayInNode(const FOctreeNode& InNode, const FAABB& InBounds) const
 {
-	// Case 1. 자식 노드가 존재하지 않으므로 종료
-	if (IsLeaf()) { return; }
-
-	// 모든 자식 노드가 리프 노드인지 확인
-	for (int Index = 0; Index < 8; ++Index)
+	const FVector Center = InBounds.GetCenter();
+	if (!IsInsideCell(InNode, Center) || !InNode.LooseBounds.IsContains(InBounds))
 	{
-		if (!Children[Index]->IsLeaf())
-		{
-			return; // 하나라도 리프가 아니면 합치지 않음
-		}
+		return false;
 	}
 
-	// 모든 자식 노드에 있는 프리미티브의 총 개수를 계산
-	uint32 TotalPrimitives = static_cast<uint32>(Primitives.size());
-	for (int Index = 0; Index < 8; ++Index)
+	// 더 깊은 자식으로 내려갈 수 있다면 재배치
+	return InNode.IsLeafNode() || !FitsInChild(InNode, (InBounds.Max - InBounds.Min) * 0.5f);
+}
+
+void FOctree::AddToNode(int32 InNodeIndex, UPrimitiveComponent* InPrimitive)
+{
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	InPrimitive->OctreeNodeIndex = InNodeIndex;
+	InPrimitive->OctreeElementIndex = static_cast<int32>(Node.Primitives.size());
+	Node.Primitives.push_back(InPrimitive);
+}
+
+void FOctree::RemoveFromNode(UPrimitiveComponent* InPrimitive)
+{
+	TArray<UPrimitiveComponent*>& Primitives = Nodes[InPrimitive->OctreeNodeIndex].Primitives;
+	const int32 ElementIndex = InPrimitive->OctreeElementIndex;
+
+	// 마지막 원소를 빈자리로 옮기고 옮겨진 프리미티브의 Back-pointer 갱신
+	UPrimitiveComponent* Moved = Primitives.back();
+	Primitives[ElementIndex] = Moved;
+	Moved->OctreeElementIndex = ElementIndex;
+	Primitives.pop_back();
+
+	InPrimitive->OctreeNodeIndex = -1;
+	InPrimitive->OctreeElementIndex = -1;
+}
+
+void FOctree::Subdivide(int32 InNodeIndex)
+{
+	// 블록 할당 중 노드 풀이 재할당될 수 있으므로 참조는 할당 이후에 얻음
+	const int32 FirstChild = AllocateChildBlock();
+
+	FOctreeNode& Node = Nodes[InNodeIndex];
+	const FVector ChildHalfExtent = Node.HalfExtent * 0.5f;
+	for (int32 Slot = 0; Slot < NumChildren; ++Slot)
 	{
-		TotalPrimitives += static_cast<uint32>(Children[Index]->Primitives.size());
+		const FVector ChildCenter(
+			Node.Center.X + ((Slot & 1) ? ChildHalfExtent.X : -ChildHalfExtent.X),
+			Node.Center.Y + ((Slot & 2) ? ChildHalfExtent.Y : -ChildHalfExtent.Y),
+			Node.Center.Z + ((Slot & 4) ? ChildHalfExtent.Z : -ChildHalfExtent.Z));
+		InitializeNode(Nodes[FirstChild + Slot], ChildCenter, ChildHalfExtent, InNodeIndex, Node.Depth + 1);
 	}
+	Node.FirstChild = FirstChild;
 
-	// 프리미티브 총 개수가 최대치보다 작으면 합치기 수행
-	if (TotalPrimitives <= MAX_PRIMITIVES)
+	// 자식 셀에 들어갈 수 있는 프리미티브만 내려보내고 큰 프리미티브는 현재 노드에 남김
+	TArray<UPrimitiveComponent*> PrimitivesToMove;
+	PrimitivesToMove.swap(Node.Primitives);
+	for (UPrimitiveComponent* Primitive : PrimitivesToMove)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		const FAABB Bounds = GetPrimitiveBoundingBox(Primitive);
+		const FOctreeNode& Parent = Nodes[InNodeIndex];
+		if (FitsInChild(Parent, (Bounds.Max - Bounds.Min) * 0.5f))
 		{
-			Primitives.insert(Primitives.end(), Children[Index]->Primitives.begin(), Children[Index]->Primitives.end());
+			AddToNode(Parent.FirstChild + GetChildSlot(Parent, Bounds.GetCenter()), Primitive);
 		}
+		else
+		{
+			AddToNode(InNodeIndex, Primitive);
+		}
+	}
 
-		// 모든 자식 노드를 메모리에서 해제
-		for (int Index = 0; Index < 8; ++Index) { SafeDelete(Children[Index]); }
+	// 한 자식에 몰렸다면 최대 깊이까지 계속 분할
+	for (int32 Child = FirstChild; Child < FirstChild + NumChildren; ++Child)
+	{
+		if (Nodes[Child].Primitives.size() > MAX_PRIMITIVES && Nodes[Child].Depth < MAX_DEPTH)
+		{
+			Subdivide(Child);
+		}
 	}
 }
 
-void FOctree::DeepCopy(FOctree* OutOctree) const
+void FOctree::TryMerge(int32 InNodeIndex)
 {
-	if (!OutOctree) { return; }
-
-	// 1) 필드 복사
-	OutOctree->BoundingVolume = BoundingVolume;
-	OutOctree->Depth = Depth;
+	// Case 1. 자식 노드가 존재하지 않으므로 종료
+	if (Nodes[InNodeIndex].IsLeafNode()) { return; }
 
-	// 2) 기존 대상의 프리미티브/자식 정리 후 초기화
-	//    - 프리미티브는 대입으로 교체
-	OutOctree->Primitives = Primitives; // shallow copy of pointers
+	const int32 FirstChild = Nodes[InNodeIndex].FirstChild;
 
-	//    - 기존 자식 노드 메모리 해제
-	for (FOctree* Child : OutOctree->Children)
+	// 모든 자식 노드가 리프 노드인지 확인하며 프리미티브 총 개수 계산
+	size_t TotalPrimitives = Nodes[InNodeIndex].Primitives.size();
+	for (int32 Child = FirstChild; Child < FirstChild + NumChildren; ++Child)
 	{
-		SafeDelete(Child);
+		if (!Nodes[Child].IsLeafNode())
+		{
+			return; // 하나라도 리프가 아니면 합치지 않음
+		}
+		TotalPrimitives += Nodes[Child].Primitives.size();
 	}
-	OutOctree->Children.clear();
-	OutOctree->Children.resize(8, nullptr);
 
-	// 3) 자식 재귀 복사
-	if (!IsLeaf())
+	// 경계에서 움직이는 프리미티브 때문에 분할/병합이 반복되지 않도록 분할 기준의 절반 이하일 때만 병합
+	if (TotalPrimitives > MAX_PRIMITIVES / 2) { return; }
+
+	for (int32 Child = FirstChild; Child < FirstChild + NumChildren; ++Child)
 	{
-		for (int Index = 0; Index < 8; ++Index)
+		for (UPrimitiveComponent* Primitive : Nodes[Child].Primitives)
 		{
-			if (Children[Index] != nullptr)
-			{
-				// 자식 노드 생성 후 재귀 복사
-				OutOctree->Children[Index] = new FOctree(Children[Index]->BoundingVolume, Children[Index]->Depth);
-				Children[Index]->DeepCopy(OutOctree->Children[Index]);
-			}
+			AddToNode(InNodeIndex, Primitive);
 		}
+		Nodes[Child].Primitives.clear();
 	}
+
+	Nodes[InNodeIndex].FirstChild = -1;
+	FreeChildBlocks.push_back(FirstChild);
+}
+
+int32 FOctree::AllocateChildBlock()
+{
+	if (!FreeChildBlocks.empty())
+	{
+		const int32 FirstChild = FreeChildBlocks.back();
+		FreeChildBlocks.pop_back();
+		return FirstChild;
+	}
+
+	const int32 FirstChild = static_cast<int32>(Nodes.size());
+	Nodes.resize(Nodes.size() + NumChildren);
+	return FirstChild;
 }
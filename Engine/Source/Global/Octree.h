@@ -4,46 +4,105 @@
 
 class UPrimitiveComponent;
 
-constexpr int MAX_PRIMITIVES = 16; 
-constexpr int MAX_DEPTH = 5;      
+constexpr int MAX_PRIMITIVES = 16;
+constexpr int MAX_DEPTH = 5;
 
+/**
+ * @brief Loose Octree 노드
+ * 셀(Center ± HalfExtent)을 두 배로 키운 LooseBounds를 가지며, 중심이 셀 안에 있고 크기가 셀 이하인 프리미티브는 LooseBounds에 완전히 포함된다
+ * 노드는 FOctree의 노드 풀에 저장되고 8개 자식은 풀에서 연속된 블록을 차지하므로 자식은 FirstChild ~ FirstChild + 7로 접근한다
+ */
+struct FOctreeNode
+{
+	FAABB LooseBounds;
+	FVector Center;
+	FVector HalfExtent;
+	int32 Parent = -1;
+	int32 FirstChild = -1;
+	int32 Depth = 0;
+	TArray<UPrimitiveComponent*> Primitives;
+
+	/** @brief 쿼리에 사용하는 영역 (셀이 아닌 Loose 영역) */
+	const FAABB& GetBoundingVolume() const { return LooseBounds; }
+	FAABB GetCellBounds() const { return FAABB(Center - HalfExtent, Center + HalfExtent); }
+	bool IsLeafNode() const { return FirstChild < 0; }
+	int32 GetFirstChild() const { return FirstChild; }
+	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
+};
+
+/**
+ * @brief 노드 풀 기반 Loose Octree
+ * 프리미티브는 자신이 들어 있는 노드를 Back-pointer로 기억하므로 Update/Remove는 트리를 탐색하지 않는다
+ * 루트는 생성 시 주어진 영역이며, 영역 밖 프리미티브가 생기면 GrowToInclude로 키운 뒤 전체를 재배치한다
+ */
 class FOctree
 {
 public:
+	static constexpr int32 NumChildren = 8;
+	static constexpr int32 RootNodeIndex = 0;
+
 	FOctree();
-	FOctree(const FVector& InPosition, float InSize, int InDepth);
-	FOctree(const FAABB& InBoundingBox, int InDepth);
+	explicit FOctree(const FAABB& InRootBounds);
 	~FOctree();
 
+	/**
+	 * @brief 프리미티브를 크기와 중심에 맞는 가장 깊은 노드에 삽입 (이미 들어 있으면 Update와 동일)
+	 * @return 루트 영역 밖이라 삽입하지 못하면 false
+	 */
 	bool Insert(UPrimitiveComponent* InPrimitive);
+
+	/**
+	 * @brief 움직인 프리미티브의 위치를 갱신
+	 * 현재 노드에 그대로 속하면 아무것도 하지 않고, 아니면 Back-pointer로 제거한 뒤 루트부터 다시 삽입한다
+	 * @return 루트 영역 밖으로 나가 트리에서 빠졌으면 false
+	 */
+	bool Update(UPrimitiveComponent* InPrimitive);
+
 	bool Remove(UPrimitiveComponent* InPrimitive);
 	void Clear();
 
-	void DeepCopy(FOctree* OutOctree) const;
+	/** @brief 루트를 새 영역으로 바꾸고 들어 있던 프리미티브를 모두 다시 삽입 */
+	void Rebuild(const FAABB& InRootBounds);
 
-	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
-	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount);
+	/** @brief 루트가 InBounds를 포함하도록 최소 두 배씩 키워 재배치 (연속으로 벗어나도 재배치 횟수가 로그로 제한됨) */
+	void GrowToInclude(const FAABB& InBounds);
 
-	const FAABB& GetBoundingVolume() const { return BoundingVolume; }
-	void SetBoundingVolume(const FAABB& InAABB) { BoundingVolume = InAABB; }
-	bool IsLeafNode() const { return IsLeaf(); }
-	const TArray<UPrimitiveComponent*>& GetPrimitives() const { return Primitives; }
-	TArray<FOctree*>& GetChildren() { return Children; }
-	const TArray<FOctree*>& GetChildren() const { return Children; }
+	bool IsInOctree(const UPrimitiveComponent* InPrimitive) const;
+
+	/** @brief 노드와 그 아래 모든 노드의 프리미티브 수집 */
+	void GetAllPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives, int32 InNodeIndex = RootNodeIndex) const;
+	/** @brief FindPos에 가까운 노드부터 프리미티브를 모아 MaxPrimitiveCount개를 넘으면 멈춤 (노드 단위이므로 조금 넘을 수 있음) */
+	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount) const;
+	/**
+	 * @brief Ray와 Loose 영역이 교차하는 노드의 프리미티브 수집 (Picking 후보)
+	 * @return InNodeIndex 노드가 Ray와 교차하지 않으면 false
+	 */
+	bool QueryRay(const FRay& InRay, TArray<UPrimitiveComponent*>& OutPrimitives, int32 InNodeIndex = RootNodeIndex) const;
+
+	const FOctreeNode& GetNode(int32 InNodeIndex) const { return Nodes[InNodeIndex]; }
+	const FOctreeNode& GetRootNode() const { return Nodes[RootNodeIndex]; }
+	const FAABB& GetBoundingVolume() const { return Nodes[RootNodeIndex].LooseBounds; }
+	int32 GetNumPrimitives() const { return NumPrimitives; }
 
 private:
-	bool IsLeaf() const { return Children[0] == nullptr; }
-	void Subdivide(UPrimitiveComponent* InPrimitive);
-	void TryMerge();
+	void InitializeNode(FOctreeNode& OutNode, const FVector& InCenter, const FVector& InHalfExtent, int32 InParent, int32 InDepth);
+	int32 FindTargetNode(const FAABB& InBounds) const;
+	bool ShouldStayInNode(const FOctreeNode& InNode, const FAABB& InBounds) const;
+	void AddToNode(int32 InNodeIndex, UPrimitiveComponent* InPrimitive);
+	void RemoveFromNode(UPrimitiveComponent* InPrimitive);
+	void Subdivide(int32 InNodeIndex);
+	void TryMerge(int32 InNodeIndex);
+	int32 AllocateChildBlock();
 
-	FAABB BoundingVolume;
-	int Depth;                       
-	TArray<UPrimitiveComponent*> Primitives;
-	TArray<FOctree*> Children;
+	// 0번은 루트, 이후 8개 단위 블록
+	TArray<FOctreeNode> Nodes;
+	// 병합으로 반납된 자식 블록의 시작 인덱스
+	TArray<int32> FreeChildBlocks;
+	int32 NumPrimitives = 0;
 };
 
 using FNodeQueue = std::priority_queue<
-	std::pair<float, FOctree*>,
-	std::vector<std::pair<float, FOctree*>>,
-	std::greater<std::pair<float, FOctree*>>
+	std::pair<float, int32>,
+	std::vector<std::pair<float, int32>>,
+	std::greater<std::pair<float, int32>>
 >;
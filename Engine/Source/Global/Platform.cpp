@@ -0,0 +1,7 @@
+#include "pch.h"
+#include "Global/Platform.h"
+
+#if PLATFORM_WINDOWS
+double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
+bool FWindowsPlatformTime::bInitialized = false;
+#endif
@@ -0,0 +1,320 @@
+#pragma once
+#include "Global/Types.h"
+
+/**
+ * @brief 플랫폼 추상화 레이어
+ * OS 의존 기능(고해상도 타이머, 정렬 할당, CPU 정보)을 한 곳에 모아
+ * 엔진 코어가 Windows 헤더에 직접 의존하지 않도록 합니다.
+ */
+#if defined(_WIN32)
+	#define PLATFORM_WINDOWS 1
+	#define PLATFORM_LINUX 0
+#elif defined(__linux__)
+	#define PLATFORM_WINDOWS 0
+	#define PLATFORM_LINUX 1
+#else
+	#error "지원하지 않는 플랫폼입니다"
+#endif
+
+#if PLATFORM_WINDOWS
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+	#include <malloc.h>
+	#include <intrin.h>
+#else
+	#include <time.h>
+	#include <cstdlib>
+	#include <malloc.h>
+	#include <execinfo.h>
+	#include <sys/mman.h>
+	#include <cpuid.h>
+
+	// winnt.h가 제공하는 인라인 강제 매크로
+	#ifndef FORCEINLINE
+		#define FORCEINLINE inline __attribute__((always_inline))
+	#endif
+#endif
+
+#include <thread>
+#include <emmintrin.h>
+
+#if PLATFORM_WINDOWS
+/**
+ * @brief QueryPerformanceCounter 기반 타이머
+ */
+class FWindowsPlatformTime
+{
+public:
+	static double GSecondsPerCycle; // 0
+	static bool bInitialized; // false
+
+	static void InitTiming()
+	{
+		if (!bInitialized)
+		{
+			bInitialized = true;
+
+			double Frequency = (double)GetFrequency();
+			if (Frequency <= 0.0)
+			{
+				Frequency = 1.0;
+			}
+
+			GSecondsPerCycle = 1.0 / Frequency;
+		}
+	}
+	static double GetSecondsPerCycle()
+	{
+		if (!bInitialized)
+		{
+			InitTiming();
+		}
+		return (double)GSecondsPerCycle;
+	}
+	static uint64 GetFrequency()
+	{
+		LARGE_INTEGER Frequency;
+		QueryPerformanceFrequency(&Frequency);
+		return Frequency.QuadPart;
+	}
+	static double ToMilliseconds(uint64 CycleDiff)
+	{
+		double Ms = static_cast<double>(CycleDiff)
+			* GetSecondsPerCycle()
+			* 1000.0;
+
+		return Ms;
+	}
+
+	static uint64 Cycles64()
+	{
+		LARGE_INTEGER CycleCount;
+		QueryPerformanceCounter(&CycleCount);
+		return (uint64)CycleCount.QuadPart;
+	}
+};
+
+typedef FWindowsPlatformTime FPlatformTime;
+#else
+/**
+ * @brief CLOCK_MONOTONIC 기반 타이머 (1 cycle = 1ns)
+ */
+class FLinuxPlatformTime
+{
+public:
+	static void InitTiming() {}
+	static double GetSecondsPerCycle() { return 1.0e-9; }
+	static uint64 GetFrequency() { return 1000000000ull; }
+	static double ToMilliseconds(uint64 CycleDiff)
+	{
+		return static_cast<double>(CycleDiff) * 1.0e-6;
+	}
+
+	static uint64 Cycles64()
+	{
+		timespec TimeSpec;
+		clock_gettime(CLOCK_MONOTONIC, &TimeSpec);
+		return static_cast<uint64>(TimeSpec.tv_sec) * 1000000000ull + static_cast<uint64>(TimeSpec.tv_nsec);
+	}
+};
+
+typedef FLinuxPlatformTime FPlatformTime;
+#endif
+
+/**
+ * @brief 정렬 메모리 할당 (operator new/delete 오버로딩을 거치지 않는 OS 할당)
+ */
+struct FPlatformMemory
+{
+	/**
+	 * @brief Malloc으로 받은 블록의 실제 사용 가능 크기 (요청 크기 이상)
+	 * 할당 추적이 블록 앞에 헤더를 두지 않고도 해제 시 크기를 알 수 있게 한다
+	 */
+	static size_t GetAllocationSize(void* InPtr)
+	{
+#if PLATFORM_WINDOWS
+		return _msize(InPtr);
+#else
+		return malloc_usable_size(InPtr);
+#endif
+	}
+
+	/** @brief AlignedMalloc으로 받은 블록의 실제 사용 가능 크기 */
+	static size_t GetAlignedAllocationSize(void* InPtr, size_t InAlignment)
+	{
+#if PLATFORM_WINDOWS
+		return _aligned_msize(InPtr, InAlignment, 0);
+#else
+		// posix_memalign 메모리는 일반 malloc 블록과 같은 방식으로 조회된다
+		(void)InAlignment;
+		return malloc_usable_size(InPtr);
+#endif
+	}
+
+	static void* AlignedMalloc(size_t InSize, size_t InAlignment)
+	{
+#if PLATFORM_WINDOWS
+		return _aligned_malloc(InSize, InAlignment);
+#else
+		// posix_memalign은 sizeof(void*)의 배수 정렬만 허용
+		if (InAlignment < sizeof(void*))
+		{
+			InAlignment = sizeof(void*);
+		}
+		void* Ptr = nullptr;
+		if (posix_memalign(&Ptr, InAlignment, InSize) != 0)
+		{
+			return nullptr;
+		}
+		return Ptr;
+#endif
+	}
+
+	static void AlignedFree(void* InPtr)
+	{
+#if PLATFORM_WINDOWS
+		_aligned_free(InPtr);
+#else
+		free(InPtr);
+#endif
+	}
+
+	/**
+	 * @brief 물리 메모리 없이 가상 주소 범위만 예약 (실패 시 nullptr)
+	 * 예약한 주소는 ReleaseVirtual 전까지 바뀌지 않으므로, 그 안에서 필요한 만큼만 CommitVirtual로 늘려 쓴다
+	 */
+	static void* ReserveVirtual(size_t InSize)
+	{
+#if PLATFORM_WINDOWS
+		return VirtualAlloc(nullptr, InSize, MEM_RESERVE, PAGE_NOACCESS);
+#else
+		void* Address = mmap(nullptr, InSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		return Address != MAP_FAILED ? Address : nullptr;
+#endif
+	}
+
+	/** @brief 예약한 범위의 일부를 읽기/쓰기 가능한 메모리로 확정 */
+	static bool CommitVirtual(void* InAddress, size_t InSize)
+	{
+#if PLATFORM_WINDOWS
+		return VirtualAlloc(InAddress, InSize, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+		return mprotect(InAddress, InSize, PROT_READ | PROT_WRITE) == 0;
+#endif
+	}
+
+	/** @brief ReserveVirtual로 받은 범위 전체를 반환 (InSize는 예약할 때의 크기) */
+	static void ReleaseVirtual(void* InAddress, size_t InSize)
+	{
+#if PLATFORM_WINDOWS
+		(void)InSize;
+		VirtualFree(InAddress, 0, MEM_RELEASE);
+#else
+		munmap(InAddress, InSize);
+#endif
+	}
+};
+
+/**
+ * @brief 기타 플랫폼 정보
+ */
+struct FPlatformMisc
+{
+	/** @brief 논리 코어 수 (조회 실패 시 1) */
+	static int32 NumberOfCores()
+	{
+		const uint32 Count = std::thread::hardware_concurrency();
+		return Count > 0 ? static_cast<int32>(Count) : 1;
+	}
+
+	/**
+	 * @brief AVX2와 FMA3를 모두 쓸 수 있는지 (CPU 지원 + OS의 YMM 레지스터 보존)
+	 * 처음 호출할 때 CPUID로 한 번만 조사한다
+	 */
+	static bool SupportsAVX2()
+	{
+		static const bool bSupported = DetectAVX2();
+		return bSupported;
+	}
+
+	/** @brief 스핀 대기 중 CPU에 양보 */
+	static void CpuPause()
+	{
+		_mm_pause();
+	}
+
+	/**
+	 * @brief 현재 콜스택의 반환 주소를 캡처
+	 * @param InSkipFrames 이 함수를 부른 쪽에서 건너뛸 프레임 수
+	 * @return OutFrames에 채운 프레임 수
+	 */
+	static int32 CaptureCallstack(void** OutFrames, int32 InMaxFrames, int32 InSkipFrames)
+	{
+#if PLATFORM_WINDOWS
+		return static_cast<int32>(::RtlCaptureStackBackTrace(static_cast<DWORD>(InSkipFrames + 1), static_cast<DWORD>(InMaxFrames), OutFrames, nullptr));
+#else
+		// backtrace는 건너뛰기를 지원하지 않으므로 여유분을 받아 앞부분을 버린다
+		void* Frames[64];
+		const int32 Skip = InSkipFrames + 1;
+		const int32 NumCaptured = backtrace(Frames, std::min(InMaxFrames + Skip, 64));
+		const int32 NumFrames = std::max(NumCaptured - Skip, 0);
+		for (int32 Index = 0; Index < NumFrames; ++Index)
+		{
+			OutFrames[Index] = Frames[Index + Skip];
+		}
+		return NumFrames;
+#endif
+	}
+
+private:
+	static bool DetectAVX2()
+	{
+		uint32 Leaf1[4] = {};
+		uint32 Leaf7[4] = {};
+		uint64 EnabledStates = 0;
+#if PLATFORM_WINDOWS
+		int32 Registers[4];
+		__cpuid(Registers, 0);
+		if (Registers[0] < 7)
+		{
+			return false;
+		}
+		__cpuid(Registers, 1);
+		memcpy(Leaf1, Registers, sizeof(Leaf1));
+		__cpuidex(Registers, 7, 0);
+		memcpy(Leaf7, Registers, sizeof(Leaf7));
+#else
+		if (__get_cpuid_max(0, nullptr) < 7)
+		{
+			return false;
+		}
+		__get_cpuid(1, &Leaf1[0], &Leaf1[1], &Leaf1[2], &Leaf1[3]);
+		__get_cpuid_count(7, 0, &Leaf7[0], &Leaf7[1], &Leaf7[2], &Leaf7[3]);
+#endif
+		// ECX: 12 = FMA, 27 = OSXSAVE, 28 = AVX
+		constexpr uint32 RequiredLeaf1 = (1u << 12) | (1u << 27) | (1u << 28);
+		if ((Leaf1[2] & RequiredLeaf1) != RequiredLeaf1)
+		{
+			return false;
+		}
+
+		// OS가 문맥 전환 시 XMM/YMM 상태를 저장하는지 (XCR0 비트 1, 2)
+#if PLATFORM_WINDOWS
+		EnabledStates = _xgetbv(0);
+#else
+		uint32 Low = 0;
+		uint32 High = 0;
+		__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+		EnabledStates = (static_cast<uint64>(High) << 32) | Low;
+#endif
+		if ((EnabledStates & 0x6) != 0x6)
+		{
+			return false;
+		}
+
+		// EBX: 5 = AVX2
+		return (Leaf7[1] & (1u << 5)) != 0;
+	}
+};
@@ -0,0 +1,231 @@
+#include "pch.h"
+#include "Global/Transform.h"
+
+namespace
+{
+	inline __m128 LoadVector(const FVector& InVector)
+	{
+		return _mm_set_ps(0.0f, InVector.Z, InVector.Y, InVector.X);
+	}
+
+	inline FVector StoreVector(__m128 InVector)
+	{
+		alignas(16) float Lanes[4];
+		_mm_store_ps(Lanes, InVector);
+		return FVector(Lanes[0], Lanes[1], Lanes[2]);
+	}
+
+	template <int Lane>
+	inline __m128 Splat(__m128 InVector)
+	{
+		return _mm_shuffle_ps(InVector, InVector, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+	}
+
+	/** @brief (X, Y, Z) 외적, W 성분은 0 */
+	inline __m128 Cross(__m128 InA, __m128 InB)
+	{
+		// A * B.yzx - A.yzx * B = (A x B).zxy 이므로 한 번 더 yzx로 돌려 맞춤
+		const __m128 AYZX = _mm_shuffle_ps(InA, InA, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 BYZX = _mm_shuffle_ps(InB, InB, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 Result = _mm_sub_ps(_mm_mul_ps(InA, BYZX), _mm_mul_ps(AYZX, InB));
+		return _mm_shuffle_ps(Result, Result, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	/** @brief FQuaternion::operator*와 같은 해밀턴 곱 */
+	inline __m128 QuaternionMultiply(__m128 InA, __m128 InB)
+	{
+		// _mm_set_ps는 (W, Z, Y, X) 순서
+		const __m128 SignX = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		const __m128 SignY = _mm_set_ps(-0.0f, -0.0f, 0.0f, 0.0f);
+		const __m128 SignZ = _mm_set_ps(-0.0f, 0.0f, 0.0f, -0.0f);
+
+		__m128 Result = _mm_mul_ps(Splat<3>(InA), InB);
+		// A.X * ( B.W, -B.Z,  B.Y, -B.X)
+		Result = _mm_add_ps(Result, _mm_mul_ps(Splat<0>(InA), _mm_xor_ps(_mm_shuffle_ps(InB, InB, _MM_SHUFFLE(0, 1, 2, 3)), SignX)));
+		// A.Y * ( B.Z,  B.W, -B.X, -B.Y)
+		Result = _mm_add_ps(Result, _mm_mul_ps(Splat<1>(InA), _mm_xor_ps(_mm_shuffle_ps(InB, InB, _MM_SHUFFLE(1, 0, 3, 2)), SignY)));
+		// A.Z * (-B.Y,  B.X,  B.W, -B.Z)
+		Result = _mm_add_ps(Result, _mm_mul_ps(Splat<2>(InA), _mm_xor_ps(_mm_shuffle_ps(InB, InB, _MM_SHUFFLE(2, 3, 0, 1)), SignZ)));
+		return Result;
+	}
+
+	inline __m128 QuaternionConjugate(__m128 InQuaternion)
+	{
+		return _mm_xor_ps(InQuaternion, _mm_set_ps(0.0f, -0.0f, -0.0f, -0.0f));
+	}
+
+	/** @brief FQuaternion::RotateVector(const FVector&)와 같은 회전 (ToRotationMatrix의 행 벡터 곱과 일치) */
+	inline __m128 QuaternionRotate(__m128 InQuaternion, __m128 InVector)
+	{
+		const __m128 VCrossQ = Cross(InVector, InQuaternion);
+		const __m128 TT = _mm_add_ps(VCrossQ, VCrossQ);
+		const __m128 Result = _mm_add_ps(InVector, _mm_mul_ps(TT, Splat<3>(InQuaternion)));
+		return _mm_add_ps(Result, Cross(TT, InQuaternion));
+	}
+
+	inline __m128 Reciprocal(__m128 InVector)
+	{
+		// W 성분은 0이므로 0 / 1로 계산해 0을 유지
+		return _mm_div_ps(_mm_set_ps(0.0f, 1.0f, 1.0f, 1.0f), _mm_add_ps(InVector, _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f)));
+	}
+}
+
+FTransform::FTransform()
+	: Rotation(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f))
+	, Translation(_mm_setzero_ps())
+	, Scale3D(_mm_set_ps(0.0f, 1.0f, 1.0f, 1.0f))
+{
+}
+
+FTransform::FTransform(const FVector& InLocation, const FQuaternion& InRotation, const FVector& InScale)
+	: Rotation(_mm_set_ps(InRotation.W, InRotation.Z, InRotation.Y, InRotation.X))
+	, Translation(LoadVector(InLocation))
+	, Scale3D(LoadVector(InScale))
+{
+}
+
+FTransform FTransform::Identity()
+{
+	return FTransform();
+}
+
+FVector FTransform::GetLocation() const
+{
+	return StoreVector(Translation);
+}
+
+FQuaternion FTransform::GetRotation() const
+{
+	alignas(16) float Lanes[4];
+	_mm_store_ps(Lanes, Rotation);
+	return FQuaternion(Lanes[0], Lanes[1], Lanes[2], Lanes[3]);
+}
+
+FVector FTransform::GetScale3D() const
+{
+	return StoreVector(Scale3D);
+}
+
+void FTransform::SetLocation(const FVector& InLocation)
+{
+	Translation = LoadVector(InLocation);
+}
+
+void FTransform::SetRotation(const FQuaternion& InRotation)
+{
+	Rotation = _mm_set_ps(InRotation.W, InRotation.Z, InRotation.Y, InRotation.X);
+}
+
+void FTransform::SetScale3D(const FVector& InScale)
+{
+	Scale3D = LoadVector(InScale);
+}
+
+FTransform FTransform::operator*(const FTransform& InOther) const
+{
+	FTransform Result;
+	Result.Rotation = QuaternionMultiply(Rotation, InOther.Rotation);
+	Result.Scale3D = _mm_mul_ps(Scale3D, InOther.Scale3D);
+	Result.Translation = InOther.TransformPosition(Translation);
+	return Result;
+}
+
+FTransform& FTransform::operator*=(const FTransform& InOther)
+{
+	*this = *this * InOther;
+	return *this;
+}
+
+FTransform FTransform::Inverse() const
+{
+	FTransform Result;
+	Result.Rotation = QuaternionConjugate(Rotation);
+	Result.Scale3D = Reciprocal(Scale3D);
+	// -(S^-1 * R^-1(T))
+	const __m128 InverseTranslation = _mm_mul_ps(Result.Scale3D, QuaternionRotate(Result.Rotation, Translation));
+	Result.Translation = _mm_sub_ps(_mm_setzero_ps(), InverseTranslation);
+	return Result;
+}
+
+FVector FTransform::TransformPosition(const FVector& InPosition) const
+{
+	return StoreVector(TransformPosition(LoadVector(InPosition)));
+}
+
+FVector FTransform::TransformVector(const FVector& InVector) const
+{
+	return StoreVector(QuaternionRotate(Rotation, _mm_mul_ps(LoadVector(InVector), Scale3D)));
+}
+
+FVector FTransform::InverseTransformPosition(const FVector& InPosition) const
+{
+	const __m128 Local = _mm_sub_ps(LoadVector(InPosition), Translation);
+	return StoreVector(_mm_mul_ps(QuaternionRotate(QuaternionConjugate(Rotation), Local), Reciprocal(Scale3D)));
+}
+
+FVector FTransform::InverseTransformVector(const FVector& InVector) const
+{
+	return StoreVector(_mm_mul_ps(QuaternionRotate(QuaternionConjugate(Rotation), LoadVector(InVector)), Reciprocal(Scale3D)));
+}
+
+__m128 FTransform::TransformPosition(__m128 InPosition) const
+{
+	return _mm_add_ps(QuaternionRotate(Rotation, _mm_mul_ps(InPosition, Scale3D)), Translation);
+}
+
+FMatrix FTransform::ToMatrix() const
+{
+	alignas(16) float Q[4];
+	alignas(16) float T[4];
+	alignas(16) float S[4];
+	_mm_store_ps(Q, Rotation);
+	_mm_store_ps(T, Translation);
+	_mm_store_ps(S, Scale3D);
+
+	const float X2 = Q[0] * Q[0], Y2 = Q[1] * Q[1], Z2 = Q[2] * Q[2];
+	const float XY = Q[0] * Q[1], XZ = Q[0] * Q[2], YZ = Q[1] * Q[2];
+	const float WX = Q[3] * Q[0], WY = Q[3] * Q[1], WZ = Q[3] * Q[2];
+
+	// FQuaternion::ToRotationMatrix의 각 행에 해당 축 스케일을 곱하고 마지막 행에 이동을 넣음 (S * R * T)
+	return FMatrix(
+		S[0] * (1.0f - 2.0f * (Y2 + Z2)), S[0] * 2.0f * (XY - WZ), S[0] * 2.0f * (XZ + WY), 0.0f,
+		S[1] * 2.0f * (XY + WZ), S[1] * (1.0f - 2.0f * (X2 + Z2)), S[1] * 2.0f * (YZ - WX), 0.0f,
+		S[2] * 2.0f * (XZ - WY), S[2] * 2.0f * (YZ + WX), S[2] * (1.0f - 2.0f * (X2 + Y2)), 0.0f,
+		T[0], T[1], T[2], 1.0f);
+}
+
+FMatrix FTransform::ToInverseMatrix() const
+{
+	alignas(16) float Q[4];
+	alignas(16) float T[4];
+	alignas(16) float S[4];
+	_mm_store_ps(Q, Rotation);
+	_mm_store_ps(T, Translation);
+	_mm_store_ps(S, Scale3D);
+
+	const float X2 = Q[0] * Q[0], Y2 = Q[1] * Q[1], Z2 = Q[2] * Q[2];
+	const float XY = Q[0] * Q[1], XZ = Q[0] * Q[2], YZ = Q[1] * Q[2];
+	const float WX = Q[3] * Q[0], WY = Q[3] * Q[1], WZ = Q[3] * Q[2];
+
+	// T^-1 * R^T * S^-1: 회전 행렬을 전치한 뒤 열마다 스케일로 나누고, 마지막 행은 -T를 같은 행렬로 변환
+	const float R[3][3] =
+	{
+		{ 1.0f - 2.0f * (Y2 + Z2), 2.0f * (XY - WZ), 2.0f * (XZ + WY) },
+		{ 2.0f * (XY + WZ), 1.0f - 2.0f * (X2 + Z2), 2.0f * (YZ - WX) },
+		{ 2.0f * (XZ - WY), 2.0f * (YZ + WX), 1.0f - 2.0f * (X2 + Y2) }
+	};
+	const float InvS[3] = { 1.0f / S[0], 1.0f / S[1], 1.0f / S[2] };
+
+	FMatrix Result = FMatrix::Identity();
+	for (int32 Column = 0; Column < 3; ++Column)
+	{
+		float Translated = 0.0f;
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			Result.Data[Row][Column] = R[Column][Row] * InvS[Column];
+			Translated += T[Row] * R[Column][Row];
+		}
+		Result.Data[3][Column] = -Translated * InvS[Column];
+	}
+	return Result;
+}
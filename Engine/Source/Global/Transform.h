@@ -0,0 +1,73 @@
+#pragma once
+
+struct FVector;
+struct FQuaternion;
+struct FMatrix;
+
+/**
+ * @brief 회전(쿼터니언), 이동, 스케일로 이루어진 트랜스폼 (SSE)
+ * FMatrix::GetModelMatrix(Location, Rotation, Scale)와 같은 S * R * T 변환을 나타내며, 행렬처럼 A * B는 A를 먼저 적용한 뒤 B를 적용한다
+ * 계층 합성(자식 World = 자식 Relative * 부모 World)을 행렬 곱 없이 쿼터니언 곱과 벡터 연산으로 처리한다
+ *
+ * 회전된 자식에 비균등 스케일의 부모가 있으면 행렬 곱은 전단(Shear)을 만들지만 트랜스폼은 이를 표현할 수 없으므로
+ * 스케일을 축별로 곱해 근사한다 (언리얼 FTransform과 같은 규칙)
+ */
+struct FTransform
+{
+	/** @brief 회전 (X, Y, Z, W) */
+	__m128 Rotation;
+	/** @brief 이동 (X, Y, Z, 0) */
+	__m128 Translation;
+	/** @brief 스케일 (X, Y, Z, 0) */
+	__m128 Scale3D;
+
+	/**
+	 * @brief 항등 트랜스폼
+	 */
+	FTransform();
+
+	FTransform(const FVector& InLocation, const FQuaternion& InRotation, const FVector& InScale);
+
+	static FTransform Identity();
+
+	FVector GetLocation() const;
+	FQuaternion GetRotation() const;
+	FVector GetScale3D() const;
+
+	void SetLocation(const FVector& InLocation);
+	void SetRotation(const FQuaternion& InRotation);
+	void SetScale3D(const FVector& InScale);
+
+	/**
+	 * @brief 자신을 먼저 적용한 뒤 InOther를 적용하는 트랜스폼
+	 * 회전 = this.Rotation * InOther.Rotation, 스케일 = 축별 곱, 이동 = InOther로 변환한 this.Translation
+	 */
+	FTransform operator*(const FTransform& InOther) const;
+	FTransform& operator*=(const FTransform& InOther);
+
+	/**
+	 * @brief 역 트랜스폼
+	 * 스케일이 비균등하고 회전이 있으면 근사값이므로, 정확한 역변환이 필요하면 InverseTransformPosition/ToInverseMatrix를 사용
+	 */
+	FTransform Inverse() const;
+
+	FVector TransformPosition(const FVector& InPosition) const;
+	FVector TransformVector(const FVector& InVector) const;
+
+	/** @brief (P - Translation)을 역회전한 뒤 스케일로 나눔 (스케일과 관계없이 정확) */
+	FVector InverseTransformPosition(const FVector& InPosition) const;
+	FVector InverseTransformVector(const FVector& InVector) const;
+
+	/**
+	 * @brief FMatrix::GetModelMatrix(Location, Rotation, Scale)와 같은 행렬
+	 */
+	FMatrix ToMatrix() const;
+
+	/**
+	 * @brief FMatrix::GetModelMatrixInverse(Location, Rotation, Scale)와 같은 행렬
+	 */
+	FMatrix ToInverseMatrix() const;
+
+private:
+	__m128 TransformPosition(__m128 InPosition) const;
+};
@@ -0,0 +1,153 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumChains = 256;
+	constexpr int32 ChainDepth = 256;
+	constexpr int32 NumPasses = 8;
+
+	/** @brief 자식 하나씩만 이어진 깊은 계층의 상대 트랜스폼 (노드 i의 부모는 같은 체인의 i - 1) */
+	struct FChainNode
+	{
+		FVector Location;
+		FQuaternion Rotation;
+		FVector Scale;
+	};
+
+	/** @brief FTransform 도입 이전 USceneComponent::GetWorldRotationAsQuaternion처럼 부모 체인을 따라 회전을 곱함 */
+	FQuaternion LegacyWorldRotation(const FChainNode* InChain, int32 InDepth)
+	{
+		FQuaternion Result = InChain[InDepth].Rotation;
+		for (int32 Depth = InDepth - 1; Depth >= 0; --Depth)
+		{
+			Result = Result * InChain[Depth].Rotation;
+		}
+		return Result;
+	}
+
+	float GetMaxDifference(const FMatrix& InA, const FMatrix& InB)
+	{
+		float MaxDiff = 0.0f;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				MaxDiff = std::max(MaxDiff, std::abs(InA.Data[Row][Column] - InB.Data[Row][Column]) / (1.0f + std::abs(InA.Data[Row][Column])));
+			}
+		}
+		return MaxDiff;
+	}
+}
+
+/**
+ * @brief 깊이 256인 체인 256개의 World 트랜스폼 계산: 노드마다 GetModelMatrix * 부모 행렬 vs FTransform 합성 후 행렬 한 번 변환
+ * World 회전/스케일 조회도 함께 비교 (이전: 부모 체인을 따라 회전 곱 + 행렬 행 길이, 이후: World FTransform에서 바로 읽음)
+ * 행렬 곱과 결과가 같도록 스케일은 노드마다 균등하게 둔다
+ */
+IMPLEMENT_BENCHMARK(TransformComposition, "깊은 계층 World 트랜스폼: 행렬 체인 vs FTransform 합성")
+{
+	constexpr int32 NumNodes = NumChains * ChainDepth;
+	std::mt19937 Random(20251017);
+	std::uniform_real_distribution<float> Offset(-2.0f, 2.0f);
+	std::uniform_real_distribution<float> Angle(-30.0f, 30.0f);
+	std::uniform_real_distribution<float> UniformScale(0.98f, 1.02f);
+
+	TArray<FChainNode> Nodes(NumNodes);
+	for (FChainNode& Node : Nodes)
+	{
+		const float Scale = UniformScale(Random);
+		Node.Location = FVector(Offset(Random), Offset(Random), Offset(Random));
+		Node.Rotation = FQuaternion::FromEuler(FVector(Angle(Random), Angle(Random), Angle(Random)));
+		Node.Scale = FVector(Scale, Scale, Scale);
+	}
+
+	// 1. 계층 합성 (행렬 경로는 합성 결과가 곧 렌더러가 쓰는 행렬)
+	TArray<FMatrix> MatrixWorlds(NumNodes);
+	FScopeCycleCounter MatrixCounter;
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		for (int32 Chain = 0; Chain < NumChains; ++Chain)
+		{
+			const int32 Base = Chain * ChainDepth;
+			MatrixWorlds[Base] = FMatrix::GetModelMatrix(Nodes[Base].Location, Nodes[Base].Rotation, Nodes[Base].Scale);
+			for (int32 Index = Base + 1; Index < Base + ChainDepth; ++Index)
+			{
+				MatrixWorlds[Index] = FMatrix::GetModelMatrix(Nodes[Index].Location, Nodes[Index].Rotation, Nodes[Index].Scale) * MatrixWorlds[Index - 1];
+			}
+		}
+	}
+	const double MatrixMilliseconds = MatrixCounter.Finish();
+
+	TArray<FTransform> TransformWorlds(NumNodes);
+	FScopeCycleCounter TransformCounter;
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		for (int32 Chain = 0; Chain < NumChains; ++Chain)
+		{
+			const int32 Base = Chain * ChainDepth;
+			TransformWorlds[Base] = FTransform(Nodes[Base].Location, Nodes[Base].Rotation, Nodes[Base].Scale);
+			for (int32 Index = Base + 1; Index < Base + ChainDepth; ++Index)
+			{
+				TransformWorlds[Index] = FTransform(Nodes[Index].Location, Nodes[Index].Rotation, Nodes[Index].Scale) * TransformWorlds[Index - 1];
+			}
+		}
+	}
+	const double TransformMilliseconds = TransformCounter.Finish();
+
+	// 렌더러가 컴포넌트마다 한 번 요청하는 행렬 변환
+	TArray<FMatrix> TransformMatrices(NumNodes);
+	FScopeCycleCounter ToMatrixCounter;
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		for (int32 Index = 0; Index < NumNodes; ++Index)
+		{
+			TransformMatrices[Index] = TransformWorlds[Index].ToMatrix();
+		}
+	}
+	const double ToMatrixMilliseconds = ToMatrixCounter.Finish();
+
+	// 2. World 회전/스케일 조회
+	double LegacyChecksum = 0.0;
+	FScopeCycleCounter LegacyQueryCounter;
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		const FQuaternion Rotation = LegacyWorldRotation(&Nodes[Index - Index % ChainDepth], Index % ChainDepth);
+		const FVector Scale = MatrixWorlds[Index].GetScale();
+		LegacyChecksum += Rotation.W + Scale.X;
+	}
+	const double LegacyQueryMilliseconds = LegacyQueryCounter.Finish();
+
+	double TransformChecksum = 0.0;
+	FScopeCycleCounter TransformQueryCounter;
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		const FQuaternion Rotation = TransformWorlds[Index].GetRotation();
+		const FVector Scale = TransformWorlds[Index].GetScale3D();
+		TransformChecksum += Rotation.W + Scale.X;
+	}
+	const double TransformQueryMilliseconds = TransformQueryCounter.Finish();
+
+	// 3. 결과 비교 (깊이가 깊을수록 두 경로의 부동소수점 오차가 쌓임)
+	float MaxDiff = 0.0f;
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		MaxDiff = std::max(MaxDiff, GetMaxDifference(MatrixWorlds[Index], TransformMatrices[Index]));
+	}
+	FBenchmarkRegistry::Consume(static_cast<uint64>(std::abs(LegacyChecksum + TransformChecksum)));
+	if (MaxDiff > 1.0e-2f || std::abs(LegacyChecksum - TransformChecksum) > 1.0e-3 * NumNodes)
+	{
+		UE_LOG_ERROR("  결과 불일치: 최대 상대 오차 %.2e, Checksum %f / %f", MaxDiff, LegacyChecksum, TransformChecksum);
+	}
+
+	const double NumCompositions = static_cast<double>(NumNodes) * NumPasses;
+	UE_LOG("  %d chains x depth %d, %d passes", NumChains, ChainDepth, NumPasses);
+	UE_LOG("  Method                 | Total (ms) | ns/node");
+	UE_LOG("  Matrix Chain           | %10.3f | %7.2f", MatrixMilliseconds, MatrixMilliseconds * 1.0e6 / NumCompositions);
+	UE_LOG("  FTransform Compose     | %10.3f | %7.2f", TransformMilliseconds, TransformMilliseconds * 1.0e6 / NumCompositions);
+	UE_LOG("  FTransform + ToMatrix  | %10.3f | %7.2f", TransformMilliseconds + ToMatrixMilliseconds, (TransformMilliseconds + ToMatrixMilliseconds) * 1.0e6 / NumCompositions);
+	UE_LOG("  Rotation/Scale Query   | Legacy %.3f ms, FTransform %.3f ms", LegacyQueryMilliseconds, TransformQueryMilliseconds);
+	UE_LOG("  Max relative diff      | %.2e", MaxDiff);
+}
@@ -10,6 +10,12 @@
 #include <unordered_set>
 #include <vector>
 #include <functional>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 template<typename T, typename Alloc = std::allocator<T>>
 using TArray = std::vector<T, Alloc>;
@@ -43,3 +49,262 @@ using uint32 = std::uint32_t;
 using int32 = std::int32_t;
 using uint64 = std::uint64_t;
 using int64 = std::int64_t;
+
+/**
+ * @brief 처음 N개 원소를 객체 안에 저장하고, 넘치면 힙으로 옮기는 배열
+ * 대부분 0~N개만 담는 오브젝트별 컨테이너(OwnedComponents, AttachChildren 등)가 별도 힙 블록을 갖지 않게 한다
+ * 인터페이스는 TArray(std::vector)와 같으며, 원소를 추가/삭제하거나 용량이 늘어나면 원소 주소가 바뀐다
+ * 한 번 힙으로 옮겨진 뒤에는 clear해도 힙 버퍼를 유지하고, 소멸하거나 다른 배열을 이동 대입받을 때 해제한다
+ */
+template <typename T, size_t N>
+class TInlineArray
+{
+	static_assert(N > 0, "TInlineArray는 최소 1개의 인라인 공간이 필요합니다");
+
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	TInlineArray() = default;
+
+	TInlineArray(std::initializer_list<T> InList)
+	{
+		assign(InList.begin(), InList.end());
+	}
+
+	template <typename InputIterator, typename = typename std::iterator_traits<InputIterator>::iterator_category>
+	TInlineArray(InputIterator InFirst, InputIterator InLast)
+	{
+		assign(InFirst, InLast);
+	}
+
+	TInlineArray(const TInlineArray& InOther)
+	{
+		assign(InOther.begin(), InOther.end());
+	}
+
+	TInlineArray(TInlineArray&& InOther) noexcept(std::is_nothrow_move_constructible_v<T>)
+	{
+		MoveFrom(InOther);
+	}
+
+	~TInlineArray()
+	{
+		clear();
+		ReleaseHeap();
+	}
+
+	TInlineArray& operator=(const TInlineArray& InOther)
+	{
+		if (this != &InOther)
+		{
+			assign(InOther.begin(), InOther.end());
+		}
+		return *this;
+	}
+
+	TInlineArray& operator=(TInlineArray&& InOther) noexcept(std::is_nothrow_move_constructible_v<T>)
+	{
+		if (this != &InOther)
+		{
+			clear();
+			ReleaseHeap();
+			MoveFrom(InOther);
+		}
+		return *this;
+	}
+
+	TInlineArray& operator=(std::initializer_list<T> InList)
+	{
+		assign(InList.begin(), InList.end());
+		return *this;
+	}
+
+	// Iterator
+	iterator begin() { return Data; }
+	iterator end() { return Data + Size; }
+	const_iterator begin() const { return Data; }
+	const_iterator end() const { return Data + Size; }
+	const_iterator cbegin() const { return Data; }
+	const_iterator cend() const { return Data + Size; }
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+	// Element Access
+	T& operator[](size_type InIndex) { return Data[InIndex]; }
+	const T& operator[](size_type InIndex) const { return Data[InIndex]; }
+	T& front() { return Data[0]; }
+	const T& front() const { return Data[0]; }
+	T& back() { return Data[Size - 1]; }
+	const T& back() const { return Data[Size - 1]; }
+	T* data() { return Data; }
+	const T* data() const { return Data; }
+
+	// Capacity
+	bool empty() const { return Size == 0; }
+	size_type size() const { return Size; }
+	size_type capacity() const { return Capacity; }
+	/** @brief 원소가 아직 객체 안의 공간에 있는지 여부 (힙 블록이 없음) */
+	bool IsInline() const { return Data == GetInlineData(); }
+
+	void reserve(size_type InCapacity)
+	{
+		if (InCapacity > Capacity)
+		{
+			Reallocate(InCapacity);
+		}
+	}
+
+	// Modifier
+	void clear()
+	{
+		std::destroy(begin(), end());
+		Size = 0;
+	}
+
+	template <typename... ArgTypes>
+	T& emplace_back(ArgTypes&&... InArgs)
+	{
+		if (Size == Capacity)
+		{
+			// 인자가 자기 원소를 가리킬 수 있으므로 새 버퍼에 먼저 만든 뒤 기존 원소를 옮긴다
+			const size_type NewCapacity = Capacity * 2;
+			T* NewData = std::allocator<T>().allocate(NewCapacity);
+			::new (static_cast<void*>(NewData + Size)) T(std::forward<ArgTypes>(InArgs)...);
+			std::uninitialized_move(begin(), end(), NewData);
+			ReplaceBuffer(NewData, NewCapacity);
+		}
+		else
+		{
+			::new (static_cast<void*>(Data + Size)) T(std::forward<ArgTypes>(InArgs)...);
+		}
+		return Data[Size++];
+	}
+
+	void push_back(const T& InValue) { emplace_back(InValue); }
+	void push_back(T&& InValue) { emplace_back(std::move(InValue)); }
+
+	void pop_back()
+	{
+		--Size;
+		std::destroy_at(Data + Size);
+	}
+
+	iterator insert(const_iterator InPosition, const T& InValue)
+	{
+		const size_type Index = static_cast<size_type>(InPosition - Data);
+		emplace_back(InValue);
+		std::rotate(Data + Index, Data + Size - 1, Data + Size);
+		return Data + Index;
+	}
+
+	iterator erase(const_iterator InPosition)
+	{
+		return erase(InPosition, InPosition + 1);
+	}
+
+	iterator erase(const_iterator InFirst, const_iterator InLast)
+	{
+		T* First = Data + (InFirst - Data);
+		T* Last = Data + (InLast - Data);
+		if (First != Last)
+		{
+			T* NewEnd = std::move(Last, end(), First);
+			std::destroy(NewEnd, end());
+			Size = static_cast<size_type>(NewEnd - Data);
+		}
+		return First;
+	}
+
+	void resize(size_type InSize)
+	{
+		if (InSize < Size)
+		{
+			erase(begin() + InSize, end());
+			return;
+		}
+		reserve(InSize);
+		std::uninitialized_value_construct(Data + Size, Data + InSize);
+		Size = InSize;
+	}
+
+	template <typename InputIterator>
+	void assign(InputIterator InFirst, InputIterator InLast)
+	{
+		clear();
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+		{
+			reserve(static_cast<size_type>(std::distance(InFirst, InLast)));
+		}
+		for (; InFirst != InLast; ++InFirst)
+		{
+			emplace_back(*InFirst);
+		}
+	}
+
+private:
+	T* GetInlineData() { return reinterpret_cast<T*>(InlineStorage); }
+	const T* GetInlineData() const { return reinterpret_cast<const T*>(InlineStorage); }
+
+	void Reallocate(size_type InCapacity)
+	{
+		T* NewData = std::allocator<T>().allocate(InCapacity);
+		std::uninitialized_move(begin(), end(), NewData);
+		ReplaceBuffer(NewData, InCapacity);
+	}
+
+	/** @brief 기존 원소를 파괴하고 버퍼를 교체 (원소는 이미 InNewData로 옮겨진 상태) */
+	void ReplaceBuffer(T* InNewData, size_type InNewCapacity)
+	{
+		std::destroy(begin(), end());
+		ReleaseHeap();
+		Data = InNewData;
+		Capacity = InNewCapacity;
+	}
+
+	void ReleaseHeap()
+	{
+		if (!IsInline())
+		{
+			std::allocator<T>().deallocate(Data, Capacity);
+			Data = GetInlineData();
+			Capacity = N;
+		}
+	}
+
+	/** @brief 비어 있고 인라인 상태인 배열로 InOther를 옮김 (힙 버퍼는 넘겨받고, 인라인 원소는 하나씩 이동) */
+	void MoveFrom(TInlineArray& InOther)
+	{
+		if (InOther.IsInline())
+		{
+			std::uninitialized_move(InOther.begin(), InOther.end(), Data);
+			Size = InOther.Size;
+			InOther.clear();
+		}
+		else
+		{
+			Data = InOther.Data;
+			Size = InOther.Size;
+			Capacity = InOther.Capacity;
+			InOther.Data = InOther.GetInlineData();
+			InOther.Size = 0;
+			InOther.Capacity = N;
+		}
+	}
+
+	T* Data = GetInlineData();
+	size_type Size = 0;
+	size_type Capacity = N;
+	alignas(T) unsigned char InlineStorage[sizeof(T) * N];
+};
@@ -161,14 +161,14 @@ FVector4 FVector4::operator*(const FMatrix& InMatrix) const
 
 	// R1 = R0 + (Row1 * Y)
 	// R1 = (m00*X + m10*Y, m01*X + m11*Y, ...)
-	__m128 R1 = _mm_fmadd_ps(MatrixRows[1], VecY, R0);
+	__m128 R1 = _mm_add_ps(_mm_mul_ps(MatrixRows[1], VecY), R0);
 
 	// R2 = R1 + (Row2 * Z)
-	__m128 R2 = _mm_fmadd_ps(MatrixRows[2], VecZ, R1);
+	__m128 R2 = _mm_add_ps(_mm_mul_ps(MatrixRows[2], VecZ), R1);
 
 	// Final Result = R2 + (Row3 * W)
 	// 최종 결과 레지스터에는 (Result.X, Result.Y, Result.Z, Result.W)가 담깁니다.
-	__m128 ResultVec = _mm_fmadd_ps(MatrixRows[3], VecW, R2);
+	__m128 ResultVec = _mm_add_ps(_mm_mul_ps(MatrixRows[3], VecW), R2);
 
 	// 4. 결과를 FVector4 구조체에 저장합니다.
 	FVector4 Result;
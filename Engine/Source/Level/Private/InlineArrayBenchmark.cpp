@@ -0,0 +1,271 @@
+#include "pch.h"
+#include "Level/Public/World.h"
+#include "Level/Public/Level.h"
+#include "Actor/Public/MovingCubeActor.h"
+#include "Component/Public/PrimitiveComponent.h"
+#include "Component/Public/RotatingMovementComponent.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	constexpr int32 NumActors = 50000;
+	constexpr int32 NumPasses = 20;
+	constexpr int32 NumMeasuredFrames = 10;
+	constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+	template <typename T>
+	using TLegacyList = TArray<T>;
+	template <typename T>
+	using TInlineList = TInlineArray<T, 4>;
+
+	/**
+	 * @brief 실제 레벨의 컴포넌트 컨테이너만 그대로 복제한 노드
+	 * UObject처럼 노드마다 따로 할당하며, TLegacyList는 TInlineArray 도입 이전의 TArray 멤버를 재현한다
+	 */
+	template <template <typename> class TList>
+	struct TMirrorComponent
+	{
+		UActorComponent* Component = nullptr;
+		TList<TMirrorComponent*> AttachChildren;
+		TList<FOverlapInfo> OverlapInfos;
+	};
+
+	template <template <typename> class TList>
+	struct TMirrorActor
+	{
+		TMirrorComponent<TList>* RootComponent = nullptr;
+		TList<TMirrorComponent<TList>*> OwnedComponents;
+	};
+
+	template <template <typename> class TList>
+	struct TMirrorLevel
+	{
+		TArray<TMirrorActor<TList>*> Actors;
+		// 컨테이너를 제외한 노드 수 (힙 블록 수에서 빼기 위함)
+		uint64 NumNodes = 0;
+
+		~TMirrorLevel()
+		{
+			for (TMirrorActor<TList>* Actor : Actors)
+			{
+				for (TMirrorComponent<TList>* Component : Actor->OwnedComponents)
+				{
+					delete Component;
+				}
+				delete Actor;
+			}
+		}
+
+		void Build(const TArray<AActor*>& InActors)
+		{
+			Actors.reserve(InActors.size());
+			for (AActor* SourceActor : InActors)
+			{
+				TMirrorActor<TList>* Actor = new TMirrorActor<TList>();
+				for (UActorComponent* SourceComponent : SourceActor->GetOwnedComponents())
+				{
+					TMirrorComponent<TList>* Component = new TMirrorComponent<TList>();
+					Component->Component = SourceComponent;
+					if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(SourceComponent))
+					{
+						Component->OverlapInfos.assign(Primitive->GetOverlapInfos().begin(), Primitive->GetOverlapInfos().end());
+					}
+					if (SourceComponent == SourceActor->GetRootComponent())
+					{
+						Actor->RootComponent = Component;
+					}
+					Actor->OwnedComponents.push_back(Component);
+					NumNodes += 1;
+				}
+
+				// 실제 계층과 같은 부모-자식 연결
+				for (TMirrorComponent<TList>* Component : Actor->OwnedComponents)
+				{
+					USceneComponent* SceneComponent = Cast<USceneComponent>(Component->Component);
+					if (!SceneComponent)
+					{
+						continue;
+					}
+					for (USceneComponent* SourceChild : SceneComponent->GetChildren())
+					{
+						for (TMirrorComponent<TList>* Candidate : Actor->OwnedComponents)
+						{
+							if (Candidate->Component == SourceChild)
+							{
+								Component->AttachChildren.push_back(Candidate);
+								break;
+							}
+						}
+					}
+				}
+
+				Actors.push_back(Actor);
+				NumNodes += 1;
+			}
+		}
+
+		/** @brief Tick 등록/실행처럼 액터마다 OwnedComponents를 훑으며 컴포넌트 상태를 읽음 */
+		uint64 TickPass() const
+		{
+			uint64 NumTickable = 0;
+			for (const TMirrorActor<TList>* Actor : Actors)
+			{
+				for (const TMirrorComponent<TList>* Component : Actor->OwnedComponents)
+				{
+					NumTickable += Component->Component->CanEverTick() ? 1 : 0;
+				}
+			}
+			return NumTickable;
+		}
+
+		/** @brief 루트부터 AttachChildren을 따라 내려가며 Overlap 정보를 확인 (계층 순회) */
+		uint64 TraversalPass() const
+		{
+			uint64 Visited = 0;
+			TArray<const TMirrorComponent<TList>*> Stack;
+			for (const TMirrorActor<TList>* Actor : Actors)
+			{
+				if (!Actor->RootComponent)
+				{
+					continue;
+				}
+				Stack.push_back(Actor->RootComponent);
+				while (!Stack.empty())
+				{
+					const TMirrorComponent<TList>* Component = Stack.back();
+					Stack.pop_back();
+					Visited += 1 + Component->OverlapInfos.size();
+					for (const TMirrorComponent<TList>* Child : Component->AttachChildren)
+					{
+						Stack.push_back(Child);
+					}
+				}
+			}
+			return Visited;
+		}
+	};
+
+	struct FMirrorResult
+	{
+		uint64 ContainerBlocks = 0;
+		double TickMilliseconds = 0.0;
+		double TraversalMilliseconds = 0.0;
+		uint64 Checksum = 0;
+	};
+
+	template <template <typename> class TList>
+	FMirrorResult MeasureMirror(const TArray<AActor*>& InActors)
+	{
+		FMirrorResult Result;
+
+		const uint64 BlocksBefore = FAllocationTracker::GetCurrentCount();
+		TMirrorLevel<TList>* Level = new TMirrorLevel<TList>();
+		Level->Build(InActors);
+		// 노드, 레벨 객체, Actors 배열을 뺀 나머지가 컨테이너 블록
+		Result.ContainerBlocks = FAllocationTracker::GetCurrentCount() - BlocksBefore - Level->NumNodes - 2;
+
+		FScopeCycleCounter TickCounter;
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			Result.Checksum += Level->TickPass();
+		}
+		Result.TickMilliseconds = TickCounter.Finish() / NumPasses;
+
+		FScopeCycleCounter TraversalCounter;
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			Result.Checksum += Level->TraversalPass();
+		}
+		Result.TraversalMilliseconds = TraversalCounter.Finish() / NumPasses;
+
+		delete Level;
+		return Result;
+	}
+}
+
+/**
+ * @brief 50k MovingCubeActor 레벨에서 오브젝트별 컨테이너의 힙 블록 수와 Tick/계층 순회 시간 비교
+ * 같은 레벨의 OwnedComponents/AttachChildren/OverlapInfos를 TArray(이전)와 TInlineArray(이후)로 복제해 비교하고,
+ * 실제 레벨의 스폰 시 힙 블록 수와 World Tick 시간도 함께 출력한다
+ */
+IMPLEMENT_BENCHMARK(ActorInlineContainers, "50k 액터 컴포넌트 컨테이너: TArray vs TInlineArray (힙 블록 / Tick / 순회)")
+{
+	UWorld* PreviousWorld = GWorld;
+
+	// 1. 실제 레벨 생성 (스폰 중 늘어난 힙 블록 수 측정)
+	const uint64 BlocksBeforeSpawn = FAllocationTracker::GetCurrentCount();
+	UWorld* World = NewObject<UWorld>();
+	World->SetWorldType(EWorldType::Game);
+	GWorld = World;
+	World->CreateNewLevel();
+
+	TArray<AActor*> Actors;
+	Actors.reserve(NumActors);
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		AActor* Actor = World->SpawnActor(AMovingCubeActor::StaticClass());
+		if (!Actor)
+		{
+			continue;
+		}
+		Actor->SetActorLocation(FVector(static_cast<float>(Index % 256), static_cast<float>(Index / 256), 0.0f));
+
+		URotatingMovementComponent* RotatingMovement = Actor->CreateDefaultSubobject<URotatingMovementComponent>();
+		RotatingMovement->RotationRate = FVector(0.0f, 0.0f, 90.0f);
+		RotatingMovement->BeginPlay();
+		Actors.push_back(Actor);
+	}
+	const uint64 SpawnBlocks = FAllocationTracker::GetCurrentCount() - BlocksBeforeSpawn;
+
+	uint64 NumSpilled = 0;
+	uint64 NumContainers = 0;
+	for (AActor* Actor : Actors)
+	{
+		++NumContainers;
+		NumSpilled += Actor->GetOwnedComponents().IsInline() ? 0 : 1;
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+			{
+				++NumContainers;
+				NumSpilled += SceneComponent->GetChildren().IsInline() ? 0 : 1;
+			}
+			if (UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(Component))
+			{
+				++NumContainers;
+				NumSpilled += Primitive->GetOverlapInfos().IsInline() ? 0 : 1;
+			}
+		}
+	}
+
+	// 워커 기동 및 Octree 재삽입 대기열 안정화를 위한 예열
+	World->Tick(BenchmarkDeltaTime);
+	FScopeCycleCounter WorldTickCounter;
+	for (int32 Frame = 0; Frame < NumMeasuredFrames; ++Frame)
+	{
+		World->Tick(BenchmarkDeltaTime);
+	}
+	const double WorldTickMilliseconds = WorldTickCounter.Finish() / NumMeasuredFrames;
+
+	// 2. 같은 레벨의 컨테이너를 이전/이후 방식으로 복제해 비교
+	const FMirrorResult Legacy = MeasureMirror<TLegacyList>(Actors);
+	const FMirrorResult Inline = MeasureMirror<TInlineList>(Actors);
+	FBenchmarkRegistry::Consume(Legacy.Checksum + Inline.Checksum);
+	if (Legacy.Checksum != Inline.Checksum)
+	{
+		UE_LOG_ERROR("  결과 불일치: %llu / %llu",
+			static_cast<unsigned long long>(Legacy.Checksum), static_cast<unsigned long long>(Inline.Checksum));
+	}
+
+	UE_LOG("  %d MovingCubeActors + RotatingMovementComponent", static_cast<int32>(Actors.size()));
+	UE_LOG("  Level: %.2f heap blocks/actor on spawn, %llu / %llu containers spilled to heap, World Tick %.3f ms/frame",
+		static_cast<double>(SpawnBlocks) / NumActors,
+		static_cast<unsigned long long>(NumSpilled), static_cast<unsigned long long>(NumContainers), WorldTickMilliseconds);
+	UE_LOG("  Containers   | Heap Blocks | Tick Pass (ms) | Traversal (ms)");
+	UE_LOG("  TArray       | %11llu | %14.3f | %14.3f", static_cast<unsigned long long>(Legacy.ContainerBlocks), Legacy.TickMilliseconds, Legacy.TraversalMilliseconds);
+	UE_LOG("  TInlineArray | %11llu | %14.3f | %14.3f", static_cast<unsigned long long>(Inline.ContainerBlocks), Inline.TickMilliseconds, Inline.TraversalMilliseconds);
+
+	Actors.clear();
+	SafeDelete(World);
+	GWorld = PreviousWorld;
+}
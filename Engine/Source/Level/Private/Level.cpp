@@ -7,21 +7,33 @@
 #include "Component/Public/AmbientLightComponent.h"
 #include "Component/Public/SpotLightComponent.h"
 #include "Core/Public/Object.h"
-#include "Editor/Public/Editor.h"
-#include "Render/UI/Viewport/Public/Viewport.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
+#include "Level/Public/TickTaskManager.h"
+#include "Level/Public/WorldAABBCache.h"
+#include "Level/Public/SceneTransformSystem.h"
 #include "Manager/Config/Public/ConfigManager.h"
-#include "Render/Renderer/Public/Renderer.h"
 #include "Utility/Public/JsonSerializer.h"
-#include "Manager/UI/Public/ViewportManager.h"
 #include <json.hpp>
 
+#ifndef IS_HEADLESS
+#include "Editor/Public/Editor.h"
+#include "Render/UI/Viewport/Public/Viewport.h"
+#include "Render/Renderer/Public/Renderer.h"
+#include "Manager/UI/Public/ViewportManager.h"
+#endif
+
 IMPLEMENT_CLASS(ULevel, UObject)
 
 ULevel::ULevel()
 {
-	StaticOctree = new FOctree(FVector(0, 0, -5), 75, 0);
+	// 루트는 비어 있는 상태로 시작해 처음 등록되는 프리미티브들의 영역에 맞춰 커짐 (UpdateOctree)
+	StaticOctree = new FOctree();
+	DynamicTree = new FDynamicAABBTree();
+	TickTaskManager = new FTickTaskManager(this);
+	WorldAABBCache = new FWorldAABBCache();
+	TransformSystem = new FSceneTransformSystem();
 }
 
 ULevel::~ULevel()
@@ -35,6 +47,10 @@ ULevel::~ULevel()
 
 	// 모든 액터 객체가 삭제되었으므로, 포인터를 담고 있던 컨테이너들을 비웁니다.
 	SafeDelete(StaticOctree);
+	SafeDelete(DynamicTree);
+	SafeDelete(TickTaskManager);
+	SafeDelete(WorldAABBCache);
+	SafeDelete(TransformSystem);
 }
 
 void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
@@ -63,8 +79,13 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 			}
 		}
 
-		// 뷰포트 카메라 정보 로드
-		UViewportManager::GetInstance().SerializeViewports(bInIsLoading, InOutHandle);
+		// 뷰포트 카메라 정보 로드 (에디터가 없는 Headless 실행에서는 생략)
+#ifndef IS_HEADLESS
+		if (GEditor)
+		{
+			UViewportManager::GetInstance().SerializeViewports(bInIsLoading, InOutHandle);
+		}
+#endif
 	}
 	// 저장
 	else
@@ -84,7 +105,12 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 		InOutHandle["Actors"] = ActorsJson;
 
 		// 뷰포트 카메라 정보 저장
-		UViewportManager::GetInstance().SerializeViewports(bInIsLoading, InOutHandle);
+#ifndef IS_HEADLESS
+		if (GEditor)
+		{
+			UViewportManager::GetInstance().SerializeViewports(bInIsLoading, InOutHandle);
+		}
+#endif
 	}
 }
 
@@ -97,6 +123,7 @@ void ULevel::Init()
 			Actor->BeginPlay();
 		}
 	}
+	FTickTaskManager::MarkRegistrationDirty();
 }
 
 AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, JSON* ActorJsonData)
@@ -120,6 +147,7 @@ AActor* ULevel::SpawnActorToLevel(UClass* InActorClass, JSON* ActorJsonData)
 		}
 		NewActor->BeginPlay();
 		AddLevelComponent(NewActor);
+		FTickTaskManager::MarkRegistrationDirty();
 		return NewActor;
 	}
 
@@ -138,14 +166,14 @@ void ULevel::RegisterComponent(UActorComponent* InComponent)
 		return;
 	}
 
+	if (auto SceneComponent = Cast<USceneComponent>(InComponent))
+	{
+		TransformSystem->Add(SceneComponent);
+	}
+
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에 먼저 삽입 시도
-		if (!(StaticOctree->Insert(PrimitiveComponent)))
-		{
-			// 실패하면 DynamicPrimitiveQueue 목록에 추가
-			OnPrimitiveUpdated(PrimitiveComponent);
-		}
+		InsertPrimitiveToOctree(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -186,12 +214,14 @@ void ULevel::UnregisterComponent(UActorComponent* InComponent)
 		return;
 	}
 
+	if (auto SceneComponent = Cast<USceneComponent>(InComponent))
+	{
+		TransformSystem->Remove(SceneComponent);
+	}
+
 	if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(InComponent))
 	{
-		// StaticOctree에서 제거 시도
-		StaticOctree->Remove(PrimitiveComponent);
-	
-		OnPrimitiveUnregistered(PrimitiveComponent);
+		RemovePrimitiveFromOctree(PrimitiveComponent);
 	}
 	else if (auto LightComponent = Cast<ULightComponent>(InComponent))
 	{
@@ -212,6 +242,7 @@ void ULevel::AddActorToLevel(AActor* InActor)
 	}
 
 	LevelActors.push_back(InActor);
+	FTickTaskManager::MarkRegistrationDirty();
 }
 
 void ULevel::AddLevelComponent(AActor* Actor)
@@ -223,9 +254,14 @@ void ULevel::AddLevelComponent(AActor* Actor)
 
 	for (auto& Component : Actor->GetOwnedComponents())
 	{
+		if (auto SceneComponent = Cast<USceneComponent>(Component))
+		{
+			TransformSystem->Add(SceneComponent);
+		}
+
 		if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
 		{
-			OnPrimitiveUpdated(PrimitiveComponent);			
+			InsertPrimitiveToOctree(PrimitiveComponent);
 		}
 		else if (auto LightComponent = Cast<ULightComponent>(Component))
 		{
@@ -273,14 +309,17 @@ bool ULevel::DestroyActor(AActor* InActor)
 		*It = std::move(LevelActors.back());
 		LevelActors.pop_back();
 	}
+	FTickTaskManager::MarkRegistrationDirty();
 
-	// Remove Actor Selection
-	UEditor* Editor = GEditor->GetEditorModule();
-	if (Editor->GetSelectedActor() == InActor)
+	// Remove Actor Selection (Headless 실행에서는 GEditor가 없음)
+#ifndef IS_HEADLESS
+	UEditor* Editor = GEditor ? GEditor->GetEditorModule() : nullptr;
+	if (Editor && Editor->GetSelectedActor() == InActor)
 	{
 		Editor->SelectActor(nullptr);
 		Editor->SelectComponent(nullptr);
 	}
+#endif
 
 	// EndPlay 호출 (Lua EndPlay 등 정리 로직 실행)
 	InActor->EndPlay();
@@ -293,9 +332,71 @@ bool ULevel::DestroyActor(AActor* InActor)
 
 void ULevel::UpdatePrimitiveInOctree(UPrimitiveComponent* InComponent)
 {
-	if (!StaticOctree->Remove(InComponent))
+	// 병렬 Tick 중에는 Octree를 건드리지 않고 Wave가 끝난 뒤 Game Thread에서 반영
+	if (FTickTaskManager::DeferPrimitiveUpdate(InComponent))
+	{
+		return;
+	}
+
+	if (!StaticOctree)
+	{
+		return;
+	}
+
+	// 이미 움직이는 프리미티브는 Fat AABB를 벗어날 때만 Leaf를 다시 붙임
+	if (DynamicTree->Contains(InComponent))
+	{
+		DynamicTree->Update(InComponent);
+
+		// 루트 밖에서 대기 중이던 정적 프리미티브도 움직이기 시작했다면 Dynamic Tree에 남김
+		if (!PendingOctreePrimitives.empty())
+		{
+			PendingOctreePrimitives.erase(InComponent);
+		}
 		return;
-	OnPrimitiveUpdated(InComponent);
+	}
+
+	// 처음 움직인 정적 프리미티브는 Dynamic Tree로 옮김 (이 레벨에 등록되지 않은 프리미티브는 무시)
+	if (StaticOctree->Remove(InComponent))
+	{
+		DynamicTree->Insert(InComponent);
+	}
+}
+
+TArray<UPrimitiveComponent*> ULevel::FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount) const
+{
+	// Dynamic Tree는 정확한 거리 순서로 최대 MaxPrimitiveCount개를 반환
+	TArray<std::pair<float, UPrimitiveComponent*>> ScoredCandidates;
+	if (DynamicTree)
+	{
+		DynamicTree->FindNearestPrimitives(FindPos, MaxPrimitiveCount, ScoredCandidates);
+	}
+
+	// Octree는 가까운 노드 단위로 채우므로 프리미티브별 거리를 다시 계산
+	if (StaticOctree)
+	{
+		FVector Min, Max;
+		for (UPrimitiveComponent* Primitive : StaticOctree->FindNearestPrimitives(FindPos, MaxPrimitiveCount))
+		{
+			Primitive->GetWorldAABB(Min, Max);
+			ScoredCandidates.push_back({ FAABB(Min, Max).GetCenterDistanceSquared(FindPos), Primitive });
+		}
+	}
+
+	const size_t NumCandidates = std::min<size_t>(ScoredCandidates.size(), MaxPrimitiveCount);
+	std::partial_sort(ScoredCandidates.begin(), ScoredCandidates.begin() + NumCandidates, ScoredCandidates.end(),
+		[](const std::pair<float, UPrimitiveComponent*>& InA, const std::pair<float, UPrimitiveComponent*>& InB)
+		{
+			return InA.first < InB.first;
+		});
+
+	TArray<UPrimitiveComponent*> Candidates;
+	Candidates.reserve(NumCandidates);
+	for (size_t Index = 0; Index < NumCandidates; ++Index)
+	{
+		Candidates.push_back(ScoredCandidates[Index].second);
+	}
+	return Candidates;
 }
 
 UObject* ULevel::Duplicate()
@@ -316,6 +417,7 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 		DuplicatedLevel->LevelActors.push_back(DuplicatedActor);
 		DuplicatedLevel->AddLevelComponent(DuplicatedActor);
 	}
+	FTickTaskManager::MarkRegistrationDirty();
 }
 
 /*-----------------------------------------------------------------------------
@@ -324,80 +426,98 @@ void ULevel::DuplicateSubObjects(UObject* DuplicatedObject)
 
 void ULevel::UpdateOctree()
 {
-	if (!StaticOctree)
+	if (!StaticOctree || PendingOctreePrimitives.empty())
 	{
 		return;
 	}
-	
-	uint32 Count = 0;
-	FDynamicPrimitiveQueue NotInsertedQueue;
-	
-	while (!DynamicPrimitiveQueue.empty() && Count < MAX_OBJECTS_TO_INSERT_PER_FRAME)
+
+	// 1. 루트 안에 들어가는 프리미티브는 Dynamic Tree에서 Octree로 옮김
+	FAABB PendingBounds;
+	bool bHasOutsidePrimitive = false;
+	for (auto It = PendingOctreePrimitives.begin(); It != PendingOctreePrimitives.end();)
 	{
-		auto [Component, TimePoint] = DynamicPrimitiveQueue.front();
-		DynamicPrimitiveQueue.pop();
+		UPrimitiveComponent* Component = *It;
+		if (StaticOctree->Insert(Component))
+		{
+			DynamicTree->Remove(Component);
+			It = PendingOctreePrimitives.erase(It);
+			continue;
+		}
 
-		if (auto It = DynamicPrimitiveMap.find(Component); It != DynamicPrimitiveMap.end())
+		FVector Min, Max;
+		Component->GetWorldAABB(Min, Max);
+		PendingBounds = bHasOutsidePrimitive ? Union(PendingBounds, FAABB(Min, Max)) : FAABB(Min, Max);
+		bHasOutsidePrimitive = true;
+		++It;
+	}
+
+	// 2. 여전히 루트 밖에 있다면 루트를 레벨 영역에 맞게 한 번 키운 뒤 모두 삽입
+	if (bHasOutsidePrimitive)
+	{
+		StaticOctree->GrowToInclude(PendingBounds);
+		for (auto It = PendingOctreePrimitives.begin(); It != PendingOctreePrimitives.end();)
 		{
-			if (It->second <= TimePoint)
+			if (StaticOctree->Insert(*It))
 			{
-				// 큐에 기록된 오브젝트의 마지막 변경 시간 이후로 변경이 없었다면 Octree에 재삽입한다.
-				if (StaticOctree->Insert(Component))
-				{
-					DynamicPrimitiveMap.erase(It);
-				}
-				// 삽입이 안됐다면 다시 Queue에 들어가기 위해 저장
-				else
-				{
-					NotInsertedQueue.push({Component, It->second});
-				}
-				// TODO: 오브젝트의 유일성을 보장하기 위해 StaticOctree->Remove(Component)가 필요한가?
-				++Count;
+				DynamicTree->Remove(*It);
+				It = PendingOctreePrimitives.erase(It);
 			}
 			else
 			{
-				// 큐에 기록된 오브젝트의 마지막 변경 이후 새로운 변경이 존재했다면 다시 큐에 삽입한다.
-				DynamicPrimitiveQueue.push({Component, It->second});
+				++It;
 			}
 		}
 	}
-	
-	DynamicPrimitiveQueue = NotInsertedQueue;
-	if (Count != 0)
+}
+
+void ULevel::UpdateTransforms()
+{
+	const TArray<USceneComponent*>& UpdatedComponents = TransformSystem->UpdateTransforms();
+	WorldAABBCache->UpdateDirtyBounds();
+
+	// 부모를 따라 움직인 자손 프리미티브도 트리에 반영
+	for (USceneComponent* Component : UpdatedComponents)
 	{
-		// UE_LOG("UpdateOctree: %d개의 컴포넌트가 업데이트 되었습니다.", Count);
+		if (auto PrimitiveComponent = Cast<UPrimitiveComponent>(Component))
+		{
+			UpdatePrimitiveInOctree(PrimitiveComponent);
+		}
 	}
 }
 
-void ULevel::OnPrimitiveUpdated(UPrimitiveComponent* InComponent)
+void ULevel::InsertPrimitiveToOctree(UPrimitiveComponent* InComponent)
 {
-	if (!InComponent)
+	if (!InComponent || !StaticOctree)
 	{
 		return;
 	}
 
-	float GameTime = UTimeManager::GetInstance().GetGameTime();
-	if (auto It = DynamicPrimitiveMap.find(InComponent); It != DynamicPrimitiveMap.end())
+	// 트리 삽입이 World AABB를 읽으므로 캐시에 먼저 등록
+	WorldAABBCache->Add(InComponent);
+
+	// 이미 움직이는 프리미티브로 등록되어 있다면 그대로 둠
+	if (DynamicTree->Contains(InComponent))
 	{
-		It->second = GameTime;
+		return;
 	}
-	else
-	{
-		DynamicPrimitiveMap[InComponent] = UTimeManager::GetInstance().GetGameTime();
 
-		DynamicPrimitiveQueue.push({InComponent, GameTime});
+	// 루트 밖이어도 같은 프레임부터 쿼리되도록 Dynamic Tree에 넣어 둠
+	if (!StaticOctree->Insert(InComponent))
+	{
+		DynamicTree->Insert(InComponent);
+		PendingOctreePrimitives.insert(InComponent);
 	}
 }
 
-void ULevel::OnPrimitiveUnregistered(UPrimitiveComponent* InComponent)
+void ULevel::RemovePrimitiveFromOctree(UPrimitiveComponent* InComponent)
 {
 	if (!InComponent)
 	{
 		return;
 	}
 
-	if (auto It = DynamicPrimitiveMap.find(InComponent); It != DynamicPrimitiveMap.end())
-	{
-		DynamicPrimitiveMap.erase(It);
-	}
+	StaticOctree->Remove(InComponent);
+	DynamicTree->Remove(InComponent);
+	PendingOctreePrimitives.erase(InComponent);
+	WorldAABBCache->Remove(InComponent);
 }
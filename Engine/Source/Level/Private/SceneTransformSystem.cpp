@@ -0,0 +1,178 @@
+#include "pch.h"
+#include "Level/Public/SceneTransformSystem.h"
+
+#include "Component/Public/SceneComponent.h"
+#include "Core/Public/TaskGraph.h"
+
+namespace
+{
+	// 한 Batch가 평균적으로 계산할 노드 수 (작은 계층이 많으면 여러 계층을 한 Batch로 묶음)
+	constexpr int32 MinNodesPerBatch = 256;
+}
+
+FSceneTransformSystem::~FSceneTransformSystem()
+{
+	// 레벨보다 오래 사는 컴포넌트가 해제된 시스템을 가리키지 않도록 연결을 끊음
+	for (USceneComponent* Component : Components)
+	{
+		Component->TransformSystem = nullptr;
+		Component->TransformSystemHandle = -1;
+		Component->bIsTransformQueued.store(false, std::memory_order_relaxed);
+	}
+}
+
+void FSceneTransformSystem::Add(USceneComponent* InComponent)
+{
+	if (!InComponent || InComponent->TransformSystem == this)
+	{
+		return;
+	}
+
+	if (InComponent->TransformSystem)
+	{
+		InComponent->TransformSystem->Remove(InComponent);
+	}
+
+	InComponent->TransformSystem = this;
+	InComponent->TransformSystemHandle = Num();
+	Components.push_back(InComponent);
+}
+
+void FSceneTransformSystem::Remove(USceneComponent* InComponent)
+{
+	if (!InComponent || InComponent->TransformSystem != this)
+	{
+		return;
+	}
+
+	// 마지막 항목을 빈 자리로 옮기고 옮겨진 컴포넌트의 핸들을 갱신
+	const int32 Handle = InComponent->TransformSystemHandle;
+	Components[Handle] = Components.back();
+	Components[Handle]->TransformSystemHandle = Handle;
+	Components.pop_back();
+
+	if (InComponent->bIsTransformQueued.load(std::memory_order_relaxed))
+	{
+		std::lock_guard<std::mutex> Lock(DirtyLock);
+		DirtyComponents.erase(std::remove(DirtyComponents.begin(), DirtyComponents.end(), InComponent), DirtyComponents.end());
+		InComponent->bIsTransformQueued.store(false, std::memory_order_relaxed);
+	}
+
+	InComponent->TransformSystem = nullptr;
+	InComponent->TransformSystemHandle = -1;
+}
+
+void FSceneTransformSystem::MarkDirty(USceneComponent* InComponent)
+{
+	// 이미 대기 중이면 잠금 없이 반환하고, 처음 대기열에 올리는 스레드만 잠금을 잡음
+	if (InComponent->bIsTransformQueued.exchange(true, std::memory_order_acq_rel))
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> Lock(DirtyLock);
+	DirtyComponents.push_back(InComponent);
+	bHasPendingUpdates.store(true, std::memory_order_release);
+}
+
+const TArray<USceneComponent*>& FSceneTransformSystem::UpdateTransforms()
+{
+	Nodes.clear();
+	ParentSlots.clear();
+	HierarchyStarts.clear();
+	RootParentTransforms.clear();
+
+	PendingComponents.clear();
+	{
+		std::lock_guard<std::mutex> Lock(DirtyLock);
+		PendingComponents.swap(DirtyComponents);
+	}
+
+	if (PendingComponents.empty())
+	{
+		return Nodes;
+	}
+
+	// 1. 대기 중인 컴포넌트를 루트로 하는 계층을 부모가 자식보다 앞에 오도록 펼침 (너비 우선)
+	// 루트의 부모 트랜스폼은 여기서 읽으며, 아직 대기 중 표시가 남아 있어 조회 경로가 부모 버전을 확인한다
+	for (USceneComponent* Component : PendingComponents)
+	{
+		if (HasQueuedAncestor(Component))
+		{
+			continue;
+		}
+
+		const int32 Start = static_cast<int32>(Nodes.size());
+		HierarchyStarts.push_back(Start);
+		RootParentTransforms.push_back(Component->AttachParent ? Component->AttachParent->GetWorldTransform() : FTransform::Identity());
+
+		Nodes.push_back(Component);
+		ParentSlots.push_back(-1);
+		for (int32 Slot = Start; Slot < static_cast<int32>(Nodes.size()); ++Slot)
+		{
+			for (USceneComponent* Child : Nodes[Slot]->AttachChildren)
+			{
+				Nodes.push_back(Child);
+				ParentSlots.push_back(Slot);
+			}
+		}
+	}
+	HierarchyStarts.push_back(static_cast<int32>(Nodes.size()));
+
+	for (USceneComponent* Component : PendingComponents)
+	{
+		Component->bIsTransformQueued.store(false, std::memory_order_relaxed);
+	}
+
+	// 2. 서로 독립인 계층끼리 병렬로 계산
+	const int32 NumNodes = static_cast<int32>(Nodes.size());
+	const int32 NumHierarchies = static_cast<int32>(HierarchyStarts.size()) - 1;
+	WorldTransforms.resize(NumNodes);
+
+	const int32 HierarchiesPerBatch = std::max(1, static_cast<int32>(static_cast<int64>(NumHierarchies) * MinNodesPerBatch / NumNodes));
+	FTaskGraph::GetInstance().ParallelForRange(NumHierarchies, [this](int32 InBegin, int32 InEnd)
+	{
+		for (int32 HierarchyIndex = InBegin; HierarchyIndex < InEnd; ++HierarchyIndex)
+		{
+			UpdateHierarchy(HierarchyIndex);
+		}
+	}, HierarchiesPerBatch);
+
+	bHasPendingUpdates.store(false, std::memory_order_release);
+	return Nodes;
+}
+
+bool FSceneTransformSystem::HasQueuedAncestor(const USceneComponent* InComponent)
+{
+	for (const USceneComponent* Parent = InComponent->AttachParent; Parent; Parent = Parent->AttachParent)
+	{
+		if (Parent->bIsTransformQueued.load(std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FSceneTransformSystem::UpdateHierarchy(int32 InHierarchyIndex)
+{
+	const int32 Begin = HierarchyStarts[InHierarchyIndex];
+	const int32 End = HierarchyStarts[InHierarchyIndex + 1];
+
+	// 부모가 항상 앞에 있으므로 한 번 훑으면 모든 World 트랜스폼이 확정된다
+	// 행렬은 만들지 않고 TransformVersion만 올려, 조회하는 쪽이 처음 한 번만 변환하게 한다
+	for (int32 Slot = Begin; Slot < End; ++Slot)
+	{
+		USceneComponent* Component = Nodes[Slot];
+		const int32 ParentSlot = ParentSlots[Slot];
+		const FTransform& ParentWorld = ParentSlot < 0 ? RootParentTransforms[InHierarchyIndex] : WorldTransforms[ParentSlot];
+
+		WorldTransforms[Slot] = Component->GetRelativeTransform() * ParentWorld;
+
+		Component->WorldTransform = WorldTransforms[Slot];
+		Component->bIsTransformDirty = false;
+		++Component->TransformVersion;
+		Component->ParentTransformVersion = Component->AttachParent ? Component->AttachParent->TransformVersion : 0;
+		Component->OnWorldTransformUpdated();
+	}
+}
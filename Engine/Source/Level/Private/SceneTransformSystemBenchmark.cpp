@@ -0,0 +1,199 @@
+#include "pch.h"
+#include "Level/Public/SceneTransformSystem.h"
+#include "Component/Public/SceneComponent.h"
+#include "Core/Public/NewObject.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumHierarchies = 100;
+	constexpr int32 NodesPerHierarchy = 500;
+	constexpr int32 ChildrenPerNode = 4;
+	constexpr int32 NumFrames = 20;
+
+	/** @brief 시스템 도입 이전 USceneComponent처럼 이동 시 자손을 재귀로 Dirty 표시하고, 조회한 쪽에서 부모 체인을 따라 계산 */
+	struct FLegacySceneNode
+	{
+		virtual ~FLegacySceneNode() = default;
+
+		virtual void MarkAsDirty()
+		{
+			bIsTransformDirty = true;
+			bIsTransformDirtyInverse = true;
+			for (FLegacySceneNode* Child : AttachChildren)
+			{
+				Child->MarkAsDirty();
+			}
+		}
+
+		void SetRelativeLocation(const FVector& InLocation)
+		{
+			RelativeLocation = InLocation;
+			MarkAsDirty();
+		}
+
+		const FMatrix& GetWorldTransformMatrix() const
+		{
+			if (bIsTransformDirty)
+			{
+				WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, RelativeRotation, RelativeScale3D);
+				if (AttachParent)
+				{
+					WorldTransformMatrix *= AttachParent->GetWorldTransformMatrix();
+				}
+				bIsTransformDirty = false;
+			}
+			return WorldTransformMatrix;
+		}
+
+		mutable bool bIsTransformDirty = true;
+		mutable bool bIsTransformDirtyInverse = true;
+		mutable FMatrix WorldTransformMatrix;
+
+		FVector RelativeLocation;
+		FQuaternion RelativeRotation = FQuaternion::Identity();
+		FVector RelativeScale3D = FVector(1.0f, 1.0f, 1.0f);
+
+		FLegacySceneNode* AttachParent = nullptr;
+		TArray<FLegacySceneNode*> AttachChildren;
+	};
+
+	bool IsNearlySame(const FMatrix& InA, const FMatrix& InB)
+	{
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 4; ++Column)
+			{
+				if (std::abs(InA.Data[Row][Column] - InB.Data[Row][Column]) > 1.0e-3f * (1.0f + std::abs(InA.Data[Row][Column])))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+}
+
+/**
+ * @brief 500개 컴포넌트가 붙은 계층 100개의 루트를 매 프레임 옮긴 뒤 모든 World 행렬을 임의 순서로 읽는 비용 비교
+ * 기존 방식은 이동마다 자손 500개를 재귀로 Dirty 표시하고 처음 조회한 쪽이 부모 체인을 따라 계산하며,
+ * FSceneTransformSystem은 루트만 대기 목록에 올린 뒤 계층별로 부모 -> 자식 순서의 한 번 훑기로 계산한다
+ */
+IMPLEMENT_BENCHMARK(SceneTransformSystem, "계층 트랜스폼 갱신: 재귀 Dirty + 지연 계산 vs 계층 단위 일괄 계산")
+{
+	constexpr int32 NumNodes = NumHierarchies * NodesPerHierarchy;
+	std::mt19937 Random(20251017);
+	std::uniform_real_distribution<float> Offset(-10.0f, 10.0f);
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+
+	// 1. 같은 모양의 계층을 두 방식으로 구성 (노드 i의 부모는 같은 계층의 (i - 1) / ChildrenPerNode)
+	TArray<FLegacySceneNode> LegacyNodes(NumNodes);
+	TArray<USceneComponent*> Components(NumNodes);
+	FSceneTransformSystem TransformSystem;
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		const FVector Location(Offset(Random), Offset(Random), Offset(Random));
+		const FQuaternion Rotation = FQuaternion::FromEuler(FVector(Angle(Random), Angle(Random), Angle(Random)));
+
+		FLegacySceneNode& LegacyNode = LegacyNodes[Index];
+		LegacyNode.RelativeLocation = Location;
+		LegacyNode.RelativeRotation = Rotation;
+
+		USceneComponent* Component = NewObject<USceneComponent>();
+		Component->SetRelativeLocation(Location);
+		Component->SetRelativeRotation(Rotation);
+		Components[Index] = Component;
+
+		const int32 LocalIndex = Index % NodesPerHierarchy;
+		if (LocalIndex > 0)
+		{
+			const int32 ParentIndex = Index - LocalIndex + (LocalIndex - 1) / ChildrenPerNode;
+			LegacyNode.AttachParent = &LegacyNodes[ParentIndex];
+			LegacyNodes[ParentIndex].AttachChildren.push_back(&LegacyNode);
+			Component->AttachToComponent(Components[ParentIndex]);
+		}
+		TransformSystem.Add(Component);
+	}
+	TransformSystem.UpdateTransforms();
+
+	// 렌더러처럼 계층 순서와 무관한 순서로 읽음
+	TArray<int32> ReadOrder(NumNodes);
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		ReadOrder[Index] = Index;
+	}
+	std::shuffle(ReadOrder.begin(), ReadOrder.end(), Random);
+
+	TArray<FVector> RootLocations(static_cast<size_t>(NumHierarchies) * NumFrames);
+	for (FVector& Location : RootLocations)
+	{
+		Location = FVector(Offset(Random), Offset(Random), Offset(Random));
+	}
+
+	// 2. 매 프레임 모든 루트를 옮기고 모든 World 행렬을 읽음
+	float LegacyChecksum = 0.0f;
+	FScopeCycleCounter LegacyCounter;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Hierarchy = 0; Hierarchy < NumHierarchies; ++Hierarchy)
+		{
+			LegacyNodes[Hierarchy * NodesPerHierarchy].SetRelativeLocation(RootLocations[Frame * NumHierarchies + Hierarchy]);
+		}
+		for (int32 Index : ReadOrder)
+		{
+			LegacyChecksum += LegacyNodes[Index].GetWorldTransformMatrix().Data[3][0];
+		}
+	}
+	const double LegacyMilliseconds = LegacyCounter.Finish();
+
+	float SystemChecksum = 0.0f;
+	double UpdateMilliseconds = 0.0;
+	FScopeCycleCounter SystemCounter;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Hierarchy = 0; Hierarchy < NumHierarchies; ++Hierarchy)
+		{
+			Components[Hierarchy * NodesPerHierarchy]->SetRelativeLocation(RootLocations[Frame * NumHierarchies + Hierarchy]);
+		}
+
+		FScopeCycleCounter UpdateCounter;
+		TransformSystem.UpdateTransforms();
+		UpdateMilliseconds += UpdateCounter.Finish();
+
+		for (int32 Index : ReadOrder)
+		{
+			SystemChecksum += Components[Index]->GetWorldTransformMatrix().Data[3][0];
+		}
+	}
+	const double SystemMilliseconds = SystemCounter.Finish();
+
+	// 3. 결과 비교
+	int32 NumMismatches = 0;
+	for (int32 Index = 0; Index < NumNodes; ++Index)
+	{
+		if (!IsNearlySame(LegacyNodes[Index].GetWorldTransformMatrix(), Components[Index]->GetWorldTransformMatrix()))
+		{
+			++NumMismatches;
+		}
+	}
+	FBenchmarkRegistry::Consume(static_cast<uint64>(std::abs(LegacyChecksum + SystemChecksum)));
+	if (NumMismatches > 0)
+	{
+		UE_LOG_ERROR("  결과 불일치: %d / %d", NumMismatches, NumNodes);
+	}
+
+	const double NumReads = static_cast<double>(NumNodes) * NumFrames;
+	UE_LOG("  %d hierarchies x %d components, %d frames", NumHierarchies, NodesPerHierarchy, NumFrames);
+	UE_LOG("  Method            | Total (ms) | ns/component");
+	UE_LOG("  Recursive + Lazy  | %10.3f | %12.2f", LegacyMilliseconds, LegacyMilliseconds * 1.0e6 / NumReads);
+	UE_LOG("  Transform System  | %10.3f | %12.2f", SystemMilliseconds, SystemMilliseconds * 1.0e6 / NumReads);
+	UE_LOG("    UpdateTransforms| %10.3f |", UpdateMilliseconds);
+
+	// 자식부터 지워 부모의 자식 목록이 해제된 컴포넌트를 가리키는 시간을 없앰
+	for (auto It = Components.rbegin(); It != Components.rend(); ++It)
+	{
+		delete *It;
+	}
+}
@@ -0,0 +1,399 @@
+#include "pch.h"
+#include "Level/Public/TickTaskManager.h"
+
+#include "Actor/Public/Actor.h"
+#include "Component/Public/ActorComponent.h"
+#include "Core/Public/TaskGraph.h"
+#include "Level/Public/Level.h"
+
+std::atomic<uint32> FTickTaskManager::RegistrationSerial{ 1 };
+
+namespace
+{
+	// 병렬 Tick Batch를 실행 중인 스레드가 미뤄 둔 Octree 갱신 목록
+	thread_local TArray<UPrimitiveComponent*>* DeferredUpdatesForThread = nullptr;
+
+	/**
+	 * @brief 목록 재구성 중에만 쓰는 Tick 함수 정보 (Actor Tick 또는 Component Tick 하나)
+	 */
+	struct FTickFunctionInfo
+	{
+		AActor* Actor = nullptr;
+		UActorComponent* Component = nullptr;
+		int32 TickGroup = 0;
+		bool bRunOnAnyThread = false;
+		TArray<int32> Prerequisites;
+		int32 UnitIndex = -1;
+	};
+
+	constexpr int32 ToIndex(ETickingGroup InTickGroup)
+	{
+		return static_cast<int32>(InTickGroup);
+	}
+}
+
+FTickTaskManager::FTickTaskManager(ULevel* InLevel)
+	: Level(InLevel)
+{
+}
+
+FTickTaskManager::~FTickTaskManager() = default;
+
+void FTickTaskManager::MarkRegistrationDirty()
+{
+	RegistrationSerial.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool FTickTaskManager::DeferPrimitiveUpdate(UPrimitiveComponent* InComponent)
+{
+	if (!DeferredUpdatesForThread)
+	{
+		return false;
+	}
+
+	DeferredUpdatesForThread->push_back(InComponent);
+	return true;
+}
+
+void FTickTaskManager::StartFrame(bool bInIsEditorWorld)
+{
+	// 재구성 도중의 변경도 다음 프레임에 반영되도록 재구성 전에 읽는다
+	const uint32 CurrentSerial = RegistrationSerial.load(std::memory_order_relaxed);
+	if (CurrentSerial == BuiltRegistrationSerial && bInIsEditorWorld == bIsEditorWorld)
+	{
+		return;
+	}
+
+	BuiltRegistrationSerial = CurrentSerial;
+	bIsEditorWorld = bInIsEditorWorld;
+
+	RebuildTickUnits();
+	BuildTickWaves();
+}
+
+/**
+ * @brief 그룹의 Wave를 순서대로 실행
+ * 병렬 단위가 모두 끝난 뒤 미뤄 둔 Octree 갱신을 반영하고, 이어서 Game Thread 단위를 실행한다
+ */
+void FTickTaskManager::RunTickGroup(ETickingGroup InTickGroup, float InDeltaTime)
+{
+	FTaskGraph& TaskGraph = FTaskGraph::GetInstance();
+
+	for (const FTickWave& Wave : TickWaves[ToIndex(InTickGroup)])
+	{
+		if (!Wave.ParallelUnits.empty())
+		{
+			TaskGraph.ParallelForRange(static_cast<int32>(Wave.ParallelUnits.size()), [this, &Wave, InDeltaTime](int32 InBegin, int32 InEnd)
+			{
+				TArray<UPrimitiveComponent*> LocalUpdates;
+
+				// Wait 중 다른 Batch를 대신 실행할 수 있으므로 이전 값을 복원
+				TArray<UPrimitiveComponent*>* PreviousUpdates = DeferredUpdatesForThread;
+				DeferredUpdatesForThread = &LocalUpdates;
+				for (int32 Index = InBegin; Index < InEnd; ++Index)
+				{
+					ExecuteTickUnit(TickUnits[Wave.ParallelUnits[Index]], InDeltaTime, false);
+				}
+				DeferredUpdatesForThread = PreviousUpdates;
+
+				if (!LocalUpdates.empty())
+				{
+					std::lock_guard<std::mutex> Lock(DeferredUpdateLock);
+					DeferredPrimitiveUpdates.insert(DeferredPrimitiveUpdates.end(), LocalUpdates.begin(), LocalUpdates.end());
+				}
+			}, MinUnitsPerBatch);
+
+			FlushDeferredPrimitiveUpdates();
+		}
+
+		for (int32 UnitIndex : Wave.GameThreadUnits)
+		{
+			ExecuteTickUnit(TickUnits[UnitIndex], InDeltaTime, true);
+		}
+	}
+}
+
+bool FTickTaskManager::ShouldTickActor(const AActor* InActor) const
+{
+	if (!InActor || !InActor->CanTick())
+	{
+		return false;
+	}
+	return !bIsEditorWorld || InActor->CanTickInEditor();
+}
+
+/**
+ * @brief Level의 Actor를 한 번 순회해 Tick 함수를 모으고 (Actor, 그룹)별 실행 단위로 묶는다
+ * @note 기존 동작과 같이 Tick 조건을 통과한 Actor의 컴포넌트만 등록한다
+ */
+void FTickTaskManager::RebuildTickUnits()
+{
+	TickUnits.clear();
+
+	TArray<FTickFunctionInfo> Functions;
+	TMap<const UObject*, int32> FunctionIndices;
+
+	for (AActor* Actor : Level->GetLevelActors())
+	{
+		if (!ShouldTickActor(Actor))
+		{
+			continue;
+		}
+
+		const int32 ActorFunctionIndex = static_cast<int32>(Functions.size());
+		FTickFunctionInfo ActorFunction;
+		ActorFunction.Actor = Actor;
+		ActorFunction.TickGroup = ToIndex(Actor->GetTickGroup());
+		ActorFunction.bRunOnAnyThread = Actor->CanTickOnAnyThread();
+		Functions.push_back(std::move(ActorFunction));
+		FunctionIndices[Actor] = ActorFunctionIndex;
+
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			if (!Component || !Component->CanEverTick())
+			{
+				continue;
+			}
+
+			FTickFunctionInfo ComponentFunction;
+			ComponentFunction.Actor = Actor;
+			ComponentFunction.Component = Component;
+			ComponentFunction.TickGroup = ToIndex(Component->GetTickGroup());
+			ComponentFunction.bRunOnAnyThread = Component->CanTickOnAnyThread();
+			// 컴포넌트는 항상 Owner Actor의 Tick 이후에 실행
+			ComponentFunction.Prerequisites.push_back(ActorFunctionIndex);
+
+			FunctionIndices[Component] = static_cast<int32>(Functions.size());
+			Functions.push_back(std::move(ComponentFunction));
+		}
+	}
+	NumTickFunctions = static_cast<int32>(Functions.size());
+
+	// 명시적 선행 조건 연결 (Tick하지 않는 대상은 이미 끝난 것으로 간주)
+	for (int32 FunctionIndex = 0; FunctionIndex < NumTickFunctions; ++FunctionIndex)
+	{
+		FTickFunctionInfo& Function = Functions[FunctionIndex];
+		const TArray<UObject*>& Prerequisites = Function.Component
+			? Function.Component->GetTickPrerequisites()
+			: Function.Actor->GetTickPrerequisites();
+
+		for (const UObject* Prerequisite : Prerequisites)
+		{
+			auto It = FunctionIndices.find(Prerequisite);
+			if (It != FunctionIndices.end() && It->second != FunctionIndex)
+			{
+				Function.Prerequisites.push_back(It->second);
+			}
+		}
+	}
+
+	// 선행 조건이 더 늦은 그룹에 있으면 같은 그룹으로 미룬다 (그룹 수가 유한하므로 반드시 수렴)
+	bool bIsChanged = true;
+	while (bIsChanged)
+	{
+		bIsChanged = false;
+		for (FTickFunctionInfo& Function : Functions)
+		{
+			for (int32 Prerequisite : Function.Prerequisites)
+			{
+				if (Functions[Prerequisite].TickGroup > Function.TickGroup)
+				{
+					Function.TickGroup = Functions[Prerequisite].TickGroup;
+					bIsChanged = true;
+				}
+			}
+		}
+	}
+
+	// Functions는 Actor별로 연속해 있으므로 Actor가 바뀔 때마다 그룹별 단위 인덱스를 초기화
+	AActor* CurrentActor = nullptr;
+	int32 UnitIndexByGroup[ToIndex(ETickingGroup::End)] = {};
+	for (FTickFunctionInfo& Function : Functions)
+	{
+		if (Function.Actor != CurrentActor)
+		{
+			CurrentActor = Function.Actor;
+			std::fill(std::begin(UnitIndexByGroup), std::end(UnitIndexByGroup), -1);
+		}
+
+		int32& UnitIndex = UnitIndexByGroup[Function.TickGroup];
+		if (UnitIndex < 0)
+		{
+			UnitIndex = static_cast<int32>(TickUnits.size());
+			FTickUnit NewUnit;
+			NewUnit.Actor = Function.Actor;
+			NewUnit.TickGroup = static_cast<ETickingGroup>(Function.TickGroup);
+			TickUnits.push_back(std::move(NewUnit));
+		}
+
+		FTickUnit& Unit = TickUnits[UnitIndex];
+		if (Function.Component)
+		{
+			Unit.Components.push_back(Function.Component);
+		}
+		else
+		{
+			Unit.bTickActor = true;
+		}
+		Unit.bRunOnAnyThread = Unit.bRunOnAnyThread && Function.bRunOnAnyThread;
+		Function.UnitIndex = UnitIndex;
+	}
+
+	// 같은 그룹의 다른 단위를 향한 선행 조건만 단위 간 의존으로 남긴다
+	// 같은 단위 안에서는 Actor Tick → OwnedComponents 순서로 실행된다
+	for (const FTickFunctionInfo& Function : Functions)
+	{
+		FTickUnit& Unit = TickUnits[Function.UnitIndex];
+		for (int32 Prerequisite : Function.Prerequisites)
+		{
+			const int32 PrerequisiteUnitIndex = Functions[Prerequisite].UnitIndex;
+			if (PrerequisiteUnitIndex == Function.UnitIndex || TickUnits[PrerequisiteUnitIndex].TickGroup != Unit.TickGroup)
+			{
+				continue;
+			}
+
+			if (std::find(Unit.Prerequisites.begin(), Unit.Prerequisites.end(), PrerequisiteUnitIndex) == Unit.Prerequisites.end())
+			{
+				Unit.Prerequisites.push_back(PrerequisiteUnitIndex);
+			}
+		}
+	}
+}
+
+/**
+ * @brief 선행 조건 깊이(위상 정렬 단계)가 같은 단위끼리 Wave로 묶는다
+ * Wave 안의 순서는 Level의 Actor 순서를 따르며, 순환 의존 단위는 그룹의 마지막 Wave에서 Game Thread로 실행한다
+ */
+void FTickTaskManager::BuildTickWaves()
+{
+	for (TArray<FTickWave>& Waves : TickWaves)
+	{
+		Waves.clear();
+	}
+
+	const int32 NumUnits = static_cast<int32>(TickUnits.size());
+	TArray<int32> NumPendingPrerequisites(NumUnits, 0);
+	TArray<int32> Depths(NumUnits, 0);
+	TArray<TArray<int32>> Subsequents(NumUnits);
+	TArray<int32> ReadyUnits;
+	ReadyUnits.reserve(NumUnits);
+
+	for (int32 UnitIndex = 0; UnitIndex < NumUnits; ++UnitIndex)
+	{
+		const TArray<int32>& Prerequisites = TickUnits[UnitIndex].Prerequisites;
+		NumPendingPrerequisites[UnitIndex] = static_cast<int32>(Prerequisites.size());
+		for (int32 Prerequisite : Prerequisites)
+		{
+			Subsequents[Prerequisite].push_back(UnitIndex);
+		}
+
+		if (Prerequisites.empty())
+		{
+			ReadyUnits.push_back(UnitIndex);
+		}
+	}
+
+	for (size_t Cursor = 0; Cursor < ReadyUnits.size(); ++Cursor)
+	{
+		const int32 UnitIndex = ReadyUnits[Cursor];
+		for (int32 Subsequent : Subsequents[UnitIndex])
+		{
+			Depths[Subsequent] = std::max(Depths[Subsequent], Depths[UnitIndex] + 1);
+			if (--NumPendingPrerequisites[Subsequent] == 0)
+			{
+				ReadyUnits.push_back(Subsequent);
+			}
+		}
+	}
+
+	TArray<int32> CyclicUnits;
+	for (int32 UnitIndex = 0; UnitIndex < NumUnits; ++UnitIndex)
+	{
+		if (NumPendingPrerequisites[UnitIndex] > 0)
+		{
+			CyclicUnits.push_back(UnitIndex);
+			continue;
+		}
+
+		const FTickUnit& Unit = TickUnits[UnitIndex];
+		TArray<FTickWave>& Waves = TickWaves[ToIndex(Unit.TickGroup)];
+		const size_t WaveIndex = static_cast<size_t>(Depths[UnitIndex]);
+		if (Waves.size() <= WaveIndex)
+		{
+			Waves.resize(WaveIndex + 1);
+		}
+
+		if (Unit.bRunOnAnyThread)
+		{
+			Waves[WaveIndex].ParallelUnits.push_back(UnitIndex);
+		}
+		else
+		{
+			Waves[WaveIndex].GameThreadUnits.push_back(UnitIndex);
+		}
+	}
+
+	if (!CyclicUnits.empty())
+	{
+		UE_LOG_WARNING("TickTaskManager: %zu개의 Tick 단위에 순환 선행 조건이 있어 그룹 마지막에 Game Thread에서 실행합니다",
+			CyclicUnits.size());
+
+		TArray<FTickWave> CyclicWaves(static_cast<int32>(ETickingGroup::End));
+		for (int32 UnitIndex : CyclicUnits)
+		{
+			CyclicWaves[ToIndex(TickUnits[UnitIndex].TickGroup)].GameThreadUnits.push_back(UnitIndex);
+		}
+
+		for (int32 GroupIndex = 0; GroupIndex < ToIndex(ETickingGroup::End); ++GroupIndex)
+		{
+			if (!CyclicWaves[GroupIndex].GameThreadUnits.empty())
+			{
+				TickWaves[GroupIndex].push_back(std::move(CyclicWaves[GroupIndex]));
+			}
+		}
+	}
+}
+
+/**
+ * @param bInIsGameThread true면 앞선 Tick이 컴포넌트를 추가/제거했을 때(Lua 등) 실행 전에 소유 여부를 다시 확인
+ */
+void FTickTaskManager::ExecuteTickUnit(const FTickUnit& InUnit, float InDeltaTime, bool bInIsGameThread) const
+{
+	AActor* Actor = InUnit.Actor;
+	if (InUnit.bTickActor && Actor->CanTick())
+	{
+		Actor->Tick(InDeltaTime);
+	}
+
+	for (UActorComponent* Component : InUnit.Components)
+	{
+		if (bInIsGameThread && RegistrationSerial.load(std::memory_order_relaxed) != BuiltRegistrationSerial)
+		{
+			const auto& OwnedComponents = Actor->GetOwnedComponents();
+			if (std::find(OwnedComponents.begin(), OwnedComponents.end(), Component) == OwnedComponents.end())
+			{
+				continue;
+			}
+		}
+
+		if (Component->CanEverTick())
+		{
+			Component->TickComponent(InDeltaTime);
+		}
+	}
+}
+
+void FTickTaskManager::FlushDeferredPrimitiveUpdates()
+{
+	// ParallelForRange가 반환된 뒤에만 호출되므로 워커와 경쟁하지 않는다
+	TArray<UPrimitiveComponent*> Updates;
+	Updates.swap(DeferredPrimitiveUpdates);
+
+	// 이번 Wave에서 움직인 계층의 World 행렬과 AABB를 한 번에 다시 계산해 트리에 반영
+	Level->UpdateTransforms();
+
+	for (UPrimitiveComponent* Component : Updates)
+	{
+		Level->UpdatePrimitiveInOctree(Component);
+	}
+}
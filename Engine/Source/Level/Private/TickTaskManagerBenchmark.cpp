@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "Level/Public/TickTaskManager.h"
+#include "Level/Public/World.h"
+#include "Level/Public/Level.h"
+#include "Actor/Public/MovingCubeActor.h"
+#include "Component/Public/RotatingMovementComponent.h"
+#include "Core/Public/TaskGraph.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	constexpr int32 NumActors = 20000;
+	constexpr int32 NumMeasuredFrames = 30;
+	constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+	/**
+	 * @brief RotatingMovementComponent를 붙인 MovingCubeActor N개를 격자로 배치한 Game World 생성
+	 * SceneComponent가 GWorld의 Level Octree를 갱신하므로 호출 전후로 GWorld를 관리해야 한다
+	 */
+	UWorld* CreateBenchmarkWorld()
+	{
+		UWorld* World = NewObject<UWorld>();
+		World->SetWorldType(EWorldType::Game);
+		GWorld = World;
+		World->CreateNewLevel();
+
+		const int32 GridSize = static_cast<int32>(std::ceil(std::sqrt(static_cast<float>(NumActors))));
+		for (int32 Index = 0; Index < NumActors; ++Index)
+		{
+			AActor* Actor = World->SpawnActor(AMovingCubeActor::StaticClass());
+			if (!Actor)
+			{
+				continue;
+			}
+
+			Actor->SetActorLocation(FVector(
+				static_cast<float>(Index % GridSize - GridSize / 2),
+				static_cast<float>(Index / GridSize - GridSize / 2),
+				0.0f));
+
+			// AddComponent는 컴포넌트마다 등록 로그를 남기므로 직접 생성한 뒤 BeginPlay로 UpdatedComponent를 지정
+			URotatingMovementComponent* RotatingMovement = Actor->CreateDefaultSubobject<URotatingMovementComponent>();
+			RotatingMovement->RotationRate = FVector(0.0f, 0.0f, 90.0f);
+			RotatingMovement->PivotTranslation = FVector::ZeroVector();
+			RotatingMovement->bRotationInLocalSpace = false;
+			RotatingMovement->BeginPlay();
+		}
+
+		return World;
+	}
+
+	/** @brief Tick 그룹 실행 시간만 측정 (프레임당 ms) */
+	double MeasureTickGroups(UWorld* InWorld)
+	{
+		FTickTaskManager* TickTaskManager = InWorld->GetLevel()->GetTickTaskManager();
+		TickTaskManager->StartFrame(false);
+
+		FScopeCycleCounter Counter;
+		for (int32 Frame = 0; Frame < NumMeasuredFrames; ++Frame)
+		{
+			TickTaskManager->RunTickGroup(ETickingGroup::PrePhysics, BenchmarkDeltaTime);
+			TickTaskManager->RunTickGroup(ETickingGroup::DuringPhysics, BenchmarkDeltaTime);
+			TickTaskManager->RunTickGroup(ETickingGroup::PostPhysics, BenchmarkDeltaTime);
+		}
+		return Counter.Finish() / NumMeasuredFrames;
+	}
+
+	/** @brief Octree/충돌 갱신을 포함한 UWorld::Tick 전체 시간 측정 (프레임당 ms) */
+	double MeasureWorldTick(UWorld* InWorld)
+	{
+		FScopeCycleCounter Counter;
+		for (int32 Frame = 0; Frame < NumMeasuredFrames; ++Frame)
+		{
+			InWorld->Tick(BenchmarkDeltaTime);
+		}
+		return Counter.Finish() / NumMeasuredFrames;
+	}
+}
+
+/**
+ * @brief 20k MovingCubeActor + RotatingMovementComponent의 Tick을 1 → 논리 코어 수 스레드로 실행하며 확장성 측정
+ * 측정 중에는 GWorld와 전역 Task Graph를 바꾸므로 다른 작업이 없는 상태에서 실행해야 한다
+ */
+IMPLEMENT_BENCHMARK(TickGroups, "20k MovingCubeActor + RotatingMovementComponent Tick 그룹 병렬 실행 1~N 스레드 확장성")
+{
+	FTaskGraph& TaskGraph = FTaskGraph::GetInstance();
+	const bool bWasInitialized = TaskGraph.IsInitialized();
+	const int32 PreviousNumWorkers = TaskGraph.GetNumWorkers();
+	UWorld* PreviousWorld = GWorld;
+
+	UWorld* World = CreateBenchmarkWorld();
+	World->GetLevel()->GetTickTaskManager()->StartFrame(false);
+	UE_LOG("  Actors: %d, Tick Units: %d, Tick Functions: %d",
+		NumActors,
+		World->GetLevel()->GetTickTaskManager()->GetNumTickUnits(),
+		World->GetLevel()->GetTickTaskManager()->GetNumTickFunctions());
+
+	const int32 MaxThreads = FPlatformMisc::NumberOfCores();
+	TArray<int32> ThreadCounts;
+	for (int32 NumThreads = 1; NumThreads < MaxThreads; NumThreads *= 2)
+	{
+		ThreadCounts.push_back(NumThreads);
+	}
+	ThreadCounts.push_back(MaxThreads);
+
+	TaskGraph.Shutdown();
+
+	double SerialMilliseconds = 0.0;
+	UE_LOG("  Threads | Tick Groups (ms/frame) | World Tick (ms/frame) | Speedup");
+	for (int32 NumThreads : ThreadCounts)
+	{
+		TaskGraph.Initialize(NumThreads - 1);
+
+		// 워커 기동 및 Octree 재삽입 대기열 안정화를 위한 예열
+		World->Tick(BenchmarkDeltaTime);
+
+		const double TickGroupMilliseconds = MeasureTickGroups(World);
+		const double WorldTickMilliseconds = MeasureWorldTick(World);
+		if (NumThreads == 1)
+		{
+			SerialMilliseconds = TickGroupMilliseconds;
+		}
+
+		UE_LOG("  %7d | %22.3f | %21.3f | %6.2fx",
+			NumThreads,
+			TickGroupMilliseconds,
+			WorldTickMilliseconds,
+			TickGroupMilliseconds > 0.0 ? SerialMilliseconds / TickGroupMilliseconds : 0.0);
+
+		TaskGraph.Shutdown();
+	}
+
+	SafeDelete(World);
+	GWorld = PreviousWorld;
+
+	if (bWasInitialized)
+	{
+		TaskGraph.Initialize(PreviousNumWorkers);
+	}
+}
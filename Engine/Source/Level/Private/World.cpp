@@ -1,15 +1,20 @@
 #include "pch.h"
 #include "Level/Public/World.h"
 #include "Level/Public/Level.h"
+#include "Level/Public/TickTaskManager.h"
 #include "Actor/Public/AmbientLight.h"
 #include "Component/Public/PrimitiveComponent.h"
 #include "Component/Public/ActorComponent.h"
 #include "Utility/Public/JsonSerializer.h"
-#include "Manager/Config/Public/ConfigManager.h"
 #include "Manager/Path/Public/PathManager.h"
 #include "Manager/Script/Public/CoroutineManager.h"
 
+#ifndef IS_HEADLESS
+#include "Manager/Config/Public/ConfigManager.h"
+#endif
+
 IMPLEMENT_CLASS(UWorld, UObject)
+UWorld* GWorld = nullptr;
 
 UWorld::UWorld()
 	: WorldType(EWorldType::Editor)
@@ -73,38 +78,58 @@ void UWorld::Tick(float DeltaTimes)
 	}
 
 	// 스폰 / 삭제 처리
-	FlushPendingDestroy();
+	{
+		TIME_PROFILE(WorldFlushDestroy)
+		ALLOC_SCOPE(WorldFlushDestroy)
+		FlushPendingDestroy();
+	}
 
 	// TODO: 현재 임시로 OCtree 업데이트 처리
-	Level->UpdateOctree();
+	{
+		TIME_PROFILE(WorldOctree)
+		ALLOC_SCOPE(WorldOctree)
+		Level->UpdateOctree();
+	}
+
+	// Editor 월드는 bTickInEditor인 Actor만, Game/PIE 월드는 Tick 가능한 모든 Actor를 Tick
+	const bool bShouldTickActors = WorldType == EWorldType::Editor || WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+	FTickTaskManager* TickTaskManager = Level->GetTickTaskManager();
 
-	if (WorldType == EWorldType::Editor )
+	if (bShouldTickActors)
 	{
 		UCoroutineManager::GetInstance().Update(DeltaTimes);
-		for (AActor* Actor : Level->GetLevelActors())
+		TickTaskManager->StartFrame(WorldType == EWorldType::Editor);
+
 		{
-			if(Actor->CanTickInEditor() && Actor->CanTick())
-			{
-				Actor->Tick(DeltaTimes);
-			}
-			
-			if (Actor->IsPendingDestroy())
-			{
-				DestroyActor(Actor);
-			}
+			TIME_PROFILE(WorldTickPrePhysics)
+			ALLOC_SCOPE(WorldTick)
+			TickTaskManager->RunTickGroup(ETickingGroup::PrePhysics, DeltaTimes);
+		}
+		{
+			TIME_PROFILE(WorldTickDuringPhysics)
+			ALLOC_SCOPE(WorldTick)
+			TickTaskManager->RunTickGroup(ETickingGroup::DuringPhysics, DeltaTimes);
 		}
 	}
 
-	if (WorldType == EWorldType::Game || WorldType == EWorldType::PIE)
+	// 충돌 감지 업데이트 (Tick에서 움직인 계층의 World 행렬과 AABB를 먼저 한 번에 갱신)
+	{
+		TIME_PROFILE(WorldCollision)
+		ALLOC_SCOPE(WorldCollision)
+		Level->UpdateTransforms();
+		UpdateCollisions();
+	}
+
+	if (bShouldTickActors)
 	{
-		UCoroutineManager::GetInstance().Update(DeltaTimes);
-		for (AActor* Actor : Level->GetLevelActors())
 		{
-			if(Actor->CanTick())
-			{
-				Actor->Tick(DeltaTimes);
-			}
+			TIME_PROFILE(WorldTickPostPhysics)
+			ALLOC_SCOPE(WorldTick)
+			TickTaskManager->RunTickGroup(ETickingGroup::PostPhysics, DeltaTimes);
+		}
 
+		for (AActor* Actor : Level->GetLevelActors())
+		{
 			if (Actor->IsPendingDestroy())
 			{
 				DestroyActor(Actor);
@@ -112,8 +137,11 @@ void UWorld::Tick(float DeltaTimes)
 		}
 	}
 
-	// 충돌 감지 업데이트
-	UpdateCollisions();
+	// PostPhysics에서 움직인 계층 갱신
+	{
+		TIME_PROFILE(WorldTransformUpdate)
+		Level->UpdateTransforms();
+	}
 }
 
 ULevel* UWorld::GetLevel() const
@@ -149,7 +177,9 @@ bool UWorld::LoadLevel(path InLevelFilePath)
 		SwitchToLevel(NewLevel);
 		NewLevel->Serialize(true, LevelJson);
 
+#ifndef IS_HEADLESS
 		UConfigManager::GetInstance().SetLastUsedLevelPath(InLevelFilePath.string());
+#endif
 		BeginPlay();
 	}
 	catch (const exception& Exception)
@@ -281,6 +311,7 @@ void UWorld::FlushPendingDestroy()
 
 /**
  * @brief 모든 PrimitiveComponent의 충돌을 업데이트합니다.
+ * Sweep and Prune으로 World AABB가 겹치는 쌍만 골라 Narrowphase를 수행하므로 비용은 O(N log N + 후보 쌍 수)입니다.
  */
 void UWorld::UpdateCollisions()
 {
@@ -290,7 +321,8 @@ void UWorld::UpdateCollisions()
 	}
 
 	// 모든 PrimitiveComponent 수집
-	TArray<UPrimitiveComponent*> AllPrimitives;
+	PreviousOverlapPrimitives.swap(OverlapPrimitives);
+	OverlapPrimitives.clear();
 	for (AActor* Actor : Level->GetLevelActors())
 	{
 		if (!Actor)
@@ -304,16 +336,67 @@ void UWorld::UpdateCollisions()
 			{
 				if (PrimComp->GetGenerateOverlapEvents())
 				{
-					AllPrimitives.push_back(PrimComp);
+					OverlapPrimitives.push_back(PrimComp);
 				}
 			}
 		}
 	}
 
-	// 각 컴포넌트의 충돌 업데이트
-	for (UPrimitiveComponent* PrimComp : AllPrimitives)
+	const int32 NumPrimitives = static_cast<int32>(OverlapPrimitives.size());
+	OverlapBounds.resize(NumPrimitives);
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		FVector WorldMin, WorldMax;
+		OverlapPrimitives[Index]->GetOverlapBounds(WorldMin, WorldMax);
+		OverlapBounds[Index] = FAABB(WorldMin, WorldMax);
+	}
+
+	// Broadphase: 수집 순서가 지난 프레임과 같으면 이전 정렬 순서를 재사용
+	const bool bIsSameProxySet = OverlapPrimitives == PreviousOverlapPrimitives;
+	CollisionBroadphase.FindOverlappingPairs(OverlapBounds, bIsSameProxySet, OverlapPairs);
+
+	// Narrowphase: Shape 간 판정은 모두 대칭이므로 후보 쌍마다 한 번만 검사하고 겹친 쌍만 남긴다
+	TFrameArray<int32> OverlapOffsets(NumPrimitives + 1, 0);
+	size_t NumOverlappingPairs = 0;
+	for (const FBroadphasePair& Pair : OverlapPairs)
+	{
+		if (OverlapPrimitives[Pair.IndexA]->CheckOverlapWith(OverlapPrimitives[Pair.IndexB]))
+		{
+			OverlapPairs[NumOverlappingPairs++] = Pair;
+			++OverlapOffsets[Pair.IndexA + 1];
+			++OverlapOffsets[Pair.IndexB + 1];
+		}
+	}
+	OverlapPairs.resize(NumOverlappingPairs);
+
+	// 컴포넌트별 Overlap 대상을 연속 배열로 모은다
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		OverlapOffsets[Index + 1] += OverlapOffsets[Index];
+	}
+
+	TFrameArray<int32> OverlapTargets(NumOverlappingPairs * 2);
+	TFrameArray<int32> WriteCursors(OverlapOffsets.begin(), OverlapOffsets.end() - 1);
+	for (const FBroadphasePair& Pair : OverlapPairs)
 	{
-		PrimComp->UpdateOverlaps(AllPrimitives);
+		OverlapTargets[WriteCursors[Pair.IndexA]++] = Pair.IndexB;
+		OverlapTargets[WriteCursors[Pair.IndexB]++] = Pair.IndexA;
+	}
+
+	// 각 컴포넌트의 충돌 업데이트 (수집 순서로 정렬해 Begin/End Overlap 발생 순서를 유지)
+	TFrameArray<FOverlapInfo> NewOverlapInfos;
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		const auto RangeBegin = OverlapTargets.begin() + OverlapOffsets[Index];
+		const auto RangeEnd = OverlapTargets.begin() + OverlapOffsets[Index + 1];
+		std::sort(RangeBegin, RangeEnd);
+
+		NewOverlapInfos.clear();
+		for (auto It = RangeBegin; It != RangeEnd; ++It)
+		{
+			NewOverlapInfos.push_back(FOverlapInfo(OverlapPrimitives[*It]));
+		}
+		OverlapPrimitives[Index]->ApplyOverlapInfos(NewOverlapInfos);
 	}
 }
 
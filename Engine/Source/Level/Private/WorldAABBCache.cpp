@@ -0,0 +1,247 @@
+#include "pch.h"
+#include "Level/Public/WorldAABBCache.h"
+
+#include "Component/Public/PrimitiveComponent.h"
+
+#include <emmintrin.h>
+
+FWorldAABBCache::~FWorldAABBCache()
+{
+	// 레벨보다 오래 사는 프리미티브가 해제된 캐시를 가리키지 않도록 연결을 끊음
+	for (UPrimitiveComponent* Primitive : Primitives)
+	{
+		Primitive->WorldAABBCache = nullptr;
+		Primitive->WorldAABBHandle = -1;
+	}
+}
+
+void FWorldAABBCache::Add(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive || InPrimitive->WorldAABBCache == this)
+	{
+		return;
+	}
+
+	if (InPrimitive->WorldAABBCache)
+	{
+		InPrimitive->WorldAABBCache->Remove(InPrimitive);
+	}
+
+	InPrimitive->WorldAABBCache = this;
+	InPrimitive->WorldAABBHandle = Num();
+
+	Primitives.push_back(InPrimitive);
+	for (TArray<float>* Column : { &MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ })
+	{
+		Column->push_back(0.0f);
+	}
+	VolumeTypes.push_back(EBoundingVolumeType::None);
+	DirtyFlags.push_back(1);
+}
+
+void FWorldAABBCache::Remove(UPrimitiveComponent* InPrimitive)
+{
+	if (!InPrimitive || InPrimitive->WorldAABBCache != this)
+	{
+		return;
+	}
+
+	// 마지막 항목을 빈 자리로 옮기고 옮겨진 프리미티브의 핸들을 갱신
+	const int32 Handle = InPrimitive->WorldAABBHandle;
+	const int32 LastHandle = Num() - 1;
+	if (Handle != LastHandle)
+	{
+		Primitives[Handle] = Primitives[LastHandle];
+		Primitives[Handle]->WorldAABBHandle = Handle;
+		for (TArray<float>* Column : { &MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ })
+		{
+			(*Column)[Handle] = (*Column)[LastHandle];
+		}
+		VolumeTypes[Handle] = VolumeTypes[LastHandle];
+		DirtyFlags[Handle] = DirtyFlags[LastHandle];
+	}
+
+	Primitives.pop_back();
+	for (TArray<float>* Column : { &MinX, &MinY, &MinZ, &MaxX, &MaxY, &MaxZ })
+	{
+		Column->pop_back();
+	}
+	VolumeTypes.pop_back();
+	DirtyFlags.pop_back();
+
+	InPrimitive->WorldAABBCache = nullptr;
+	InPrimitive->WorldAABBHandle = -1;
+}
+
+void FWorldAABBCache::UpdateDirtyBounds()
+{
+	// 1. Dirty 핸들 수집 (16개씩 비교해 Dirty가 없는 구간은 한 번에 건너뜀)
+	DirtyHandles.clear();
+	const int32 NumEntries = Num();
+	const uint8* Flags = DirtyFlags.data();
+	int32 Index = 0;
+	for (; Index + 16 <= NumEntries; Index += 16)
+	{
+		const __m128i FlagBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Flags + Index));
+		uint32 Mask = ~static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(FlagBytes, _mm_setzero_si128()))) & 0xFFFFu;
+		for (int32 Bit = 0; Mask != 0; ++Bit, Mask >>= 1)
+		{
+			if (Mask & 1u)
+			{
+				DirtyHandles.push_back(Index + Bit);
+			}
+		}
+	}
+	for (; Index < NumEntries; ++Index)
+	{
+		if (Flags[Index])
+		{
+			DirtyHandles.push_back(Index);
+		}
+	}
+
+	const int32 NumDirty = static_cast<int32>(DirtyHandles.size());
+	if (NumDirty == 0)
+	{
+		return;
+	}
+
+	// 2. 로컬 박스와 월드 행렬을 4개 단위 블록에 레인별로 모음 (가상 호출은 Dirty 항목에서만 발생)
+	const int32 NumBlocks = (NumDirty + 3) / 4;
+	ArvoBlocks.resize(NumBlocks);
+	for (int32 DirtyIndex = 0; DirtyIndex < NumBlocks * 4; ++DirtyIndex)
+	{
+		FArvoBlock& Block = ArvoBlocks[DirtyIndex / 4];
+		const int32 Lane = DirtyIndex % 4;
+
+		FVector LocalCenter, LocalExtent;
+		const FMatrix* World = nullptr;
+		if (DirtyIndex < NumDirty)
+		{
+			const int32 Handle = DirtyHandles[DirtyIndex];
+			UPrimitiveComponent* Primitive = Primitives[Handle];
+			VolumeTypes[Handle] = Primitive->GetLocalBounds(LocalCenter, LocalExtent);
+			DirtyFlags[Handle] = 0;
+
+			if (VolumeTypes[Handle] != EBoundingVolumeType::None)
+			{
+				World = &Primitive->GetWorldTransformMatrix();
+			}
+		}
+
+		const float LocalCenterValues[3] = { LocalCenter.X, LocalCenter.Y, LocalCenter.Z };
+		const float LocalExtentValues[3] = { LocalExtent.X, LocalExtent.Y, LocalExtent.Z };
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Block.LocalCenter[Axis][Lane] = LocalCenterValues[Axis];
+			Block.LocalExtent[Axis][Lane] = LocalExtentValues[Axis];
+		}
+
+		// 바운딩 볼륨이 없거나 빈 레인이면 행렬을 0으로 두어 원점의 크기 0 박스가 되게 함
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Column = 0; Column < 3; ++Column)
+			{
+				Block.World[Row][Column][Lane] = World ? World->Data[Row][Column] : 0.0f;
+			}
+		}
+	}
+
+	// 3. 블록마다 4개 항목의 World AABB를 동시에 계산한 뒤 핸들 위치에 기록
+	const __m128 SignMask = _mm_set1_ps(-0.0f);
+	TArray<float>* const MinColumns[3] = { &MinX, &MinY, &MinZ };
+	TArray<float>* const MaxColumns[3] = { &MaxX, &MaxY, &MaxZ };
+	for (int32 BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex)
+	{
+		const FArvoBlock& Block = ArvoBlocks[BlockIndex];
+		const int32 NumLanes = std::min(4, NumDirty - BlockIndex * 4);
+		const int32* Handles = DirtyHandles.data() + BlockIndex * 4;
+
+		for (int32 Column = 0; Column < 3; ++Column)
+		{
+			__m128 Center = _mm_load_ps(Block.World[3][Column]);
+			__m128 Extent = _mm_setzero_ps();
+			for (int32 Row = 0; Row < 3; ++Row)
+			{
+				const __m128 Element = _mm_load_ps(Block.World[Row][Column]);
+				Center = _mm_add_ps(Center, _mm_mul_ps(_mm_load_ps(Block.LocalCenter[Row]), Element));
+				Extent = _mm_add_ps(Extent, _mm_mul_ps(_mm_load_ps(Block.LocalExtent[Row]), _mm_andnot_ps(SignMask, Element)));
+			}
+
+			alignas(16) float WorldMin[4];
+			alignas(16) float WorldMax[4];
+			_mm_store_ps(WorldMin, _mm_sub_ps(Center, Extent));
+			_mm_store_ps(WorldMax, _mm_add_ps(Center, Extent));
+			for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+			{
+				(*MinColumns[Column])[Handles[Lane]] = WorldMin[Lane];
+				(*MaxColumns[Column])[Handles[Lane]] = WorldMax[Lane];
+			}
+		}
+	}
+}
+
+void FWorldAABBCache::GetBounds(int32 InHandle, FVector& OutMin, FVector& OutMax)
+{
+	if (DirtyFlags[InHandle])
+	{
+		RefreshEntry(InHandle);
+	}
+
+	OutMin = FVector(MinX[InHandle], MinY[InHandle], MinZ[InHandle]);
+	OutMax = FVector(MaxX[InHandle], MaxY[InHandle], MaxZ[InHandle]);
+}
+
+EBoundingVolumeType FWorldAABBCache::GetVolumeType(int32 InHandle)
+{
+	if (DirtyFlags[InHandle])
+	{
+		RefreshEntry(InHandle);
+	}
+	return VolumeTypes[InHandle];
+}
+
+void FWorldAABBCache::TransformBounds(const FVector& InLocalCenter, const FVector& InLocalExtent, const FMatrix& InWorld, FVector& OutMin, FVector& OutMax)
+{
+	// UpdateDirtyBounds의 SSE 경로와 같은 연산 순서
+	const float LocalCenter[3] = { InLocalCenter.X, InLocalCenter.Y, InLocalCenter.Z };
+	const float LocalExtent[3] = { InLocalExtent.X, InLocalExtent.Y, InLocalExtent.Z };
+	float WorldMin[3];
+	float WorldMax[3];
+	for (int32 Column = 0; Column < 3; ++Column)
+	{
+		float Center = InWorld.Data[3][Column];
+		float Extent = 0.0f;
+		for (int32 Row = 0; Row < 3; ++Row)
+		{
+			Center += LocalCenter[Row] * InWorld.Data[Row][Column];
+			Extent += LocalExtent[Row] * std::abs(InWorld.Data[Row][Column]);
+		}
+		WorldMin[Column] = Center - Extent;
+		WorldMax[Column] = Center + Extent;
+	}
+
+	OutMin = FVector(WorldMin[0], WorldMin[1], WorldMin[2]);
+	OutMax = FVector(WorldMax[0], WorldMax[1], WorldMax[2]);
+}
+
+void FWorldAABBCache::RefreshEntry(int32 InHandle)
+{
+	UPrimitiveComponent* Primitive = Primitives[InHandle];
+	FVector LocalCenter, LocalExtent;
+	VolumeTypes[InHandle] = Primitive->GetLocalBounds(LocalCenter, LocalExtent);
+
+	FVector WorldMin, WorldMax;
+	if (VolumeTypes[InHandle] != EBoundingVolumeType::None)
+	{
+		TransformBounds(LocalCenter, LocalExtent, Primitive->GetWorldTransformMatrix(), WorldMin, WorldMax);
+	}
+
+	MinX[InHandle] = WorldMin.X;
+	MinY[InHandle] = WorldMin.Y;
+	MinZ[InHandle] = WorldMin.Z;
+	MaxX[InHandle] = WorldMax.X;
+	MaxY[InHandle] = WorldMax.Y;
+	MaxZ[InHandle] = WorldMax.Z;
+	DirtyFlags[InHandle] = 0;
+}
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include "Level/Public/WorldAABBCache.h"
+#include "Level/Public/World.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Shape/Public/BoxComponent.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 NumPrimitives = 100000;
+	constexpr int32 NumIterations = 20;
+	// 일반적인 프레임에서 움직이는 프리미티브 비율
+	constexpr int32 PartialDirtyStride = 10;
+
+	/** @brief 캐시 도입 이전 UPrimitiveComponent::GetWorldAABB처럼 로컬 박스의 8개 코너를 모두 변환해 Min/Max를 구함 */
+	void LegacyComputeWorldAABB(const UPrimitiveComponent* InPrimitive, FVector& OutMin, FVector& OutMax)
+	{
+		FVector LocalCenter, LocalExtent;
+		InPrimitive->GetLocalBounds(LocalCenter, LocalExtent);
+		const FVector LocalMin = LocalCenter - LocalExtent;
+		const FVector LocalMax = LocalCenter + LocalExtent;
+
+		const FMatrix& WorldTransform = InPrimitive->GetWorldTransformMatrix();
+		OutMin = FVector(+FLT_MAX, +FLT_MAX, +FLT_MAX);
+		OutMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			const FVector4 WorldCorner = FVector4(
+				(Corner & 1) ? LocalMax.X : LocalMin.X,
+				(Corner & 2) ? LocalMax.Y : LocalMin.Y,
+				(Corner & 4) ? LocalMax.Z : LocalMin.Z,
+				1.0f) * WorldTransform;
+			OutMin.X = min(OutMin.X, WorldCorner.X);
+			OutMin.Y = min(OutMin.Y, WorldCorner.Y);
+			OutMin.Z = min(OutMin.Z, WorldCorner.Z);
+			OutMax.X = max(OutMax.X, WorldCorner.X);
+			OutMax.Y = max(OutMax.Y, WorldCorner.Y);
+			OutMax.Z = max(OutMax.Z, WorldCorner.Z);
+		}
+	}
+
+	bool IsNearlySame(const FVector& InA, const FVector& InB)
+	{
+		const float Tolerance = 1.0e-3f * (1.0f + std::abs(InA.X) + std::abs(InA.Y) + std::abs(InA.Z));
+		return std::abs(InA.X - InB.X) <= Tolerance && std::abs(InA.Y - InB.Y) <= Tolerance && std::abs(InA.Z - InB.Z) <= Tolerance;
+	}
+}
+
+/**
+ * @brief 100k 회전된 Box의 World AABB 재계산: 프리미티브별 8코너 변환 vs SoA 캐시의 4개 단위 SSE Arvo 변환
+ * 월드 행렬은 미리 계산해 두어 AABB 변환 비용만 비교하며, 일부만 Dirty인 프레임도 함께 측정한다
+ */
+IMPLEMENT_BENCHMARK(WorldAABBCache, "100k 프리미티브 World AABB 갱신: 8코너 변환 vs SoA 캐시 일괄 Arvo")
+{
+	UWorld* PreviousWorld = GWorld;
+	std::mt19937 Random(20251017);
+
+	UWorld* World = NewObject<UWorld>();
+	World->SetWorldType(EWorldType::Game);
+	GWorld = World;
+	World->CreateNewLevel();
+
+	AActor* BoxOwner = World->SpawnActor(AActor::StaticClass());
+	std::uniform_real_distribution<float> Position(-200.0f, 200.0f);
+	std::uniform_real_distribution<float> Angle(-180.0f, 180.0f);
+	std::uniform_real_distribution<float> Extent(0.5f, 4.0f);
+
+	FWorldAABBCache Cache;
+	TArray<UPrimitiveComponent*> Primitives;
+	Primitives.reserve(NumPrimitives);
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		UBoxComponent* Box = BoxOwner->CreateDefaultSubobject<UBoxComponent>();
+		Box->SetBoxExtent(FVector(Extent(Random), Extent(Random), Extent(Random)));
+		Box->SetRelativeLocation(FVector(Position(Random), Position(Random), Position(Random)));
+		Box->SetRelativeRotation(FQuaternion::FromEuler(FVector(Angle(Random), Angle(Random), Angle(Random))));
+		Box->GetWorldTransformMatrix();
+		Cache.Add(Box);
+		Primitives.push_back(Box);
+	}
+
+	// 1. 모든 프리미티브 재계산
+	TArray<FVector> LegacyMin(NumPrimitives), LegacyMax(NumPrimitives);
+	FScopeCycleCounter LegacyCounter;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (int32 Index = 0; Index < NumPrimitives; ++Index)
+		{
+			LegacyComputeWorldAABB(Primitives[Index], LegacyMin[Index], LegacyMax[Index]);
+		}
+	}
+	const double LegacyMilliseconds = LegacyCounter.Finish();
+
+	double BatchMilliseconds = 0.0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (int32 Handle = 0; Handle < Cache.Num(); ++Handle)
+		{
+			Cache.MarkDirty(Handle);
+		}
+
+		FScopeCycleCounter BatchCounter;
+		Cache.UpdateDirtyBounds();
+		BatchMilliseconds += BatchCounter.Finish();
+	}
+
+	// 2. 일부만 Dirty인 프레임 (Dirty 탐색 비용 포함)
+	double PartialMilliseconds = 0.0;
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (int32 Handle = Iteration % PartialDirtyStride; Handle < Cache.Num(); Handle += PartialDirtyStride)
+		{
+			Cache.MarkDirty(Handle);
+		}
+
+		FScopeCycleCounter PartialCounter;
+		Cache.UpdateDirtyBounds();
+		PartialMilliseconds += PartialCounter.Finish();
+	}
+
+	// 3. 결과 비교 (Arvo는 8코너 결과와 수학적으로 같은 박스)
+	int32 NumMismatches = 0;
+	double Checksum = 0.0;
+	for (int32 Index = 0; Index < NumPrimitives; ++Index)
+	{
+		FVector Min, Max;
+		Primitives[Index]->GetWorldAABB(Min, Max);
+		Checksum += Min.X + Max.Y;
+		if (!IsNearlySame(Min, LegacyMin[Index]) || !IsNearlySame(Max, LegacyMax[Index]))
+		{
+			++NumMismatches;
+		}
+	}
+	FBenchmarkRegistry::Consume(static_cast<uint64>(std::abs(Checksum)));
+	if (NumMismatches > 0)
+	{
+		UE_LOG_ERROR("  결과 불일치: %d / %d", NumMismatches, NumPrimitives);
+	}
+
+	const double NumUpdates = static_cast<double>(NumPrimitives) * NumIterations;
+	UE_LOG("  %d rotated boxes, %d iterations, partial = 1/%d dirty", NumPrimitives, NumIterations, PartialDirtyStride);
+	UE_LOG("  Method             | Total (ms) | ns/primitive");
+	UE_LOG("  8-Corner           | %10.3f | %12.2f", LegacyMilliseconds, LegacyMilliseconds * 1.0e6 / NumUpdates);
+	UE_LOG("  SoA Arvo (all)     | %10.3f | %12.2f", BatchMilliseconds, BatchMilliseconds * 1.0e6 / NumUpdates);
+	UE_LOG("  SoA Arvo (partial) | %10.3f | %12.2f", PartialMilliseconds, PartialMilliseconds * 1.0e6 * PartialDirtyStride / NumUpdates);
+
+	Primitives.clear();
+	SafeDelete(World);
+	GWorld = PreviousWorld;
+}
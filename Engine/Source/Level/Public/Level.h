@@ -12,6 +12,10 @@ class UPrimitiveComponent;
 class UPointLightComponent;
 class ULightComponent;
 class FOctree;
+class FDynamicAABBTree;
+class FTickTaskManager;
+class FWorldAABBCache;
+class FSceneTransformSystem;
 
 UCLASS()
 class ULevel : public UObject
@@ -43,17 +47,28 @@ public:
 
 	FOctree* GetStaticOctree() { return StaticOctree; }
 
-	/** @todo: 효율 개선을 위해 DirtyFlag와 캐시 도입 가능 */
-	TArray<UPrimitiveComponent*>& GetDynamicPrimitives()
-	{
-		DynamicPrimitives.clear();
+	/** @brief 움직인 적이 있는 프리미티브와, Octree 루트 밖이라 아직 Octree에 들어가지 못한 프리미티브 */
+	FDynamicAABBTree* GetDynamicTree() { return DynamicTree; }
 
-		for (auto [Component, TimePoint] : DynamicPrimitiveMap)
-		{
-			DynamicPrimitives.push_back(Component);
-		}
-		return DynamicPrimitives;
-	}
+	/**
+	 * @brief FindPos 근처의 프리미티브 후보 (오클루더 선택용)
+	 * Dynamic Tree의 최근접 결과와 Static Octree의 가까운 노드 결과를 World AABB 중심 거리로 합쳐 MaxPrimitiveCount개로 자른다
+	 */
+	TArray<UPrimitiveComponent*> FindNearestPrimitives(const FVector& FindPos, uint32 MaxPrimitiveCount) const;
+
+	FTickTaskManager* GetTickTaskManager() const { return TickTaskManager; }
+
+	/** @brief 등록된 모든 프리미티브의 World AABB (Octree, Dynamic Tree, 컬링, 충돌이 여기서 읽음) */
+	FWorldAABBCache* GetWorldAABBCache() const { return WorldAABBCache; }
+
+	/** @brief 등록된 모든 SceneComponent의 World 행렬을 계층 단위로 한 번에 갱신 */
+	FSceneTransformSystem* GetTransformSystem() const { return TransformSystem; }
+
+	/**
+	 * @brief 대기 중인 World 행렬과 World AABB를 갱신하고, 움직인 프리미티브를 Octree/Dynamic Tree에 반영 (Game Thread)
+	 * 충돌, 렌더링처럼 레벨 전체의 트랜스폼을 읽기 직전에 호출한다
+	 */
+	void UpdateTransforms();
 
 	friend class UWorld;
 public:
@@ -70,6 +85,9 @@ private:
 	// 지연 삭제를 위한 리스트
 	TArray<AActor*> ActorsToDelete;
 
+	// Tick하는 Actor/Component를 Tick 그룹별로 보관하고 실행
+	FTickTaskManager* TickTaskManager = nullptr;
+
 	uint64 ShowFlags =
 		static_cast<uint64>(EEngineShowFlags::SF_Billboard) |
 		static_cast<uint64>(EEngineShowFlags::SF_StaticMesh) |
@@ -85,37 +103,22 @@ public:
 	
 private:
 
-	void OnPrimitiveUpdated(UPrimitiveComponent* InComponent);
+	/** @brief World AABB 캐시에 등록한 뒤 Octree에 삽입하고, 루트 밖이라 실패하면 Dynamic Tree에 넣어 두고 대기 목록에 추가 */
+	void InsertPrimitiveToOctree(UPrimitiveComponent* InComponent);
 
-	void OnPrimitiveUnregistered(UPrimitiveComponent* InComponent);
+	void RemovePrimitiveFromOctree(UPrimitiveComponent* InComponent);
 
-	/** @brief 한 프레임에 Octree에 삽입할 오브젝트의 최대 크기를 결정해서 부하를 여러 프레임에 분산함. */
-	static constexpr uint32 MAX_OBJECTS_TO_INSERT_PER_FRAME = 256;
-	
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent를 Octree에 삽입하기 위해 필요한 구조체. */
-	struct FDynamicPrimitiveData
-	{
-		UPrimitiveComponent* Primitive;
-		float LastMoveTimePoint;
-
-		bool operator>(const FDynamicPrimitiveData& Other) const
-		{
-			return LastMoveTimePoint > Other.LastMoveTimePoint;
-		}
-	};
-	
-	using FDynamicPrimitiveQueue = TQueue<FDynamicPrimitiveData>;
-	
+	// 한 번도 움직이지 않은 프리미티브
 	FOctree* StaticOctree = nullptr;
 
-	/** @deprecated 기존 코드와의 호환성을 위해 유지, 직접 사용하거나 업데이트하는 것을 금지함 */
-	TArray<UPrimitiveComponent*> DynamicPrimitives;
+	// 움직이는 프리미티브 (처음 움직일 때 StaticOctree에서 옮겨 오며, 같은 프레임에 바로 쿼리 가능)
+	FDynamicAABBTree* DynamicTree = nullptr;
 
-	/** @brief 가장 오래전에 움직인 UPrimitiveComponent부터 순서대로 Octree에 삽입할 수 있도록 보관 */
-	FDynamicPrimitiveQueue DynamicPrimitiveQueue;
+	/** @brief Octree 루트 밖이라 Dynamic Tree에 임시로 들어 있는 정적 프리미티브 (UpdateOctree에서 루트를 키워 옮김) */
+	TSet<UPrimitiveComponent*> PendingOctreePrimitives;
 
-	/** @brief 각 UPrimitiveComponent가 움직인 가장 마지막 시간을 기록 */
-	TMap<UPrimitiveComponent*, float> DynamicPrimitiveMap;
+	FWorldAABBCache* WorldAABBCache = nullptr;
+	FSceneTransformSystem* TransformSystem = nullptr;
 	
 	/*-----------------------------------------------------------------------------
 		Lighting Management
@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+
+class USceneComponent;
+
+/**
+ * @brief 레벨에 등록된 SceneComponent의 World 트랜스폼을 프레임마다 한 번에 갱신하는 시스템
+ * 상대 트랜스폼이 바뀐 컴포넌트는 자손을 재귀로 Dirty 표시하지 않고 대기 목록에만 올린다
+ * UpdateTransforms는 대기 중인 컴포넌트를 루트로 하는 계층을 부모가 자식보다 앞에 오도록 연속 배열에 펼친 뒤,
+ * 서로 독립인 계층끼리 FTaskGraph로 병렬 계산해 결과를 컴포넌트에 기록한다
+ * 합성은 FTransform으로 하며, World 행렬은 렌더러 등이 처음 조회할 때 컴포넌트마다 한 번만 만든다
+ *
+ * 갱신 전에 조회된 트랜스폼은 USceneComponent::GetWorldTransform이 부모 버전을 비교해 그 자리에서 맞춰 주므로 항상 최신이다
+ */
+class FSceneTransformSystem
+{
+public:
+	/** @brief 이미 이 시스템에 있으면 무시하고, 다른 시스템에 있으면 그 시스템에서 제거한 뒤 등록 */
+	void Add(USceneComponent* InComponent);
+	void Remove(USceneComponent* InComponent);
+
+	/** @brief 상대 트랜스폼이 바뀐 컴포넌트를 대기 목록에 추가 (병렬 Tick 중에도 호출 가능) */
+	void MarkDirty(USceneComponent* InComponent);
+
+	bool HasPendingUpdates() const { return bHasPendingUpdates.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief 대기 중인 컴포넌트와 그 자손의 World 트랜스폼을 부모 -> 자식 순서로 다시 계산 (Game Thread)
+	 * @return 이번에 World 트랜스폼이 바뀐 컴포넌트 (다음 호출까지 유효)
+	 */
+	const TArray<USceneComponent*>& UpdateTransforms();
+
+	int32 Num() const { return static_cast<int32>(Components.size()); }
+
+	// Special Member Function
+	FSceneTransformSystem() = default;
+	~FSceneTransformSystem();
+	FSceneTransformSystem(const FSceneTransformSystem&) = delete;
+	FSceneTransformSystem& operator=(const FSceneTransformSystem&) = delete;
+
+private:
+	/** @brief 조상 중에 대기 중인 컴포넌트가 있으면 그 계층에 포함되므로 따로 펼치지 않는다 */
+	static bool HasQueuedAncestor(const USceneComponent* InComponent);
+
+	void UpdateHierarchy(int32 InHierarchyIndex);
+
+	TArray<USceneComponent*> Components;
+
+	std::mutex DirtyLock;
+	TArray<USceneComponent*> DirtyComponents;
+	std::atomic<bool> bHasPendingUpdates{ false };
+
+	// UpdateTransforms 작업 버퍼 (계층 i는 Nodes의 [HierarchyStarts[i], HierarchyStarts[i + 1]) 구간)
+	TArray<USceneComponent*> PendingComponents;
+	TArray<USceneComponent*> Nodes;
+	// 같은 계층 안의 부모 위치, 계층 루트는 -1
+	TArray<int32> ParentSlots;
+	TArray<FTransform> WorldTransforms;
+	TArray<int32> HierarchyStarts;
+	// 계층 루트의 부모 World 트랜스폼 (부모가 없으면 항등 트랜스폼)
+	TArray<FTransform> RootParentTransforms;
+};
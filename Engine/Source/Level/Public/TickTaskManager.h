@@ -0,0 +1,97 @@
+#pragma once
+#include <atomic>
+#include <mutex>
+
+class ULevel;
+class AActor;
+class UActorComponent;
+class UPrimitiveComponent;
+
+/**
+ * @brief Level 단위 Tick 실행기
+ * 실제로 Tick하는 Actor/Component만 Tick 그룹별로 모아 두고 PrePhysics → DuringPhysics → PostPhysics 순서로 실행한다
+ *
+ * - Actor와 같은 그룹의 컴포넌트는 하나의 실행 단위(Actor Tick → Component Tick 순)로 묶는다
+ * - 그룹 안에서는 선행 조건 깊이에 따라 Wave로 나누고, 같은 Wave의 bRunOnAnyThread 단위는 FTaskGraph로 병렬 실행한다
+ * - 그 외 단위(Lua 스크립트 등)는 병렬 구간이 끝난 뒤 Game Thread에서 등록 순서대로 실행한다
+ * - 선행 조건이 더 늦은 그룹에 있으면 해당 그룹으로 미뤄서 실행하고, 컴포넌트는 Owner Actor보다 앞선 그룹에서 실행되지 않는다
+ *
+ * Spawn/Destroy, Tick 플래그, 그룹, 선행 조건이 바뀌면 MarkRegistrationDirty로 알리며,
+ * 목록 재구성은 다음 StartFrame에서 한 번만 수행한다
+ */
+class FTickTaskManager
+{
+public:
+	/** @brief 모든 Level의 Tick 목록을 다음 프레임에 다시 구성하도록 표시 */
+	static void MarkRegistrationDirty();
+
+	/**
+	 * @brief 병렬 Tick 도중 호출되면 Octree 갱신을 Wave 종료 시점으로 미룬다
+	 * @return 미뤘으면 true, Game Thread에서 바로 처리해야 하면 false
+	 */
+	static bool DeferPrimitiveUpdate(UPrimitiveComponent* InComponent);
+
+	/**
+	 * @brief 등록 정보가 바뀌었거나 World 종류가 달라졌으면 Tick 목록 재구성
+	 * @param bInIsEditorWorld true면 CanTickInEditor인 Actor만 Tick
+	 */
+	void StartFrame(bool bInIsEditorWorld);
+	void RunTickGroup(ETickingGroup InTickGroup, float InDeltaTime);
+
+	int32 GetNumTickUnits() const { return static_cast<int32>(TickUnits.size()); }
+	int32 GetNumTickFunctions() const { return NumTickFunctions; }
+
+	// Special Member Function
+	explicit FTickTaskManager(ULevel* InLevel);
+	~FTickTaskManager();
+	FTickTaskManager(const FTickTaskManager&) = delete;
+	FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+private:
+	/**
+	 * @brief 한 번에 실행되는 Tick 묶음
+	 * @var Actor 단위를 소유한 Actor
+	 * @var bTickActor Actor 자체의 Tick 포함 여부 (false면 컴포넌트만 실행)
+	 * @var bRunOnAnyThread 모든 구성원이 워커 스레드에서 실행 가능한지 여부
+	 * @var Prerequisites 같은 그룹에서 먼저 끝나야 하는 단위 인덱스
+	 */
+	struct FTickUnit
+	{
+		AActor* Actor = nullptr;
+		bool bTickActor = false;
+		bool bRunOnAnyThread = true;
+		ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+		TArray<UActorComponent*> Components;
+		TArray<int32> Prerequisites;
+	};
+
+	/** @brief 선행 조건 깊이가 같아 동시에 실행할 수 있는 단위 목록 */
+	struct FTickWave
+	{
+		TArray<int32> ParallelUnits;
+		TArray<int32> GameThreadUnits;
+	};
+
+	bool ShouldTickActor(const AActor* InActor) const;
+	void RebuildTickUnits();
+	void BuildTickWaves();
+	void ExecuteTickUnit(const FTickUnit& InUnit, float InDeltaTime, bool bInIsGameThread) const;
+	void FlushDeferredPrimitiveUpdates();
+
+	ULevel* Level = nullptr;
+	bool bIsEditorWorld = false;
+	uint32 BuiltRegistrationSerial = 0;
+	int32 NumTickFunctions = 0;
+
+	TArray<FTickUnit> TickUnits;
+	TArray<FTickWave> TickWaves[static_cast<int32>(ETickingGroup::End)];
+
+	std::mutex DeferredUpdateLock;
+	TArray<UPrimitiveComponent*> DeferredPrimitiveUpdates;
+
+	// 0은 '한 번도 구성하지 않음'을 의미하므로 1부터 시작
+	static std::atomic<uint32> RegistrationSerial;
+
+	// 병렬 실행 Batch 하나가 가져가는 최소 단위 수
+	static constexpr int32 MinUnitsPerBatch = 32;
+};
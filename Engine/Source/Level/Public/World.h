@@ -2,11 +2,13 @@
 #include <filesystem>
 #include "Core/Public/Object.h"
 #include "Global/Types.h"
+#include "Physics/Public/SweepAndPrune.h"
 
 class UEditor;
 class ULevel;
 class AActor;
 class UClass;
+class UPrimitiveComponent;
 
 namespace json { class JSON; }
 using JSON = json::JSON;
@@ -63,14 +65,23 @@ public:
 	EWorldType GetWorldType() const;
 	void SetWorldType(EWorldType InWorldType);
 
+	// Collision
+	void UpdateCollisions(); // 모든 PrimitiveComponent의 충돌 업데이트
+
 private:
 	EWorldType WorldType;
 	ULevel* Level = nullptr; // Persistance Level. Sublevels are not considered in Engine.
 	bool bBegunPlay = false;
 	TArray<AActor*> PendingDestroyActors;
 
+	// Overlap Broadphase 상태 (정렬 순서와 버퍼를 프레임 간 재사용)
+	FSweepAndPrune CollisionBroadphase;
+	TArray<UPrimitiveComponent*> OverlapPrimitives;
+	TArray<UPrimitiveComponent*> PreviousOverlapPrimitives;
+	TArray<FAABB> OverlapBounds;
+	TArray<FBroadphasePair> OverlapPairs;
+
 	void FlushPendingDestroy(); // Destroy marking 된 액터들을 실제 삭제
-	void UpdateCollisions(); // 모든 PrimitiveComponent의 충돌 업데이트
 
 	void SwitchToLevel(ULevel* InNewLevel);
 	
@@ -81,3 +92,6 @@ protected:
 	virtual void DuplicateSubObjects(UObject* DuplicatedObject) override;
 
 };
+
+// 현재 활성화된 UWorld 포인터
+extern UWorld* GWorld;
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Physics/Public/BoundingVolume.h"
+
+class UPrimitiveComponent;
+
+/**
+ * @brief 레벨에 등록된 프리미티브의 World AABB를 SoA(Min/Max 축별 배열)로 보관하는 캐시
+ * 프리미티브는 등록할 때 받은 핸들(배열 인덱스)로 조회하며, 제거 시 마지막 항목을 빈 자리로 옮겨 배열을 빈틈없이 유지한다
+ * 트랜스폼이나 바운딩 볼륨이 바뀐 프리미티브는 Dirty 표시만 해 두고, UpdateDirtyBounds에서 로컬 박스와 월드 행렬로
+ * 4개씩 SSE Arvo 변환을 수행해 한 번에 다시 계산한다
+ * 갱신 전에 조회된 Dirty 항목은 그 항목만 즉시 다시 계산하므로 조회 결과는 항상 최신이다
+ */
+class FWorldAABBCache
+{
+public:
+	FWorldAABBCache() = default;
+	~FWorldAABBCache();
+
+	FWorldAABBCache(const FWorldAABBCache&) = delete;
+	FWorldAABBCache& operator=(const FWorldAABBCache&) = delete;
+
+	/** @brief 이미 이 캐시에 있으면 무시하고, 다른 캐시에 있으면 그 캐시에서 제거한 뒤 등록 */
+	void Add(UPrimitiveComponent* InPrimitive);
+	void Remove(UPrimitiveComponent* InPrimitive);
+
+	/** @brief 서로 다른 핸들은 병렬 Tick 중에 동시에 표시해도 된다 */
+	void MarkDirty(int32 InHandle) { DirtyFlags[InHandle] = 1; }
+
+	/** @brief Dirty 항목을 모아 한 번에 다시 계산 (Game Thread) */
+	void UpdateDirtyBounds();
+
+	void GetBounds(int32 InHandle, FVector& OutMin, FVector& OutMax);
+	EBoundingVolumeType GetVolumeType(int32 InHandle);
+
+	int32 Num() const { return static_cast<int32>(Primitives.size()); }
+	UPrimitiveComponent* GetPrimitive(int32 InHandle) const { return Primitives[InHandle]; }
+
+	/**
+	 * @brief 로컬 박스(중심, 반 크기)를 행렬로 변환한 World AABB (Arvo)
+	 * 중심은 그대로 변환하고, 반 크기는 행렬 원소의 절댓값으로 변환한다
+	 */
+	static void TransformBounds(const FVector& InLocalCenter, const FVector& InLocalExtent, const FMatrix& InWorld, FVector& OutMin, FVector& OutMax);
+
+private:
+	void RefreshEntry(int32 InHandle);
+
+	TArray<UPrimitiveComponent*> Primitives;
+	TArray<float> MinX, MinY, MinZ;
+	TArray<float> MaxX, MaxY, MaxZ;
+	TArray<EBoundingVolumeType> VolumeTypes;
+	// 1이면 다시 계산해야 함 (uint8이라 16개씩 SSE로 훑는다)
+	TArray<uint8> DirtyFlags;
+
+	/** @brief Dirty 항목 4개의 입력을 레인별로 모은 것 ([행][열][레인]) */
+	struct alignas(16) FArvoBlock
+	{
+		float LocalCenter[3][4];
+		float LocalExtent[3][4];
+		float World[4][3][4];
+	};
+
+	// UpdateDirtyBounds에서 재사용하는 작업 버퍼
+	TArray<int32> DirtyHandles;
+	TArray<FArvoBlock> ArvoBlocks;
+};
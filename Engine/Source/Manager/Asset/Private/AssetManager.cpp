@@ -1,12 +1,15 @@
 #include "pch.h"
 #include "Manager/Asset/Public/AssetManager.h"
-#include "Render/Renderer/Public/Renderer.h"
 #include "Component/Mesh/Public/VertexDatas.h"
 #include "Physics/Public/AABB.h"
 #include "Texture/Public/Texture.h"
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Path/Public/PathManager.h"
+
+#ifndef IS_HEADLESS
+#include "Render/Renderer/Public/Renderer.h"
 #include "Render/Renderer/Public/RenderResourceFactory.h"
+#endif
 
 IMPLEMENT_SINGLETON_CLASS(UAssetManager, UObject)
 UAssetManager::UAssetManager()
@@ -18,7 +21,13 @@ UAssetManager::~UAssetManager() = default;
 
 void UAssetManager::Initialize()
 {
-	TextureManager->LoadAllTexturesFromDirectory(UPathManager::GetInstance().GetDataPath());
+	// Device가 없는 Headless 실행에서는 텍스처 선로딩을 생략
+#ifndef IS_HEADLESS
+	if (URenderer::GetInstance().GetDevice())
+	{
+		TextureManager->LoadAllTexturesFromDirectory(UPathManager::GetInstance().GetDataPath());
+	}
+#endif
 	// Data 폴더 속 모든 .obj 파일 로드 및 캐싱
 	LoadAllObjStaticMesh();
 
@@ -30,12 +39,15 @@ void UAssetManager::Initialize()
 	VertexDatas.emplace(EPrimitiveType::Sprite, &VerticesVerticalSquare);
 
 	IndexDatas.emplace(EPrimitiveType::Sprite, &IndicesVerticalSquare);
+#ifndef IS_HEADLESS
 	IndexBuffers.emplace(EPrimitiveType::Sprite,
 		FRenderResourceFactory::CreateIndexBuffer(IndicesVerticalSquare.data(), static_cast<int>(IndicesVerticalSquare.size()) * sizeof(uint32)));
+#endif
 
 	NumIndices.emplace(EPrimitiveType::Sprite, static_cast<uint32>(IndicesVerticalSquare.size()));
 	
 	// TArray.GetData(), TArray.Num()*sizeof(FVertexSimple), TArray.GetTypeSize()
+#ifndef IS_HEADLESS
 	VertexBuffers.emplace(EPrimitiveType::Torus, FRenderResourceFactory::CreateVertexBuffer(
 		VerticesTorus.data(), static_cast<int>(VerticesTorus.size() * sizeof(FNormalVertex))));
 	VertexBuffers.emplace(EPrimitiveType::Arrow, FRenderResourceFactory::CreateVertexBuffer(
@@ -48,6 +60,7 @@ void UAssetManager::Initialize()
 		VerticesLine.data(), static_cast<int>(VerticesLine.size() * sizeof(FNormalVertex))));
 	VertexBuffers.emplace(EPrimitiveType::Sprite, FRenderResourceFactory::CreateVertexBuffer(
 		VerticesVerticalSquare.data(), static_cast<int>(VerticesVerticalSquare.size() * sizeof(FNormalVertex))));
+#endif
 
 	NumVertices.emplace(EPrimitiveType::Torus, static_cast<uint32>(VerticesTorus.size()));
 	NumVertices.emplace(EPrimitiveType::Arrow, static_cast<uint32>(VerticesArrow.size()));
@@ -86,6 +99,7 @@ void UAssetManager::Initialize()
 void UAssetManager::Release()
 {
 	// TMap.Value()
+#ifndef IS_HEADLESS
 	for (auto& Pair : VertexBuffers)
 	{
 		SafeRelease(Pair.second);
@@ -103,6 +117,7 @@ void UAssetManager::Release()
 	{
 		SafeRelease(Pair.second);
 	}
+#endif
 
 	StaticMeshCache.clear();	// unique ptr 이라서 자동으로 해제됨
 	StaticMeshVertexBuffers.clear();
@@ -155,10 +170,10 @@ void UAssetManager::LoadAllObjStaticMesh()
 		UStaticMesh* LoadedMesh = FObjManager::LoadObjStaticMesh(ObjPath, Config);
 
 		// 로드에 성공했는지 확인합니다.
+		// StaticMeshCache 등록(소유권 이전)은 FObjManager::LoadObjStaticMesh에서 이미 처리됨
+		// 여기서 다시 emplace하면 키가 중복일 때 libstdc++는 새 노드의 unique_ptr을 파괴하며 메시를 해제함
 		if (LoadedMesh)
 		{
-			StaticMeshCache.emplace(ObjPath, LoadedMesh);
-
 			StaticMeshVertexBuffers.emplace(ObjPath, this->CreateVertexBuffer(LoadedMesh->GetVertices()));
 			StaticMeshIndexBuffers.emplace(ObjPath, this->CreateIndexBuffer(LoadedMesh->GetIndices()));
 		}
@@ -185,12 +200,20 @@ ID3D11Buffer* UAssetManager::GetIndexBuffer(FName InObjPath)
 
 ID3D11Buffer* UAssetManager::CreateVertexBuffer(TArray<FNormalVertex> InVertices)
 {
+#ifdef IS_HEADLESS
+	return nullptr;
+#else
 	return FRenderResourceFactory::CreateVertexBuffer(InVertices.data(), static_cast<int>(InVertices.size()) * sizeof(FNormalVertex));
+#endif
 }
 
 ID3D11Buffer* UAssetManager::CreateIndexBuffer(TArray<uint32> InIndices)
 {
+#ifdef IS_HEADLESS
+	return nullptr;
+#else
 	return FRenderResourceFactory::CreateIndexBuffer(InIndices.data(), static_cast<int>(InIndices.size()) * sizeof(uint32));
+#endif
 }
 
 TArray<FNormalVertex>* UAssetManager::GetVertexData(EPrimitiveType InType)
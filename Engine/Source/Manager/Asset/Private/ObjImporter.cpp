@@ -30,8 +30,19 @@ bool FObjImporter::LoadObj(const std::filesystem::path& FilePath, FObjInfo* OutO
 			UE_LOG("바이너리 파일이 존재합니다: %s", BinFilePath.string().c_str());
 			FWindowsBinReader WindowsBinReader(BinFilePath);
 			WindowsBinReader << *OutObjInfo;
-
-			return true;
+			if (!WindowsBinReader.IsValid())
+			{
+				UE_LOG_ERROR("바이너리 파일이 손상되었습니다. 원본을 다시 읽습니다: %s", BinFilePath.string().c_str());
+			}
+			else if (!IsMaterialLibraryUpToDate(OutObjInfo->MaterialLibraryList))
+			{
+				UE_LOG("머티리얼 파일이 바뀌었습니다. 원본을 다시 읽습니다: %s", BinFilePath.string().c_str());
+			}
+			else
+			{
+				return true;
+			}
+			*OutObjInfo = FObjInfo();
 		}
 		else
 		{
@@ -320,6 +331,11 @@ bool FObjImporter::LoadMaterial(const std::filesystem::path& FilePath, FObjInfo*
 		return false;
 	}
 
+	// 바이너리 캐시가 .mtl만 수정된 경우도 감지하도록 읽기 시작한 시점의 수정 시각을 기록
+	FObjMaterialLibrary MaterialLibrary{ FilePath.string() };
+	GetLastWriteTime(FilePath, MaterialLibrary.LastWriteTime);
+	OutObjInfo->MaterialLibraryList.push_back(std::move(MaterialLibrary));
+
 	TOptional<FObjectMaterialInfo> OptMaterialInfo;
 
 	FString Buffer;
@@ -734,3 +750,29 @@ bool FObjImporter::ParseFaceBuffer(const FString& FaceBuffer, FObjectInfo* OutOb
 
 	return true;
 }
+
+bool FObjImporter::IsMaterialLibraryUpToDate(const TArray<FObjMaterialLibrary>& MaterialLibraryList)
+{
+	for (const FObjMaterialLibrary& MaterialLibrary : MaterialLibraryList)
+	{
+		int64 LastWriteTime = 0;
+		if (!GetLastWriteTime(MaterialLibrary.FilePath, LastWriteTime) || LastWriteTime != MaterialLibrary.LastWriteTime)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FObjImporter::GetLastWriteTime(const std::filesystem::path& FilePath, int64& OutLastWriteTime)
+{
+	// file_time_type의 기준 시점은 구현마다 달라 유효한 값도 음수일 수 있으므로 오류는 반환값으로 구분
+	std::error_code ErrorCode;
+	const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(FilePath, ErrorCode);
+	if (ErrorCode)
+	{
+		return false;
+	}
+	OutLastWriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+	return true;
+}
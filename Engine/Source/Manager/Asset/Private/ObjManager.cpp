@@ -1,11 +1,14 @@
 #include "pch.h"
 
 #include "Core/Public/ObjectIterator.h"
+#include "Core/Public/NewObject.h"
 #include "Manager/Asset/Public/ObjManager.h"
 #include "Manager/Asset/Public/ObjImporter.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Texture/Public/Material.h"
 #include "Texture/Public/Texture.h"
+#include "Core/Public/WindowsBinReader.h"
+#include "Core/Public/WindowsBinWriter.h"
 #include <filesystem>
 
 // N과 직교하는 안전한 탄젠트 생성 (폴백용)
@@ -124,6 +127,197 @@ struct VertexKeyHash
 	}
 };
 
+/**
+ * @brief Cooked FStaticMesh 캐시 (.meshbin)
+ * 정점, 인덱스, 섹션, 재질 정보와 평탄화된 BVH를 한 파일에 저장해 두 번째 실행부터는 OBJ 파싱, 정점 병합, 탄젠트 계산, BVH 구축을 모두 건너뛴다
+ * 헤더 뒤에는 OBJ가 참조한 .mtl 경로와 수정 시각을 기록해, .mtl만 수정해도 캐시를 다시 만든다
+ */
+namespace
+{
+	// 'FSMC'
+	constexpr uint32 StaticMeshCacheMagic = 0x434D5346;
+	// FStaticMesh 또는 FBVH의 직렬화 내용이 바뀌면 올려서 기존 캐시를 무효화
+	constexpr uint32 StaticMeshCacheVersion = 2;
+
+	struct FStaticMeshCacheHeader
+	{
+		uint32 Magic = StaticMeshCacheMagic;
+		uint32 Version = StaticMeshCacheVersion;
+		// 구조체 배치가 다른 빌드에서 만든 캐시를 그대로 읽지 않도록 원소 크기도 함께 기록
+		uint32 VertexStride = sizeof(FNormalVertex);
+		uint32 NodeStride = sizeof(FBVHNode);
+		uint32 TriangleStride = sizeof(FBVHTriangle);
+		// 같은 OBJ라도 Import 설정에 따라 Cooked 결과가 달라지므로 설정도 함께 비교
+		uint32 ImportFlags = 0;
+	};
+
+	uint32 GetImportFlags(const FObjImporter::Configuration& InConfig)
+	{
+		return (InConfig.bFlipWindingOrder ? 1u : 0u)
+			| (InConfig.bPositionToUEBasis ? 2u : 0u)
+			| (InConfig.bNormalToUEBasis ? 4u : 0u)
+			| (InConfig.bUVToUEBasis ? 8u : 0u);
+	}
+
+	bool IsSameCacheHeader(const FStaticMeshCacheHeader& InA, const FStaticMeshCacheHeader& InB)
+	{
+		return InA.Magic == InB.Magic
+			&& InA.Version == InB.Version
+			&& InA.VertexStride == InB.VertexStride
+			&& InA.NodeStride == InB.NodeStride
+			&& InA.TriangleStride == InB.TriangleStride
+			&& InA.ImportFlags == InB.ImportFlags;
+	}
+
+	std::filesystem::path GetStaticMeshCachePath(const FName& InPathFileName)
+	{
+		std::filesystem::path CacheFilePath = InPathFileName.ToString();
+		CacheFilePath.replace_extension(".meshbin");
+		return CacheFilePath;
+	}
+
+	/**
+	 * @brief 캐시에 저장하는 순서대로 FStaticMesh를 직렬화
+	 * 로드 중에는 단계마다 Archive 오류를 확인해 손상된 길이나 잘린 파일을 만나면 바로 중단한다
+	 * @return 모든 단계가 오류 없이 끝났으면 true
+	 */
+	bool SerializeStaticMesh(FArchive& Ar, FStaticMesh& StaticMesh)
+	{
+		Ar.SerializeBulk(StaticMesh.Vertices);
+		if (Ar.IsError())
+		{
+			return false;
+		}
+		Ar.SerializeBulk(StaticMesh.Indices);
+		if (Ar.IsError())
+		{
+			return false;
+		}
+		Ar.SerializeBulk(StaticMesh.Sections);
+		if (Ar.IsError())
+		{
+			return false;
+		}
+		Ar << StaticMesh.MaterialInfo;
+		if (Ar.IsError())
+		{
+			return false;
+		}
+		Ar << StaticMesh.BVH;
+		return !Ar.IsError();
+	}
+
+	/**
+	 * @brief 캐시에서 읽은 메시가 렌더링과 피킹에 그대로 써도 되는 값인지 확인
+	 * 인덱스, 섹션 구간, 재질 슬롯이 모두 배열 범위 안에 있고 BVH가 메시 삼각형과 일치해야 한다
+	 */
+	bool IsValidCachedStaticMesh(const FStaticMesh& InStaticMesh)
+	{
+		const size_t NumVertices = InStaticMesh.Vertices.size();
+		const size_t NumIndices = InStaticMesh.Indices.size();
+		if (NumIndices % 3 != 0)
+		{
+			return false;
+		}
+
+		for (const uint32 Index : InStaticMesh.Indices)
+		{
+			if (Index >= NumVertices)
+			{
+				return false;
+			}
+		}
+
+		for (const FMeshSection& Section : InStaticMesh.Sections)
+		{
+			if (static_cast<uint64>(Section.StartIndex) + Section.IndexCount > NumIndices)
+			{
+				return false;
+			}
+			// 재질을 찾지 못한 섹션은 INVALID_INDEX 슬롯으로 저장된다
+			if (Section.MaterialSlot != static_cast<uint32>(FObjManager::INVALID_INDEX) && Section.MaterialSlot >= InStaticMesh.MaterialInfo.size())
+			{
+				return false;
+			}
+		}
+
+		// BVH는 메시의 모든 삼각형을 하나씩 담으므로 삼각형 수도 같아야 한다
+		if (static_cast<size_t>(InStaticMesh.BVH.GetTriangleCount()) != NumIndices / 3)
+		{
+			return false;
+		}
+		return InStaticMesh.BVH.CheckValidity();
+	}
+
+	/**
+	 * @brief 원본보다 최신이고 버전, Import 설정, .mtl 수정 시각이 일치하는 캐시가 있으면 Cooked 데이터를 그대로 읽음
+	 * @return 캐시를 사용했으면 true, 없거나 무효하면 false (이때 OutStaticMesh는 사용하지 않아야 함)
+	 */
+	bool LoadStaticMeshCache(const FName& InPathFileName, const FObjImporter::Configuration& InConfig, FStaticMesh& OutStaticMesh)
+	{
+		const std::filesystem::path ObjFilePath = InPathFileName.ToString();
+		const std::filesystem::path CacheFilePath = GetStaticMeshCachePath(InPathFileName);
+
+		std::error_code ErrorCode;
+		if (!std::filesystem::exists(CacheFilePath, ErrorCode) || !std::filesystem::exists(ObjFilePath, ErrorCode))
+		{
+			return false;
+		}
+
+		if (std::filesystem::last_write_time(CacheFilePath, ErrorCode) < std::filesystem::last_write_time(ObjFilePath, ErrorCode))
+		{
+			UE_LOG("메시 캐시가 원본보다 오래되었습니다. 다시 생성합니다: %s", CacheFilePath.string().c_str());
+			return false;
+		}
+
+		FWindowsBinReader Reader(CacheFilePath);
+		FStaticMeshCacheHeader ExpectedHeader;
+		ExpectedHeader.ImportFlags = GetImportFlags(InConfig);
+
+		FStaticMeshCacheHeader Header;
+		Header.Magic = 0;
+		Reader << Header;
+		if (!Reader.IsValid() || !IsSameCacheHeader(Header, ExpectedHeader))
+		{
+			UE_LOG("메시 캐시의 버전 또는 Import 설정이 다릅니다. 다시 생성합니다: %s", CacheFilePath.string().c_str());
+			return false;
+		}
+
+		TArray<FObjMaterialLibrary> MaterialLibraryList;
+		Reader << MaterialLibraryList;
+		if (!Reader.IsValid())
+		{
+			UE_LOG_ERROR("메시 캐시가 손상되었습니다. 다시 생성합니다: %s", CacheFilePath.string().c_str());
+			return false;
+		}
+		if (!FObjImporter::IsMaterialLibraryUpToDate(MaterialLibraryList))
+		{
+			UE_LOG("메시 캐시의 머티리얼 파일이 바뀌었습니다. 다시 생성합니다: %s", CacheFilePath.string().c_str());
+			return false;
+		}
+
+		if (!SerializeStaticMesh(Reader, OutStaticMesh) || Reader.GetRemainingBytes() != 0 || !IsValidCachedStaticMesh(OutStaticMesh))
+		{
+			UE_LOG_ERROR("메시 캐시가 손상되었습니다. 다시 생성합니다: %s", CacheFilePath.string().c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	void SaveStaticMeshCache(const FName& InPathFileName, const FObjImporter::Configuration& InConfig,
+		TArray<FObjMaterialLibrary>& InMaterialLibraryList, FStaticMesh& InStaticMesh)
+	{
+		FStaticMeshCacheHeader Header;
+		Header.ImportFlags = GetImportFlags(InConfig);
+
+		FWindowsBinWriter Writer(GetStaticMeshCachePath(InPathFileName));
+		Writer << Header;
+		Writer << InMaterialLibraryList;
+		SerializeStaticMesh(Writer, InStaticMesh);
+	}
+}
+
 /** @todo: std::filesystem으로 변경 */
 FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, const FObjImporter::Configuration& Config)
 {
@@ -133,6 +327,19 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		return Iter->second.get();
 	}
 
+	/** #0. 바이너리 캐시가 켜져 있으면 BVH까지 포함된 Cooked 캐시를 먼저 시도 */
+	if (Config.bIsBinaryEnabled)
+	{
+		auto CachedStaticMesh = std::make_unique<FStaticMesh>();
+		if (LoadStaticMeshCache(PathFileName, Config, *CachedStaticMesh))
+		{
+			CachedStaticMesh->PathFileName = PathFileName;
+			FStaticMesh* Result = CachedStaticMesh.get();
+			ObjFStaticMeshMap.emplace(PathFileName, std::move(CachedStaticMesh));
+			return Result;
+		}
+	}
+
 	/** #1. '.obj' 파일로부터 오브젝트 정보를 로드 */
 	FObjInfo ObjInfo;
 	if (!FObjImporter::LoadObj(PathFileName.ToString(), &ObjInfo, Config))
@@ -288,7 +495,13 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FName& PathFileName, cons
 		}
 	}
 
-	//StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
+	StaticMesh->BVH.Build(StaticMesh.get()); // 빠른 피킹용 BVH 구축
+
+	/** #5. 다음 실행부터 재구축 없이 쓰도록 Cooked 데이터와 BVH를 캐시에 저장 */
+	if (Config.bIsBinaryEnabled)
+	{
+		SaveStaticMeshCache(PathFileName, Config, ObjInfo.MaterialLibraryList, *StaticMesh);
+	}
 	ObjFStaticMeshMap.emplace(PathFileName, std::move(StaticMesh));
 
 	return ObjFStaticMeshMap[PathFileName].get();
@@ -1,12 +1,16 @@
 ﻿#include "pch.h"
 #include "Manager/Asset/Public/TextureManager.h"
-#include "Render/Renderer/Public/RenderResourceFactory.h"
 #include "Texture/Public/Texture.h"
-#include <DirectXTK/DDSTextureLoader.h>
-#include <DirectXTK/WICTextureLoader.h>
+#include "Core/Public/NewObject.h"
 
 #include "Manager/Path/Public/PathManager.h"
 
+#ifndef IS_HEADLESS
+#include "Render/Renderer/Public/RenderResourceFactory.h"
+#include <DirectXTK/DDSTextureLoader.h>
+#include <DirectXTK/WICTextureLoader.h>
+#endif
+
 FTextureManager::FTextureManager() = default;
 
 FTextureManager::~FTextureManager()
@@ -15,10 +19,12 @@ FTextureManager::~FTextureManager()
     {
         SafeDelete(TextureCache.second);
     }
+#ifndef IS_HEADLESS
     if (DefaultSampler)
     {
         SafeRelease(DefaultSampler);
     }
+#endif
 }
 
 UTexture* FTextureManager::LoadTexture(const FName& InFilePath)
@@ -53,11 +59,13 @@ UTexture* FTextureManager::LoadTexture(const FName& InFilePath)
     // Not Cached
     ComPtr<ID3D11ShaderResourceView> SRV = CreateTextureFromFile(AbsolutePath.string());
 
+#ifndef IS_HEADLESS
     if (!DefaultSampler)
     {
         DefaultSampler = FRenderResourceFactory::CreateSamplerState(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_CLAMP);
         UE_LOG("[TextureManager] Default Sampler Create");
     }
+#endif
     
     UTexture* Texture = NewObject<UTexture>();
     Texture->SetFilePath(CacheKey);
@@ -98,10 +106,7 @@ void FTextureManager::LoadAllTexturesFromDirectory(const path& InDirectoryPath)
         if (SupportedExtensions.count(Extension))
         {
             FName TextureName(FilePath.string());
-            UTexture* Texture = LoadTexture(TextureName);
-            Texture->GetTextureSRV()->AddRef();
-            int temp = Texture->GetTextureSRV()->Release();
-            int y =1;
+            LoadTexture(TextureName);
         }
     }
 
@@ -115,6 +120,9 @@ const TMap<FName, UTexture*>& FTextureManager::GetTextureCache() const
 
 ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const path& InFilePath)
 {
+#ifdef IS_HEADLESS
+    return nullptr;
+#else
     URenderer& Renderer = URenderer::GetInstance();
     ID3D11Device* Device = Renderer.GetDevice();
     ID3D11DeviceContext* DeviceContext = Renderer.GetDeviceContext();
@@ -170,4 +178,5 @@ ComPtr<ID3D11ShaderResourceView> FTextureManager::CreateTextureFromFile(const pa
         return nullptr;
     }
     return SUCCEEDED(ResultHandle) ? TextureSRV : nullptr;
+#endif
 }
@@ -15,6 +15,23 @@
 struct FObjectInfo;
 struct FObjectMaterialInfo;
 
+/**
+ * @brief A .mtl file referenced by a .obj file, with its last write time at parse time.
+ * Binary caches store these so that editing only the .mtl file still invalidates them.
+ */
+struct FObjMaterialLibrary
+{
+	FString FilePath;
+	int64 LastWriteTime = 0;
+};
+
+inline FArchive& operator<<(FArchive& Ar, FObjMaterialLibrary& MaterialLibrary)
+{
+	Ar << MaterialLibrary.FilePath;
+	Ar << MaterialLibrary.LastWriteTime;
+	return Ar;
+}
+
 /** @brief Holds all the data parsed from a single .obj file, including all objects, materials, and global vertex data. */
 struct FObjInfo
 {
@@ -24,6 +41,9 @@ struct FObjInfo
 	TArray<FVector> VertexList;
 	TArray<FVector> NormalList;
 	TArray<FVector2> TexCoordList;
+
+	/** .mtl files loaded through 'mtllib' */
+	TArray<FObjMaterialLibrary> MaterialLibraryList;
 };
 
 inline FArchive& operator<<(FArchive& Ar, FObjInfo& ObjInfo)
@@ -35,6 +55,8 @@ inline FArchive& operator<<(FArchive& Ar, FObjInfo& ObjInfo)
 	Ar << ObjInfo.NormalList;
 	Ar << ObjInfo.TexCoordList;
 
+	Ar << ObjInfo.MaterialLibraryList;
+
 	return Ar;
 }
 
@@ -146,20 +168,23 @@ inline FArchive& operator<<(FArchive& Ar, FObjectMaterialInfo& ObjectMaterialInf
 	return Ar;
 }
 
+/** @todo: Implement configuration to manage behaviors of LoadObj */
+/** @note 멤버 기본값을 쓰는 기본 인자(= {})가 GCC에서도 컴파일되도록 FObjImporter 밖에 정의 */
+struct FObjImporterConfiguration
+{
+	FString DefaultName = "DefaultObject";
+	bool bIsObjectEnabled = false;
+	bool bIsBinaryEnabled = false;
+	bool bFlipWindingOrder = false;
+	bool bPositionToUEBasis = true;
+	bool bNormalToUEBasis = true;
+	bool bUVToUEBasis = true;
+	// ...
+};
+
 struct FObjImporter
 {
-	/** @todo: Implement configuration to manage behaviors of LoadObj */
-	struct Configuration
-	{
-		FString DefaultName = "DefaultObject";
-		bool bIsObjectEnabled = false;
-		bool bIsBinaryEnabled = false;
-		bool bFlipWindingOrder = false;
-		bool bPositionToUEBasis = true;
-		bool bNormalToUEBasis = true;
-		bool bUVToUEBasis = true;
-		// ...
-	};
+	using Configuration = FObjImporterConfiguration;
 
 	/**
 	 * @brief Loads and parses a .obj file from the given path.
@@ -178,7 +203,19 @@ struct FObjImporter
 	 */
 	static bool LoadMaterial(const std::filesystem::path& FilePath, FObjInfo* OutObjInfo);
 
+	/**
+	 * @brief Checks whether every recorded .mtl file still exists with the same last write time.
+	 * @return False if any material library was modified or removed since it was parsed.
+	 */
+	static bool IsMaterialLibraryUpToDate(const TArray<FObjMaterialLibrary>& MaterialLibraryList);
+
 private:
+	/**
+	 * @brief Reads the file's last write time as a raw tick count of std::filesystem::file_time_type.
+	 * @return False if the time cannot be read. The tick count itself may be negative.
+	 */
+	static bool GetLastWriteTime(const std::filesystem::path& FilePath, int64& OutLastWriteTime);
+
 	/**
 	 * @brief Parses a single face component string (e.g., "v/vt/vn").
 	 * @param FaceBuffer The string chunk representing one vertex of a face.
@@ -27,8 +27,13 @@ void UPathManager::Init()
 void UPathManager::InitializeRootPath()
 {
 	// Get Execution File Path
+#if PLATFORM_WINDOWS
 	wchar_t ProgramPath[MAX_PATH];
 	GetModuleFileNameW(nullptr, ProgramPath, MAX_PATH);
+#else
+	std::error_code ErrorCode;
+	const path ProgramPath = filesystem::read_symlink("/proc/self/exe", ErrorCode);
+#endif
 
 	// Add Root Path
 	RootPath = path(ProgramPath).parent_path();
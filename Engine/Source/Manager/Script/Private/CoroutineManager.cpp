@@ -104,6 +104,8 @@ void UCoroutineManager::StopCoroutine(UScriptComponent* Comp, const FString& Fun
 
 void UCoroutineManager::Update(const float DeltaTime)
 {
+    ALLOC_SCOPE(Lua)
+
     //등록 대기중인 코루틴 등록
     for (auto& pendingData : PendingCoroutines)
     {
@@ -484,6 +484,11 @@ void UScriptManager::RegisterGlobalFunctions()
 		return UTimeManager::GetInstance().GetGameTime();
 		};
 
+	// UUID로 Actor 찾기 (obj.UUID로 저장해 둔 다른 Actor를 다시 얻을 때 사용, 없으면 nil)
+	lua["FindActorByUUID"] = [](uint32 InUUID) -> AActor* {
+		return FindObjectByUUID<AActor>(InUUID);
+		};
+
 	UE_LOG_INFO("Lua global functions registered");
 }
 
@@ -5,6 +5,13 @@
 #include "Level/Public/Level.h"
 #include "Global/Octree.h"
 
+FWorldAABBData::FWorldAABBData(UPrimitiveComponent* InPrim)
+    : Prim(InPrim)
+{
+    Prim->GetWorldAABB(Min, Max);
+    Center = (Min + Max) * 0.5f;
+}
+
 COcclusionCuller::COcclusionCuller()
 { 
     CPU_ZBuffer.resize(Z_BUFFER_SIZE);
@@ -16,57 +23,47 @@ void COcclusionCuller::InitializeCuller(const FMatrix& ViewMatrix, const FMatrix
     CurrentViewProj = ViewMatrix * ProjectionMatrix;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::PerformCulling(const TArray<UPrimitiveComponent*>& AllPrimitives, const FVector& CameraPos)
 {    
     Frame++;
-    // 0. Primitive AABB 데이터 채우기
-    CachedAABBs.clear();
-    for (int32 i = 0; i < AllPrimitives.size(); ++i)
+    // 0. 이번 프레임 컬링 대상 표시 (World AABB는 복사하지 않고 레벨 캐시에서 필요할 때 읽음)
+    for (UPrimitiveComponent* PrimitiveComp : AllPrimitives)
     {
-        UPrimitiveComponent* PrimitiveComp = AllPrimitives[i];
         if (!PrimitiveComp) continue;
-
-        FWorldAABBData Data;
-        Data.Prim = PrimitiveComp;
-        PrimitiveComp->GetWorldAABB(Data.Min, Data.Max);
-        Data.Center = (Data.Min + Data.Max) * 0.5f;
-        CachedAABBs.push_back(Data);
-
-        // 인덱스를 컴포넌트에 직접 캐시
-        PrimitiveComp->CachedAABBIndex = i;
         PrimitiveComp->CachedFrame = Frame;
     }
 
 
     // 1. 오클루더 동적 선택
     ULevel* CurrentLevel = GWorld->GetLevel();
-    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->GetStaticOctree()->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.size()) / 10);
-    TArray<UPrimitiveComponent*> SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
+    TArray<UPrimitiveComponent*> OccluderCandidates = CurrentLevel->FindNearestPrimitives(CameraPos, static_cast<uint32>(AllPrimitives.size()) / 10);
+    const TArray<UPrimitiveComponent*>& SelectedOccluders = SelectOccluders(OccluderCandidates, CameraPos);
 
     // 2. CPU Z-Buffer 구성
     RasterizeOccluders(SelectedOccluders, CameraPos);
 
     // 3. 가시성 테스트
     VisibleMeshComponents.clear();
-    for (auto& AABBData : CachedAABBs)
+    for (UPrimitiveComponent* PrimitiveComp : AllPrimitives)
     {
-        if (IsMeshVisible(AABBData))
+        if (!PrimitiveComp) continue;
+        if (IsMeshVisible(FWorldAABBData(PrimitiveComp)))
         {
-            VisibleMeshComponents.push_back(AABBData.Prim);
+            VisibleMeshComponents.push_back(PrimitiveComp);
         }
     }
 
     return VisibleMeshComponents;
 }
 
-TArray<UPrimitiveComponent*> COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
+const TArray<UPrimitiveComponent*>& COcclusionCuller::SelectOccluders(const TArray<UPrimitiveComponent*>& Candidates, const FVector& CameraPos)
 {
     FilteredOccluders.clear();
 
     for (UPrimitiveComponent* Occluder : Candidates)
     {
         if (Occluder->CachedFrame != Frame) { continue; }
-        FWorldAABBData& Data = CachedAABBs[Occluder->CachedAABBIndex];
+        const FWorldAABBData Data(Occluder);
 
         float AABB_Diagonal_LengthSq = FVector::DistSquared(Data.Min, Data.Max);
         float DistanceToOccluderSq = FVector::DistSquared(CameraPos, Data.Center);
@@ -84,20 +81,17 @@ void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& Se
     {
         if (OccluderComp->CachedFrame != Frame) { continue; }
         // 1. AABB를 12개 삼각형의 월드 정점 리스트로 변환
-        TArray<FVector> BoxTriangles = ConvertAABBToTriangles(OccluderComp);
+        const TArray<FVector>& BoxTriangles = ConvertAABBToTriangles(OccluderComp);
 
-        // 2. CPU 래스터라이징
-        for (uint32 Idx = 0; Idx < BoxTriangles.size(); Idx += 3)
-        {
-            // 삼각형의 세 정점 (월드 좌표)
-            const FVector& P1_World = BoxTriangles[Idx];
-            const FVector& P2_World = BoxTriangles[Idx + 1];
-            const FVector& P3_World = BoxTriangles[Idx + 2];
+        // 2. 모든 정점을 한 번에 화면 좌표로 투영
+        ProjectToScreen(BoxTriangles, ScreenTriangles);
 
-            // 정점을 화면 좌표로 투영
-            FVector P1_Screen = Project(P1_World);
-            FVector P2_Screen = Project(P2_World);
-            FVector P3_Screen = Project(P3_World);
+        // 3. CPU 래스터라이징
+        for (uint32 Idx = 0; Idx < ScreenTriangles.size(); Idx += 3)
+        {
+            const FVector& P1_Screen = ScreenTriangles[Idx];
+            const FVector& P2_Screen = ScreenTriangles[Idx + 1];
+            const FVector& P3_Screen = ScreenTriangles[Idx + 2];
 
             // Backface Culling
             FVector2 V1(P2_Screen.X - P1_Screen.X, P2_Screen.Y - P1_Screen.Y);
@@ -113,24 +107,24 @@ void COcclusionCuller::RasterizeOccluders(const TArray<UPrimitiveComponent*>& Se
     }
 }
 
-FVector COcclusionCuller::Project(const FVector& WorldPos) const
+void COcclusionCuller::ProjectToScreen(const TArray<FVector>& WorldPositions, TArray<FVector>& OutScreenPositions)
 {
-    FVector4 WorldPos4(WorldPos.X, WorldPos.Y, WorldPos.Z, 1.0f);
-    FVector4 ClipPos = WorldPos4 * CurrentViewProj;
+    const int32 NumPositions = static_cast<int32>(WorldPositions.size());
+    ClipPositions.resize(NumPositions);
+    OutScreenPositions.resize(NumPositions);
 
-    if (ClipPos.W != 0.0f)
-    {
-        ClipPos.X /= ClipPos.W;
-        ClipPos.Y /= ClipPos.W;
-        ClipPos.Z /= ClipPos.W;
-    }
+    // W가 0이 아니면 X/Y/Z는 이미 W로 나눈 NDC 값
+    CurrentViewProj.ProjectPoints(WorldPositions.data(), ClipPositions.data(), NumPositions);
 
     // NDC to Screen
-    float ScreenX = (ClipPos.X + 1.0f) * 0.5f * Z_BUFFER_WIDTH;
-    float ScreenY = (1.0f - ClipPos.Y) * 0.5f * Z_BUFFER_HEIGHT;
-    float ScreenZ = ClipPos.Z;
-
-    return FVector(ScreenX, ScreenY, ScreenZ);
+    for (int32 Index = 0; Index < NumPositions; ++Index)
+    {
+        const FVector4& NDCPos = ClipPositions[Index];
+        OutScreenPositions[Index] = FVector(
+            (NDCPos.X + 1.0f) * 0.5f * Z_BUFFER_WIDTH,
+            (1.0f - NDCPos.Y) * 0.5f * Z_BUFFER_HEIGHT,
+            NDCPos.Z);
+    }
 }
 
 bool COcclusionCuller::IsMeshVisible(const FWorldAABBData& AABBData)
@@ -362,13 +356,13 @@ void COcclusionCuller::RasterizeTriangle(const FVector& P1, const FVector& P2, c
     }
 }
 
-TArray<FVector> COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
+const TArray<FVector>& COcclusionCuller::ConvertAABBToTriangles(UPrimitiveComponent* Prim)
 {
     Triangles.clear();
 
     if (!Prim) { return Triangles; }
 
-    FWorldAABBData& Data = CachedAABBs[Prim->CachedAABBIndex];
+    const FWorldAABBData Data(Prim);
     const FVector& WorldCenter = Data.Center;
     FVector Extent = (Data.Min - Data.Max) * 0.5f;
 
@@ -22,7 +22,7 @@ public:
      * @param CameraPos 현재 카메라 위치
      * @return 렌더링되어야 할 UPrimitiveComponent 목록
      */
-    TArray<UPrimitiveComponent*> PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
+    const TArray<UPrimitiveComponent*>& PerformCulling(const TArray<UPrimitiveComponent*>& AllStaticMeshes, const FVector& CameraPos);
 
     // Constants
     static constexpr int Z_BUFFER_WIDTH = 256;
@@ -35,15 +35,15 @@ private:
     * @param AllCandidates 가까운 곳의 Occluders 후보
     * @return 오클루더로 선정된 UPrimitiveComponent 목록
     */
-    TArray<UPrimitiveComponent*> SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
+    const TArray<UPrimitiveComponent*>& SelectOccluders(const TArray<UPrimitiveComponent*>& AllCandidates, const FVector& CameraPos);
 
     void RasterizeOccluders(const TArray<UPrimitiveComponent*>& SelectedOccluders, const FVector& CameraPos);
 
     /**
-     * @brief World Pos > Clip Space > Screen Coordinate
-     * @return 스크린 좌표 (X, Y)와 NDC Depth (Z)를 담은 FVector
+     * @brief World Pos > Clip Space > Screen Coordinate (FMatrix::ProjectPoints로 일괄 처리)
+     * @param OutScreenPositions 스크린 좌표 (X, Y)와 NDC Depth (Z)
      */
-    FVector Project(const FVector& WorldPos) const;
+    void ProjectToScreen(const TArray<FVector>& WorldPositions, TArray<FVector>& OutScreenPositions);
 
     /**
      * @brief 해당 메시 컴포넌트가 Z-Buffer에 의해 가려지는지 테스트합니다.
@@ -62,13 +62,14 @@ private:
     /**
      * @brief PrimitiveComponent의 AABB를 12개의 삼각형 정점으로 변환
      */
-    TArray<FVector> ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
+    const TArray<FVector>& ConvertAABBToTriangles(class UPrimitiveComponent* PrimitiveComp);
 
     TArray<float> CPU_ZBuffer;
     FMatrix CurrentViewProj;
 
-    TArray<struct FWorldAABBData> CachedAABBs;
     TArray<FVector> Triangles;
+    TArray<FVector4> ClipPositions;
+    TArray<FVector> ScreenTriangles;
     TArray<UPrimitiveComponent*> FilteredOccluders;    
     TArray<UPrimitiveComponent*> VisibleMeshComponents;
     uint32 Frame = 0;
@@ -85,6 +86,9 @@ struct FWorldAABBData
     FVector Min;
     FVector Max;
     FVector Center; // 자주 사용되는 Center 값도 저장하여 계산 오버헤드 제거
+
+    /** @brief 레벨의 World AABB 캐시에서 바로 읽음 */
+    explicit FWorldAABBData(UPrimitiveComponent* InPrim);
 };
 
 struct alignas(16) BatchProjectionInput
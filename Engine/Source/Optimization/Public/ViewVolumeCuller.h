@@ -4,6 +4,7 @@
 #include "Physics/Public/AABB.h"
 
 class FOctree;
+class FDynamicAABBTree;
 
 enum class EBoundCheckResult
 {
@@ -24,29 +25,29 @@ struct FFrustum
         {
             const FVector4& P = Planes[i];
 
-            // positive vertex: 법선 방향으로 가장 먼 꼭짓점
-            FVector PositiveVertex(
-                (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
-                (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
-                (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
+            // negative vertex: 법선(바깥) 방향으로 가장 가까운 꼭짓점
+            FVector NegativeVertex(
+                (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
+                (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
+                (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
             );
 
-            if (P.Dot3(PositiveVertex) + P.W > 0)
+            if (P.Dot3(NegativeVertex) + P.W > 0)
             {
-                // 박스가 평면 바깥(+측)으로 완전히 나감
+                // 가장 안쪽 꼭짓점조차 평면 바깥(+측) → 박스가 완전히 나감
                 return EBoundCheckResult::Outside;
             }
 
-            // negative vertex: 반대쪽 꼭짓점
-            FVector NegativeVertex(
-                (P.X >= 0) ? BBox.Min.X : BBox.Max.X,
-                (P.Y >= 0) ? BBox.Min.Y : BBox.Max.Y,
-                (P.Z >= 0) ? BBox.Min.Z : BBox.Max.Z
+            // positive vertex: 법선 방향으로 가장 먼 꼭짓점
+            FVector PositiveVertex(
+                (P.X >= 0) ? BBox.Max.X : BBox.Min.X,
+                (P.Y >= 0) ? BBox.Max.Y : BBox.Min.Y,
+                (P.Z >= 0) ? BBox.Max.Z : BBox.Min.Z
             );
 
-            if (P.Dot3(NegativeVertex) + P.W < 0)
+            if (P.Dot3(PositiveVertex) + P.W <= 0)
             {
-                // 박스가 평면 안쪽(-측)으로 완전히 들어옴 → 계속 검사
+                // 가장 바깥 꼭짓점도 평면 안쪽(-측) → 이 평면에 대해 완전히 들어옴, 계속 검사
                 continue;
             }
 
@@ -59,6 +60,32 @@ struct FFrustum
     }
 
     void Clear() { for (int i = 0; i < 6; ++i) { Planes[i] = FVector4::Zero(); }; }
+
+    /**
+     * @brief View * Projection 행렬에서 6개 평면을 추출하고 법선이 바깥을 향하도록 정규화
+     * @return 평면이 퇴화(길이 0)하면 false
+     */
+    bool SetFromViewProjection(const FMatrix& InViewProjection)
+    {
+        Planes[0] = InViewProjection[3] + InViewProjection[0]; // Left
+        Planes[1] = InViewProjection[3] - InViewProjection[0]; // Right
+        Planes[2] = InViewProjection[3] + InViewProjection[1]; // Bottom
+        Planes[3] = InViewProjection[3] - InViewProjection[1]; // Top
+        Planes[4] = InViewProjection[2]; // Near
+        Planes[5] = InViewProjection[3] - InViewProjection[2]; // Far
+
+        for (int i = 0; i < 6; i++)
+        {
+            const float Length = sqrt((Planes[i].X * Planes[i].X) +
+                                    (Planes[i].Y * Planes[i].Y) +
+                                    (Planes[i].Z * Planes[i].Z));
+
+            if (Length > -MATH_EPSILON && Length < MATH_EPSILON) { return false; }
+
+            Planes[i] /= -Length;
+        }
+        return true;
+    }
 };
 
 class ViewVolumeCuller
@@ -71,7 +98,7 @@ public:
 
 	void Cull(
         FOctree* StaticOctree,
-        TArray<UPrimitiveComponent*>& DynamicPrimitives,
+        const FDynamicAABBTree* DynamicTree,
 		const FCameraConstants& ViewProjConstants
 	);
 
@@ -0,0 +1,152 @@
+#include "pch.h"
+#include "Level/Public/World.h"
+#include "Actor/Public/Actor.h"
+#include "Component/Shape/Public/BoxComponent.h"
+#include "Component/Shape/Public/SphereComponent.h"
+#include "Component/Shape/Public/CapsuleComponent.h"
+#include "Utility/Public/Benchmark.h"
+
+#include <random>
+
+namespace
+{
+	constexpr int32 ShapeCounts[] = { 1000, 10000, 50000 };
+	constexpr int32 NumMeasuredFrames = 10;
+
+	// 이 개수를 넘으면 기존 전체 쌍 검사는 한 프레임에 수 초 이상 걸리므로 생략
+	constexpr int32 MaxBruteForceShapes = 10000;
+
+	// Shape당 평균 1개 안팎의 Overlap이 생기도록 밀도를 유지하는 평균 간격
+	constexpr float ShapeSpacing = 8.0f;
+	constexpr float JitterPerFrame = 0.5f;
+
+	/**
+	 * @brief Box/Sphere/Capsule을 번갈아 N개 가진 Actor 하나로 구성한 Game World 생성
+	 * SceneComponent가 GWorld의 Level Octree를 갱신하므로 호출 전후로 GWorld를 관리해야 한다
+	 */
+	UWorld* CreateBenchmarkWorld(int32 InNumShapes, std::mt19937& InRandom, TArray<UPrimitiveComponent*>& OutShapes)
+	{
+		UWorld* World = NewObject<UWorld>();
+		World->SetWorldType(EWorldType::Game);
+		GWorld = World;
+		World->CreateNewLevel();
+
+		AActor* ShapeOwner = World->SpawnActor(AActor::StaticClass());
+		const float HalfRange = std::cbrt(static_cast<float>(InNumShapes)) * ShapeSpacing * 0.5f;
+		std::uniform_real_distribution<float> Position(-HalfRange, HalfRange);
+
+		OutShapes.clear();
+		for (int32 Index = 0; Index < InNumShapes; ++Index)
+		{
+			UPrimitiveComponent* Shape = nullptr;
+			switch (Index % 3)
+			{
+			case 0:
+				Shape = ShapeOwner->CreateDefaultSubobject<UBoxComponent>();
+				break;
+			case 1:
+				Shape = ShapeOwner->CreateDefaultSubobject<USphereComponent>();
+				break;
+			default:
+				Shape = ShapeOwner->CreateDefaultSubobject<UCapsuleComponent>();
+				break;
+			}
+
+			Shape->SetRelativeLocation(FVector(Position(InRandom), Position(InRandom), Position(InRandom)));
+			OutShapes.push_back(Shape);
+		}
+
+		return World;
+	}
+
+	/** @brief 모든 Shape를 조금씩 움직여 매 프레임 Broadphase 정렬이 실제로 갱신되도록 한다 */
+	void JitterShapes(const TArray<UPrimitiveComponent*>& InShapes, std::mt19937& InRandom)
+	{
+		std::uniform_real_distribution<float> Offset(-JitterPerFrame, JitterPerFrame);
+		for (UPrimitiveComponent* Shape : InShapes)
+		{
+			Shape->SetRelativeLocation(Shape->GetRelativeLocation() + FVector(Offset(InRandom), Offset(InRandom), Offset(InRandom)));
+		}
+	}
+
+	size_t CountOverlapInfos(const TArray<UPrimitiveComponent*>& InShapes)
+	{
+		size_t NumOverlapInfos = 0;
+		for (const UPrimitiveComponent* Shape : InShapes)
+		{
+			NumOverlapInfos += Shape->GetOverlapInfos().size();
+		}
+		return NumOverlapInfos;
+	}
+}
+
+/**
+ * @brief 1k/10k/50k Shape에서 Sweep and Prune 기반 UWorld::UpdateCollisions와 기존 전체 쌍 검사 비교
+ * 두 방식이 같은 Overlap 결과를 내는지도 함께 확인한다
+ */
+IMPLEMENT_BENCHMARK(Collision, "Box/Sphere/Capsule 1k/10k/50k Overlap 갱신: Sweep and Prune vs 전체 쌍 검사")
+{
+	UWorld* PreviousWorld = GWorld;
+	std::mt19937 Random(20251017);
+
+	UE_LOG("  Shapes | Broadphase (ms/frame) | Brute Force (ms/frame) | Overlaps | Speedup");
+	for (int32 NumShapes : ShapeCounts)
+	{
+		TArray<UPrimitiveComponent*> Shapes;
+		UWorld* World = CreateBenchmarkWorld(NumShapes, Random, Shapes);
+
+		// 첫 프레임은 모든 BeginOverlap과 전체 정렬이 일어나므로 측정에서 제외
+		World->UpdateCollisions();
+
+		double BroadphaseMilliseconds = 0.0;
+		for (int32 Frame = 0; Frame < NumMeasuredFrames; ++Frame)
+		{
+			JitterShapes(Shapes, Random);
+
+			FScopeCycleCounter Counter;
+			World->UpdateCollisions();
+			BroadphaseMilliseconds += Counter.Finish();
+		}
+		BroadphaseMilliseconds /= NumMeasuredFrames;
+
+		const size_t NumOverlapInfos = CountOverlapInfos(Shapes);
+		FBenchmarkRegistry::Consume(NumOverlapInfos);
+
+		if (NumShapes <= MaxBruteForceShapes)
+		{
+			// 같은 배치에서 이전 구현(컴포넌트마다 전체 목록과 비교)을 한 프레임 실행
+			FScopeCycleCounter Counter;
+			for (UPrimitiveComponent* Shape : Shapes)
+			{
+				Shape->UpdateOverlaps(Shapes);
+			}
+			const double BruteForceMilliseconds = Counter.Finish();
+
+			const size_t NumBruteForceOverlapInfos = CountOverlapInfos(Shapes);
+			if (NumBruteForceOverlapInfos != NumOverlapInfos)
+			{
+				UE_LOG_ERROR("  Overlap 결과 불일치: Broadphase %zu, Brute Force %zu", NumOverlapInfos, NumBruteForceOverlapInfos);
+			}
+
+			UE_LOG("  %6d | %21.3f | %22.3f | %8zu | %6.1fx",
+				NumShapes,
+				BroadphaseMilliseconds,
+				BruteForceMilliseconds,
+				NumOverlapInfos / 2,
+				BroadphaseMilliseconds > 0.0 ? BruteForceMilliseconds / BroadphaseMilliseconds : 0.0);
+		}
+		else
+		{
+			UE_LOG("  %6d | %21.3f | %22s | %8zu | %7s",
+				NumShapes,
+				BroadphaseMilliseconds,
+				"-",
+				NumOverlapInfos / 2,
+				"-");
+		}
+
+		SafeDelete(World);
+	}
+
+	GWorld = PreviousWorld;
+}
@@ -0,0 +1,158 @@
+#include "pch.h"
+#include "Physics/Public/SweepAndPrune.h"
+
+namespace
+{
+	float GetAxisValue(const FVector& InVector, int32 InAxis)
+	{
+		return InAxis == 0 ? InVector.X : (InAxis == 1 ? InVector.Y : InVector.Z);
+	}
+}
+
+void FSweepAndPrune::FindOverlappingPairs(const TArray<FAABB>& InBounds, bool bInIsSameProxySet, TArray<FBroadphasePair>& OutPairs)
+{
+	OutPairs.clear();
+
+	const int32 NumProxies = static_cast<int32>(InBounds.size());
+	if (NumProxies < 2)
+	{
+		SortedProxies.clear();
+		return;
+	}
+
+	const int32 NewSortAxis = SelectSortAxis(InBounds);
+	const bool bCanReuseOrder = bInIsSameProxySet && NewSortAxis == SortAxis;
+	SortAxis = NewSortAxis;
+	SortProxies(InBounds, bCanReuseOrder);
+
+	// 정렬 축에서 구간이 겹치는 동안만 뒤쪽 프록시를 검사하므로 출력되는 쌍은 항상 한 번뿐이다
+	for (int32 SortedIndex = 0; SortedIndex < NumProxies; ++SortedIndex)
+	{
+		const int32 ProxyA = SortedProxies[SortedIndex];
+		const float MaxA = SortedMaxs[SortedIndex];
+		const FAABB& BoundsA = InBounds[ProxyA];
+
+		for (int32 OtherIndex = SortedIndex + 1; OtherIndex < NumProxies && SortedMins[OtherIndex] <= MaxA; ++OtherIndex)
+		{
+			const int32 ProxyB = SortedProxies[OtherIndex];
+			if (BoundsA.IsIntersected(InBounds[ProxyB]))
+			{
+				FBroadphasePair Pair;
+				Pair.IndexA = min(ProxyA, ProxyB);
+				Pair.IndexB = max(ProxyA, ProxyB);
+				OutPairs.push_back(Pair);
+			}
+		}
+	}
+}
+
+void FSweepAndPrune::Reset()
+{
+	SortAxis = 0;
+	SortedProxies.clear();
+	SortedMins.clear();
+	SortedMaxs.clear();
+}
+
+/**
+ * @brief AABB 중심의 분산이 가장 큰 축 선택
+ * 한 축에 몰려 있는 배치에서 정렬 축을 잘못 고르면 Sweep 구간이 길어져 다시 O(N²)에 가까워진다
+ */
+int32 FSweepAndPrune::SelectSortAxis(const TArray<FAABB>& InBounds) const
+{
+	double Sum[3] = { 0.0, 0.0, 0.0 };
+	double SquaredSum[3] = { 0.0, 0.0, 0.0 };
+
+	for (const FAABB& Bounds : InBounds)
+	{
+		const FVector Center = Bounds.GetCenter();
+		Sum[0] += Center.X;
+		Sum[1] += Center.Y;
+		Sum[2] += Center.Z;
+		SquaredSum[0] += static_cast<double>(Center.X) * Center.X;
+		SquaredSum[1] += static_cast<double>(Center.Y) * Center.Y;
+		SquaredSum[2] += static_cast<double>(Center.Z) * Center.Z;
+	}
+
+	const double NumProxies = static_cast<double>(InBounds.size());
+	double Variance[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Variance[Axis] = SquaredSum[Axis] - Sum[Axis] * Sum[Axis] / NumProxies;
+	}
+
+	int32 BestAxis = SortAxis;
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (Variance[Axis] > Variance[BestAxis] * AxisSwitchRatio)
+		{
+			BestAxis = Axis;
+		}
+	}
+	return BestAxis;
+}
+
+/**
+ * @brief 정렬 축 Min 기준으로 프록시 정렬 후 Sweep용 Min/Max 캐시 갱신
+ * 이전 순서를 재사용할 수 있으면 삽입 정렬로 보정하고, 이동량이 많으면 전체 정렬로 전환한다
+ */
+void FSweepAndPrune::SortProxies(const TArray<FAABB>& InBounds, bool bInCanReuseOrder)
+{
+	const int32 NumProxies = static_cast<int32>(InBounds.size());
+	auto GetSortKey = [this, &InBounds](int32 InProxy)
+	{
+		return GetAxisValue(InBounds[InProxy].Min, SortAxis);
+	};
+
+	bool bIsSorted = false;
+	if (bInCanReuseOrder && static_cast<int32>(SortedProxies.size()) == NumProxies)
+	{
+		int64 RemainingShifts = static_cast<int64>(NumProxies) * MaxInsertionShiftsPerProxy;
+		bIsSorted = true;
+
+		for (int32 Index = 1; Index < NumProxies && bIsSorted; ++Index)
+		{
+			const int32 Proxy = SortedProxies[Index];
+			const float Key = GetSortKey(Proxy);
+
+			int32 InsertIndex = Index;
+			while (InsertIndex > 0 && GetSortKey(SortedProxies[InsertIndex - 1]) > Key)
+			{
+				SortedProxies[InsertIndex] = SortedProxies[InsertIndex - 1];
+				--InsertIndex;
+
+				if (--RemainingShifts < 0)
+				{
+					bIsSorted = false;
+					break;
+				}
+			}
+			SortedProxies[InsertIndex] = Proxy;
+		}
+	}
+
+	if (!bIsSorted)
+	{
+		SortedProxies.resize(NumProxies);
+		for (int32 Index = 0; Index < NumProxies; ++Index)
+		{
+			SortedProxies[Index] = Index;
+		}
+
+		std::sort(SortedProxies.begin(), SortedProxies.end(), [&GetSortKey](int32 InA, int32 InB)
+		{
+			const float KeyA = GetSortKey(InA);
+			const float KeyB = GetSortKey(InB);
+			return KeyA < KeyB || (KeyA == KeyB && InA < InB);
+		});
+	}
+
+	SortedMins.resize(NumProxies);
+	SortedMaxs.resize(NumProxies);
+	for (int32 Index = 0; Index < NumProxies; ++Index)
+	{
+		const FAABB& Bounds = InBounds[SortedProxies[Index]];
+		SortedMins[Index] = GetAxisValue(Bounds.Min, SortAxis);
+		SortedMaxs[Index] = GetAxisValue(Bounds.Max, SortAxis);
+	}
+}
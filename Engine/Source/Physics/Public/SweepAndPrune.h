@@ -0,0 +1,52 @@
+#pragma once
+#include "Physics/Public/AABB.h"
+
+/**
+ * @brief Broadphase가 찾은 후보 쌍 (입력 배열 기준 인덱스, 항상 IndexA < IndexB)
+ */
+struct FBroadphasePair
+{
+	int32 IndexA = -1;
+	int32 IndexB = -1;
+};
+
+/**
+ * @brief Sweep and Prune Broadphase
+ * World AABB를 분산이 가장 큰 축의 Min 값으로 정렬한 뒤 한 번 훑으며 겹치는 쌍만 후보로 내보낸다
+ *
+ * - 같은 쌍은 한 번만 출력되며, 판정은 FAABB::IsIntersected와 같은 경계 포함 비교를 사용한다
+ * - 프록시 구성이 지난 호출과 같으면 이전 정렬 순서를 삽입 정렬로 보정해 프레임 간 일관성을 활용한다
+ */
+class FSweepAndPrune
+{
+public:
+	/**
+	 * @brief 겹치는 AABB 쌍 계산
+	 * @param InBounds 프록시별 World AABB
+	 * @param bInIsSameProxySet 지난 호출과 같은 순서의 같은 프록시 집합이면 true
+	 * @param OutPairs 후보 쌍 (기존 내용은 지워진다)
+	 */
+	void FindOverlappingPairs(const TArray<FAABB>& InBounds, bool bInIsSameProxySet, TArray<FBroadphasePair>& OutPairs);
+
+	/** @brief 정렬 상태를 버려 다음 호출에서 전체 정렬하도록 한다 */
+	void Reset();
+
+	int32 GetSortAxis() const { return SortAxis; }
+
+private:
+	int32 SelectSortAxis(const TArray<FAABB>& InBounds) const;
+	void SortProxies(const TArray<FAABB>& InBounds, bool bInCanReuseOrder);
+
+	int32 SortAxis = 0;
+	TArray<int32> SortedProxies;
+
+	// 정렬 축 기준 Min/Max를 정렬 순서대로 모은 캐시 (Sweep 내부 루프의 메모리 접근을 연속으로 유지)
+	TArray<float> SortedMins;
+	TArray<float> SortedMaxs;
+
+	// 삽입 정렬 이동 횟수가 프록시 수의 이 배수를 넘으면 전체 정렬로 전환
+	static constexpr int32 MaxInsertionShiftsPerProxy = 4;
+
+	// 다른 축의 분산이 현재 축보다 이 비율 이상 클 때만 정렬 축을 바꿔 축이 매 프레임 뒤바뀌는 것을 막는다
+	static constexpr float AxisSwitchRatio = 1.25f;
+};
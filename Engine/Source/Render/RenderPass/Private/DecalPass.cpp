@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Component/Public/DecalComponent.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Asset/Public/AssetManager.h"
 #include "Physics/Public/OBB.h"
@@ -154,8 +155,6 @@ void FDecalPass::Execute(FRenderingContext& Context)
     uint32 RenderedDecal = 0;
     uint32 CollidedComps = 0;
     
-    TArray<UPrimitiveComponent*>& DynamicPrimitives = GWorld->GetLevel()->GetDynamicPrimitives();
-    
     // --- Render Decals ---
     for (UDecalComponent* Decal : Context.Decals)
     {
@@ -199,8 +198,11 @@ void FDecalPass::Execute(FRenderingContext& Context)
         // --- Enable Octree Optimization --- 
         ULevel* CurrentLevel = GWorld->GetLevel();
 
-        Query(CurrentLevel->GetStaticOctree(), Decal, Primitives);
-        Primitives.insert(Primitives.end(), DynamicPrimitives.begin(), DynamicPrimitives.end());
+        Query(CurrentLevel->GetStaticOctree(), FOctree::RootNodeIndex, Decal, Primitives);
+        if (const FDynamicAABBTree* DynamicTree = CurrentLevel->GetDynamicTree())
+        {
+            DynamicTree->QueryAABB(DecalOBB->ToWorldAABB(), Primitives);
+        }
 
         // --- Disable Octree Optimization --- 
         // Primitives = Context.DefaultPrimitives;
@@ -209,8 +211,8 @@ void FDecalPass::Execute(FRenderingContext& Context)
         {
             if (!Prim || !Prim->IsVisible() || Prim->IsVisualizationComponent() || !Prim->bReceivesDecals) { continue; }
 
-            const IBoundingVolume* PrimBV = Prim->GetBoundingVolume();
-        	if (!PrimBV || PrimBV->GetType() != EBoundingVolumeType::AABB) { continue; }
+            // 바운딩 볼륨을 월드로 갱신하지 않고 World AABB 캐시에 기록된 타입만 확인
+        	if (Prim->GetBoundingVolumeType() != EBoundingVolumeType::AABB) { continue; }
         
         	FVector WorldMin, WorldMax;
         	Prim->GetWorldAABB(WorldMin, WorldMax);
@@ -248,26 +250,26 @@ void FDecalPass::Release()
     SafeRelease(ConstantBufferDecal);
 }
 
-void FDecalPass::Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives)
+void FDecalPass::Query(const FOctree* InOctree, int32 InNodeIndex, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives)
 {
     /** @todo Use polymorphism to gracefully handle collsion between decal and octree. For now, use explicit casting. */
     auto BoundingVolume = static_cast<const FOBB*>(InDecal->GetBoundingVolume());
+    const FOctreeNode& Node = InOctree->GetNode(InNodeIndex);
 
-    if (!BoundingVolume->Intersects(InOctree->GetBoundingVolume()))
+    if (!BoundingVolume->Intersects(Node.GetBoundingVolume()))
     {
         return;
     }
 
-    auto Primitives = InOctree->GetPrimitives();
+    const auto& Primitives = Node.GetPrimitives();
     OutPrimitives.insert(OutPrimitives.end(), Primitives.begin(), Primitives.end());
-    if (InOctree->IsLeafNode())
+    if (Node.IsLeafNode())
     {
         return;
     }
 
-    
-    for (auto Child : InOctree->GetChildren())
+    for (int32 Child = Node.GetFirstChild(); Child < Node.GetFirstChild() + FOctree::NumChildren; ++Child)
     {
-        Query(Child, InDecal, OutPrimitives);
+        Query(InOctree, Child, InDecal, OutPrimitives);
     }
 }
@@ -299,7 +299,7 @@ void FShadowMapPass::Execute(FRenderingContext& Context)
 
 void FShadowMapPass::RenderDirectionalShadowMap(
 	UDirectionalLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes,
+	const TFrameArray<UStaticMeshComponent*>& Meshes,
 	UCamera* InCamera
 	)
 {
@@ -453,7 +453,7 @@ void FShadowMapPass::RenderDirectionalShadowMap(
 void FShadowMapPass::RenderSpotShadowMap(
 	USpotLightComponent* Light,
 	uint32 AtlasIndex,
-	const TArray<UStaticMeshComponent*>& Meshes
+	const TFrameArray<UStaticMeshComponent*>& Meshes
 	)
 {
 	// FShadowMapResource* ShadowMap = GetOrCreateShadowMap(Light);
@@ -558,7 +558,7 @@ void FShadowMapPass::RenderSpotShadowMap(
 void FShadowMapPass::RenderPointShadowMap(
 	UPointLightComponent* Light,
 	uint32 AtlasIndex,
-	const TArray<UStaticMeshComponent*>& Meshes
+	const TFrameArray<UStaticMeshComponent*>& Meshes
 	)
 {
 	// FCubeShadowMapResource* ShadowMap = GetOrCreateCubeShadowMap(Light);
@@ -714,7 +714,7 @@ void FShadowMapPass::SetShadowAtlasTilePositionStructuredBuffer()
 }
 
 void FShadowMapPass::CalculateDirectionalLightViewProj(UDirectionalLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj)
+	const TFrameArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj)
 {
 	// PSM (Perspective Shadow Map) 구현
 	if (!InCamera)
@@ -757,7 +757,7 @@ void FShadowMapPass::CalculateDirectionalLightViewProj(UDirectionalLightComponen
 }
 
 void FShadowMapPass::CalculateUniformShadowMapViewProj(UDirectionalLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
+	const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
 {
 	// Sample 버전의 Uniform Shadow Map 구현
 	// 1. 모든 메시의 AABB를 포함하는 bounding box 계산
@@ -865,7 +865,7 @@ void FShadowMapPass::CalculateUniformShadowMapViewProj(UDirectionalLightComponen
 }
 
 void FShadowMapPass::CalculateSpotLightViewProj(USpotLightComponent* Light,
-	const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
+	const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj)
 {
 	// 1. Light의 위치와 방향 가져오기
 	FVector LightPos = Light->GetWorldLocation();
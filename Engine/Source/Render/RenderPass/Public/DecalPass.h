@@ -35,7 +35,7 @@ public:
 
 private:
 	// --- Octree Optimization ---
-	void Query(FOctree* InOctree, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives);
+	void Query(const FOctree* InOctree, int32 InNodeIndex, UDecalComponent* InDecal, TArray<UPrimitiveComponent*>& OutPrimitives);
 
 	ID3D11VertexShader* VS = nullptr;
     ID3D11PixelShader* PS = nullptr;
@@ -1,5 +1,10 @@
 ﻿#pragma once
+#include "Global/FrameArena.h"
 
+/**
+ * @brief 한 뷰포트를 그리는 동안 패스들이 공유하는 정보
+ * 프리미티브 목록은 프레임 Arena에 할당되므로 프레임이 끝나기 전에 비워야 한다
+ */
 struct FRenderingContext
 {
     FRenderingContext(){}
@@ -14,17 +19,17 @@ struct FRenderingContext
     D3D11_VIEWPORT Viewport;
     FVector2 RenderTargetSize;
 
-    TArray<class UPrimitiveComponent*> AllPrimitives;
+    TFrameArray<class UPrimitiveComponent*> AllPrimitives;
     // Components By Render Pass
-    TArray<class UStaticMeshComponent*> StaticMeshes;
-    TArray<class UBillBoardComponent*> BillBoards;
-    TArray<class UEditorIconComponent*> EditorIcons;
-    TArray<class UTextComponent*> Texts;
-    TArray<class UUUIDTextComponent*> UUIDs;
-    TArray<class UDecalComponent*> Decals;
-    TArray<class UPointLightComponent*> PointLights;
-    TArray<class USpotLightComponent*> SpotLights;
-    TArray<class UDirectionalLightComponent*> DirectionalLights;
-    TArray<class UAmbientLightComponent*> AmbientLights;
-    TArray<class UHeightFogComponent*> Fogs;
+    TFrameArray<class UStaticMeshComponent*> StaticMeshes;
+    TFrameArray<class UBillBoardComponent*> BillBoards;
+    TFrameArray<class UEditorIconComponent*> EditorIcons;
+    TFrameArray<class UTextComponent*> Texts;
+    TFrameArray<class UUUIDTextComponent*> UUIDs;
+    TFrameArray<class UDecalComponent*> Decals;
+    TFrameArray<class UPointLightComponent*> PointLights;
+    TFrameArray<class USpotLightComponent*> SpotLights;
+    TFrameArray<class UDirectionalLightComponent*> DirectionalLights;
+    TFrameArray<class UAmbientLightComponent*> AmbientLights;
+    TFrameArray<class UHeightFogComponent*> Fogs;
 };
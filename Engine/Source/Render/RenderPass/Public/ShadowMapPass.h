@@ -101,7 +101,7 @@ private:
 	 */
 	void RenderDirectionalShadowMap(
 		UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes,
+		const TFrameArray<UStaticMeshComponent*>& Meshes,
 		UCamera* InCamera
 		);
 
@@ -114,7 +114,7 @@ private:
 	void RenderSpotShadowMap(
 		USpotLightComponent* Light,
 		uint32 AtlasIndex,
-		const TArray<UStaticMeshComponent*>& Meshes
+		const TFrameArray<UStaticMeshComponent*>& Meshes
 		);
 
 	// --- Point Light Shadow Rendering (6 faces) ---
@@ -126,7 +126,7 @@ private:
 	void RenderPointShadowMap(
 		UPointLightComponent* Light,
 		uint32 AtlasIndex,
-		const TArray<UStaticMeshComponent*>& Meshes
+		const TFrameArray<UStaticMeshComponent*>& Meshes
 		);
 
 	void SetShadowAtlasTilePositionStructuredBuffer();
@@ -141,7 +141,7 @@ private:
 	 * @param OutProj 출력 projection matrix
 	 */
 	void CalculateDirectionalLightViewProj(UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj);
+		const TFrameArray<UStaticMeshComponent*>& Meshes, UCamera* InCamera, FMatrix& OutView, FMatrix& OutProj);
 
 	/**
 	 * @brief Uniform Shadow Map의 view-projection 행렬을 계산합니다 (Sample 버전).
@@ -151,7 +151,7 @@ private:
 	 * @param OutProj 출력 projection matrix
 	 */
 	void CalculateUniformShadowMapViewProj(UDirectionalLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
+		const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
 
 	/**
 	 * @brief Spot light의 view-projection 행렬을 계산합니다.
@@ -161,7 +161,7 @@ private:
 	 * @param OutProj 출력 projection matrix
 	 */
 	void CalculateSpotLightViewProj(USpotLightComponent* Light,
-		const TArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
+		const TFrameArray<UStaticMeshComponent*>& Meshes, FMatrix& OutView, FMatrix& OutProj);
 
 	/**
 	 * @brief Point light의 6면에 대한 view-projection 행렬을 계산합니다.
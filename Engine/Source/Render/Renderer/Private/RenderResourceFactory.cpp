@@ -76,6 +76,9 @@ void FRenderResourceFactory::CreateVertexShaderAndInputLayout(const wstring& InF
 
 ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FNormalVertex* InVertices, uint32 InByteWidth)
 {
+	// Headless 실행 등 Device가 없는 경우 GPU 리소스를 만들지 않음
+	if (!URenderer::GetInstance().GetDevice()) { return nullptr; }
+
 	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_IMMUTABLE, D3D11_BIND_VERTEX_BUFFER, 0, 0, 0 };
 	D3D11_SUBRESOURCE_DATA InitData = { InVertices, 0, 0 };
 	ID3D11Buffer* VertexBuffer = nullptr;
@@ -85,6 +88,8 @@ ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FNormalVertex* InVertic
 
 ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FVector* InVertices, uint32 InByteWidth, bool bCpuAccess)
 {
+	if (!URenderer::GetInstance().GetDevice()) { return nullptr; }
+
 	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_IMMUTABLE, D3D11_BIND_VERTEX_BUFFER, 0, 0, 0 };
 	if (bCpuAccess)
 	{
@@ -99,6 +104,8 @@ ID3D11Buffer* FRenderResourceFactory::CreateVertexBuffer(FVector* InVertices, ui
 
 ID3D11Buffer* FRenderResourceFactory::CreateIndexBuffer(const void* InIndices, uint32 InByteWidth)
 {
+	if (!URenderer::GetInstance().GetDevice()) { return nullptr; }
+
 	D3D11_BUFFER_DESC Desc = { InByteWidth, D3D11_USAGE_IMMUTABLE, D3D11_BIND_INDEX_BUFFER, 0, 0, 0 };
 	D3D11_SUBRESOURCE_DATA InitData = { InIndices, 0, 0 };
 	ID3D11Buffer* IndexBuffer = nullptr;
@@ -175,6 +182,8 @@ void FRenderResourceFactory::CreateComputeShader(const wstring& InFilePath, ID3D
 
 ID3D11SamplerState* FRenderResourceFactory::CreateSamplerState(D3D11_FILTER InFilter, D3D11_TEXTURE_ADDRESS_MODE InAddressMode)
 {
+	if (!URenderer::GetInstance().GetDevice()) { return nullptr; }
+
 	D3D11_SAMPLER_DESC SamplerDesc = {};
 	SamplerDesc.Filter = InFilter;
 	SamplerDesc.AddressU = InAddressMode;
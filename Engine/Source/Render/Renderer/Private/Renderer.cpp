@@ -15,6 +15,7 @@
 #include "Editor/Public/Editor.h"
 #include "Global/Octree.h"
 #include "Global/Octree.h"
+#include "Global/DynamicAABBTree.h"
 #include "Level/Public/Level.h"
 #include "Manager/Script/Public/ScriptManager.h"
 #include "Manager/UI/Public/UIManager.h"
@@ -943,6 +944,9 @@ void URenderer::Update()
     }
 
     RenderEnd();
+
+    // 프리미티브 목록은 프레임 Arena 메모리이므로 프레임 끝의 Reset 전에 비운다
+    RenderingContext = FRenderingContext();
 }
 
 void URenderer::RenderBegin() const
@@ -984,44 +988,29 @@ void URenderer::RenderBegin() const
 
 void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 {
+	ALLOC_SCOPE(RenderLevel)
+
 	// 뷰포트별로 렌더링할 World 결정 (PIE active viewport면 PIE World, 아니면 Editor World)
 	UWorld* WorldToRender = GEditor->GetWorldForViewport(ViewportIndex);
 	if (!WorldToRender) { return; }
 
-	const ULevel* CurrentLevel = WorldToRender->GetLevel();
+	ULevel* CurrentLevel = WorldToRender->GetLevel();
 	if (!CurrentLevel) { return; }
 
+	// World Tick 이후 에디터/UI에서 움직인 계층까지 반영
+	CurrentLevel->UpdateTransforms();
+
 	const FCameraConstants& ViewProj = InViewport->GetViewportClient()->GetCamera()->GetFViewProjConstants();
 	static bool bCullingEnabled = false; // 임시 토글(초기값: 컬링 비활성)
-	TArray<UPrimitiveComponent*> FinalVisiblePrims;
+	TFrameArray<UPrimitiveComponent*> FinalVisiblePrims;
 	if (!bCullingEnabled)
 	{
-		// 1) 옥트리(정적 프리미티브) 전부 수집
-		if (FOctree* StaticOctree = WorldToRender->GetLevel()->GetStaticOctree())
-		{
-			TArray<UPrimitiveComponent*> AllStatics;
-			StaticOctree->GetAllPrimitives(AllStatics);
-			for (UPrimitiveComponent* Primitive : AllStatics)
-			{
-				if (Primitive && Primitive->IsVisible())
-				{
-					FinalVisiblePrims.push_back(Primitive);
-				}
-			}
-		}
-		// 2) 동적 프리미티브 전부 수집
-		TArray<UPrimitiveComponent*>& DynamicPrimitives = WorldToRender->GetLevel()->GetDynamicPrimitives();
-		for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				FinalVisiblePrims.push_back(Primitive);
-			}
-		}
+		CollectVisiblePrimitives(WorldToRender->GetLevel(), FinalVisiblePrims);
 	}
 	else
 	{
-		FinalVisiblePrims = InViewport->GetViewportClient()->GetCamera()->GetViewVolumeCuller().GetRenderableObjects();
+		const TArray<UPrimitiveComponent*>& RenderableObjects = InViewport->GetViewportClient()->GetCamera()->GetViewVolumeCuller().GetRenderableObjects();
+		FinalVisiblePrims.assign(RenderableObjects.begin(), RenderableObjects.end());
 	}
 
 	RenderingContext = FRenderingContext(
@@ -1131,6 +1120,30 @@ void URenderer::RenderLevel(FViewport* InViewport, int32 ViewportIndex)
 	}
 }
 
+void URenderer::CollectVisiblePrimitives(ULevel* InLevel, TFrameArray<UPrimitiveComponent*>& OutPrimitives)
+{
+	// 1) 옥트리(정적 프리미티브)
+	PrimitiveScratch.clear();
+	if (FOctree* StaticOctree = InLevel->GetStaticOctree())
+	{
+		StaticOctree->GetAllPrimitives(PrimitiveScratch);
+	}
+	// 2) 동적 프리미티브
+	if (FDynamicAABBTree* DynamicTree = InLevel->GetDynamicTree())
+	{
+		DynamicTree->GetAllPrimitives(PrimitiveScratch);
+	}
+
+	OutPrimitives.reserve(OutPrimitives.size() + PrimitiveScratch.size());
+	for (UPrimitiveComponent* Primitive : PrimitiveScratch)
+	{
+		if (Primitive && Primitive->IsVisible())
+		{
+			OutPrimitives.push_back(Primitive);
+		}
+	}
+}
+
 void URenderer::RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride, uint32 InIndexBufferStride)
 {
     // Use the global stride if InStride is 0
@@ -1304,31 +1317,8 @@ void URenderer::RenderHitProxyPass(UCamera* InCamera, const D3D11_VIEWPORT& InVi
 	Context.RenderTargetSize = FVector2(InViewport.Width, InViewport.Height);
 
 	// 모든 Primitive 컴포넌트 수집
-	TArray<UPrimitiveComponent*> AllVisiblePrims;
-
-	// Static Octree에서 정적 프리미티브 수집
-	if (FOctree* StaticOctree = CurrentLevel->GetStaticOctree())
-	{
-		TArray<UPrimitiveComponent*> AllStatics;
-		StaticOctree->GetAllPrimitives(AllStatics);
-		for (UPrimitiveComponent* Primitive : AllStatics)
-		{
-			if (Primitive && Primitive->IsVisible())
-			{
-				AllVisiblePrims.push_back(Primitive);
-			}
-		}
-	}
-
-	// 동적 프리미티브 수집
-	TArray<UPrimitiveComponent*>& DynamicPrimitives = CurrentLevel->GetDynamicPrimitives();
-	for (UPrimitiveComponent* Primitive : DynamicPrimitives)
-	{
-		if (Primitive && Primitive->IsVisible())
-		{
-			AllVisiblePrims.push_back(Primitive);
-		}
-	}
+	TFrameArray<UPrimitiveComponent*> AllVisiblePrims;
+	CollectVisiblePrimitives(CurrentLevel, AllVisiblePrims);
 
 	// Primitive 타입별로 분류
 	for (auto& Prim : AllVisiblePrims)
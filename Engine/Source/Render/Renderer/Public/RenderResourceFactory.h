@@ -41,7 +41,10 @@ public:
 		Desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
 
 		ID3D11Buffer* Buffer = nullptr;
-		URenderer::GetInstance().GetDevice()->CreateBuffer(&Desc, nullptr, &Buffer);
+		if (ID3D11Device* Device = URenderer::GetInstance().GetDevice())
+		{
+			Device->CreateBuffer(&Desc, nullptr, &Buffer);
+		}
 		return Buffer;
 	}
 
@@ -17,6 +17,7 @@ class FShadowMapPass;
 class FViewport;
 class FViewportClient;
 class UCamera;
+class ULevel;
 class UPipeline;
 
 // URenderer 내부에서 셰이더들은 용도에 따라 분류될 수 있음.
@@ -83,14 +84,16 @@ public:
 	void Update();
 	void RenderBegin() const;
 	void RenderLevel(FViewport* InViewport, int32 ViewportIndex);
+	/** @brief Level의 정적/동적 트리에서 보이는 프리미티브를 모두 수집 (컬링 없음) */
+	void CollectVisiblePrimitives(ULevel* InLevel, TFrameArray<UPrimitiveComponent*>& OutPrimitives);
 	void RenderEnd() const;
 	void RenderEditorPrimitive(const FEditorPrimitive& InPrimitive, const FRenderState& InRenderState, uint32 InStride = 0, uint32 InIndexBufferStride = 0);
 
 	void OnResize(uint32 Inwidth = 0, uint32 InHeight = 0) const;
 
 	// Getter & Setter
-	ID3D11Device* GetDevice() const { return DeviceResources->GetDevice(); }
-	ID3D11DeviceContext* GetDeviceContext() const { return DeviceResources->GetDeviceContext(); }
+	ID3D11Device* GetDevice() const { return DeviceResources ? DeviceResources->GetDevice() : nullptr; }
+	ID3D11DeviceContext* GetDeviceContext() const { return DeviceResources ? DeviceResources->GetDeviceContext() : nullptr; }
 	IDXGISwapChain* GetSwapChain() const { return DeviceResources->GetSwapChain(); }
 	
 	ID3D11SamplerState* GetDefaultSampler() const { return DefaultSampler; }
@@ -222,6 +225,8 @@ private:
 	bool bFXAAEnabled = true;
 
 	FRenderingContext RenderingContext{};
+	// 트리에서 프리미티브를 꺼낼 때 쓰는 재사용 버퍼 (용량을 유지해 매 프레임 힙 할당하지 않음)
+	TArray<UPrimitiveComponent*> PrimitiveScratch;
 
 	TArray<class FRenderPass*> RenderPasses;
 
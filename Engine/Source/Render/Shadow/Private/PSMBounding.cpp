@@ -268,6 +268,33 @@ bool FPSMFrustum::TestSweptSphere(const FPSMBoundingSphere& Sphere, const FVecto
 // FPSMBoundingCone
 //-----------------------------------------------------------------------------
 
+// 헬퍼: 모든 박스 모서리를 한 번에 포스트-프로젝티브 공간으로 변환 (W가 0에 가까운 점은 제외)
+static void ProjectBoxCorners(std::vector<FVector>& OutPoints, const std::vector<FPSMBoundingBox>& Boxes, const FMatrix& Projection)
+{
+	std::vector<FVector> Corners;
+	Corners.reserve(Boxes.size() * 8);
+	for (const auto& Box : Boxes)
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			Corners.push_back(Box.GetCorner(i));
+		}
+	}
+
+	std::vector<FVector4> Projected(Corners.size());
+	Projection.ProjectPoints(Corners.data(), Projected.data(), static_cast<int32>(Corners.size()));
+
+	OutPoints.clear();
+	OutPoints.reserve(Corners.size());
+	for (const FVector4& PP : Projected)
+	{
+		if (std::abs(PP.W) > 1e-6f)
+		{
+			OutPoints.push_back(FVector(PP.X, PP.Y, PP.Z));
+		}
+	}
+}
+
 FPSMBoundingCone::FPSMBoundingCone(
 	const std::vector<FPSMBoundingBox>& Boxes,
 	const FMatrix& Projection,
@@ -284,24 +311,7 @@ FPSMBoundingCone::FPSMBoundingCone(
 
 	// 모든 박스 모서리를 포스트-프로젝티브 공간으로 변환
 	std::vector<FVector> PPPoints;
-	PPPoints.reserve(Boxes.size() * 8);
-
-	for (const auto& Box : Boxes)
-	{
-		for (int i = 0; i < 8; i++)
-		{
-			FVector Corner = Box.GetCorner(i);
-			FVector4 Transformed = Projection.TransformVector4(FVector4(Corner, 1.0f));
-			if (std::abs(Transformed.W) > 1e-6f)
-			{
-				PPPoints.push_back(FVector(
-					Transformed.X / Transformed.W,
-					Transformed.Y / Transformed.W,
-					Transformed.Z / Transformed.W
-				));
-			}
-		}
-	}
+	ProjectBoxCorners(PPPoints, Boxes, Projection);
 
 	if (PPPoints.empty())
 	{
@@ -329,9 +339,11 @@ FPSMBoundingCone::FPSMBoundingCone(
 	Far = -FLT_MAX;
 	float MaxX = 0.0f, MaxY = 0.0f;
 
-	for (const auto& Pt : PPPoints)
+	std::vector<FVector> LSPoints(PPPoints.size());
+	LookAtMatrix.TransformPositions(PPPoints.data(), LSPoints.data(), static_cast<int32>(PPPoints.size()));
+
+	for (const auto& LSPoint : LSPoints)
 	{
-		FVector4 LSPoint = LookAtMatrix.TransformVector4(FVector4(Pt, 1.0f));
 		if (LSPoint.Z > 1e-6f)  // Z는 라이트 공간에서의 깊이
 		{
 			MaxX = std::max(MaxX, std::abs(LSPoint.X / LSPoint.Z));
@@ -362,29 +374,15 @@ FPSMBoundingCone::FPSMBoundingCone(
 
 	// 모든 박스 모서리 변환
 	std::vector<FVector> LSPoints;
-	LSPoints.reserve(Boxes.size() * 8);
-
-	for (const auto& Box : Boxes)
-	{
-		for (int i = 0; i < 8; i++)
-		{
-			FVector Corner = Box.GetCorner(i);
-			FVector4 PP = Projection.TransformVector4(FVector4(Corner, 1.0f));
-			if (std::abs(PP.W) > 1e-6f)
-			{
-				FVector PPCorner(PP.X / PP.W, PP.Y / PP.W, PP.Z / PP.W);
-				LSPoints.push_back(PPCorner);
-			}
-		}
-	}
+	ProjectBoxCorners(LSPoints, Boxes, Projection);
+	LookAtMatrix.TransformPositions(LSPoints.data(), LSPoints.data(), static_cast<int32>(LSPoints.size()));
 
 	Near = FLT_MAX;
 	Far = -FLT_MAX;
 	float MaxX = 0.0f, MaxY = 0.0f;
 
-	for (const auto& Pt : LSPoints)
+	for (const auto& LSPoint : LSPoints)
 	{
-		FVector4 LSPoint = LookAtMatrix.TransformVector4(FVector4(Pt, 1.0f));
 		if (LSPoint.Z > 1e-6f)
 		{
 			MaxX = std::max(MaxX, std::abs(LSPoint.X / LSPoint.Z));
@@ -407,11 +405,15 @@ void TransformBoundingBox(FPSMBoundingBox& Result, const FPSMBoundingBox& Source
 	Result.MinPt = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
 	Result.MaxPt = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
 
+	FVector Corners[8];
 	for (int i = 0; i < 8; i++)
 	{
-		FVector Corner = Source.GetCorner(i);
-		FVector4 Transformed = Transform.TransformVector4(FVector4(Corner, 1.0f));
-		FVector TransformedCorner(Transformed.X, Transformed.Y, Transformed.Z);
+		Corners[i] = Source.GetCorner(i);
+	}
+	Transform.TransformPositions(Corners, Corners, 8);
+
+	for (const FVector& TransformedCorner : Corners)
+	{
 		Result.Merge(TransformedCorner);
 	}
 }
@@ -23,7 +23,7 @@ void FPSMCalculator::CalculateShadowProjection(
 	FMatrix& OutProjectionMatrix,
 	const FVector& LightDirection,
 	UCamera* Camera,
-	const std::vector<UStaticMeshComponent*>& Meshes,
+	const TFrameArray<UStaticMeshComponent*>& Meshes,
 	FPSMParameters& InOutParams)
 {
 	// 그림자 캐스터와 리시버 분류
@@ -71,7 +71,7 @@ void FPSMCalculator::CalculateShadowProjection(
 void FPSMCalculator::ComputeVirtualCameraParameters(
 	const FVector& LightDirection,
 	UCamera* Camera,
-	const std::vector<UStaticMeshComponent*>& Meshes,
+	const TFrameArray<UStaticMeshComponent*>& Meshes,
 	std::vector<FPSMBoundingBox>& OutShadowCasters,
 	std::vector<FPSMBoundingBox>& OutShadowReceivers,
 	FPSMParameters& InOutParams)
@@ -542,7 +542,7 @@ void FPSMCalculator::BuildLSPSMProjection(
 	FMatrix& OutProj,
 	const FVector& LightDirection,
 	UCamera* Camera,
-	const std::vector<UStaticMeshComponent*>& Meshes,
+	const TFrameArray<UStaticMeshComponent*>& Meshes,
 	FPSMParameters& Params)
 {
 	// Sample LiSPSM 알고리즘 정확한 재구현 (line 536-607)
@@ -619,9 +619,10 @@ void FPSMCalculator::BuildLSPSMProjection(
 
 	// Sample line 572: Transform Body B to Light Space, calculate AABB
 	FPSMBoundingBox LSBody;
-	for (const auto& Pt : BodyB)
+	std::vector<FVector> LSBodyB(BodyB.size());
+	LSLightView.TransformPositions(BodyB.data(), LSBodyB.data(), static_cast<int32>(BodyB.size()));
+	for (const auto& LSPt : LSBodyB)
 	{
-		FVector LSPt = LSLightView.TransformPosition(Pt);
 		LSBody.Merge(LSPt);
 	}
 
@@ -673,20 +674,14 @@ void FPSMCalculator::BuildLSPSMProjection(
 	FMatrix LSLightViewProj = LSLightView * LiSPSMProj;
 
 	LSBody = FPSMBoundingBox();
-	for (const auto& Pt : BodyB)
+	std::vector<FVector4> ProjectedBodyB(BodyB.size());
+	LSLightViewProj.ProjectPoints(BodyB.data(), ProjectedBodyB.data(), static_cast<int32>(BodyB.size()));
+	for (const auto& TransformedPt4D : ProjectedBodyB)
 	{
-		FVector4 Pt4D(Pt.X, Pt.Y, Pt.Z, 1.0f);
-		FVector4 TransformedPt4D = Pt4D * LSLightViewProj;
-
-		// Perspective divide (Sample line 1052-1054)
+		// Perspective divide (Sample line 1052-1054), ProjectPoints가 이미 나눈 값
 		if (std::abs(TransformedPt4D.W) > 1e-6f)
 		{
-			FVector TransformedPt(
-				TransformedPt4D.X / TransformedPt4D.W,
-				TransformedPt4D.Y / TransformedPt4D.W,
-				TransformedPt4D.Z / TransformedPt4D.W);
-
-			LSBody.Merge(TransformedPt);
+			LSBody.Merge(FVector(TransformedPt4D.X, TransformedPt4D.Y, TransformedPt4D.Z));
 		}
 	}
 
@@ -4,6 +4,7 @@
 #include "Global/Vector.h"
 #include "Global/Matrix.h"
 #include "Global/Types.h"
+#include "Global/FrameArena.h"
 #include <vector>
 
 class UCamera;
@@ -74,7 +75,7 @@ public:
 		FMatrix& OutProjectionMatrix,
 		const FVector& LightDirection,
 		UCamera* Camera,
-		const TArray<UStaticMeshComponent*>& Meshes,
+		const TFrameArray<UStaticMeshComponent*>& Meshes,
 		FPSMParameters& InOutParams
 	);
 
@@ -86,7 +87,7 @@ private:
 	static void ComputeVirtualCameraParameters(
 		const FVector& LightDirection,
 		UCamera* Camera,
-		const TArray<UStaticMeshComponent*>& Meshes,
+		const TFrameArray<UStaticMeshComponent*>& Meshes,
 		std::vector<FPSMBoundingBox>& OutShadowCasters,
 		std::vector<FPSMBoundingBox>& OutShadowReceivers,
 		FPSMParameters& InOutParams
@@ -126,7 +127,7 @@ private:
 		FMatrix& OutProj,
 		const FVector& LightDirection,
 		UCamera* Camera,
-		const std::vector<UStaticMeshComponent*>& Meshes,
+		const TFrameArray<UStaticMeshComponent*>& Meshes,
 		FPSMParameters& Params
 	);
 
@@ -4,6 +4,8 @@
 #include "Render/Renderer/Public/Renderer.h"
 #include "Render/UI/Overlay/Public/D2DOverlayManager.h"
 #include "Manager/Render/Public/CascadeManager.h"
+#include "Global/FrameArena.h"
+#include "Utility/Public/AllocationProfiler.h"
 
 IMPLEMENT_SINGLETON_CLASS(UStatOverlay, UObject)
 
@@ -46,6 +48,10 @@ void UStatOverlay::Render()
     {
         RenderShadowInfo();
     }
+    if (IsStatEnabled(EStatType::Alloc))
+    {
+        RenderAllocInfo();
+    }
 }
 
 void UStatOverlay::RenderFPS()
@@ -67,10 +73,14 @@ void UStatOverlay::RenderFPS()
 
 void UStatOverlay::RenderMemory()
 {
-    float MemoryMB = static_cast<float>(TotalAllocationBytes) / (1024.0f * 1024.0f);
+    float MemoryMB = static_cast<float>(FAllocationTracker::GetCurrentBytes()) / (1024.0f * 1024.0f);
+
+    const FFrameArena& FrameArena = FFrameArena::GetInstance();
 
-    char Buf[64];
-    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%u objects)", MemoryMB, TotalAllocationCount);
+    char Buf[128];
+    (void)sprintf_s(Buf, sizeof(Buf), "Memory: %.1f MB (%llu objects), %llu allocs/frame, Arena %.0f KB",
+        MemoryMB, FAllocationTracker::GetCurrentCount(), FrameArena.GetLastFrameHeapAllocations(),
+        static_cast<float>(FrameArena.GetLastFrameUsedBytes()) / 1024.0f);
     FString text = Buf;
 
     float OffsetY = 0.0f;
@@ -314,6 +324,45 @@ void UStatOverlay::RenderShadowInfo()
     }
 }
 
+void UStatOverlay::RenderAllocInfo()
+{
+    // 다른 항목은 왼쪽 열에 줄 수가 바뀌며 쌓이므로 태그 보고서는 오른쪽 열에 따로 그린다
+    constexpr float ColumnOffsetX = 580.0f;
+    constexpr float LineHeight = 20.0f;
+    constexpr int32 MaxTagLines = 12;
+
+    const FAllocationProfiler& Profiler = FAllocationProfiler::GetInstance();
+    const float X = OverlayX + ColumnOffsetX;
+    float CurrentY = OverlayY;
+
+    {
+        char Buf[128];
+        (void)sprintf_s(Buf, sizeof(Buf), "Alloc/Frame: %llu (%.1f KB)",
+            Profiler.GetLastFrameTotalCount(), static_cast<float>(Profiler.GetLastFrameTotalBytes()) / 1024.0f);
+        RenderText(Buf, X, CurrentY, 1.0f, 1.0f, 0.0f);
+        CurrentY += LineHeight;
+    }
+
+    const TArray<int32>& SortedTags = Profiler.GetSortedTags();
+    const int32 NumLines = std::min(static_cast<int32>(SortedTags.size()), MaxTagLines);
+    for (int32 Index = 0; Index < NumLines; ++Index)
+    {
+        const int32 Tag = SortedTags[Index];
+        const FAllocationProfiler::FTagFrameStats& TagStats = Profiler.GetLastFrameStats(Tag);
+
+        char Buf[128];
+        (void)sprintf_s(Buf, sizeof(Buf), "  %-16s %6llu allocs %9.1f KB",
+            FAllocationTracker::GetTagName(Tag), TagStats.Count, static_cast<float>(TagStats.Bytes) / 1024.0f);
+
+        float r = 0.8f, g = 0.8f, b = 0.8f;
+        if (TagStats.Count > 1000) { r = 1.0f; g = 0.0f; b = 0.0f; }
+        else if (TagStats.Count > 100) { r = 1.0f; g = 1.0f; b = 0.0f; }
+
+        RenderText(Buf, X, CurrentY, r, g, b);
+        CurrentY += LineHeight;
+    }
+}
+
 void UStatOverlay::RenderText(const FString& Text, float x, float y, float r, float g, float b)
 {
     if (Text.empty())
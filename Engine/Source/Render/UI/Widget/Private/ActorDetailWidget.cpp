@@ -217,7 +217,7 @@ void UActorDetailWidget::RenderSceneComponents(USceneComponent* InSceneComponent
 	bool bHasNonVisualizationChildren = false;
 	if (InSceneComponent)
 	{
-		const TArray<USceneComponent*>& Children = InSceneComponent->GetChildren();
+		const auto& Children = InSceneComponent->GetChildren();
 		for (USceneComponent* Child : Children)
 		{
 			if (!Child)
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Render/UI/Widget/Public/ConsoleWidget.h"
 
+#include "Core/Public/ObjectPool.h"
 #include "Component/Public/LightComponentBase.h"
 #include "Level/Public/Level.h"
 #include "Manager/Render/Public/CascadeManager.h"
@@ -8,6 +9,8 @@
 #include "Utility/Public/UELogParser.h"
 #include "Utility/Public/ScopeCycleCounter.h"
 #include "Utility/Public/LogFileWriter.h"
+#include "Utility/Public/Benchmark.h"
+#include "Utility/Public/AllocationProfiler.h"
 
 // #define IMGUI_DEFINE_MATH_OPERATORS
 // #include "ImGui/imgui_internal.h"
@@ -799,6 +802,76 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		HandleStatCommand(StatCommand);
 	}
 
+	// bench 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower == "bench" || (CommandLower.length() > 6 && CommandLower.substr(0, 6) == "bench "))
+	{
+		FString BenchmarkName = CommandLower.length() > 6 ? CommandLower.substr(6) : "";
+		if (BenchmarkName.empty() || BenchmarkName == "list")
+		{
+			AddLog(ELogType::System, "Available Benchmarks:");
+			for (const FBenchmarkRegistry::FBenchmarkEntry& Entry : FBenchmarkRegistry::GetBenchmarks())
+			{
+				AddLog(ELogType::Info, "  %s - %s", Entry.Name.c_str(), Entry.Description.c_str());
+			}
+		}
+		else
+		{
+			FBenchmarkRegistry::Run(BenchmarkName);
+		}
+	}
+
+	// alloc 명령어 처리
+	else if (FString CommandLower = InCommand;
+		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
+		CommandLower.length() > 6 && CommandLower.substr(0, 6) == "alloc ")
+	{
+		FAllocationProfiler& Profiler = FAllocationProfiler::GetInstance();
+		const FString SubCommand = CommandLower.substr(6);
+		if (SubCommand == "tags")
+		{
+			Profiler.LogLastFrame();
+		}
+		else if (SubCommand == "callstacks")
+		{
+			Profiler.LogCallstackSamples(10);
+		}
+		else if (SubCommand.length() > 7 && SubCommand.substr(0, 7) == "sample ")
+		{
+			try
+			{
+				const int32 Interval = std::stoi(SubCommand.substr(7));
+				FAllocationTracker::SetSampleInterval(static_cast<uint32>(std::max(Interval, 0)));
+				AddLog(ELogType::Success, "Allocation callstack sampling: %s", Interval > 0 ? SubCommand.substr(7).c_str() : "off");
+			}
+			catch (const exception&)
+			{
+				AddLog(ELogType::Error, "Invalid sample interval: %s", SubCommand.substr(7).c_str());
+			}
+		}
+		else if (SubCommand.length() > 4 && SubCommand.substr(0, 4) == "csv ")
+		{
+			// 경로는 대소문자를 유지하기 위해 원본 입력에서 잘라낸다
+			FString FilePath = FString(InCommand).substr(10);
+			FilePath.erase(0, FilePath.find_first_not_of(" \t"));
+			FilePath.erase(FilePath.find_last_not_of(" \t") + 1);
+			if (FilePath.empty())
+			{
+				AddLog(ELogType::Error, "Usage: alloc csv <path>");
+			}
+			else
+			{
+				Profiler.ExportCSV(path(FilePath));
+			}
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Unknown alloc command: %s", SubCommand.c_str());
+			AddLog(ELogType::Info, "Available: tags, sample <N>, callstacks, csv <path>");
+		}
+	}
+
 	// shadow_filter 명령어 처리
 	else if (FString CommandLower = InCommand;
 		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
@@ -983,6 +1056,9 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  STAT MEMORY - Show memory overlay");
 		AddLog(ELogType::Info, "  STAT PICK - Show picking performance overlay");
 		AddLog(ELogType::Info, "  STAT SHADOW - Show light and shadow map stats");
+		AddLog(ELogType::Info, "  STAT POOL - Log UObject slab pool usage per class");
+		AddLog(ELogType::Info, "  STAT ALLOC - Log heap usage and allocation size histogram");
+		AddLog(ELogType::Info, "  STAT ALLOCTAGS - Show per-frame allocations by ALLOC_SCOPE tag");
 		AddLog(ELogType::Info, "  STAT NONE - Hide all overlays");
 		AddLog(ELogType::Info, "  SHADOW_FILTER <filter> - Apply shadow filter to all lights");
 		AddLog(ELogType::Debug, "    Available filters: VSM, PCF, UnFiltered, VSM_BOX, VSM_GAUSSIAN, SAVSM");
@@ -990,6 +1066,11 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  SHADOW.CSM.NUMCASCADES <1-8> - Set cascade split number");
 		AddLog(ELogType::Info, "  SHADOW.CSM.DISTRIBUTION <0.0-1.0> - Set cascade distribution factor");
 		AddLog(ELogType::Info, "  SHADOW.CSM.NEARBIAS <0.0-1000.0> - Set cascade near plane bias");
+		AddLog(ELogType::Info, "  BENCH [name|all|list] - Run engine microbenchmarks");
+		AddLog(ELogType::Info, "  ALLOC TAGS - Log last frame allocations by tag");
+		AddLog(ELogType::Info, "  ALLOC SAMPLE <N> - Capture a callstack every N allocations (0 = off)");
+		AddLog(ELogType::Info, "  ALLOC CALLSTACKS - Log sampled allocation callsites");
+		AddLog(ELogType::Info, "  ALLOC CSV <path> - Export recent per-frame tag report to CSV");
 		AddLog(ELogType::Info, "  UE_LOG(\"String with format\", Args...) - Enhanced printf Formatting");
 		AddLog(ELogType::Debug, "    기본 예제: UE_LOG(\"Hello World %%d\", 2025)");
 		AddLog(ELogType::Debug, "    문자열: UE_LOG(\"User: %%s\", \"John\")");
@@ -1049,6 +1130,19 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 		StatOverlay.ShowShadow();
 		AddLog(ELogType::Success, "Shadow overlay enabled");
 	}
+	else if (StatCommand == "pool" || StatCommand == "pools")
+	{
+		FObjectPool::LogStats();
+	}
+	else if (StatCommand == "alloc")
+	{
+		FAllocationTracker::LogStats();
+	}
+	else if (StatCommand == "alloctags")
+	{
+		StatOverlay.ShowAlloc();
+		AddLog(ELogType::Success, "Allocation tag overlay enabled");
+	}
 	else if (StatCommand == "all")
 	{
 		StatOverlay.ShowAll();
@@ -1062,7 +1156,7 @@ void UConsoleWidget::HandleStatCommand(const FString& StatCommand)
 	else
 	{
 		AddLog(ELogType::Error, "Unknown stat command: %s", StatCommand.data());
-		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, all, none");
+		AddLog(ELogType::Info, "Available: fps, memory, pick, time, decal, shadow, pool, alloc, alloctags, all, none");
 	}
 }
 
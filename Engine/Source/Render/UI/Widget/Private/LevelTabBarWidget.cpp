@@ -337,7 +337,7 @@ void ULevelTabBarWidget::RenderWidget()
 					if (ImGui::BeginMenu("Other Actors"))
 					{
 						// FutureEngine 철학: UClass::FindClasses로 모든 Actor 타입 검색
-						TArray<UClass*> AllActorClasses = UClass::FindClasses(AActor::StaticClass());
+						const TArray<UClass*>& AllActorClasses = UClass::FindClasses(AActor::StaticClass());
 
 						// 이미 카테고리화된 클래스 제외
 						for (UClass* ActorClass : AllActorClasses)
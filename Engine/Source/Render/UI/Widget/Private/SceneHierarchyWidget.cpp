@@ -160,7 +160,9 @@ void USceneHierarchyWidget::RenderActorInfo(AActor* InActor, int32 InIndex)
 	}
 
 	FName ActorName = InActor->GetName();
-	FString ActorDisplayName = ActorName.ToString();
+	// 매 프레임 Actor마다 문자열을 새로 만들지 않도록 멤버 버퍼에 덧붙인다
+	ActorNameBuffer.clear();
+	ActorName.AppendString(ActorNameBuffer);
 
 	// Actor의 PrimitiveComponent들의 Visibility 체크
 	bool bHasPrimitive = false;
@@ -294,7 +296,7 @@ void USceneHierarchyWidget::RenderActorInfo(AActor* InActor, int32 InIndex)
 	else
 	{
 		// 일반 선택 모드
-		bool bClicked = ImGui::Selectable(ActorDisplayName.data(), bIsSelected, ImGuiSelectableFlags_SpanAllColumns);
+		bool bClicked = ImGui::Selectable(ActorNameBuffer.data(), bIsSelected, ImGuiSelectableFlags_SpanAllColumns);
 
 		if (bClicked)
 		{
@@ -25,6 +25,7 @@ public:
 private:
 	// UI 상태
 	bool bShowDetails = true;
+	FString ActorNameBuffer; // RenderActorInfo에서 재사용하는 이름 버퍼
 
 	// 검색 기능
 	char SearchBuffer[256] = "";
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Public/Object.h"
+#include "Core/Public/Archive.h"
 
 class UTexture;
 
@@ -54,6 +55,26 @@ struct FMaterial
 	FString BumpMap;
 };
 
+inline FArchive& operator<<(FArchive& Ar, FMaterial& Material)
+{
+	Ar << Material.Name;
+	Ar << Material.Ka;
+	Ar << Material.Kd;
+	Ar << Material.Ks;
+	Ar << Material.Ke;
+	Ar << Material.Ns;
+	Ar << Material.Ni;
+	Ar << Material.D;
+	Ar << Material.Illumination;
+	Ar << Material.KaMap;
+	Ar << Material.KdMap;
+	Ar << Material.KsMap;
+	Ar << Material.NsMap;
+	Ar << Material.DMap;
+	Ar << Material.BumpMap;
+	return Ar;
+}
+
 UCLASS()
 class UMaterial : public UObject
 {
@@ -0,0 +1,209 @@
+#include "pch.h"
+#include "Utility/Public/AllocationProfiler.h"
+
+#include <fstream>
+
+#if PLATFORM_WINDOWS
+#include <dbghelp.h>
+#pragma comment(lib, "dbghelp")
+#endif
+
+namespace
+{
+	/**
+	 * @brief 반환 주소를 "함수 (파일:줄)" 형태의 문자열로 변환
+	 * 샘플을 출력할 때만 호출되므로 할당 경로에는 비용이 없다
+	 */
+	FString ResolveSymbol(void* InAddress)
+	{
+		char Buffer[512];
+#if PLATFORM_WINDOWS
+		static bool bSymbolsInitialized = false;
+		const HANDLE Process = GetCurrentProcess();
+		if (!bSymbolsInitialized)
+		{
+			SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+			bSymbolsInitialized = SymInitialize(Process, nullptr, TRUE) == TRUE;
+		}
+
+		alignas(SYMBOL_INFO) char SymbolBuffer[sizeof(SYMBOL_INFO) + MAX_SYM_NAME];
+		SYMBOL_INFO* Symbol = reinterpret_cast<SYMBOL_INFO*>(SymbolBuffer);
+		Symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+		Symbol->MaxNameLen = MAX_SYM_NAME;
+
+		const DWORD64 Address = reinterpret_cast<DWORD64>(InAddress);
+		if (!bSymbolsInitialized || !SymFromAddr(Process, Address, nullptr, Symbol))
+		{
+			(void)snprintf(Buffer, sizeof(Buffer), "0x%p", InAddress);
+			return Buffer;
+		}
+
+		IMAGEHLP_LINE64 Line = {};
+		Line.SizeOfStruct = sizeof(IMAGEHLP_LINE64);
+		DWORD Displacement = 0;
+		if (SymGetLineFromAddr64(Process, Address, &Displacement, &Line))
+		{
+			const char* FileName = strrchr(Line.FileName, '\\');
+			(void)snprintf(Buffer, sizeof(Buffer), "%s (%s:%lu)", Symbol->Name, FileName ? FileName + 1 : Line.FileName, Line.LineNumber);
+		}
+		else
+		{
+			(void)snprintf(Buffer, sizeof(Buffer), "%s", Symbol->Name);
+		}
+#else
+		char** Symbols = backtrace_symbols(&InAddress, 1);
+		(void)snprintf(Buffer, sizeof(Buffer), "%s", Symbols ? Symbols[0] : "?");
+		free(Symbols);
+#endif
+		return Buffer;
+	}
+}
+
+FAllocationProfiler& FAllocationProfiler::GetInstance()
+{
+	static FAllocationProfiler Instance;
+	return Instance;
+}
+
+void FAllocationProfiler::EndFrame()
+{
+	if (History.empty())
+	{
+		History.resize(static_cast<size_t>(MaxHistoryFrames) * MaxAllocationTags);
+	}
+
+	const FAllocationStats Stats = FAllocationTracker::GetStats();
+	FTagFrameStats* FrameHistory = &History[(NumFramesRecorded % MaxHistoryFrames) * MaxAllocationTags];
+
+	LastFrameTotalCount = 0;
+	LastFrameTotalBytes = 0;
+	SortedTags.clear();
+
+	for (int32 Tag = 0; Tag < MaxAllocationTags; ++Tag)
+	{
+		// 첫 프레임은 기준값만 잡는다 (시작 이후의 누적이 한 프레임으로 잡히지 않도록)
+		FTagFrameStats& TagStats = LastFrameStats[Tag];
+		TagStats.Count = bHasPreviousTotals ? Stats.TagCounts[Tag] - PreviousTagCounts[Tag] : 0;
+		TagStats.Bytes = bHasPreviousTotals ? Stats.TagBytes[Tag] - PreviousTagBytes[Tag] : 0;
+		PreviousTagCounts[Tag] = Stats.TagCounts[Tag];
+		PreviousTagBytes[Tag] = Stats.TagBytes[Tag];
+
+		FrameHistory[Tag] = TagStats;
+		LastFrameTotalCount += TagStats.Count;
+		LastFrameTotalBytes += TagStats.Bytes;
+		if (TagStats.Count > 0)
+		{
+			SortedTags.push_back(Tag);
+		}
+	}
+
+	std::sort(SortedTags.begin(), SortedTags.end(), [this](int32 InLeft, int32 InRight)
+	{
+		return LastFrameStats[InLeft].Count > LastFrameStats[InRight].Count;
+	});
+
+	bHasPreviousTotals = true;
+	++NumFramesRecorded;
+}
+
+bool FAllocationProfiler::ExportCSV(const path& InFilePath) const
+{
+	std::ofstream File(InFilePath);
+	if (!File.is_open())
+	{
+		UE_LOG_ERROR("AllocationProfiler: CSV 파일을 열 수 없습니다: %s", InFilePath.string().c_str());
+		return false;
+	}
+
+	File << "Frame,Tag,Count,Bytes\n";
+
+	const uint64 NumFrames = std::min<uint64>(NumFramesRecorded, MaxHistoryFrames);
+	const uint64 FirstFrame = NumFramesRecorded - NumFrames;
+	const int32 NumTags = FAllocationTracker::GetNumTags();
+	for (uint64 Frame = FirstFrame; Frame < NumFramesRecorded; ++Frame)
+	{
+		const FTagFrameStats* FrameHistory = &History[(Frame % MaxHistoryFrames) * MaxAllocationTags];
+		for (int32 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			if (FrameHistory[Tag].Count == 0)
+			{
+				continue;
+			}
+			File << Frame << ',' << FAllocationTracker::GetTagName(Tag) << ',' << FrameHistory[Tag].Count << ',' << FrameHistory[Tag].Bytes << '\n';
+		}
+	}
+
+	UE_LOG_SUCCESS("AllocationProfiler: %llu 프레임을 %s에 저장했습니다", NumFrames, InFilePath.string().c_str());
+	return true;
+}
+
+void FAllocationProfiler::LogLastFrame() const
+{
+	UE_LOG("AllocationProfiler: %-20s | %8s | %10s", "Tag", "Allocs", "KB");
+	for (int32 Tag : SortedTags)
+	{
+		const FTagFrameStats& TagStats = LastFrameStats[Tag];
+		UE_LOG("AllocationProfiler: %-20s | %8llu | %10.2f",
+			FAllocationTracker::GetTagName(Tag), static_cast<unsigned long long>(TagStats.Count), static_cast<double>(TagStats.Bytes) / 1024.0);
+	}
+	UE_LOG("AllocationProfiler: %-20s | %8llu | %10.2f", "Total",
+		static_cast<unsigned long long>(LastFrameTotalCount), static_cast<double>(LastFrameTotalBytes) / 1024.0);
+}
+
+void FAllocationProfiler::LogCallstackSamples(int32 InMaxCallsites) const
+{
+	if (FAllocationTracker::GetSampleInterval() == 0)
+	{
+		UE_LOG_WARNING("AllocationProfiler: 콜스택 샘플링이 꺼져 있습니다 (alloc sample <N>으로 켜기)");
+	}
+
+	TArray<FAllocationSample> Samples(MaxAllocationSamples);
+	Samples.resize(FAllocationTracker::CopyRecentSamples(Samples.data(), MaxAllocationSamples));
+	if (Samples.empty())
+	{
+		UE_LOG("AllocationProfiler: 샘플이 없습니다");
+		return;
+	}
+
+	// 같은 콜스택끼리 묶기
+	struct FCallsite
+	{
+		const FAllocationSample* Sample;
+		uint32 Count;
+		uint64 Bytes;
+	};
+	TArray<FCallsite> Callsites;
+	TMap<FString, int32> CallsiteIndices;
+	for (const FAllocationSample& Sample : Samples)
+	{
+		const FString Key(reinterpret_cast<const char*>(Sample.Frames), Sample.NumFrames * sizeof(void*));
+		auto [It, bInserted] = CallsiteIndices.emplace(Key, static_cast<int32>(Callsites.size()));
+		if (bInserted)
+		{
+			Callsites.push_back({ &Sample, 0, 0 });
+		}
+		++Callsites[It->second].Count;
+		Callsites[It->second].Bytes += Sample.Size;
+	}
+
+	std::sort(Callsites.begin(), Callsites.end(), [](const FCallsite& InLeft, const FCallsite& InRight)
+	{
+		return InLeft.Count > InRight.Count;
+	});
+
+	UE_LOG("AllocationProfiler: 최근 샘플 %zu개, 호출 위치 %zu곳 (1/%u 샘플링)",
+		Samples.size(), Callsites.size(), FAllocationTracker::GetSampleInterval());
+
+	const int32 NumToPrint = std::min(InMaxCallsites, static_cast<int32>(Callsites.size()));
+	for (int32 Index = 0; Index < NumToPrint; ++Index)
+	{
+		const FCallsite& Callsite = Callsites[Index];
+		UE_LOG("AllocationProfiler: #%d %u samples, %.2f KB, tag %s",
+			Index + 1, Callsite.Count, static_cast<double>(Callsite.Bytes) / 1024.0, FAllocationTracker::GetTagName(Callsite.Sample->Tag));
+
+		for (int32 Frame = 0; Frame < Callsite.Sample->NumFrames; ++Frame)
+		{
+			UE_LOG("AllocationProfiler:     %s", ResolveSymbol(Callsite.Sample->Frames[Frame]).c_str());
+		}
+	}
+}
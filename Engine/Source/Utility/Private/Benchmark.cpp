@@ -0,0 +1,68 @@
+#include "pch.h"
+#include "Utility/Public/Benchmark.h"
+
+namespace
+{
+	volatile uint64 BenchmarkSink = 0;
+
+	FString ToLower(FString InString)
+	{
+		std::transform(InString.begin(), InString.end(), InString.begin(), ::tolower);
+		return InString;
+	}
+}
+
+TArray<FBenchmarkRegistry::FBenchmarkEntry>& FBenchmarkRegistry::GetEntries()
+{
+	// 정적 초기화 순서와 무관하게 등록할 수 있도록 함수 내부 static 사용
+	static TArray<FBenchmarkEntry> Entries;
+	return Entries;
+}
+
+bool FBenchmarkRegistry::Register(const char* InName, const char* InDescription, FBenchmarkFunction InFunction)
+{
+	GetEntries().push_back({ InName, InDescription, InFunction });
+	return true;
+}
+
+bool FBenchmarkRegistry::Run(const FString& InName)
+{
+	const FString NameLower = ToLower(InName);
+	if (NameLower == "all")
+	{
+		RunAll();
+		return true;
+	}
+
+	for (const FBenchmarkEntry& Entry : GetEntries())
+	{
+		if (ToLower(Entry.Name) == NameLower)
+		{
+			UE_LOG_SYSTEM("Benchmark: [%s] %s", Entry.Name.c_str(), Entry.Description.c_str());
+			Entry.Function();
+			return true;
+		}
+	}
+
+	UE_LOG_ERROR("Benchmark: 등록되지 않은 벤치마크입니다: %s", InName.c_str());
+	return false;
+}
+
+void FBenchmarkRegistry::RunAll()
+{
+	for (const FBenchmarkEntry& Entry : GetEntries())
+	{
+		UE_LOG_SYSTEM("Benchmark: [%s] %s", Entry.Name.c_str(), Entry.Description.c_str());
+		Entry.Function();
+	}
+}
+
+const TArray<FBenchmarkRegistry::FBenchmarkEntry>& FBenchmarkRegistry::GetBenchmarks()
+{
+	return GetEntries();
+}
+
+void FBenchmarkRegistry::Consume(uint64 InValue)
+{
+	BenchmarkSink = BenchmarkSink + InValue;
+}
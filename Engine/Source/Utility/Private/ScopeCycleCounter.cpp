@@ -17,6 +17,11 @@ void FScopeCycleCounter::AddTimeProfile(const TStatId& Key, double InMillisecond
         TimeProfileMap[Key.Key].CallCount++;
     }
 }
+//측정값 전체 초기화 (Headless 등 프레임 단위로 수집할 때 사용)
+void FScopeCycleCounter::TimeProfileInit()
+{
+    TimeProfileMap.clear();
+}
 const FTimeProfile& FScopeCycleCounter::GetTimeProfile(const FString& Key)
 {
     return TimeProfileMap[Key];
@@ -41,6 +46,3 @@ const TArray<FTimeProfile> FScopeCycleCounter::GetTimeProfileValues()
     }
     return Values;
 }
-
-double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
-bool FWindowsPlatformTime::bInitialized = false;
@@ -0,0 +1,64 @@
+#pragma once
+
+/**
+ * @brief ALLOC_SCOPE 태그별 프레임 할당 보고서
+ * 프레임 끝의 EndFrame에서 태그별 누적 카운터의 차이로 이번 프레임의 할당 횟수/바이트를 구하고,
+ * 최근 MaxHistoryFrames 프레임을 링 버퍼에 남겨 CSV로 내보낸다
+ * 샘플링된 콜스택(FAllocationTracker::SetSampleInterval)을 호출 위치별로 묶어 출력하는 기능도 제공한다
+ * @note 태그는 스레드별이므로 워커 스레드의 할당은 해당 스레드에서 ALLOC_SCOPE를 열지 않으면 Untagged로 집계된다
+ */
+class FAllocationProfiler
+{
+public:
+	static constexpr int32 MaxHistoryFrames = 300;
+
+	struct FTagFrameStats
+	{
+		uint64 Count = 0;
+		uint64 Bytes = 0;
+	};
+
+	static FAllocationProfiler& GetInstance();
+
+	/** @brief 프레임 끝에서 호출: 이번 프레임의 태그별 통계를 확정하고 기록에 추가 */
+	void EndFrame();
+
+	const FTagFrameStats& GetLastFrameStats(int32 InTag) const { return LastFrameStats[InTag]; }
+	uint64 GetLastFrameTotalCount() const { return LastFrameTotalCount; }
+	uint64 GetLastFrameTotalBytes() const { return LastFrameTotalBytes; }
+
+	/** @brief 직전 프레임에 할당이 있었던 태그를 할당 횟수가 많은 순서로 */
+	const TArray<int32>& GetSortedTags() const { return SortedTags; }
+
+	/**
+	 * @brief 기록된 프레임을 Frame,Tag,Count,Bytes 형식의 CSV로 저장
+	 * @return 파일을 열 수 없으면 false
+	 */
+	bool ExportCSV(const path& InFilePath) const;
+
+	/** @brief 직전 프레임의 태그별 할당을 로그로 출력 */
+	void LogLastFrame() const;
+
+	/** @brief 샘플링된 콜스택을 호출 위치별로 묶어 많은 순서로 InMaxCallsites개 출력 */
+	void LogCallstackSamples(int32 InMaxCallsites) const;
+
+private:
+	FAllocationProfiler() = default;
+	~FAllocationProfiler() = default;
+
+	FAllocationProfiler(const FAllocationProfiler&) = delete;
+	FAllocationProfiler& operator=(const FAllocationProfiler&) = delete;
+
+	uint64 PreviousTagCounts[MaxAllocationTags] = {};
+	uint64 PreviousTagBytes[MaxAllocationTags] = {};
+	bool bHasPreviousTotals = false;
+
+	FTagFrameStats LastFrameStats[MaxAllocationTags] = {};
+	uint64 LastFrameTotalCount = 0;
+	uint64 LastFrameTotalBytes = 0;
+	TArray<int32> SortedTags;
+
+	// [프레임 % MaxHistoryFrames][태그] 링 버퍼
+	TArray<FTagFrameStats> History;
+	uint64 NumFramesRecorded = 0;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+/**
+ * @brief 엔진 내장 마이크로벤치마크 레지스트리
+ * IMPLEMENT_BENCHMARK로 등록한 함수를 콘솔의 "bench <이름>" 또는 Headless 실행의 -bench=<이름>으로 실행한다
+ * 결과는 UE_LOG로 출력한다 (Release/Develop 구성에서 측정할 것)
+ */
+class FBenchmarkRegistry
+{
+public:
+	using FBenchmarkFunction = void(*)();
+
+	struct FBenchmarkEntry
+	{
+		FString Name;
+		FString Description;
+		FBenchmarkFunction Function = nullptr;
+	};
+
+	static bool Register(const char* InName, const char* InDescription, FBenchmarkFunction InFunction);
+
+	/** @brief 이름으로 실행 (대소문자 무시), "all"이면 전체 실행 */
+	static bool Run(const FString& InName);
+	static void RunAll();
+
+	static const TArray<FBenchmarkEntry>& GetBenchmarks();
+
+	/** @brief 측정 대상 연산이 최적화로 제거되지 않도록 결과를 소비 */
+	static void Consume(uint64 InValue);
+
+private:
+	static TArray<FBenchmarkEntry>& GetEntries();
+};
+
+#define IMPLEMENT_BENCHMARK(Name, Description) \
+	static void Benchmark_##Name(); \
+	static bool bIsRegistered_Benchmark_##Name = FBenchmarkRegistry::Register(#Name, Description, &Benchmark_##Name); \
+	static void Benchmark_##Name()
@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Global/Types.h"
+#include "Global/Platform.h"
 
 #ifdef _DEVELOP //_DEVELOP 이 정의 되어 있을때만 측정
 	#define TIME_PROFILE(Key) FScopeCycleCounter Key##Counter(#Key);
@@ -14,58 +15,6 @@
 	#define TIME_PROFILE_END(Key)
 #endif
 
-class FWindowsPlatformTime
-{
-public:
-	static double GSecondsPerCycle; // 0
-	static bool bInitialized; // false
-
-	static void InitTiming()
-	{
-		if (!bInitialized)
-		{
-			bInitialized = true;
-
-			double Frequency = (double)GetFrequency();
-			if (Frequency <= 0.0)
-			{
-				Frequency = 1.0;
-			}
-
-			GSecondsPerCycle = 1.0 / Frequency;
-		}
-	}
-	static double GetSecondsPerCycle()
-	{
-		if (!bInitialized)
-		{
-			InitTiming();
-		}
-		return (double)GSecondsPerCycle;
-	}
-	static uint64 GetFrequency()
-	{
-		LARGE_INTEGER Frequency;
-		QueryPerformanceFrequency(&Frequency);
-		return Frequency.QuadPart;
-	}
-	static double ToMilliseconds(uint64 CycleDiff)
-	{
-		double Ms = static_cast<double>(CycleDiff)
-			* GetSecondsPerCycle()
-			* 1000.0;
-
-		return Ms;
-	}
-
-	static uint64 Cycles64()
-	{
-		LARGE_INTEGER CycleCount;
-		QueryPerformanceCounter(&CycleCount);
-		return (uint64)CycleCount.QuadPart;
-	}
-};
-
 struct TStatId
 {
 	FString Key;
@@ -86,8 +35,6 @@ struct FTimeProfile
 	}
 };
 
-typedef FWindowsPlatformTime FPlatformTime;
-
 class FScopeCycleCounter
 {
 public:
@@ -119,7 +66,7 @@ public:
 		const uint64 EndCycles = FPlatformTime::Cycles64();
 		const uint64 CycleDiff = EndCycles - StartCycles;
 
-		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
+		double Milliseconds = FPlatformTime::ToMilliseconds(CycleDiff);
 		if (UsedStatId.Key.empty() == false)
 		{
 			AddTimeProfile(UsedStatId, Milliseconds); //키 값이 있을경우 Map에 저장
@@ -1,10 +1,17 @@
 #include "pch.h"
 #include "Core/Public/ClientApp.h"
+#include "Core/Public/HeadlessApp.h"
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
+
+    // -headless: 윈도우/렌더러 없이 Scene만 Tick하는 벤치마크 실행
+    if (FHeadlessApp::IsHeadlessCommandLine(lpCmdLine))
+    {
+        FHeadlessApp HeadlessApp;
+        return HeadlessApp.Run(lpCmdLine);
+    }
 
     FClientApp Client;
     return Client.Run(hInstance, nShowCmd);
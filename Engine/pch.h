@@ -34,12 +34,14 @@
 
 // Global Included
 #include "Source/Global/Types.h"
+#include "Source/Global/Platform.h"
 #include "Source/Global/Memory.h"
 #include "Source/Global/Constant.h"
 #include "Source/Global/Enum.h"
 #include "Source/Global/Matrix.h"
 #include "Source/Global/Vector.h"
 #include "Source/Global/Quaternion.h"
+#include "Source/Global/Transform.h"
 #include "Source/Global/CoreTypes.h"
 #include "Source/Global/Macro.h"
 #include "Source/Global/Function.h"